@@ -10,6 +10,7 @@ public:
 
     IAdapter* GetAdapter() { return m_adapter.Get(); }
     std::string_view GetDescription() const { return m_description; }
+    std::string_view GetDriverVersion() const { return m_driverVersion; }
     std::string GetDetailedDescription() const;
 
     static Adapter Select(std::shared_ptr<DxCoreModule> module, std::string_view adapterSubstring = {});
@@ -58,6 +58,26 @@ CommandLineArgs::CommandLineArgs(int argc, char** argv)
             "Prints detail message before and after each command.",
             cxxopts::value<bool>()
         )
+        (
+            "parse_threads",
+            "Number of threads used to parse resources and dispatchables in JSON models. 0 uses all hardware threads.",
+            cxxopts::value<uint32_t>()->default_value("1")
+        )
+        (
+            "model_cache",
+            "Directory for caching parsed JSON models. Unchanged models are loaded from the cache instead of re-parsed.",
+            cxxopts::value<std::filesystem::path>()
+        )
+        (
+            "large_pages",
+            "Allocates parsed JSON model data (e.g. operator descs) from large pages where the OS allows it.",
+            cxxopts::value<bool>()
+        )
+        (
+            "share_buffers",
+            "Backs buffers with identical initial values with a single GPU resource when no dispatch can write to them.",
+            cxxopts::value<bool>()
+        )
         ;
 
     // TIMING OPTIONS
@@ -72,6 +92,16 @@ CommandLineArgs::CommandLineArgs(int argc, char** argv)
             "The number of times dispatch is invoked within each loop iteration (for microbenchmarking)", 
             cxxopts::value<uint32_t>()->default_value("1")
         )
+        (
+            "dispatch_batch",
+            "The number of loop iterations recorded into one command list and executed with a single wait (for measuring throughput)",
+            cxxopts::value<uint32_t>()->default_value("1")
+        )
+        (
+            "frames_in_flight",
+            "The maximum number of loop iterations (or batches) executing on the GPU at once. Above 1, the next is recorded while earlier ones execute (for measuring streaming throughput)",
+            cxxopts::value<uint32_t>()->default_value("1")
+        )
         (
             "t,milliseconds_to_run",
             "Specifies the total time to run the test for. Overrides dispatch_iterations",
@@ -97,6 +127,26 @@ CommandLineArgs::CommandLineArgs(int argc, char** argv)
             "Determines the size of the GPU timestamp buffer. A value of 0 will disable GPU timing.",
             cxxopts::value<uint32_t>()
         )
+        (
+            "results_file",
+            "Appends the timing statistics of each dispatch to a file: a CSV row for a .csv file, otherwise a line of JSON.",
+            cxxopts::value<std::filesystem::path>()
+        )
+        (
+            "baseline_file",
+            "Compares each dispatch's hot timings with the same dispatch in a JSON results file, and fails if any is significantly slower.",
+            cxxopts::value<std::filesystem::path>()
+        )
+        (
+            "regression_threshold",
+            "Percent by which a dispatch's median time must exceed the baseline's to count as a regression.",
+            cxxopts::value<double>()->default_value("5")
+        )
+        (
+            "regression_p_value",
+            "Significance level of the Mann-Whitney U test that compares a dispatch's timings with the baseline's.",
+            cxxopts::value<double>()->default_value("0.01")
+        )
         ;
 
     // DIRECTX OPTIONS
@@ -283,6 +333,24 @@ CommandLineArgs::CommandLineArgs(int argc, char** argv)
         m_dispatchRepeat = result["dispatch_repeat"].as<uint32_t>();
     }
 
+    if (result.count("dispatch_batch"))
+    {
+        m_dispatchBatchSize = result["dispatch_batch"].as<uint32_t>();
+        if (m_dispatchBatchSize == 0)
+        {
+            throw std::invalid_argument("Unexpected value for dispatch_batch. Must be at least 1");
+        }
+    }
+
+    if (result.count("frames_in_flight"))
+    {
+        m_framesInFlight = result["frames_in_flight"].as<uint32_t>();
+        if (m_framesInFlight == 0)
+        {
+            throw std::invalid_argument("Unexpected value for frames_in_flight. Must be at least 1");
+        }
+    }
+
     if (result.count("milliseconds_to_run"))
     {
         m_timeToRunInMilliseconds.emplace(result["milliseconds_to_run"].as<uint32_t>());
@@ -329,6 +397,26 @@ CommandLineArgs::CommandLineArgs(int argc, char** argv)
         m_outputRelPath = result["output_path"].as<std::filesystem::path>();
     }
 
+    if (result.count("parse_threads"))
+    {
+        m_parseThreadCount = result["parse_threads"].as<uint32_t>();
+    }
+
+    if (result.count("model_cache"))
+    {
+        m_modelCachePath = result["model_cache"].as<std::filesystem::path>();
+    }
+
+    if (result.count("large_pages"))
+    {
+        m_useLargePages = result["large_pages"].as<bool>();
+    }
+
+    if (result.count("share_buffers"))
+    {
+        m_shareReadOnlyBuffers = result["share_buffers"].as<bool>();
+    }
+
     if (result.count("timing_verbosity"))
     {
         m_timingVerbosity = static_cast<TimingVerbosity>(result["timing_verbosity"].as<uint32_t>());
@@ -339,6 +427,30 @@ CommandLineArgs::CommandLineArgs(int argc, char** argv)
         m_maxGpuTimeMeasurements = result["max_gpu_time_measurements"].as<uint32_t>();
     }
 
+    if (result.count("results_file"))
+    {
+        m_resultsFilePath = result["results_file"].as<std::filesystem::path>();
+    }
+
+    if (result.count("baseline_file"))
+    {
+        m_baselineFilePath = result["baseline_file"].as<std::filesystem::path>();
+    }
+
+    if (result.count("regression_threshold"))
+    {
+        m_regressionThresholdPercent = result["regression_threshold"].as<double>();
+    }
+
+    if (result.count("regression_p_value"))
+    {
+        m_regressionPValue = result["regression_p_value"].as<double>();
+        if (!(m_regressionPValue > 0 && m_regressionPValue < 1))
+        {
+            throw std::invalid_argument("Unexpected value for regression_p_value. Must be between 0 and 1 (exclusive)");
+        }
+    }
+
     if (result.count("show_dependencies"))
     {
         m_showDependencies = result["show_dependencies"].as<bool>();
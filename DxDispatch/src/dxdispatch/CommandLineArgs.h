@@ -37,11 +37,21 @@ public:
     const std::optional<std::filesystem::path>& ModelPath() const { return m_modelPath; }
     const std::optional<std::filesystem::path>& InputPath() const { return m_inputRelPath;; }
     const std::optional<std::filesystem::path>& OutputPath() const { return m_outputRelPath; }
+    const std::optional<std::filesystem::path>& ModelCachePath() const { return m_modelCachePath; }
+    const std::optional<std::filesystem::path>& ResultsFilePath() const { return m_resultsFilePath; }
+    const std::optional<std::filesystem::path>& BaselineFilePath() const { return m_baselineFilePath; }
+    double RegressionThresholdPercent() const { return m_regressionThresholdPercent; }
+    double RegressionPValue() const { return m_regressionPValue; }
+    uint32_t ParseThreadCount() const { return m_parseThreadCount; }
+    bool UseLargePages() const { return m_useLargePages; }
+    bool ShareReadOnlyBuffers() const { return m_shareReadOnlyBuffers; }
 
     DML_FEATURE_LEVEL DmlFeatureLevel() const { return m_dmlFeatureLevel; }
     const std::string& HelpText() const { return m_helpText; }
     uint32_t DispatchIterations() const { return m_dispatchIterations; }
     uint32_t DispatchRepeat() const { return m_dispatchRepeat; }
+    uint32_t DispatchBatchSize() const { return m_dispatchBatchSize; }
+    uint32_t FramesInFlight() const { return m_framesInFlight; }
     std::optional<uint32_t> TimeToRunInMilliseconds() const { return m_timeToRunInMilliseconds; }
     uint32_t MinimumDispatchIntervalInMilliseconds() const { return m_minDispatchIntervalInMilliseconds; }
     uint32_t MaxWarmupSamples() const { return m_maxWarmupSamples; }
@@ -101,10 +111,20 @@ private:
     std::optional<std::filesystem::path> m_modelPath;
     std::optional<std::filesystem::path> m_inputRelPath;
     std::optional<std::filesystem::path> m_outputRelPath;
+    std::optional<std::filesystem::path> m_modelCachePath;
+    std::optional<std::filesystem::path> m_resultsFilePath;
+    std::optional<std::filesystem::path> m_baselineFilePath;
+    double m_regressionThresholdPercent = 5;
+    double m_regressionPValue = 0.01;
+    uint32_t m_parseThreadCount = 1;
+    bool m_useLargePages = false;
+    bool m_shareReadOnlyBuffers = false;
     std::string m_pixCaptureName = "dxdispatch";
     std::string m_helpText;
     uint32_t m_dispatchIterations = 1;
     uint32_t m_dispatchRepeat = 1;
+    uint32_t m_dispatchBatchSize = 1;
+    uint32_t m_framesInFlight = 1;
     std::optional<uint32_t> m_timeToRunInMilliseconds = {};
     uint32_t m_minDispatchIntervalInMilliseconds = 0;
     uint32_t m_maxWarmupSamples = 1;
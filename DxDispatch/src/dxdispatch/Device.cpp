@@ -52,6 +52,7 @@ Device::Device(
     bool debugLayersEnabled, 
     D3D12_COMMAND_LIST_TYPE commandListType, 
     uint32_t dispatchRepeat,
+    uint32_t framesInFlight,
     bool uavBarrierAfterDispatch,
     bool aliasingBarrierAfterDispatch,
     bool clearShaderCaches,
@@ -265,14 +266,19 @@ Device::Device(
     }
 #endif
 
-    THROW_IF_FAILED(m_d3d->CreateCommandAllocator(
-        m_commandListType,
-        IID_GRAPHICS_PPV_ARGS(m_commandAllocator.ReleaseAndGetAddressOf())));
+    // One more allocator than the submissions in flight, for recording the next command list.
+    m_commandAllocators.resize(static_cast<size_t>(std::max(framesInFlight, 1u)) + 1);
+    for (auto& slot : m_commandAllocators)
+    {
+        THROW_IF_FAILED(m_d3d->CreateCommandAllocator(
+            m_commandListType,
+            IID_GRAPHICS_PPV_ARGS(slot.allocator.ReleaseAndGetAddressOf())));
+    }
 
     THROW_IF_FAILED(m_d3d->CreateCommandList(
         0,
         m_commandListType,
-        m_commandAllocator.Get(),
+        m_commandAllocators[m_commandAllocatorIndex].allocator.Get(),
         nullptr,
         IID_GRAPHICS_PPV_ARGS(m_commandList.ReleaseAndGetAddressOf())));
 
@@ -437,9 +443,18 @@ ComPtr<ID3D12Resource> Device::CreateReadbackBuffer(
 
 void Device::WaitForGpuWorkToComplete()
 {
-    uint64_t nextFenceValue = m_fence->GetCompletedValue() + 1;
-    THROW_IF_FAILED(m_queue->Signal(m_fence.Get(), nextFenceValue));
-    THROW_IF_FAILED(m_fence->SetEventOnCompletion(nextFenceValue, nullptr));
+    const uint64_t fenceValue = ++m_lastSignaledFenceValue;
+    THROW_IF_FAILED(m_queue->Signal(m_fence.Get(), fenceValue));
+    WaitForFenceValue(fenceValue);
+}
+
+void Device::WaitForFenceValue(uint64_t fenceValue)
+{
+    if (m_fence->GetCompletedValue() < fenceValue)
+    {
+        // A null event blocks until the fence reaches the value.
+        THROW_IF_FAILED(m_fence->SetEventOnCompletion(fenceValue, nullptr));
+    }
 }
 
 void Device::RecordInitialize(IDMLDispatchable* dispatchable, IDMLBindingTable* bindingTable)
@@ -540,7 +555,7 @@ Microsoft::WRL::ComPtr<ID3D12Resource> Device::Upload(uint64_t totalSize, gsl::s
             std::swap(barriers[0].Transition.StateBefore, barriers[0].Transition.StateAfter);
             m_commandList->ResourceBarrier(_countof(barriers), barriers);
 
-            m_temporaryResources.push_back(std::move(uploadBuffer));
+            KeepAliveUntilNextCommandListDispatch(std::move(uploadBuffer));
         }
     }
 
@@ -620,15 +635,13 @@ Microsoft::WRL::ComPtr<ID3D12Resource> Device::Upload(
     return texture;
 }
 
-std::vector<std::byte> Device::Download(Microsoft::WRL::ComPtr<ID3D12Resource> buffer)
+ComPtr<ID3D12Resource> Device::GetReadableResource(ComPtr<ID3D12Resource> buffer)
 {
     if (buffer->GetDesc().Width > std::numeric_limits<size_t>::max())
     {
         throw std::invalid_argument(fmt::format("Buffer width '{}' is too large.", buffer->GetDesc().Width));
     }
 
-    ComPtr<ID3D12Resource> resourceToMap;
-
     // Can't assume the input buffer was created as a custom heap (e.g., ONNX dispatchable with a deferred
     // resource allocated by the DML EP), so check the heap properties.
     D3D12_HEAP_PROPERTIES heapProps = {};
@@ -638,27 +651,32 @@ std::vector<std::byte> Device::Download(Microsoft::WRL::ComPtr<ID3D12Resource> b
         heapProps.MemoryPoolPreference == D3D12_MEMORY_POOL_L0 && 
         heapProps.CPUPageProperty == D3D12_CPU_PAGE_PROPERTY_WRITE_COMBINE)
     {
-        resourceToMap = buffer;
+        return buffer;
     }
-    else
+
+    ComPtr<ID3D12Resource> readbackBuffer = CreateReadbackBuffer(buffer->GetDesc().Width);
+    readbackBuffer->SetName(L"Device::Download");
+
+    D3D12_RESOURCE_BARRIER barriers[] =
     {
-        resourceToMap = CreateReadbackBuffer(buffer->GetDesc().Width);
-        resourceToMap->SetName(L"Device::Download");
+        CD3DX12_RESOURCE_BARRIER::Transition(
+            buffer.Get(),
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+            D3D12_RESOURCE_STATE_COPY_SOURCE)
+    };
 
-        D3D12_RESOURCE_BARRIER barriers[] =
-        {
-            CD3DX12_RESOURCE_BARRIER::Transition(
-                buffer.Get(),
-                D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-                D3D12_RESOURCE_STATE_COPY_SOURCE)
-        };
+    m_commandList->ResourceBarrier(_countof(barriers), barriers);
+    m_commandList->CopyResource(readbackBuffer.Get(), buffer.Get());
+    std::swap(barriers[0].Transition.StateBefore, barriers[0].Transition.StateAfter);
+    m_commandList->ResourceBarrier(_countof(barriers), barriers);
+    ExecuteCommandListAndWait();
 
-        m_commandList->ResourceBarrier(_countof(barriers), barriers);
-        m_commandList->CopyResource(resourceToMap.Get(), buffer.Get());
-        std::swap(barriers[0].Transition.StateBefore, barriers[0].Transition.StateAfter);
-        m_commandList->ResourceBarrier(_countof(barriers), barriers);
-        ExecuteCommandListAndWait();
-    }
+    return readbackBuffer;
+}
+
+std::vector<std::byte> Device::Download(Microsoft::WRL::ComPtr<ID3D12Resource> buffer)
+{
+    ComPtr<ID3D12Resource> resourceToMap = GetReadableResource(buffer);
 
     std::vector<std::byte> outputBuffer(static_cast<size_t>(buffer->GetDesc().Width));
     
@@ -672,27 +690,75 @@ std::vector<std::byte> Device::Download(Microsoft::WRL::ComPtr<ID3D12Resource> b
     return outputBuffer;
 }
 
-void Device::ExecuteCommandList()
+std::shared_ptr<DownloadedBuffer> Device::DownloadMapped(Microsoft::WRL::ComPtr<ID3D12Resource> buffer)
 {
-    THROW_IF_FAILED(m_commandList->Close());
+    ComPtr<ID3D12Resource> resourceToMap = GetReadableResource(buffer);
 
-    ID3D12CommandList* commandLists[] = { m_commandList.Get() };
-    m_queue->ExecuteCommandLists(_countof(commandLists), commandLists);
-    THROW_IF_FAILED(m_commandList->Reset(m_commandAllocator.Get(), nullptr));
+    // A CPU-visible buffer may still be written by later GPU work, so its contents are copied now.
+    if (resourceToMap == buffer)
+    {
+        return std::make_shared<DownloadedBuffer>(Download(buffer));
+    }
+
+    return std::make_shared<DownloadedBuffer>(std::move(resourceToMap), gsl::narrow<size_t>(buffer->GetDesc().Width));
 }
 
-void Device::ExecuteCommandListAndWait()
+DownloadedBuffer::DownloadedBuffer(ComPtr<ID3D12Resource> readbackBuffer, size_t sizeInBytes) : 
+    m_readbackBuffer(std::move(readbackBuffer))
+{
+    CD3DX12_RANGE readRange(0, sizeInBytes);
+    void* mappedBufferData = nullptr;
+    THROW_IF_FAILED(m_readbackBuffer->Map(0, &readRange, &mappedBufferData));
+    m_data = gsl::span<const std::byte>(static_cast<const std::byte*>(mappedBufferData), sizeInBytes);
+}
+
+DownloadedBuffer::DownloadedBuffer(std::vector<std::byte>&& data) : m_copiedData(std::move(data))
+{
+    m_data = m_copiedData;
+}
+
+DownloadedBuffer::~DownloadedBuffer()
+{
+    if (m_readbackBuffer)
+    {
+        // Nothing was written, so the written range is empty.
+        CD3DX12_RANGE writtenRange(0, 0);
+        m_readbackBuffer->Unmap(0, &writtenRange);
+    }
+}
+
+uint64_t Device::ExecuteCommandList()
 {
     THROW_IF_FAILED(m_commandList->Close());
 
     ID3D12CommandList* commandLists[] = { m_commandList.Get() };
     m_queue->ExecuteCommandLists(_countof(commandLists), commandLists);
-    WaitForGpuWorkToComplete();
+
+    const uint64_t fenceValue = ++m_lastSignaledFenceValue;
+    THROW_IF_FAILED(m_queue->Signal(m_fence.Get(), fenceValue));
+    m_commandAllocators[m_commandAllocatorIndex].fenceValue = fenceValue;
+
+    // The next allocator (and the resources its commands used) can be reused once its last submission completes.
+    m_commandAllocatorIndex = (m_commandAllocatorIndex + 1) % m_commandAllocators.size();
+    auto& slot = m_commandAllocators[m_commandAllocatorIndex];
+    WaitForFenceValue(slot.fenceValue);
+    slot.temporaryResources.clear();
+    THROW_IF_FAILED(slot.allocator->Reset());
+    THROW_IF_FAILED(m_commandList->Reset(slot.allocator.Get(), nullptr));
+
+    return fenceValue;
+}
+
+void Device::ExecuteCommandListAndWait()
+{
+    WaitForFenceValue(ExecuteCommandList());
     THROW_IF_FAILED(m_d3d->GetDeviceRemovedReason());
-    THROW_IF_FAILED(m_commandAllocator->Reset());
-    THROW_IF_FAILED(m_commandList->Reset(m_commandAllocator.Get(), nullptr));
 
-    m_temporaryResources.clear();
+    // Every submission has completed.
+    for (auto& slot : m_commandAllocators)
+    {
+        slot.temporaryResources.clear();
+    }
 }
 
 void Device::RecordTimestamp()
@@ -3,8 +3,31 @@
 #include "PixCaptureHelper.h"
 #include "DxModules.h"
 
+// The contents of a buffer downloaded from the GPU, readable without a further copy. When the buffer was copied
+// into a readback heap, the data is read straight from that readback buffer, which stays mapped until this object
+// is destroyed; otherwise (the buffer itself was CPU-visible) the data is a copy. The data never changes, so it
+// may be read, and the object destroyed, on any thread.
+class DownloadedBuffer
+{
+public:
+    DownloadedBuffer(Microsoft::WRL::ComPtr<ID3D12Resource> readbackBuffer, size_t sizeInBytes);
+    explicit DownloadedBuffer(std::vector<std::byte>&& data);
+    DownloadedBuffer(const DownloadedBuffer&) = delete;
+    DownloadedBuffer& operator=(const DownloadedBuffer&) = delete;
+    ~DownloadedBuffer();
+
+    gsl::span<const std::byte> GetData() const { return m_data; }
+
+private:
+    Microsoft::WRL::ComPtr<ID3D12Resource> m_readbackBuffer;
+    std::vector<std::byte> m_copiedData;
+    gsl::span<const std::byte> m_data;
+};
+
 // Simplified abstraction for submitting work to a device with a single command queue. Not thread safe.
-// This "device" includes a single command list that is always open for recording work.
+// This "device" includes a single command list that is always open for recording work. The list records with one
+// of a ring of command allocators, so command lists can be submitted without waiting for up to framesInFlight
+// earlier submissions to finish.
 class Device
 {
 public:
@@ -15,6 +38,7 @@ public:
         bool debugLayersEnabled, 
         D3D12_COMMAND_LIST_TYPE commandListType, 
         uint32_t dispatchRepeat,
+        uint32_t framesInFlight,
         bool uavBarrierAfterDispatch,
         bool aliasingBarrierAfterDispatch,
         bool clearShaderCaches,
@@ -82,8 +106,13 @@ public:
     // Waits for all work submitted to this device's queue to complete.
     void WaitForGpuWorkToComplete();
 
-    // Submits all commands recorded into the device's command list for execution.
-    void ExecuteCommandList();
+    // Submits all commands recorded into the device's command list for execution without waiting for them.
+    // Returns the fence value that WaitForFenceValue uses to wait for the commands to complete. To reuse a command
+    // allocator, this waits for the submission framesInFlight before this one to complete.
+    uint64_t ExecuteCommandList();
+
+    // Blocks the CPU thread until the commands submitted with the given fence value have finished on the GPU.
+    void WaitForFenceValue(uint64_t fenceValue);
 
     // Submits the device command list for execution and blocks the CPU thread until the commands have finished on the GPU.
     void ExecuteCommandListAndWait();
@@ -108,9 +137,10 @@ public:
 
     bool GpuTimingEnabled() const { return m_timestampCapacity > 0; }
 
+    // Keeps an object used by the commands being recorded alive until they've finished executing.
     void KeepAliveUntilNextCommandListDispatch(Microsoft::WRL::ComPtr<IGraphicsUnknown>&& object)
     {
-        m_temporaryResources.emplace_back(std::move(object));
+        m_commandAllocators[m_commandAllocatorIndex].temporaryResources.emplace_back(std::move(object));
     }
 
     Microsoft::WRL::ComPtr<ID3D12Resource> Upload(uint64_t totalSize, gsl::span<const std::byte> data, std::wstring_view name = {});
@@ -125,6 +155,10 @@ public:
 
     std::vector<std::byte> Download(Microsoft::WRL::ComPtr<ID3D12Resource>);
 
+    // Like Download, but the result is read from the readback buffer rather than copied out of it, which avoids
+    // a second full copy of large buffers (e.g. when writing them to files).
+    std::shared_ptr<DownloadedBuffer> DownloadMapped(Microsoft::WRL::ComPtr<ID3D12Resource>);
+
     void ClearShaderCaches();
 
     static uint32_t GetSizeInBytes(DML_TENSOR_DATA_TYPE dataType);
@@ -135,6 +169,10 @@ public:
 private:
     void EnsureDxcInterfaces();
 
+    // Returns a CPU-readable resource with the contents of the buffer: either the buffer itself, if it's already
+    // CPU-visible, or a new readback buffer that it has been copied into.
+    Microsoft::WRL::ComPtr<ID3D12Resource> GetReadableResource(Microsoft::WRL::ComPtr<ID3D12Resource> buffer);
+
 private:
     std::shared_ptr<PixCaptureHelper> m_pixCaptureHelper;
     std::shared_ptr<D3d12Module> m_d3dModule;
@@ -151,10 +189,20 @@ private:
     uint32_t m_timestampHeadIndex = 0;
     uint32_t m_timestampCount = 0;
     Microsoft::WRL::ComPtr<ID3D12Fence> m_fence;
+    uint64_t m_lastSignaledFenceValue = 0;
     D3D12_COMMAND_LIST_TYPE m_commandListType = D3D12_COMMAND_LIST_TYPE_COMPUTE;
-    Microsoft::WRL::ComPtr<ID3D12CommandAllocator> m_commandAllocator;
+
+    // The command list records with the allocator at m_commandAllocatorIndex. The others may be in use by submitted
+    // command lists until the fence reaches their fenceValue.
+    struct CommandAllocatorSlot
+    {
+        Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
+        uint64_t fenceValue = 0;
+        std::vector<Microsoft::WRL::ComPtr<IGraphicsUnknown>> temporaryResources;
+    };
+    std::vector<CommandAllocatorSlot> m_commandAllocators;
+    size_t m_commandAllocatorIndex = 0;
     Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_commandList;
-    std::vector<Microsoft::WRL::ComPtr<IGraphicsUnknown>> m_temporaryResources;
     uint32_t m_dispatchRepeat = 1;
     std::vector<D3D12_RESOURCE_BARRIER> m_postDispatchBarriers;
     DWORD m_callbackCookie = 0;
@@ -36,4 +36,13 @@ struct Dispatchable
     virtual void Initialize() = 0;
     virtual void Bind(const Bindings& bindings, uint32_t iteration) = 0;
     virtual void Dispatch(const Model::DispatchCommand& args, uint32_t iteration, DeferredBindings& deferredBinings) = 0;
+
+    // Dispatchables that record all of their work into the device command list can record several iterations
+    // before the list is executed (--dispatch_batch). For these, Dispatch is RecordDispatch followed by
+    // Device::ExecuteCommandListAndWait.
+    virtual bool SupportsBatchedDispatch() const { return false; }
+    virtual void RecordDispatch(const Model::DispatchCommand& args, uint32_t iteration)
+    {
+        throw std::invalid_argument(fmt::format("Dispatchable '{}' can't be recorded without executing it.", args.dispatchableName));
+    }
 };
\ No newline at end of file
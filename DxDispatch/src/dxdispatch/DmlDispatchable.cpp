@@ -2,6 +2,7 @@
 #include "Adapter.h"
 #include "Device.h"
 #include "Model.h"
+#include "SafeArithmetic.h"
 #include "Dispatchable.h"
 #include "DmlDispatchable.h"
 #include "DirectMLHelpers/DmlGraphHelper.h"
@@ -45,15 +46,6 @@ struct BindingData
     std::vector<DML_BINDING_DESC> bindingDescs;
 };
 
-uint64_t SafeMultiply(uint64_t a, uint64_t b)
-{
-    if (b != 0 && (a > std::numeric_limits<uint64_t>::max() / b))
-    {
-        throw std::overflow_error("Overflow in size calculation");
-    }
-    return a * b;
-}
-
 uint64_t CalculateSize(uint64_t elementCount, uint64_t elementSizeInBytes)
 {
     uint64_t calculatedSize = SafeMultiply(elementCount, elementSizeInBytes);
@@ -127,7 +119,7 @@ void FillBindingData(
                 if (isSerializedGraph)
                 {
                     uint64_t sizeInBytes = CalculateSize(source.elementCount, source.elementSizeInBytes);
-                    if (offset + SafeMultiply(source.elementCount, source.elementSizeInBytes) > sizeInBytes)
+                    if (SafeAdd(offset, SafeMultiply(source.elementCount, source.elementSizeInBytes)) > sizeInBytes)
                     {
                         throw std::invalid_argument(fmt::format(
                             "Buffer size ({} bytes) is too small for the data ({} bytes) at offset {} bytes for binding point '{}'", 
@@ -576,6 +568,16 @@ void DmlDispatchable::Bind(const Bindings& bindings, uint32_t iteration)
     FillBindingData(m_bindPoints.inputs, &m_initBindings, &bindings, inputBindingData, m_isSerializedGraph, false, compileType);
     FillBindingData(m_bindPoints.outputs, &m_initBindings, &bindings, outputBindingData, m_isSerializedGraph, false, compileType);
 
+    // Dispatches recorded with the previous bindings may not have executed yet (--dispatch_batch).
+    if (m_descriptorHeap)
+    {
+        m_device->KeepAliveUntilNextCommandListDispatch(std::move(m_descriptorHeap));
+    }
+    if (m_bindingTable)
+    {
+        m_device->KeepAliveUntilNextCommandListDispatch(std::move(m_bindingTable));
+    }
+
     D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDesc = {};
     descriptorHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
     descriptorHeapDesc.NumDescriptors = bindingProps.RequiredDescriptorCount;
@@ -632,6 +634,11 @@ void DmlDispatchable::Bind(const Bindings& bindings, uint32_t iteration)
 
 void DmlDispatchable::Dispatch(const Model::DispatchCommand& args, uint32_t iteration, DeferredBindings& deferredBindings)
 {
-    m_device->RecordDispatch(m_compiledOperator.Get(), m_bindingTable.Get());
+    RecordDispatch(args, iteration);
     m_device->ExecuteCommandListAndWait();
+}
+
+void DmlDispatchable::RecordDispatch(const Model::DispatchCommand& args, uint32_t iteration)
+{
+    m_device->RecordDispatch(m_compiledOperator.Get(), m_bindingTable.Get());
 }
\ No newline at end of file
@@ -20,6 +20,8 @@ public:
     void Initialize() final;
     void Bind(const Bindings& bindings, uint32_t iteration) final;
     void Dispatch(const Model::DispatchCommand& args, uint32_t iteration, DeferredBindings& deferredBindings) final;
+    bool SupportsBatchedDispatch() const final { return true; }
+    void RecordDispatch(const Model::DispatchCommand& args, uint32_t iteration) final;
 
 private:
     std::string m_name;
@@ -8,6 +8,10 @@ static const GUID DxDispatch_DxDevice =
 static const GUID DxDispatch_DmlDevice = 
 { 0xb7c9961f, 0x44da, 0x4e1c, { 0xaa, 0xfd, 0x7a, 0x91, 0x6, 0xf9, 0x32, 0xbb } };
 
+// Returned by RunAll and RunCommand when a dispatch is significantly slower than its baseline (--baseline_file).
+// The low byte is non-zero since some platforms keep only the low byte of a process exit code.
+static const HRESULT DXDISPATCH_E_PERFORMANCE_REGRESSION = static_cast<HRESULT>(0x80040202L);
+
 MIDL_INTERFACE("E05E128D-9A97-4AEE-85D8-1725C92E4172")
 IDxDispatchLogger : public IUnknown
 {
@@ -13,10 +13,14 @@
 #endif
 #include "StdSupport.h"
 #include "NpyReaderWriter.h"
+#include "NpzReaderWriter.h"
 #include "ImageReaderWriter.h"
 #include "CommandLineArgs.h"
 #include "Executor.h"
+#include "LatencyHistogram.h"
+#include "ResultsFile.h"
 #include <half.hpp>
+#include <deque>
 
 using Microsoft::WRL::ComPtr;
 
@@ -30,16 +34,18 @@ struct Timer
     double DurationInMilliseconds() { return std::chrono::duration<double>(end - start).count() * 1000; }
 };
 
+// Streaming statistics for a sequence of timing samples, in constant memory (see LatencyHistogram).
 struct Timings
 {
-    std::vector<double> rawSamples;
-
     struct Stats
     {
         size_t count;
         double sum;
         double average;
         double median;
+        double p90;
+        double p99;
+        double p999;
         double min;
         double max;
     };
@@ -50,72 +56,172 @@ struct Timings
         Stats hot;
     };
 
-    Stats ComputeStats(gsl::span<const double> sampleSpan) const
+    // The first samples may be from "warmup" runs that skew the results because of cold caches.
+    // We call the first few samples "cold" and the later samples "hot". We always want at least 
+    // 1 hot sample. Example:
+    //
+    // Raw Samples | maxWarmup | cold | hot
+    // ------------|-----------|------|----
+    //           0 |         2 |    0 |   0
+    //           1 |         2 |    0 |   1
+    //           2 |         2 |    1 |   1
+    //           3 |         2 |    2 |   1
+    //           4 |         2 |    2 |   2
+    //           5 |         2 |    2 |   3
+    //
+    // Since the last sample is always hot, each sample is held back until the next one arrives.
+    explicit Timings(size_t maxWarmupSampleCount) : maxWarmupSampleCount(maxWarmupSampleCount) {}
+
+    void AddSample(double sample)
     {
-        Stats stats = {};
-
-        if (!sampleSpan.empty())
+        if (latestSample)
         {
-            std::vector<double> samples(sampleSpan.size());
-            std::copy(sampleSpan.begin(), sampleSpan.end(), samples.begin());
-            std::sort(samples.begin(), samples.end());
-
-            stats.count = sampleSpan.size();
-            stats.sum = std::accumulate(samples.begin(), samples.end(), 0.0);
-            stats.average = stats.sum / samples.size();
-            stats.median = samples[samples.size() / 2];
-            stats.min = samples[0];
-            stats.max = samples[samples.size() - 1];
+            (cold.Count() < maxWarmupSampleCount ? cold : hot).Record(*latestSample);
         }
+        latestSample = sample;
+    }
+
+    uint64_t Count() const { return cold.Count() + hot.Count() + (latestSample ? 1 : 0); }
 
+    static Stats ComputeStats(const LatencyHistogram& histogram)
+    {
+        Stats stats = {};
+        stats.count = static_cast<size_t>(histogram.Count());
+        stats.sum = histogram.Sum();
+        stats.average = histogram.Average();
+        stats.median = histogram.Percentile(0.5);
+        stats.p90 = histogram.Percentile(0.9);
+        stats.p99 = histogram.Percentile(0.99);
+        stats.p999 = histogram.Percentile(0.999);
+        stats.min = histogram.Min();
+        stats.max = histogram.Max();
         return stats;
     }
 
-    SampleStats ComputeStats(size_t maxWarmupSampleCount) const
+    SampleStats ComputeStats()
     {
-        SampleStats stats = {};
-        if (rawSamples.empty())
+        if (latestSample)
         {
-            return stats;
+            hot.Record(*latestSample);
+            latestSample.reset();
         }
+        return { ComputeStats(cold), ComputeStats(hot) };
+    }
 
-        // The first samples may be from "warmup" runs that skew the results because of cold caches.
-        // We call the first few samples "cold" and the later samples "hot". We always want at least 
-        // 1 hot sample. Example:
-        //
-        // Raw Samples | maxWarmup | cold | hot
-        // ------------|-----------|------|----
-        //           0 |         2 |    0 |   0
-        //           1 |         2 |    0 |   1
-        //           2 |         2 |    1 |   1
-        //           3 |         2 |    2 |   1
-        //           4 |         2 |    2 |   2
-        //           5 |         2 |    2 |   3
+    // The samples recorded so far; the latest sample isn't included until ComputeStats is called.
+    const LatencyHistogram& Cold() const { return cold; }
+    const LatencyHistogram& Hot() const { return hot; }
+
+private:
+    size_t maxWarmupSampleCount;
+    std::optional<double> latestSample;
+    LatencyHistogram cold;
+    LatencyHistogram hot;
+};
+
+// Returns the names of buffers that no dispatch can write to. DirectML operators only write to their output bind
+// points; HLSL and ONNX dispatchables (and append/consume counters) may write to anything bound to them.
+static std::unordered_set<std::string> GetReadOnlyBufferNames(const Model& model)
+{
+    std::unordered_set<std::string> readOnlyBuffers;
+    for (auto& desc : model.GetResourceDescs())
+    {
+        auto buffer = std::get_if<Model::BufferDesc>(&desc.value);
+        if (buffer && !buffer->useDeferredBinding)
+        {
+            readOnlyBuffers.insert(desc.name);
+        }
+    }
 
-        size_t coldSampleCount = std::min(std::max<size_t>(rawSamples.size(), 1) - 1, maxWarmupSampleCount);
-        size_t hotSampleCount = rawSamples.size() - coldSampleCount;
-        assert(coldSampleCount + hotSampleCount == rawSamples.size());
+    for (auto& commandDesc : model.GetCommands())
+    {
+        auto command = std::get_if<Model::DispatchCommand>(&commandDesc.command);
+        if (!command)
+        {
+            continue;
+        }
 
-        stats.cold = ComputeStats(gsl::make_span<const double>(rawSamples.data(), coldSampleCount));
-        stats.hot = ComputeStats(gsl::make_span<const double>(rawSamples.data() + coldSampleCount, hotSampleCount));
+        auto dmlDesc = std::get_if<Model::DmlDispatchableDesc>(&model.GetDispatchable(command->dispatchableName).value);
+        for (auto& [bindingName, sources] : command->bindings)
+        {
+            bool isInput = dmlDesc && std::any_of(
+                dmlDesc->bindPoints.inputs.begin(), 
+                dmlDesc->bindPoints.inputs.end(), 
+                [&](auto& bindPoint) { return bindPoint.name == bindingName; });
 
-        return stats;
+            for (auto& source : sources)
+            {
+                if (!isInput)
+                {
+                    readOnlyBuffers.erase(source.name);
+                }
+                if (source.counterName)
+                {
+                    readOnlyBuffers.erase(*source.counterName);
+                }
+            }
+        }
     }
-};
 
-Executor::Executor(Model& model, std::shared_ptr<Device> device, const CommandLineArgs& args, IDxDispatchLogger* logger) : 
-    m_model(model), m_device(device), m_commandLineArgs(args), m_logger(logger)
+    return readOnlyBuffers;
+}
+
+Executor::Executor(
+    Model& model,
+    std::shared_ptr<Device> device,
+    const CommandLineArgs& args,
+    IDxDispatchLogger* logger,
+    std::shared_ptr<ResultsFile> resultsFile,
+    std::optional<ResultsFile::RunInfo> runInfo) : 
+    m_model(model), m_device(device), m_commandLineArgs(args), m_logger(logger), m_resultsFile(std::move(resultsFile)), m_runInfo(std::move(runInfo))
 {
+    if (args.BaselineFilePath())
+    {
+        m_baselineResults = ResultsFile::ReadJsonResults(args.BaselineFilePath().value());
+    }
+
     // Initialize buffer resources.
     {
         PIXScopedEvent(m_device->GetCommandList(), PIX_COLOR(255, 255, 0), "Initialize resources");
+
+        // With --share_buffers, read-only buffers whose initial values share the same bytes (the parser shares
+        // identical values) are backed by the resource of the first such buffer instead of a new upload.
+        std::unordered_set<std::string> readOnlyBuffers;
+        if (args.ShareReadOnlyBuffers())
+        {
+            readOnlyBuffers = GetReadOnlyBufferNames(model);
+        }
+        using SharedBufferKey = std::tuple<const std::byte*, size_t, uint64_t, uint64_t>;
+        std::map<SharedBufferKey, ComPtr<ID3D12Resource>> sharedBuffers;
+        uint32_t sharedBufferCount = 0;
+
         for (auto& desc : model.GetResourceDescs())
         {
             auto wName = std::wstring_convert<std::codecvt_utf8<wchar_t>>().from_bytes(desc.name);
             if (std::holds_alternative<Model::BufferDesc>(desc.value))
             {
                 auto& bufferDesc = std::get<Model::BufferDesc>(desc.value);
-                if (bufferDesc.sizeInBytes > 0)
+                if (bufferDesc.sizeInBytes > 0 && !bufferDesc.initialValues.empty() && readOnlyBuffers.count(desc.name))
+                {
+                    SharedBufferKey key = {
+                        bufferDesc.initialValues.data(), 
+                        bufferDesc.initialValues.size(), 
+                        bufferDesc.sizeInBytes, 
+                        bufferDesc.initialValuesOffsetInBytes
+                    };
+
+                    auto& resource = sharedBuffers[key];
+                    if (resource)
+                    {
+                        sharedBufferCount++;
+                    }
+                    else
+                    {
+                        resource = device->Upload(bufferDesc.sizeInBytes, bufferDesc.initialValues, wName);
+                    }
+                    m_resources[desc.name] = resource;
+                }
+                else if (bufferDesc.sizeInBytes > 0)
                 {
                     m_resources[desc.name] = std::move(device->Upload(bufferDesc.sizeInBytes, bufferDesc.initialValues, wName));
                 }
@@ -135,6 +241,11 @@ Executor::Executor(Model& model, std::shared_ptr<Device> device, const CommandLi
                 m_resources[desc.name] = nullptr;
             }
         }
+
+        if (sharedBufferCount > 0)
+        {
+            m_logger->LogInfo(fmt::format("Shared {} read-only buffers with identical initial values", sharedBufferCount).c_str());
+        }
     }
     device->ExecuteCommandListAndWait();
 
@@ -222,6 +333,11 @@ Executor::Executor(Model& model, std::shared_ptr<Device> device, const CommandLi
     }
 }
 
+Executor::~Executor()
+{
+    LogFileWriteResults(m_fileWriter.Flush());
+}
+
 uint32_t Executor::GetCommandCount()
 {
     return static_cast<uint32_t>(m_model.GetCommands().size());
@@ -241,6 +357,7 @@ void Executor::RunCommand(UINT32 id)
         try
         {
             std::visit(*this, commandDescs[id].command);
+            LogFileWriteResults(m_fileWriter.TakeResults());
             if (m_commandLineArgs.PrintCommands())
             {
                 m_logger->LogCommandCompleted((UINT32)id, S_OK, "");
@@ -280,6 +397,9 @@ void Executor::Run()
     {
         RunCommand(i);
     }
+
+    // Files are written in the background; the run isn't complete until they are.
+    LogFileWriteResults(m_fileWriter.Flush());
     return;
 }
 
@@ -287,8 +407,11 @@ void Executor::operator()(const Model::DispatchCommand& command)
 {
     auto& dispatchable = m_dispatchables[command.dispatchableName];
 
-    Timings cpuTimings;
-    Timings gpuTimings;
+    Timings cpuTimings(m_commandLineArgs.MaxWarmupSamples());
+
+    // Statistics take constant memory; the raw samples (one per iteration) are only kept to print each iteration's timings.
+    const bool keepRawSamples = m_commandLineArgs.GetTimingVerbosity() >= TimingVerbosity::All;
+    std::vector<double> cpuRawSamples;
 
     Dispatchable::Bindings bindings;
     try
@@ -302,6 +425,54 @@ void Executor::operator()(const Model::DispatchCommand& command)
         throw;
     }
 
+    // Iterations of a batch are recorded into the device's command list and then executed with a single wait.
+    // With more than one frame in flight, the loop doesn't wait for each submission (batch or single iteration)
+    // but only for the oldest when there are too many executing.
+    uint32_t batchSize = m_commandLineArgs.DispatchBatchSize();
+    uint32_t framesInFlight = m_commandLineArgs.FramesInFlight();
+    if ((batchSize > 1 || framesInFlight > 1) && !dispatchable->SupportsBatchedDispatch())
+    {
+        m_logger->LogWarning(fmt::format("Dispatch '{}' can't be batched or pipelined; each iteration is executed separately.", command.dispatchableName).c_str());
+        batchSize = 1;
+        framesInFlight = 1;
+    }
+    const bool recordOnly = batchSize > 1 || framesInFlight > 1;
+
+    auto addCpuSample = [&](double milliseconds, uint32_t iterations)
+    {
+        // A submission (batch or single iteration) is one measurement, recorded once as the time per iteration,
+        // which amortizes the submission and wait. Recording it once per iteration would make the samples look
+        // more numerous, and so more significant (e.g. to the baseline comparison), than they are.
+        const double cpuSample = milliseconds / iterations / m_commandLineArgs.DispatchRepeat();
+        cpuTimings.AddSample(cpuSample);
+        if (keepRawSamples)
+        {
+            cpuRawSamples.insert(cpuRawSamples.end(), iterations, cpuSample);
+        }
+    };
+
+    struct Submission
+    {
+        uint64_t fenceValue;
+        uint32_t iterations;
+        std::chrono::steady_clock::time_point start;
+    };
+    std::deque<Submission> submissionsInFlight;
+    std::chrono::steady_clock::time_point lastCompletion;
+
+    // A pipelined submission's time is measured from when the previous one completed (or from when it started
+    // binding, if later) until it completes, so in steady state it's the interval between completions.
+    auto completeOldestSubmission = [&]()
+    {
+        const Submission& submission = submissionsInFlight.front();
+        m_device->WaitForFenceValue(submission.fenceValue);
+        const auto completion = std::chrono::steady_clock::now();
+        const auto duration = completion - std::max(lastCompletion, submission.start);
+        addCpuSample(std::chrono::duration<double>(duration).count() * 1000, submission.iterations);
+        lastCompletion = completion;
+        submissionsInFlight.pop_front();
+    };
+
     // Dispatch
     uint32_t iterationsCompleted = 0;
     bool timedOut = false;
@@ -310,30 +481,64 @@ void Executor::operator()(const Model::DispatchCommand& command)
     {
         Timer loopTimer, iterationTimer, bindTimer, dispatchTimer;
 
-        for (; !timedOut && iterationsCompleted < m_commandLineArgs.DispatchIterations(); iterationsCompleted++)
+        while (!timedOut && iterationsCompleted < m_commandLineArgs.DispatchIterations())
         {
             iterationTimer.Start();
 
-            // Bind
-            PIXBeginEvent(PIX_COLOR(128, 255, 0), L"Bind");
-            try
+            const uint32_t batchIterations = std::min(batchSize, m_commandLineArgs.DispatchIterations() - iterationsCompleted);
+            double dispatchMilliseconds = 0;
+            for (uint32_t batchIndex = 0; batchIndex < batchIterations; batchIndex++)
+            {
+                const uint32_t iteration = iterationsCompleted + batchIndex;
+
+                // Bind
+                PIXBeginEvent(PIX_COLOR(128, 255, 0), L"Bind");
+                try
+                {
+                    dispatchable->Bind(bindings, iteration);
+                }
+                catch (const std::exception& e)
+                {
+                    m_logger->LogError(fmt::format("ERROR while binding resources: {}\n", e.what()).c_str());
+                    throw;
+                }
+                PIXEndEvent();
+
+                // Dispatch
+                dispatchTimer.Start();
+                if (recordOnly)
+                {
+                    dispatchable->RecordDispatch(command, iteration);
+                }
+                else
+                {
+                    dispatchable->Dispatch(command, iteration, m_deferredBinding);
+                }
+                dispatchMilliseconds += dispatchTimer.End().DurationInMilliseconds();
+            }
+
+            if (framesInFlight > 1)
             {
-                dispatchable->Bind(bindings, iterationsCompleted);
+                submissionsInFlight.push_back({ m_device->ExecuteCommandList(), batchIterations, iterationTimer.start });
+                while (submissionsInFlight.size() >= framesInFlight)
+                {
+                    completeOldestSubmission();
+                }
             }
-            catch (const std::exception& e)
+            else
             {
-                m_logger->LogError(fmt::format("ERROR while binding resources: {}\n", e.what()).c_str());
-                throw;
+                if (recordOnly)
+                {
+                    dispatchTimer.Start();
+                    m_device->ExecuteCommandListAndWait();
+                    dispatchMilliseconds += dispatchTimer.End().DurationInMilliseconds();
+                }
+                addCpuSample(dispatchMilliseconds, batchIterations);
             }
-            PIXEndEvent();
-
-            // Dispatch
-            dispatchTimer.Start();
-            dispatchable->Dispatch(command, iterationsCompleted, m_deferredBinding);
-            cpuTimings.rawSamples.push_back(dispatchTimer.End().DurationInMilliseconds() / m_commandLineArgs.DispatchRepeat());
+            iterationsCompleted += batchIterations;
 
             // The dispatch interval defaults to 0 (dispatch as fast as possible). However, the user may increase it
-            // to potentially introduce a sleep between each iteration.
+            // to potentially introduce a sleep between each iteration (or batch of iterations).
             double timeToSleep = std::max(0.0, m_commandLineArgs.MinimumDispatchIntervalInMilliseconds() - iterationTimer.End().DurationInMilliseconds());
 
             if (m_commandLineArgs.TimeToRunInMilliseconds() &&
@@ -352,6 +557,16 @@ void Executor::operator()(const Model::DispatchCommand& command)
                 m_device->DummyPresent();
             }
         }
+
+        while (!submissionsInFlight.empty())
+        {
+            completeOldestSubmission();
+        }
+        if (framesInFlight > 1)
+        {
+            // Releases the resources kept alive for the submissions.
+            m_device->ExecuteCommandListAndWait();
+        }
     }
     catch (const std::exception& e)
     {
@@ -360,32 +575,67 @@ void Executor::operator()(const Model::DispatchCommand& command)
     }
     PIXEndEvent();
 
-    auto cpuStats = cpuTimings.ComputeStats(m_commandLineArgs.MaxWarmupSamples());
+    const uint64_t cpuSampleCount = cpuTimings.Count();
+    auto cpuStats = cpuTimings.ComputeStats();
 
-    // GPU timings are capped at a fixed size ring buffer. The first samples may have been 
+    // GPU timings (one per iteration) are capped at a fixed size ring buffer. The first samples may have been 
     // overwritten, in which case the warmup samples are dropped.
-    gpuTimings.rawSamples = m_device->ResolveTimingSamples();
-    assert(cpuTimings.rawSamples.size() >= gpuTimings.rawSamples.size());
-    auto gpuSamplesOverwritten =  static_cast<uint32_t>(gpuTimings.rawSamples.empty() ? 0 : cpuTimings.rawSamples.size() - gpuTimings.rawSamples.size());
-    auto gpuStats = gpuTimings.ComputeStats(std::max(m_commandLineArgs.MaxWarmupSamples(), gpuSamplesOverwritten) - gpuSamplesOverwritten);
+    std::vector<double> gpuRawSamples = m_device->ResolveTimingSamples();
+    assert(iterationsCompleted >= gpuRawSamples.size());
+    auto gpuSamplesOverwritten =  static_cast<uint32_t>(gpuRawSamples.empty() ? 0 : iterationsCompleted - gpuRawSamples.size());
+    Timings gpuTimings(std::max(m_commandLineArgs.MaxWarmupSamples(), gpuSamplesOverwritten) - gpuSamplesOverwritten);
+    for (double gpuSample : gpuRawSamples)
+    {
+        gpuTimings.AddSample(gpuSample);
+    }
+    auto gpuStats = gpuTimings.ComputeStats();
+
+    if (m_resultsFile && iterationsCompleted > 0)
+    {
+        try
+        {
+            m_resultsFile->Append({
+                command.dispatchableName,
+                iterationsCompleted,
+                cpuTimings.Cold(),
+                cpuTimings.Hot(),
+                gpuTimings.Cold(),
+                gpuTimings.Hot()
+            });
+        }
+        catch (const std::exception& e)
+        {
+            m_logger->LogError(fmt::format("Failed to write results: {}", e.what()).c_str());
+        }
+    }
+
+    if (m_commandLineArgs.BaselineFilePath() && iterationsCompleted > 0)
+    {
+        CompareWithBaseline(command.dispatchableName, cpuTimings.Hot(), gpuTimings.Hot());
+    }
 
     if (iterationsCompleted > 0)
     {
+        // Batched or pipelined iterations share CPU samples, so there are fewer samples than iterations.
+        std::string iterationCount = cpuSampleCount == iterationsCompleted ?
+            fmt::format("{} iterations", iterationsCompleted) :
+            fmt::format("{} iterations ({} CPU samples)", iterationsCompleted, cpuSampleCount);
+
         if (m_commandLineArgs.GetTimingVerbosity() == TimingVerbosity::Basic)
         {
-            if (gpuTimings.rawSamples.empty())
+            if (gpuRawSamples.empty())
             {
-                m_logger->LogInfo(fmt::format("Dispatch '{}': {} iterations, {:.4f} ms median (CPU)",
+                m_logger->LogInfo(fmt::format("Dispatch '{}': {}, {:.4f} ms median (CPU)",
                     command.dispatchableName, 
-                    iterationsCompleted,
+                    iterationCount,
                     cpuStats.hot.median
                 ).c_str());
             }
             else
             {
-                m_logger->LogInfo(fmt::format("Dispatch '{}': {} iterations, {:.4f} ms median (CPU), {:.6f} ms median (GPU)",
+                m_logger->LogInfo(fmt::format("Dispatch '{}': {}, {:.4f} ms median (CPU), {:.6f} ms median (GPU)",
                     command.dispatchableName, 
-                    iterationsCompleted,
+                    iterationCount,
                     cpuStats.hot.median,
                     gpuStats.hot.median
                 ).c_str());
@@ -393,8 +643,8 @@ void Executor::operator()(const Model::DispatchCommand& command)
         }
         else
         {
-            m_logger->LogInfo(fmt::format("Dispatch '{}': {} iterations",
-                command.dispatchableName, iterationsCompleted
+            m_logger->LogInfo(fmt::format("Dispatch '{}': {}",
+                command.dispatchableName, iterationCount
             ).c_str());
 
             if (cpuStats.cold.count > 0)
@@ -416,6 +666,9 @@ void Executor::operator()(const Model::DispatchCommand& command)
                 m_logger->LogInfo(fmt::format("CPU Timings (Hot)  : {} samples, {:.4f} ms average, {:.4f} ms min, {:.4f} ms median, {:.4f} ms max",
                     cpuStats.hot.count, cpuStats.hot.average, cpuStats.hot.min, cpuStats.hot.median, cpuStats.hot.max
                 ).c_str());
+                m_logger->LogInfo(fmt::format("CPU Percentiles (Hot): {:.4f} ms p50, {:.4f} ms p90, {:.4f} ms p99, {:.4f} ms p99.9",
+                    cpuStats.hot.median, cpuStats.hot.p90, cpuStats.hot.p99, cpuStats.hot.p999
+                ).c_str());
             }
 
             if (gpuStats.hot.count > 0)
@@ -423,6 +676,9 @@ void Executor::operator()(const Model::DispatchCommand& command)
                 m_logger->LogInfo(fmt::format("GPU Timings (Hot)  : {} samples, {:.4f} ms average, {:.4f} ms min, {:.4f} ms median, {:.4f} ms max",
                     gpuStats.hot.count, gpuStats.hot.average, gpuStats.hot.min, gpuStats.hot.median, gpuStats.hot.max
                 ).c_str());
+                m_logger->LogInfo(fmt::format("GPU Percentiles (Hot): {:.4f} ms p50, {:.4f} ms p90, {:.4f} ms p99, {:.4f} ms p99.9",
+                    gpuStats.hot.median, gpuStats.hot.p90, gpuStats.hot.p99, gpuStats.hot.p999
+                ).c_str());
             }
 
             if (gpuSamplesOverwritten > 0)
@@ -437,18 +693,18 @@ void Executor::operator()(const Model::DispatchCommand& command)
 
             for (uint32_t i = 0; i < iterationsCompleted; ++i)
             {
-                if (i < gpuSamplesOverwritten || gpuTimings.rawSamples.empty())
+                if (i < gpuSamplesOverwritten || gpuRawSamples.empty())
                 {
                     // GPU samples are limited to a fixed size, so the initial iterations
                     // may not have timing information (overwritten timestamps).
                     m_logger->LogInfo(fmt::format("iteration {}: {:.4f} ms (CPU)",
-                        i, cpuTimings.rawSamples[i]
+                        i, cpuRawSamples[i]
                     ).c_str());
                 }
                 else
                 {
                     m_logger->LogInfo(fmt::format("iteration {}: {:.4f} ms (CPU), {:.4f} ms (GPU)",
-                        i, cpuTimings.rawSamples[i], gpuTimings.rawSamples[i - gpuSamplesOverwritten]
+                        i, cpuRawSamples[i], gpuRawSamples[i - gpuSamplesOverwritten]
                     ).c_str());
                 }
             }
@@ -469,16 +725,12 @@ std::ostream& operator<<(std::ostream& os, const BufferDataView<T>& view)
 {
     auto nBytes = std::max(view.desc.sizeInBytes, (uint64_t) view.desc.initialValues.size());
     uint64_t elementCount = nBytes / Device::GetSizeInBytes(view.desc.initialValuesDataType);
-    if (elementCount > std::numeric_limits<uint32_t>::max())
-    {
-        throw std::invalid_argument("Buffer size is too large");
-    }
     auto values = reinterpret_cast<const T*>(view.byteValues.data());
 
-    const int32_t elementIndexWidth = int32_t(floor(log10(elementCount))) + 1;
+    const int32_t elementIndexWidth = static_cast<int32_t>(std::to_string(elementCount).size());
     const int32_t hexDigitWidth = int32_t(sizeof(T) * 2);
 
-    for (uint32_t elementIndex = 0; elementIndex < elementCount; elementIndex++)
+    for (uint64_t elementIndex = 0; elementIndex < elementCount; elementIndex++)
     {
         T value = values[elementIndex];
         
@@ -566,16 +818,26 @@ void Executor::operator()(const Model::PrintCommand& command)
         else
         {
             resource = m_resources[command.resourceName].Get();
-            bufferDesc = bufferDescTemp;
+
+            // Only the size and type of the buffer are needed to format it, so the initial values (which may
+            // be large, or backed by a mapped file) aren't copied.
+            bufferDesc = 
+            {
+                bufferDescTemp.sizeInBytes,
+                std::vector<std::byte>(),
+                bufferDescTemp.initialValuesDataType,
+                bufferDescTemp.initialValuesOffsetInBytes,
+                false
+            };
 
             // Buffers are padded up to a 4 byte alignment (DML requirement), but for printing the padding 
             // might be confusing. For example, a buffer initialized with 5x FP16 elements would would only
             // require 10 bytes, but the buffer's actual size would be 12 bytes. Printing the buffer based
             // on its size alone would show 6x FP16 elements (last element being padding) so this trims the 
             // buffer view to match the non-padded region.
-            if (bufferDesc->initialValues.size() > 0)
+            if (bufferDescTemp.initialValues.size() > 0)
             {
-                bufferDesc->sizeInBytes = bufferDesc->initialValues.size();
+                bufferDesc->sizeInBytes = bufferDescTemp.initialValues.size();
             }
         } 
         if (resource)
@@ -595,6 +857,182 @@ void Executor::operator()(const Model::PrintCommand& command)
     }
 }
 
+// Writes the given parts, one after another, to a new file (replacing any existing file).
+static void WriteFileParts(const std::filesystem::path& path, std::initializer_list<gsl::span<const std::byte>> parts)
+{
+    std::ofstream file(path, std::ios::trunc | std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::ios::failure("Could not open file");
+    }
+
+    for (auto& part : parts)
+    {
+        file.write(reinterpret_cast<const char*>(part.data()), static_cast<std::streamsize>(part.size()));
+    }
+
+    file.close();
+    if (!file)
+    {
+        throw std::ios::failure("Could not write file");
+    }
+}
+
+// Replaces the end of an existing file, from the given offset on, with the given data.
+static void WriteFileTail(const std::filesystem::path& path, uint64_t offset, gsl::span<const std::byte> data)
+{
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::ios::failure("Could not open file");
+    }
+
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    file.close();
+    if (!file)
+    {
+        throw std::ios::failure("Could not write file");
+    }
+
+    std::filesystem::resize_file(path, offset + data.size());
+}
+
+void Executor::WriteFileInBackground(const Model::WriteFileCommand& command, uint64_t sizeInBytes, std::function<void()> write)
+{
+    m_fileWriter.Enqueue([write = std::move(write), resourceName = command.resourceName, targetPath = command.targetPath]()
+    {
+        try
+        {
+            write();
+            return BackgroundFileWriter::Result{ true, fmt::format("Resource '{}' written to '{}'", resourceName, targetPath) };
+        }
+        catch (const std::exception& e)
+        {
+            return BackgroundFileWriter::Result{ false, fmt::format("Failed to write resource to file '{}': {}", targetPath, e.what()) };
+        }
+    }, sizeInBytes);
+}
+
+void Executor::LogFileWriteResults(const std::vector<BackgroundFileWriter::Result>& results)
+{
+    for (auto& result : results)
+    {
+        if (result.succeeded)
+        {
+            m_logger->LogInfo(result.message.c_str());
+        }
+        else
+        {
+            m_logger->LogError(result.message.c_str());
+        }
+    }
+}
+
+void Executor::CompareWithBaseline(const std::string& dispatchName, const LatencyHistogram& cpuHot, const LatencyHistogram& gpuHot)
+{
+    auto baselineIt = m_baselineResults.find(dispatchName);
+    if (baselineIt == m_baselineResults.end())
+    {
+        m_logger->LogWarning(fmt::format("Dispatch '{}' has no baseline results to compare with.", dispatchName).c_str());
+        return;
+    }
+
+    auto& baselineRun = baselineIt->second.runInfo;
+    if (m_runInfo)
+    {
+        if (baselineRun.dispatchRepeat != m_runInfo->dispatchRepeat)
+        {
+            m_logger->LogWarning(fmt::format("Dispatch '{}' is not compared with its baseline, which was recorded with --dispatch_repeat {} instead of {}.",
+                dispatchName, baselineRun.dispatchRepeat, m_runInfo->dispatchRepeat).c_str());
+            return;
+        }
+
+        // A batched run's CPU samples time whole submissions, averaged over their iterations, rather than each
+        // iteration's round trip.
+        if (baselineRun.dispatchBatchSize != m_runInfo->dispatchBatchSize)
+        {
+            m_logger->LogWarning(fmt::format("Dispatch '{}' is not compared with its baseline, which was recorded with --dispatch_batch {} instead of {}.",
+                dispatchName, baselineRun.dispatchBatchSize, m_runInfo->dispatchBatchSize).c_str());
+            return;
+        }
+
+        // With more than one frame in flight, CPU samples are intervals between completions (throughput)
+        // rather than each submission's latency.
+        if (baselineRun.framesInFlight != m_runInfo->framesInFlight)
+        {
+            m_logger->LogWarning(fmt::format("Dispatch '{}' is not compared with its baseline, which was recorded with --frames_in_flight {} instead of {}.",
+                dispatchName, baselineRun.framesInFlight, m_runInfo->framesInFlight).c_str());
+            return;
+        }
+
+        std::string differences;
+        auto addDifference = [&](std::string_view difference)
+        {
+            differences += differences.empty() ? "" : ", ";
+            differences += difference;
+        };
+        if (baselineRun.modelHash != m_runInfo->modelHash)
+        {
+            addDifference(fmt::format("model '{}' ({:016x})", baselineRun.modelPath, baselineRun.modelHash));
+        }
+        if (baselineRun.adapterDescription != m_runInfo->adapterDescription)
+        {
+            addDifference(fmt::format("adapter '{}'", baselineRun.adapterDescription));
+        }
+        if (baselineRun.adapterDriverVersion != m_runInfo->adapterDriverVersion)
+        {
+            addDifference(fmt::format("driver {}", baselineRun.adapterDriverVersion));
+        }
+        if (baselineRun.maxWarmupSamples != m_runInfo->maxWarmupSamples)
+        {
+            addDifference(fmt::format("{} warmup samples", baselineRun.maxWarmupSamples));
+        }
+        if (!differences.empty())
+        {
+            m_logger->LogWarning(fmt::format("Dispatch '{}' baseline was recorded with a different {}.", dispatchName, differences).c_str());
+        }
+    }
+
+    const bool compareGpu = gpuHot.Count() > 0 && baselineIt->second.gpuHot.Count() > 0;
+    auto& baseline = compareGpu ? baselineIt->second.gpuHot : baselineIt->second.cpuHot;
+    auto& current = compareGpu ? gpuHot : cpuHot;
+    if (baseline.PrecisionBits() != current.PrecisionBits() || baseline.Resolution() != current.Resolution())
+    {
+        m_logger->LogWarning(fmt::format("Dispatch '{}' is not compared with its baseline, whose histogram has a different precision or resolution.", dispatchName).c_str());
+        return;
+    }
+
+    // A regression must be both statistically significant and large enough to matter; with enough samples, the
+    // test alone finds even tiny differences (e.g. from clock or thermal drift) significant.
+    auto test = LatencyHistogram::TestForSlowdown(baseline, current);
+    const double baselineMedian = baseline.Percentile(0.5);
+    const double currentMedian = current.Percentile(0.5);
+    const double changePercent = baselineMedian > 0 ? (currentMedian / baselineMedian - 1) * 100 : 0;
+    const bool regressed = test.pValue < m_commandLineArgs.RegressionPValue() &&
+        changePercent > m_commandLineArgs.RegressionThresholdPercent();
+
+    auto message = fmt::format("Dispatch '{}': {:.4f} ms median ({}) vs. {:.4f} ms baseline, {:+.2f}%, p = {:.3g}{}",
+        dispatchName,
+        currentMedian,
+        compareGpu ? "GPU" : "CPU",
+        baselineMedian,
+        changePercent,
+        test.pValue,
+        regressed ? ": significantly slower" : ""
+    );
+
+    if (regressed)
+    {
+        m_regressionCount++;
+        m_logger->LogError(message.c_str());
+    }
+    else
+    {
+        m_logger->LogInfo(message.c_str());
+    }
+}
+
 void Executor::operator()(const Model::WriteFileCommand& command)
 {
     PIXScopedEvent(m_device->GetCommandList(), PIX_COLOR(255,255,0), "WriteFile: %s", command.resourceName.c_str());
@@ -603,10 +1041,9 @@ void Executor::operator()(const Model::WriteFileCommand& command)
     {
         auto& resourceDesc = m_model.GetResource(command.resourceName);
         auto& bufferDesc = std::get<Model::BufferDesc>(resourceDesc.value);
-        gsl::span<std::byte> fileData;
-        std::vector<std::byte> fileDataStorage;
+        std::shared_ptr<DownloadedBuffer> downloadedData;
 
-        std::vector<uint32_t> dimensions;
+        std::vector<uint64_t> dimensions;
         ID3D12Resource* resource;
         DML_TENSOR_DATA_TYPE tensorType;
         if (bufferDesc.useDeferredBinding)
@@ -620,28 +1057,39 @@ void Executor::operator()(const Model::WriteFileCommand& command)
             auto deferredBinding = &m_deferredBinding[command.resourceName];
             for (auto dim : deferredBinding->shape)
             {
-                dimensions.push_back(static_cast<uint32_t>(dim));
+                dimensions.push_back(static_cast<uint64_t>(dim));
             }
             resource = deferredBinding->resource.Get();
             if (resource == nullptr)
             {
-                fileData = gsl::span<std::byte>(deferredBinding->cpuValues);
+                // Copied, since the values may change before the file is written.
+                auto& cpuValues = deferredBinding->cpuValues;
+                downloadedData = std::make_shared<DownloadedBuffer>(std::vector<std::byte>(cpuValues.begin(), cpuValues.end()));
             }
             tensorType = deferredBinding->type;
         }
         else
         {
             resource = m_resources[command.resourceName].Get();
-            dimensions = std::vector<uint32_t>(command.dimensions);
+            dimensions = command.dimensions;
             tensorType = bufferDesc.initialValuesDataType;
         } 
         if (resource)
         {
-            fileDataStorage = m_device->Download(resource);
-            fileData = fileDataStorage;
+            downloadedData = m_device->DownloadMapped(resource);
+        }
+        else if (!downloadedData)
+        {
+            // The resource was never created (e.g. an unbound output), so there's nothing to write but an empty file.
+            downloadedData = std::make_shared<DownloadedBuffer>(std::vector<std::byte>());
         }
+        gsl::span<const std::byte> fileData = downloadedData->GetData();
+
+        // e.g. "targetPath": "outputs.npz:layer3.bias"
+        std::string_view archivePath, memberName;
+        bool isNpzMember = SplitNpzMemberPath(command.targetPath, /*out*/ archivePath, /*out*/ memberName);
 
-        std::filesystem::path pathToFile(command.targetPath.c_str());
+        std::filesystem::path pathToFile(isNpzMember ? std::string(archivePath) : command.targetPath);
         if (!std::filesystem::exists(pathToFile.parent_path()))
         {
             std::filesystem::create_directories(pathToFile.parent_path());
@@ -650,36 +1098,75 @@ void Executor::operator()(const Model::WriteFileCommand& command)
         std::string extension = pathToFile.extension().string();
         std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
 
-        // If NumPy array, serialize data into .npy file.
-        if (extension == ".npy")
+        // If NumPy array, serialize data into .npy file (or a member of an .npz archive).
+        if (extension == ".npy" || isNpzMember)
         {
             // If no dimensions were given, then treat as a 1D array.
             if (dimensions.empty())
             {
-                uint32_t elementCount = static_cast<uint32_t>(bufferDesc.sizeInBytes / Device::GetSizeInBytes(bufferDesc.initialValuesDataType));
+                uint64_t elementCount = bufferDesc.sizeInBytes / Device::GetSizeInBytes(bufferDesc.initialValuesDataType);
                 dimensions.push_back(elementCount);
             }
 
-            std::vector<std::byte> npyFileData;
-            WriteNpy(fileData, tensorType, dimensions, /*out*/ npyFileData);
-            std::swap(fileDataStorage, npyFileData);
-            fileData = fileDataStorage;
+            // The header is written first, followed by the array straight from the downloaded data.
+            std::vector<std::byte> npyHeader;
+            WriteNpyHeader(tensorType, dimensions, /*out*/ npyHeader);
 
-            std::ofstream file(command.targetPath.c_str(), std::ifstream::trunc | std::ifstream::binary);
-            if (!file.is_open())
+            if (isNpzMember)
             {
-                throw std::ios::failure("Could not open file");
-            }
+                WriteFileInBackground(command, downloadedData->GetData().size(), [pathToFile, memberName = std::string(memberName), npyHeader, downloadedData]()
+                {
+                    std::vector<std::byte> npyFileData;
+                    npyFileData.reserve(npyHeader.size() + downloadedData->GetData().size());
+                    npyFileData.insert(npyFileData.end(), npyHeader.begin(), npyHeader.end());
+                    npyFileData.insert(npyFileData.end(), downloadedData->GetData().begin(), downloadedData->GetData().end());
+
+                    // Other members of an existing archive are kept, so several commands can write to one archive.
+                    // A new member is appended in place, so only it and the central directory are written; the
+                    // archive is only rebuilt to replace a member. The mapping is closed before the file is written.
+                    std::vector<std::byte> archiveData;
+                    uint64_t appendOffset = 0;
+                    bool appended = false;
+                    if (std::filesystem::exists(pathToFile))
+                    {
+                        auto existingArchiveFile = MappedFile::Open(pathToFile);
+                        auto existingArchiveData = existingArchiveFile->GetData();
+                        appended = AppendNpzMember(existingArchiveData, memberName, npyFileData, /*out*/ appendOffset, /*out*/ archiveData);
+                        if (!appended)
+                        {
+                            AddNpzMember(existingArchiveData, memberName, npyFileData, /*out*/ archiveData);
+                        }
+                    }
+                    else
+                    {
+                        AddNpzMember({}, memberName, npyFileData, /*out*/ archiveData);
+                    }
 
-            file.write(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+                    if (appended)
+                    {
+                        WriteFileTail(pathToFile, appendOffset, archiveData);
+                    }
+                    else
+                    {
+                        WriteFileParts(pathToFile, { archiveData });
+                    }
+                });
+            }
+            else
+            {
+                WriteFileInBackground(command, downloadedData->GetData().size(), [pathToFile, npyHeader, downloadedData]()
+                {
+                    WriteFileParts(pathToFile, { npyHeader, downloadedData->GetData() });
+                });
+            }
         }
         else if (extension == ".jpg" || extension == ".png")
         {
             ImageTensorInfo tensorInfo = {};
             tensorInfo.dataType = tensorType;
-            tensorInfo.channels = dimensions.size() > 1 ? dimensions[1] : 1;
-            tensorInfo.height = dimensions.size() > 2 ? dimensions[2] : 1;
-            tensorInfo.width = dimensions.size() > 3 ? dimensions[3] : 1;
+            tensorInfo.channels = dimensions.size() > 1 ? gsl::narrow<uint32_t>(dimensions[1]) : 1;
+            tensorInfo.height = dimensions.size() > 2 ? gsl::narrow<uint32_t>(dimensions[2]) : 1;
+            tensorInfo.width = dimensions.size() > 3 ? gsl::narrow<uint32_t>(dimensions[3]) : 1;
             tensorInfo.sizeInBytes = static_cast<uint64_t>(fileData.size());
             tensorInfo.layout = ImageTensorLayout::NCHW;
             if (tensorInfo.channels == 1)
@@ -700,19 +1187,15 @@ void Executor::operator()(const Model::WriteFileCommand& command)
             }
 
             WriteTensorToImage(pathToFile, fileData, tensorInfo);
+            m_logger->LogInfo(fmt::format("Resource '{}' written to '{}'", command.resourceName, command.targetPath).c_str());
         }
         else // raw binary
         {
-            std::ofstream file(command.targetPath.c_str(), std::ifstream::trunc | std::ifstream::binary);
-            if (!file.is_open())
+            WriteFileInBackground(command, downloadedData->GetData().size(), [pathToFile, downloadedData]()
             {
-                throw std::ios::failure("Could not open file");
-            }
-
-            file.write(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+                WriteFileParts(pathToFile, { downloadedData->GetData() });
+            });
         }
-
-        m_logger->LogInfo(fmt::format("Resource '{}' written to '{}'", command.resourceName, command.targetPath).c_str());
     }
     catch (const std::exception& e)
     {
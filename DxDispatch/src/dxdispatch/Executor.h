@@ -1,11 +1,21 @@
 #pragma once
 
+#include "BackgroundFileWriter.h"
+#include "ResultsFile.h"
+
 class CommandLineArgs;
 
 class Executor
 {
 public:
-    Executor(Model& model, std::shared_ptr<Device> device, const CommandLineArgs& args, IDxDispatchLogger* logger);
+    Executor(
+        Model& model,
+        std::shared_ptr<Device> device,
+        const CommandLineArgs& args,
+        IDxDispatchLogger* logger,
+        std::shared_ptr<ResultsFile> resultsFile = nullptr,
+        std::optional<ResultsFile::RunInfo> runInfo = std::nullopt);
+    ~Executor();
 
     uint32_t GetCommandCount();
     void RunCommand(UINT32 id);
@@ -14,9 +24,21 @@ public:
     void operator()(const Model::PrintCommand& command);
     void operator()(const Model::WriteFileCommand& command);
 
+    // The number of dispatches that were significantly slower than in the baseline results (--baseline_file).
+    uint32_t GetRegressionCount() const { return m_regressionCount; }
+
 private:
     Dispatchable::Bindings ResolveBindings(const Model::Bindings& modelBindings);
 
+    // Queues a write of sizeInBytes bytes on the background file writer; its result is logged once the write completes.
+    void WriteFileInBackground(const Model::WriteFileCommand& command, uint64_t sizeInBytes, std::function<void()> write);
+    void LogFileWriteResults(const std::vector<BackgroundFileWriter::Result>& results);
+
+    // Compares a dispatch's hot timings with its baseline: GPU timings if both runs have them, else CPU timings.
+    // Baselines recorded with a different repeat count are skipped, since each of their samples timed a different
+    // amount of work; other differences from this run (model, adapter, driver, warmup) are reported.
+    void CompareWithBaseline(const std::string& dispatchName, const LatencyHistogram& cpuHot, const LatencyHistogram& gpuHot);
+
 private:
     Model& m_model;
     std::shared_ptr<Device> m_device;
@@ -25,5 +47,12 @@ private:
     std::unordered_map<std::string, Microsoft::WRL::ComPtr<ID3D12Resource>> m_resources;
     Dispatchable::DeferredBindings m_deferredBinding;
     Microsoft::WRL::ComPtr<IDxDispatchLogger> m_logger;
+    std::shared_ptr<ResultsFile> m_resultsFile;
+    std::optional<ResultsFile::RunInfo> m_runInfo;
+    std::unordered_map<std::string, ResultsFile::RecordedResult> m_baselineResults;
+    uint32_t m_regressionCount = 0;
     UINT32 m_nextId = 0;
+
+    // Declared last so that pending writes finish before anything else is destroyed.
+    BackgroundFileWriter m_fileWriter;
 };
\ No newline at end of file
@@ -371,8 +371,11 @@ void HlslDispatchable::CompileWithDxc()
         &psoDesc,
         IID_GRAPHICS_PPV_ARGS(m_pipelineState.ReleaseAndGetAddressOf())));
 
-    ComPtr<ID3D12DescriptorHeap> descriptorHeap;
-    // Create descriptor heaps (CSU + optional sampler)
+    CreateDescriptorHeaps();
+}
+
+void HlslDispatchable::CreateDescriptorHeaps()
+{
     uint32_t numCSU = 0; // CBV, SRV, UAV
     uint32_t numSamplers = 0;
     for (auto& kv : m_bindPoints)
@@ -422,6 +425,22 @@ void HlslDispatchable::Initialize()
 
 void HlslDispatchable::Bind(const Bindings& bindings, uint32_t iteration)
 {
+    // Dispatches recorded with the previously written descriptors may not have executed yet (--dispatch_batch,
+    // --frames_in_flight), so write into fresh heaps and keep the old ones alive until those dispatches finish.
+    if (m_descriptorsWritten)
+    {
+        if (m_descriptorHeap)
+        {
+            m_device->KeepAliveUntilNextCommandListDispatch(std::move(m_descriptorHeap));
+        }
+        if (m_samplerDescriptorHeap)
+        {
+            m_device->KeepAliveUntilNextCommandListDispatch(std::move(m_samplerDescriptorHeap));
+        }
+        CreateDescriptorHeaps();
+    }
+    m_descriptorsWritten = true;
+
     uint32_t descriptorIncrementSizeCSU = m_device->D3D()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
     uint32_t descriptorIncrementSizeSampler = m_device->D3D()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
 
@@ -658,6 +677,11 @@ void HlslDispatchable::Bind(const Bindings& bindings, uint32_t iteration)
 
 void HlslDispatchable::Dispatch(const Model::DispatchCommand& args, uint32_t iteration, DeferredBindings& deferredBinings)
 {
-    m_device->RecordDispatch(args.dispatchableName.c_str(), args.threadGroupCount[0], args.threadGroupCount[1], args.threadGroupCount[2]);
+    RecordDispatch(args, iteration);
     m_device->ExecuteCommandListAndWait();
+}
+
+void HlslDispatchable::RecordDispatch(const Model::DispatchCommand& args, uint32_t iteration)
+{
+    m_device->RecordDispatch(args.dispatchableName.c_str(), args.threadGroupCount[0], args.threadGroupCount[1], args.threadGroupCount[2]);
 }
\ No newline at end of file
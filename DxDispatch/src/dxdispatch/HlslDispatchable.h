@@ -10,6 +10,8 @@ public:
     void Initialize() final;
     void Bind(const Bindings& bindings, uint32_t iteration) final;
     void Dispatch(const Model::DispatchCommand& args, uint32_t iteration, DeferredBindings& deferredBinings) final;
+    bool SupportsBatchedDispatch() const final { return true; }
+    void RecordDispatch(const Model::DispatchCommand& args, uint32_t iteration) final;
 
     enum class BufferViewType
     {
@@ -33,6 +35,7 @@ public:
 private:
     void CompileWithDxc();
     void CreateRootSignatureAndBindingMap();
+    void CreateDescriptorHeaps();
 
 private:
     std::shared_ptr<Device> m_device;
@@ -46,6 +49,7 @@ private:
     Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_descriptorHeap;
     // Separate heap for samplers (D3D12 requires distinct heap type)
     Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_samplerDescriptorHeap;
+    bool m_descriptorsWritten = false;
     std::unordered_map<std::string, BindPoint> m_bindPoints;
     bool m_printHlslDisassembly = false;
     Microsoft::WRL::ComPtr<IDxDispatchLogger> m_logger;
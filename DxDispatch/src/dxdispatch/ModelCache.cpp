@@ -0,0 +1,1263 @@
+#include "pch.h"
+#include "Model.h"
+#include "JsonParsers.h"
+#include "ModelCache.h"
+#include "ContentHasher.h"
+
+#include <set>
+
+#ifdef WIN32
+#include <wil/resource.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Bump this whenever the layout of the cache file or of the Model structs changes.
+constexpr uint32_t c_modelCacheVersion = 6;
+constexpr uint32_t c_modelCacheMagic = 0x434D5844; // 'DXMC'
+constexpr size_t c_arenaAlignment = 4096;
+constexpr size_t c_regionAlignment = 16;
+
+struct ModelCacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pointerSizeInBytes;
+    uint32_t reserved;
+    uint64_t key;
+    uint64_t payloadOffset;
+    uint64_t payloadSizeInBytes;
+    uint64_t relocationsOffset;
+    uint64_t relocationCount;
+    uint64_t arenaOffset;
+    uint64_t arenaSizeInBytes;
+};
+
+static size_t RoundUpToMultiple(size_t value, size_t multiple)
+{
+    size_t remainder = value % multiple;
+    return remainder ? value + multiple - remainder : value;
+}
+
+// ----------------------------------------------------------------------------
+// DEPENDENCIES
+// ----------------------------------------------------------------------------
+
+struct FileDependency
+{
+    std::filesystem::path path;
+    uint64_t sizeInBytes;
+    uint64_t contentHash;
+};
+
+// A file is identified by its contents rather than its last write time, which isn't preserved by every copy
+// or checkout and may not change at all if a file is rewritten quickly enough.
+static std::optional<FileDependency> GetFileDependency(const std::filesystem::path& path)
+{
+    ContentHasher hasher;
+    auto sizeInBytes = hasher.AppendFile(path);
+    if (!sizeInBytes)
+    {
+        return std::nullopt;
+    }
+
+    return FileDependency{ path, *sizeInBytes, hasher.Value() };
+}
+
+static bool IsFileDependencyUnchanged(const FileDependency& dependency)
+{
+    // Comparing sizes first avoids reading a file that has obviously changed.
+    std::error_code error;
+    auto sizeInBytes = std::filesystem::file_size(dependency.path, error);
+    if (error || sizeInBytes != dependency.sizeInBytes)
+    {
+        return false;
+    }
+
+    auto current = GetFileDependency(dependency.path);
+    return current && current->sizeInBytes == dependency.sizeInBytes && current->contentHash == dependency.contentHash;
+}
+
+// A batch of images read from a directory or wildcard pattern also depends on which images it matches: each
+// image is a FileDependency, but an image added to the directory (or one that no longer matches) is only
+// noticed by listing it again.
+struct ImageBatchDependency
+{
+    std::filesystem::path sourcePath;
+    uint64_t listingHash;
+};
+
+static std::optional<ImageBatchDependency> GetImageBatchDependency(const std::filesystem::path& sourcePath)
+{
+    std::vector<std::filesystem::path> imagePaths;
+    try
+    {
+        imagePaths = JsonParsers::ListImageBatchPaths({}, sourcePath.string());
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+
+    ContentHasher hasher;
+    for (auto& imagePath : imagePaths)
+    {
+        hasher.Append(imagePath.u8string());
+    }
+    return ImageBatchDependency{ sourcePath, hasher.Value() };
+}
+
+// ----------------------------------------------------------------------------
+// ARENA IMAGE
+// ----------------------------------------------------------------------------
+
+// A copy of every region allocated by a model's BucketAllocator, concatenated into a single blob. Pointers
+// inside the DML operator descs are rewritten as offsets into the blob, and the location of each rewritten
+// pointer is recorded so it can be turned back into an address once the blob is mapped again.
+class ArenaImage
+{
+public:
+    explicit ArenaImage(const BucketAllocator& allocator)
+    {
+        for (auto region : allocator.GetAllocatedRegions())
+        {
+            size_t offset = RoundUpToMultiple(m_data.size(), c_regionAlignment);
+            m_regions.push_back({ region.data(), region.size(), offset });
+            m_data.resize(offset + region.size());
+            std::copy(region.begin(), region.end(), m_data.begin() + offset);
+        }
+    }
+
+    gsl::span<const std::byte> Data() const { return m_data; }
+    const std::set<uint64_t>& Relocations() const { return m_relocations; }
+
+    // Records an operator desc (including all of its tensors and nested operators) and returns its offset.
+    uint64_t AddOperatorDesc(const DML_OPERATOR_DESC* desc)
+    {
+        RelocateOperatorDesc(desc);
+        return OffsetOf(desc);
+    }
+
+private:
+    struct Region
+    {
+        const std::byte* begin;
+        size_t sizeInBytes;
+        size_t offset;
+    };
+
+    uint64_t OffsetOf(const void* address) const
+    {
+        auto bytes = static_cast<const std::byte*>(address);
+        for (auto& region : m_regions)
+        {
+            if (bytes >= region.begin && bytes < region.begin + region.sizeInBytes)
+            {
+                return region.offset + (bytes - region.begin);
+            }
+        }
+        throw std::invalid_argument("Operator desc references memory outside of the model's allocator");
+    }
+
+    template <typename T>
+    T ReadPointer(const void* slot) const
+    {
+        T value;
+        memcpy(&value, slot, sizeof(value));
+        return value;
+    }
+
+    void RelocatePointer(const void* slot)
+    {
+        auto target = ReadPointer<const void*>(slot);
+        if (!target)
+        {
+            return;
+        }
+
+        uint64_t slotOffset = OffsetOf(slot);
+        if (!m_relocations.insert(slotOffset).second)
+        {
+            return;
+        }
+
+        auto targetOffset = static_cast<uintptr_t>(OffsetOf(target));
+        memcpy(m_data.data() + slotOffset, &targetOffset, sizeof(targetOffset));
+    }
+
+    void RelocateTensorDesc(const DML_TENSOR_DESC* desc)
+    {
+        if (desc->Type != DML_TENSOR_TYPE_BUFFER)
+        {
+            throw std::invalid_argument("Only buffer tensor descs can be cached");
+        }
+
+        RelocatePointer(&desc->Desc);
+        auto bufferDesc = static_cast<const DML_BUFFER_TENSOR_DESC*>(desc->Desc);
+        if (bufferDesc)
+        {
+            RelocatePointer(&bufferDesc->Sizes);
+            RelocatePointer(&bufferDesc->Strides);
+        }
+    }
+
+    // Walks the raw operator desc struct using the same layout rules as SchemaHelpers::StructFieldWriter.
+    void RelocateOperatorDesc(const DML_OPERATOR_DESC* desc)
+    {
+        RelocatePointer(&desc->Desc);
+
+        AbstractOperatorDesc abstractDesc = SchemaHelpers::ConvertOperatorDesc(*desc);
+        auto structBase = static_cast<const std::byte*>(desc->Desc);
+        size_t fieldOffset = 0;
+
+        for (const OperatorField& field : abstractDesc.fields)
+        {
+            auto [fieldSize, fieldAlignment] = GetFieldLayout(field.GetSchema()->Type);
+            fieldOffset = RoundUpToMultiple(fieldOffset, fieldAlignment);
+            const std::byte* slot = structBase + fieldOffset;
+            fieldOffset += fieldSize;
+
+            switch (field.GetSchema()->Type)
+            {
+            case DML_SCHEMA_FIELD_TYPE_TENSOR_DESC:
+            {
+                RelocatePointer(slot);
+                if (auto tensor = ReadPointer<const DML_TENSOR_DESC*>(slot))
+                {
+                    RelocateTensorDesc(tensor);
+                }
+            } break;
+
+            case DML_SCHEMA_FIELD_TYPE_TENSOR_DESC_ARRAY:
+            {
+                RelocatePointer(slot);
+                auto tensors = ReadPointer<const DML_TENSOR_DESC*>(slot);
+                size_t count = field.AsTensorDescArray() ? field.AsTensorDescArray()->size() : 0;
+                for (size_t i = 0; tensors && i < count; i++)
+                {
+                    RelocateTensorDesc(&tensors[i]);
+                }
+            } break;
+
+            case DML_SCHEMA_FIELD_TYPE_OPERATOR_DESC:
+            {
+                RelocatePointer(slot);
+                if (auto op = ReadPointer<const DML_OPERATOR_DESC*>(slot))
+                {
+                    RelocateOperatorDesc(op);
+                }
+            } break;
+
+            case DML_SCHEMA_FIELD_TYPE_OPERATOR_DESC_ARRAY:
+            {
+                RelocatePointer(slot);
+                auto ops = ReadPointer<const DML_OPERATOR_DESC*>(slot);
+                size_t count = field.AsFusedActivationOperatorDescArray() ? field.AsFusedActivationOperatorDescArray()->size() : 0;
+                for (size_t i = 0; ops && i < count; i++)
+                {
+                    RelocateOperatorDesc(&ops[i]);
+                }
+            } break;
+
+            case DML_SCHEMA_FIELD_TYPE_UINT_ARRAY:
+            case DML_SCHEMA_FIELD_TYPE_INT_ARRAY:
+            case DML_SCHEMA_FIELD_TYPE_FLOAT_ARRAY:
+            case DML_SCHEMA_FIELD_TYPE_SCALE_BIAS:
+                RelocatePointer(slot);
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    static std::pair<size_t, size_t> GetFieldLayout(DML_SCHEMA_FIELD_TYPE type)
+    {
+        switch (type)
+        {
+        case DML_SCHEMA_FIELD_TYPE_UINT:
+        case DML_SCHEMA_FIELD_TYPE_INT:
+        case DML_SCHEMA_FIELD_TYPE_FLOAT:
+        case DML_SCHEMA_FIELD_TYPE_BOOL:            return { sizeof(UINT), alignof(UINT) };
+        case DML_SCHEMA_FIELD_TYPE_UINT64:          return { sizeof(UINT64), alignof(UINT64) };
+        case DML_SCHEMA_FIELD_TYPE_SIZE_2D:         return { sizeof(DML_SIZE_2D), alignof(DML_SIZE_2D) };
+        case DML_SCHEMA_FIELD_TYPE_SCALAR_UNION:    return { sizeof(DML_SCALAR_UNION), alignof(DML_SCALAR_UNION) };
+        default:                                    return { sizeof(void*), alignof(void*) };
+        }
+    }
+
+private:
+    std::vector<std::byte> m_data;
+    std::vector<Region> m_regions;
+    std::set<uint64_t> m_relocations;
+};
+
+// ----------------------------------------------------------------------------
+// SERIALIZATION
+// ----------------------------------------------------------------------------
+
+class BinaryWriter
+{
+public:
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto bytes = reinterpret_cast<const std::byte*>(&value);
+        m_data.insert(m_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T>
+    void WriteVector(gsl::span<const T> values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Write<uint64_t>(values.size());
+        auto bytes = reinterpret_cast<const std::byte*>(values.data());
+        m_data.insert(m_data.end(), bytes, bytes + values.size_bytes());
+    }
+
+    void WriteString(std::string_view value)
+    {
+        WriteVector(gsl::make_span(value.data(), value.size()));
+    }
+
+    void WritePath(const std::filesystem::path& value)
+    {
+        WriteString(value.u8string());
+    }
+
+    std::vector<std::byte>& Data() { return m_data; }
+
+private:
+    std::vector<std::byte> m_data;
+};
+
+class BinaryReader
+{
+public:
+    explicit BinaryReader(gsl::span<const std::byte> data) : m_data(data) {}
+
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        memcpy(&value, Take(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> ReadVector()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto count = Read<uint64_t>();
+        if (count > m_data.size() / sizeof(T))
+        {
+            throw std::invalid_argument("Model cache is truncated");
+        }
+        auto bytes = Take(count * sizeof(T));
+        std::vector<T> values(count);
+        memcpy(values.data(), bytes.data(), bytes.size());
+        return values;
+    }
+
+    std::string ReadString()
+    {
+        auto chars = ReadVector<char>();
+        return std::string(chars.begin(), chars.end());
+    }
+
+    std::filesystem::path ReadPath()
+    {
+        return std::filesystem::u8path(ReadString());
+    }
+
+private:
+    gsl::span<const std::byte> Take(size_t sizeInBytes)
+    {
+        if (m_offset + sizeInBytes > m_data.size())
+        {
+            throw std::invalid_argument("Model cache is truncated");
+        }
+        auto bytes = m_data.subspan(m_offset, sizeInBytes);
+        m_offset += sizeInBytes;
+        return bytes;
+    }
+
+    gsl::span<const std::byte> m_data;
+    size_t m_offset = 0;
+};
+
+static void WriteBindings(BinaryWriter& writer, const Model::Bindings& bindings)
+{
+    writer.Write<uint64_t>(bindings.size());
+    for (auto& [name, sources] : bindings)
+    {
+        writer.WriteString(name);
+        writer.Write<uint64_t>(sources.size());
+        for (auto& source : sources)
+        {
+            writer.WriteString(source.name);
+            writer.Write(source.elementCount);
+            writer.Write(source.elementSizeInBytes);
+            writer.Write(source.elementOffset);
+            writer.Write(source.format.has_value());
+            writer.Write(source.format.value_or(DXGI_FORMAT_UNKNOWN));
+            writer.Write(source.counterName.has_value());
+            writer.WriteString(source.counterName.value_or(""));
+            writer.Write(source.counterOffsetBytes);
+            writer.WriteVector<int64_t>(source.shape);
+        }
+    }
+}
+
+static Model::Bindings ReadBindings(BinaryReader& reader)
+{
+    Model::Bindings bindings;
+    auto bindingCount = reader.Read<uint64_t>();
+    for (uint64_t i = 0; i < bindingCount; i++)
+    {
+        auto& sources = bindings[reader.ReadString()];
+        sources.resize(reader.Read<uint64_t>());
+        for (auto& source : sources)
+        {
+            source.name = reader.ReadString();
+            source.elementCount = reader.Read<uint64_t>();
+            source.elementSizeInBytes = reader.Read<uint64_t>();
+            source.elementOffset = reader.Read<uint64_t>();
+            bool hasFormat = reader.Read<bool>();
+            auto format = reader.Read<DXGI_FORMAT>();
+            if (hasFormat) { source.format = format; }
+            bool hasCounterName = reader.Read<bool>();
+            auto counterName = reader.ReadString();
+            if (hasCounterName) { source.counterName = counterName; }
+            source.counterOffsetBytes = reader.Read<uint64_t>();
+            source.shape = reader.ReadVector<int64_t>();
+        }
+    }
+    return bindings;
+}
+
+static void WriteStringPairs(BinaryWriter& writer, gsl::span<const std::pair<std::string, std::string>> pairs)
+{
+    writer.Write<uint64_t>(pairs.size());
+    for (auto& [key, value] : pairs)
+    {
+        writer.WriteString(key);
+        writer.WriteString(value);
+    }
+}
+
+static void WriteStringUIntPairs(BinaryWriter& writer, gsl::span<const std::pair<std::string, uint32_t>> pairs)
+{
+    writer.Write<uint64_t>(pairs.size());
+    for (auto& [key, value] : pairs)
+    {
+        writer.WriteString(key);
+        writer.Write(value);
+    }
+}
+
+static std::vector<std::pair<std::string, std::string>> ReadStringPairs(BinaryReader& reader)
+{
+    std::vector<std::pair<std::string, std::string>> pairs(reader.Read<uint64_t>());
+    for (auto& [key, value] : pairs)
+    {
+        key = reader.ReadString();
+        value = reader.ReadString();
+    }
+    return pairs;
+}
+
+static std::vector<std::pair<std::string, uint32_t>> ReadStringUIntPairs(BinaryReader& reader)
+{
+    std::vector<std::pair<std::string, uint32_t>> pairs(reader.Read<uint64_t>());
+    for (auto& [key, value] : pairs)
+    {
+        key = reader.ReadString();
+        value = reader.Read<uint32_t>();
+    }
+    return pairs;
+}
+
+static void WriteBindPoints(BinaryWriter& writer, const std::vector<Model::DmlDispatchableDesc::BindPoint>& bindPoints)
+{
+    writer.Write<uint64_t>(bindPoints.size());
+    for (auto& bindPoint : bindPoints)
+    {
+        writer.WriteString(bindPoint.name);
+        writer.Write(bindPoint.resourceCount);
+        writer.Write(bindPoint.required);
+        writer.Write(bindPoint.requiredBinding);
+    }
+}
+
+static std::vector<Model::DmlDispatchableDesc::BindPoint> ReadBindPoints(BinaryReader& reader)
+{
+    std::vector<Model::DmlDispatchableDesc::BindPoint> bindPoints(reader.Read<uint64_t>());
+    for (auto& bindPoint : bindPoints)
+    {
+        bindPoint.name = reader.ReadString();
+        bindPoint.resourceCount = reader.Read<uint32_t>();
+        bindPoint.required = reader.Read<bool>();
+        bindPoint.requiredBinding = reader.Read<bool>();
+    }
+    return bindPoints;
+}
+
+// How a buffer's initial values are stored in the cache file.
+enum class InitialValuesStorage : uint32_t
+{
+    // The bytes are written into the cache file.
+    Inline,
+
+    // The bytes are those of an earlier buffer (see ShareIdenticalInitialValues), stored as its resource index.
+    SharedWithResource,
+
+    // The bytes are a range of a dependency (e.g. a .npy file), stored as the dependency's index, an offset, and
+    // a size. The range is mapped again when the model is loaded, so the data is never copied into the cache.
+    FileRange,
+};
+
+static void WriteModel(
+    BinaryWriter& writer, 
+    const Model& model, 
+    gsl::span<const FileDependency> dependencies, 
+    gsl::span<const ImageBatchDependency> imageBatchDependencies, 
+    ArenaImage& arena)
+{
+    writer.Write<uint64_t>(dependencies.size());
+    std::map<std::filesystem::path, uint64_t> dependencyIndices;
+    for (auto& dependency : dependencies)
+    {
+        writer.WritePath(dependency.path);
+        writer.Write(dependency.sizeInBytes);
+        writer.Write(dependency.contentHash);
+        dependencyIndices.emplace(dependency.path, dependencyIndices.size());
+    }
+
+    writer.Write<uint64_t>(imageBatchDependencies.size());
+    for (auto& dependency : imageBatchDependencies)
+    {
+        writer.WritePath(dependency.sourcePath);
+        writer.Write(dependency.listingHash);
+    }
+
+    std::unordered_map<const std::byte*, uint64_t> sharedInitialValues;
+
+    writer.Write<uint64_t>(model.GetResourceDescs().size());
+    for (uint64_t resourceIndex = 0; resourceIndex < model.GetResourceDescs().size(); resourceIndex++)
+    {
+        auto& resourceDesc = model.GetResourceDescs()[resourceIndex];
+        writer.WriteString(resourceDesc.name);
+        writer.Write<uint32_t>(static_cast<uint32_t>(resourceDesc.value.index()));
+
+        if (auto buffer = std::get_if<Model::BufferDesc>(&resourceDesc.value))
+        {
+            writer.Write(buffer->sizeInBytes);
+
+            if (auto& file = buffer->initialValues.GetFile())
+            {
+                auto dependency = dependencyIndices.find(file->GetPath());
+                if (dependency == dependencyIndices.end())
+                {
+                    throw std::invalid_argument(fmt::format("'{}' is not a dependency of the model", file->GetPath().string()));
+                }
+                writer.Write(InitialValuesStorage::FileRange);
+                writer.Write(dependency->second);
+                writer.Write(static_cast<uint64_t>(buffer->initialValues.data() - file->GetData().data()));
+                writer.Write<uint64_t>(buffer->initialValues.size());
+            }
+            else
+            {
+                std::optional<uint64_t> sharedWith;
+                if (!buffer->initialValues.empty())
+                {
+                    auto [entry, inserted] = sharedInitialValues.emplace(buffer->initialValues.data(), resourceIndex);
+                    auto& firstBuffer = std::get<Model::BufferDesc>(model.GetResourceDescs()[entry->second].value);
+                    if (!inserted && firstBuffer.initialValues.SharesBytesWith(buffer->initialValues))
+                    {
+                        sharedWith = entry->second;
+                    }
+                }
+
+                if (sharedWith)
+                {
+                    writer.Write(InitialValuesStorage::SharedWithResource);
+                    writer.Write(*sharedWith);
+                }
+                else
+                {
+                    writer.Write(InitialValuesStorage::Inline);
+                    writer.WriteVector<std::byte>(buffer->initialValues);
+                }
+            }
+            writer.Write(buffer->initialValuesDataType);
+            writer.Write(buffer->initialValuesOffsetInBytes);
+            writer.Write(buffer->useDeferredBinding);
+            writer.WritePath(buffer->sourcePath);
+            writer.Write<uint64_t>(buffer->sourceImagePaths.size());
+            for (auto& imagePath : buffer->sourceImagePaths)
+            {
+                writer.WritePath(imagePath);
+            }
+        }
+        else if (auto texture = std::get_if<Model::TextureDesc>(&resourceDesc.value))
+        {
+            writer.Write(texture->width);
+            writer.Write(texture->height);
+            writer.Write(texture->format);
+            writer.WriteVector<std::byte>(texture->initialData);
+            writer.Write(texture->useDeferredBinding);
+            writer.WritePath(texture->sourcePath);
+        }
+        else
+        {
+            writer.Write(std::get<Model::SamplerDesc>(resourceDesc.value));
+        }
+    }
+
+    writer.Write<uint64_t>(model.GetDispatchableDescs().size());
+    for (auto& dispatchableDesc : model.GetDispatchableDescs())
+    {
+        writer.WriteString(dispatchableDesc.name);
+        writer.Write<uint32_t>(static_cast<uint32_t>(dispatchableDesc.value.index()));
+
+        if (auto dml = std::get_if<Model::DmlDispatchableDesc>(&dispatchableDesc.value))
+        {
+            writer.Write(arena.AddOperatorDesc(dml->desc));
+            WriteBindPoints(writer, dml->bindPoints.inputs);
+            WriteBindPoints(writer, dml->bindPoints.outputs);
+            writer.Write(dml->executionFlags);
+            writer.Write(dml->compileType);
+            WriteBindings(writer, dml->initBindings);
+        }
+        else if (auto hlsl = std::get_if<Model::HlslDispatchableDesc>(&dispatchableDesc.value))
+        {
+            writer.WritePath(hlsl->sourcePath);
+            writer.Write(hlsl->compiler);
+            writer.Write<uint64_t>(hlsl->compilerArgs.size());
+            for (auto& arg : hlsl->compilerArgs)
+            {
+                writer.WriteString(arg);
+            }
+        }
+        else if (auto onnx = std::get_if<Model::OnnxDispatchableDesc>(&dispatchableDesc.value))
+        {
+            writer.WritePath(onnx->sourcePath);
+            WriteStringUIntPairs(writer, onnx->freeDimNameOverrides);
+            WriteStringUIntPairs(writer, onnx->freeDimDenotationOverrides);
+            WriteStringPairs(writer, onnx->sessionOptionsConfigEntries);
+            writer.Write(onnx->graphOptimizationLevel);
+            writer.Write(onnx->loggingLevel);
+        }
+        else
+        {
+            auto& graph = std::get<Model::DmlSerializedGraphDispatchableDesc>(dispatchableDesc.value);
+            writer.WritePath(graph.sourcePath);
+            writer.Write(graph.executionFlags);
+            WriteBindings(writer, graph.initBindings);
+        }
+    }
+
+    writer.Write<uint64_t>(model.GetCommands().size());
+    for (auto& commandDesc : model.GetCommands())
+    {
+        writer.WriteString(commandDesc.type);
+        writer.WriteString(commandDesc.parameters);
+        writer.Write<uint32_t>(static_cast<uint32_t>(commandDesc.command.index()));
+
+        if (auto dispatch = std::get_if<Model::DispatchCommand>(&commandDesc.command))
+        {
+            writer.WriteString(dispatch->dispatchableName);
+            WriteBindings(writer, dispatch->bindings);
+            writer.Write(dispatch->threadGroupCount);
+        }
+        else if (auto print = std::get_if<Model::PrintCommand>(&commandDesc.command))
+        {
+            writer.WriteString(print->resourceName);
+            writer.Write(print->verbose);
+        }
+        else
+        {
+            auto& writeFile = std::get<Model::WriteFileCommand>(commandDesc.command);
+            writer.WriteString(writeFile.resourceName);
+            writer.WriteString(writeFile.targetPath);
+            writer.WriteVector<uint64_t>(writeFile.dimensions);
+        }
+    }
+}
+
+static std::vector<FileDependency> ReadDependencies(BinaryReader& reader, /*out*/ std::vector<ImageBatchDependency>& imageBatchDependencies)
+{
+    std::vector<FileDependency> dependencies(reader.Read<uint64_t>());
+    for (auto& dependency : dependencies)
+    {
+        dependency.path = reader.ReadPath();
+        dependency.sizeInBytes = reader.Read<uint64_t>();
+        dependency.contentHash = reader.Read<uint64_t>();
+    }
+
+    imageBatchDependencies.resize(reader.Read<uint64_t>());
+    for (auto& dependency : imageBatchDependencies)
+    {
+        dependency.sourcePath = reader.ReadPath();
+        dependency.listingHash = reader.Read<uint64_t>();
+    }
+    return dependencies;
+}
+
+// Reads everything after the dependencies, which must already be validated. The arena must already be relocated.
+static Model ReadModel(
+    BinaryReader& reader, 
+    gsl::span<const FileDependency> dependencies, 
+    std::byte* arena, 
+    uint64_t arenaSizeInBytes, 
+    BucketAllocator&& allocator)
+{
+    // Each dependency is mapped at most once, so buffers that shared a file's bytes when the model was parsed
+    // share them again.
+    std::unordered_map<uint64_t, std::shared_ptr<MappedFile>> mappedFiles;
+
+    std::vector<Model::ResourceDesc> resourceDescs(reader.Read<uint64_t>());
+    for (uint64_t resourceIndex = 0; resourceIndex < resourceDescs.size(); resourceIndex++)
+    {
+        auto& resourceDesc = resourceDescs[resourceIndex];
+        resourceDesc.name = reader.ReadString();
+        switch (reader.Read<uint32_t>())
+        {
+        case 0:
+        {
+            Model::BufferDesc buffer;
+            buffer.sizeInBytes = reader.Read<uint64_t>();
+            switch (reader.Read<InitialValuesStorage>())
+            {
+            case InitialValuesStorage::Inline:
+                buffer.initialValues = reader.ReadVector<std::byte>();
+                break;
+
+            case InitialValuesStorage::SharedWithResource:
+            {
+                auto sharedWith = reader.Read<uint64_t>();
+                if (sharedWith >= resourceIndex || !std::holds_alternative<Model::BufferDesc>(resourceDescs[sharedWith].value))
+                {
+                    throw std::invalid_argument("Model cache contains an invalid shared buffer index");
+                }
+                buffer.initialValues = std::get<Model::BufferDesc>(resourceDescs[sharedWith].value).initialValues;
+            } break;
+
+            case InitialValuesStorage::FileRange:
+            {
+                auto dependencyIndex = reader.Read<uint64_t>();
+                auto offset = reader.Read<uint64_t>();
+                auto sizeInBytes = reader.Read<uint64_t>();
+                if (dependencyIndex >= dependencies.size())
+                {
+                    throw std::invalid_argument("Model cache contains an invalid dependency index");
+                }
+
+                auto& file = mappedFiles[dependencyIndex];
+                if (!file)
+                {
+                    file = MappedFile::Open(dependencies[dependencyIndex].path);
+                }
+                auto fileSize = file->GetData().size();
+                if (offset > fileSize || sizeInBytes > fileSize - offset)
+                {
+                    throw std::invalid_argument(fmt::format("'{}' is smaller than when it was cached", file->GetPath().string()));
+                }
+                buffer.initialValues = ByteBuffer(file, static_cast<size_t>(offset), static_cast<size_t>(sizeInBytes));
+            } break;
+
+            default:
+                throw std::invalid_argument("Model cache contains an unknown initial values storage");
+            }
+            buffer.initialValuesDataType = reader.Read<DML_TENSOR_DATA_TYPE>();
+            buffer.initialValuesOffsetInBytes = reader.Read<uint64_t>();
+            buffer.useDeferredBinding = reader.Read<bool>();
+            buffer.sourcePath = reader.ReadPath();
+            buffer.sourceImagePaths.resize(reader.Read<uint64_t>());
+            for (auto& imagePath : buffer.sourceImagePaths)
+            {
+                imagePath = reader.ReadPath();
+            }
+            resourceDesc.value = std::move(buffer);
+        } break;
+
+        case 1:
+        {
+            Model::TextureDesc texture;
+            texture.width = reader.Read<uint32_t>();
+            texture.height = reader.Read<uint32_t>();
+            texture.format = reader.Read<DXGI_FORMAT>();
+            texture.initialData = reader.ReadVector<std::byte>();
+            texture.useDeferredBinding = reader.Read<bool>();
+            texture.sourcePath = reader.ReadPath();
+            resourceDesc.value = std::move(texture);
+        } break;
+
+        case 2:
+            resourceDesc.value = reader.Read<Model::SamplerDesc>();
+            break;
+
+        default:
+            throw std::invalid_argument("Model cache contains an unknown resource type");
+        }
+    }
+
+    std::vector<Model::DispatchableDesc> dispatchableDescs(reader.Read<uint64_t>());
+    for (auto& dispatchableDesc : dispatchableDescs)
+    {
+        dispatchableDesc.name = reader.ReadString();
+        switch (reader.Read<uint32_t>())
+        {
+        case 0:
+        {
+            Model::DmlDispatchableDesc dml;
+            auto descOffset = reader.Read<uint64_t>();
+            if (descOffset + sizeof(DML_OPERATOR_DESC) > arenaSizeInBytes)
+            {
+                throw std::invalid_argument("Model cache contains an invalid operator desc offset");
+            }
+            dml.desc = reinterpret_cast<DML_OPERATOR_DESC*>(arena + descOffset);
+            dml.bindPoints.inputs = ReadBindPoints(reader);
+            dml.bindPoints.outputs = ReadBindPoints(reader);
+            dml.executionFlags = reader.Read<DML_EXECUTION_FLAGS>();
+            dml.compileType = reader.Read<Model::DmlDispatchableDesc::DmlCompileType>();
+            dml.initBindings = ReadBindings(reader);
+            dispatchableDesc.value = std::move(dml);
+        } break;
+
+        case 1:
+        {
+            Model::HlslDispatchableDesc hlsl;
+            hlsl.sourcePath = reader.ReadPath();
+            hlsl.compiler = reader.Read<Model::HlslDispatchableDesc::Compiler>();
+            hlsl.compilerArgs.resize(reader.Read<uint64_t>());
+            for (auto& arg : hlsl.compilerArgs)
+            {
+                arg = reader.ReadString();
+            }
+            dispatchableDesc.value = std::move(hlsl);
+        } break;
+
+        case 2:
+        {
+            Model::OnnxDispatchableDesc onnx;
+            onnx.sourcePath = reader.ReadPath();
+            onnx.freeDimNameOverrides = ReadStringUIntPairs(reader);
+            onnx.freeDimDenotationOverrides = ReadStringUIntPairs(reader);
+            onnx.sessionOptionsConfigEntries = ReadStringPairs(reader);
+            onnx.graphOptimizationLevel = reader.Read<uint32_t>();
+            onnx.loggingLevel = reader.Read<uint32_t>();
+            dispatchableDesc.value = std::move(onnx);
+        } break;
+
+        case 3:
+        {
+            Model::DmlSerializedGraphDispatchableDesc graph;
+            graph.sourcePath = reader.ReadPath();
+            graph.executionFlags = reader.Read<DML_EXECUTION_FLAGS>();
+            graph.initBindings = ReadBindings(reader);
+            dispatchableDesc.value = std::move(graph);
+        } break;
+
+        default:
+            throw std::invalid_argument("Model cache contains an unknown dispatchable type");
+        }
+    }
+
+    std::vector<Model::CommandDesc> commands(reader.Read<uint64_t>());
+    for (auto& commandDesc : commands)
+    {
+        commandDesc.type = reader.ReadString();
+        commandDesc.parameters = reader.ReadString();
+        switch (reader.Read<uint32_t>())
+        {
+        case 0:
+        {
+            Model::DispatchCommand dispatch;
+            dispatch.dispatchableName = reader.ReadString();
+            dispatch.bindings = ReadBindings(reader);
+            dispatch.threadGroupCount = reader.Read<std::array<uint32_t, 3>>();
+            commandDesc.command = std::move(dispatch);
+        } break;
+
+        case 1:
+        {
+            Model::PrintCommand print;
+            print.resourceName = reader.ReadString();
+            print.verbose = reader.Read<bool>();
+            commandDesc.command = std::move(print);
+        } break;
+
+        case 2:
+        {
+            Model::WriteFileCommand writeFile;
+            writeFile.resourceName = reader.ReadString();
+            writeFile.targetPath = reader.ReadString();
+            writeFile.dimensions = reader.ReadVector<uint64_t>();
+            commandDesc.command = std::move(writeFile);
+        } break;
+
+        default:
+            throw std::invalid_argument("Model cache contains an unknown command type");
+        }
+    }
+
+    return Model(std::move(resourceDescs), std::move(dispatchableDescs), std::move(commands), std::move(allocator));
+}
+
+// ----------------------------------------------------------------------------
+// FILE MAPPING
+// ----------------------------------------------------------------------------
+
+// A copy-on-write view of an entire file. Writes (e.g. relocations) are never flushed back to the file.
+class PrivateFileView
+{
+public:
+    PrivateFileView() = default;
+    PrivateFileView(const PrivateFileView&) = delete;
+    PrivateFileView& operator=(const PrivateFileView&) = delete;
+
+    ~PrivateFileView()
+    {
+        if (m_data)
+        {
+#ifdef WIN32
+            (void)UnmapViewOfFile(m_data);
+#else
+            (void)munmap(m_data, m_sizeInBytes);
+#endif
+        }
+    }
+
+    // Returns false if the file doesn't exist or can't be mapped.
+    bool Map(const std::filesystem::path& path)
+    {
+#ifdef WIN32
+        wil::unique_hfile file(CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+        if (!file)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file.get(), &fileSize) || fileSize.QuadPart == 0)
+        {
+            return false;
+        }
+
+        wil::unique_handle mapping(CreateFileMappingW(file.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+        if (!mapping)
+        {
+            return false;
+        }
+
+        m_data = MapViewOfFile(mapping.get(), FILE_MAP_COPY, 0, 0, 0);
+        m_sizeInBytes = m_data ? static_cast<size_t>(fileSize.QuadPart) : 0;
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStatus = {};
+        if (fstat(fd, &fileStatus) == 0 && fileStatus.st_size > 0)
+        {
+            void* data = mmap(nullptr, fileStatus.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                m_data = data;
+                m_sizeInBytes = static_cast<size_t>(fileStatus.st_size);
+            }
+        }
+        close(fd);
+#endif
+        return m_data != nullptr;
+    }
+
+    std::byte* Data() { return static_cast<std::byte*>(m_data); }
+    size_t SizeInBytes() const { return m_sizeInBytes; }
+
+    // Transfers ownership of the view to an allocator, which unmaps it when destroyed.
+    void MoveInto(BucketAllocator& allocator)
+    {
+        allocator.AdoptFileView(m_data, m_sizeInBytes);
+        m_data = nullptr;
+        m_sizeInBytes = 0;
+    }
+
+private:
+    void* m_data = nullptr;
+    size_t m_sizeInBytes = 0;
+};
+
+// ----------------------------------------------------------------------------
+// MODEL CACHE
+// ----------------------------------------------------------------------------
+
+ModelCache::ModelCache(std::filesystem::path cacheDirectory, IDxDispatchLogger* logger) :
+    m_cacheDirectory(std::move(cacheDirectory)),
+    m_logger(logger)
+{
+}
+
+Model ModelCache::LoadOrParse(
+    const std::filesystem::path& filePath,
+    const std::filesystem::path& inputPath,
+    const std::filesystem::path& outputPath,
+    uint32_t parseThreadCount,
+    bool useLargePages)
+{
+    std::filesystem::path modelPath = JsonParsers::ResolveModelPath(filePath, inputPath);
+    if (!std::filesystem::is_regular_file(modelPath))
+    {
+        return JsonParsers::ParseModel(filePath, inputPath, outputPath, parseThreadCount, useLargePages);
+    }
+
+    std::vector<char> fileContent;
+    {
+        std::ifstream file(modelPath, std::ios::binary);
+        fileContent.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    ContentHasher hasher;
+    hasher.Append(c_modelCacheVersion);
+    hasher.Append(std::string_view(fileContent.data(), fileContent.size()));
+    hasher.Append(std::filesystem::absolute(modelPath).u8string());
+    hasher.Append(std::filesystem::absolute(inputPath).u8string());
+    hasher.Append(std::filesystem::absolute(outputPath).u8string());
+    uint64_t key = hasher.Value();
+
+    auto cacheFilePath = m_cacheDirectory / fmt::format("{:016x}.dxdmc", key);
+
+    try
+    {
+        if (auto model = TryLoad(cacheFilePath, key))
+        {
+            return std::move(*model);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        m_logger->LogWarning(fmt::format("Ignoring model cache '{}': {}", cacheFilePath.string(), e.what()).c_str());
+    }
+
+    fileContent.push_back('\0'); // Ensure null terminated for parser.
+    Model model = JsonParsers::ParseModelInsitu(fileContent, inputPath, outputPath, parseThreadCount, useLargePages);
+
+    try
+    {
+        Store(model, cacheFilePath, key);
+    }
+    catch (const std::exception& e)
+    {
+        m_logger->LogWarning(fmt::format("Failed to write model cache '{}': {}", cacheFilePath.string(), e.what()).c_str());
+    }
+
+    return model;
+}
+
+std::optional<Model> ModelCache::TryLoad(const std::filesystem::path& cacheFilePath, uint64_t key)
+{
+    PrivateFileView view;
+    if (!view.Map(cacheFilePath))
+    {
+        return std::nullopt;
+    }
+
+    if (view.SizeInBytes() < sizeof(ModelCacheHeader))
+    {
+        throw std::invalid_argument("file is truncated");
+    }
+
+    ModelCacheHeader header;
+    memcpy(&header, view.Data(), sizeof(header));
+
+    if (header.magic != c_modelCacheMagic ||
+        header.version != c_modelCacheVersion ||
+        header.pointerSizeInBytes != sizeof(void*) ||
+        header.key != key)
+    {
+        return std::nullopt;
+    }
+
+    auto fileSize = view.SizeInBytes();
+    if (header.payloadOffset > fileSize || header.payloadSizeInBytes > fileSize - header.payloadOffset ||
+        header.relocationsOffset > fileSize || header.relocationCount > (fileSize - header.relocationsOffset) / sizeof(uint64_t) ||
+        header.arenaOffset > fileSize || header.arenaSizeInBytes > fileSize - header.arenaOffset ||
+        header.arenaOffset % c_arenaAlignment != 0)
+    {
+        throw std::invalid_argument("file is truncated");
+    }
+
+    BinaryReader reader(gsl::make_span(view.Data() + header.payloadOffset, header.payloadSizeInBytes));
+
+    // A changed input file invalidates the cache entry even though the JSON itself is unchanged.
+    std::vector<ImageBatchDependency> imageBatchDependencies;
+    auto dependencies = ReadDependencies(reader, /*out*/ imageBatchDependencies);
+    for (auto& dependency : dependencies)
+    {
+        if (!IsFileDependencyUnchanged(dependency))
+        {
+            m_logger->LogInfo(fmt::format("Model cache is stale: '{}' has changed", dependency.path.string()).c_str());
+            return std::nullopt;
+        }
+    }
+    for (auto& dependency : imageBatchDependencies)
+    {
+        auto current = GetImageBatchDependency(dependency.sourcePath);
+        if (!current || current->listingHash != dependency.listingHash)
+        {
+            m_logger->LogInfo(fmt::format("Model cache is stale: '{}' matches different images", dependency.sourcePath.string()).c_str());
+            return std::nullopt;
+        }
+    }
+
+    std::byte* arena = view.Data() + header.arenaOffset;
+    auto relocations = view.Data() + header.relocationsOffset;
+    for (uint64_t i = 0; i < header.relocationCount; i++)
+    {
+        uint64_t slotOffset;
+        memcpy(&slotOffset, relocations + i * sizeof(uint64_t), sizeof(slotOffset));
+        if (slotOffset > header.arenaSizeInBytes || header.arenaSizeInBytes - slotOffset < sizeof(uintptr_t))
+        {
+            throw std::invalid_argument("relocation is out of bounds");
+        }
+
+        uintptr_t value;
+        memcpy(&value, arena + slotOffset, sizeof(value));
+        if (value >= header.arenaSizeInBytes)
+        {
+            throw std::invalid_argument("relocation target is out of bounds");
+        }
+        value += reinterpret_cast<uintptr_t>(arena);
+        memcpy(arena + slotOffset, &value, sizeof(value));
+    }
+
+    BucketAllocator allocator;
+    view.MoveInto(allocator);
+
+    return ReadModel(reader, dependencies, arena, header.arenaSizeInBytes, std::move(allocator));
+}
+
+void ModelCache::Store(const Model& model, const std::filesystem::path& cacheFilePath, uint64_t key)
+{
+    std::vector<FileDependency> dependencies;
+    std::set<std::filesystem::path> dependencyPaths;
+    std::set<std::filesystem::path> imageBatchSourcePaths;
+    for (auto& resourceDesc : model.GetResourceDescs())
+    {
+        if (auto buffer = std::get_if<Model::BufferDesc>(&resourceDesc.value))
+        {
+            // A batch's sourcePath is a directory or pattern rather than a file; its images are the files.
+            if (buffer->sourceImagePaths.empty())
+            {
+                dependencyPaths.insert(buffer->sourcePath);
+            }
+            else
+            {
+                dependencyPaths.insert(buffer->sourceImagePaths.begin(), buffer->sourceImagePaths.end());
+                imageBatchSourcePaths.insert(buffer->sourcePath);
+            }
+            if (auto& file = buffer->initialValues.GetFile())
+            {
+                dependencyPaths.insert(file->GetPath());
+            }
+        }
+        else if (auto texture = std::get_if<Model::TextureDesc>(&resourceDesc.value))
+        {
+            dependencyPaths.insert(texture->sourcePath);
+        }
+    }
+    dependencyPaths.erase(std::filesystem::path{});
+
+    for (auto& path : dependencyPaths)
+    {
+        auto dependency = GetFileDependency(path);
+        if (!dependency)
+        {
+            throw std::invalid_argument(fmt::format("could not read '{}'", path.string()));
+        }
+        dependencies.push_back(std::move(*dependency));
+    }
+
+    std::vector<ImageBatchDependency> imageBatchDependencies;
+    for (auto& path : imageBatchSourcePaths)
+    {
+        auto dependency = GetImageBatchDependency(path);
+        if (!dependency)
+        {
+            throw std::invalid_argument(fmt::format("could not list '{}'", path.string()));
+        }
+        imageBatchDependencies.push_back(std::move(*dependency));
+    }
+
+    ArenaImage arena(model.GetAllocator());
+    BinaryWriter payload;
+    WriteModel(payload, model, dependencies, imageBatchDependencies, arena);
+
+    ModelCacheHeader header = {};
+    header.magic = c_modelCacheMagic;
+    header.version = c_modelCacheVersion;
+    header.pointerSizeInBytes = sizeof(void*);
+    header.key = key;
+    header.payloadOffset = sizeof(ModelCacheHeader);
+    header.payloadSizeInBytes = payload.Data().size();
+    header.relocationsOffset = RoundUpToMultiple(header.payloadOffset + header.payloadSizeInBytes, sizeof(uint64_t));
+    header.relocationCount = arena.Relocations().size();
+    header.arenaOffset = RoundUpToMultiple(header.relocationsOffset + header.relocationCount * sizeof(uint64_t), c_arenaAlignment);
+    header.arenaSizeInBytes = arena.Data().size();
+
+    std::vector<uint64_t> relocations(arena.Relocations().begin(), arena.Relocations().end());
+
+    std::filesystem::create_directories(m_cacheDirectory);
+
+    // Write to a temporary file first so a concurrent run never maps a partially written cache.
+    auto tempFilePath = cacheFilePath;
+    tempFilePath += fmt::format(".{}.tmp", std::chrono::steady_clock::now().time_since_epoch().count());
+    auto removeTempFile = wil::scope_exit([&]
+    {
+        std::error_code ignored;
+        std::filesystem::remove(tempFilePath, ignored);
+    });
+    {
+        std::ofstream file(tempFilePath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            throw std::invalid_argument(fmt::format("could not create '{}'", tempFilePath.string()));
+        }
+
+        auto writePadded = [&](const void* data, size_t sizeInBytes, uint64_t offset)
+        {
+            auto position = static_cast<uint64_t>(file.tellp());
+            std::vector<char> padding(offset - position);
+            file.write(padding.data(), padding.size());
+            file.write(static_cast<const char*>(data), sizeInBytes);
+        };
+
+        writePadded(&header, sizeof(header), 0);
+        writePadded(payload.Data().data(), payload.Data().size(), header.payloadOffset);
+        writePadded(relocations.data(), relocations.size() * sizeof(uint64_t), header.relocationsOffset);
+        writePadded(arena.Data().data(), arena.Data().size(), header.arenaOffset);
+
+        if (!file)
+        {
+            throw std::invalid_argument(fmt::format("could not write '{}'", tempFilePath.string()));
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempFilePath, cacheFilePath, error);
+    if (error)
+    {
+        throw std::invalid_argument(fmt::format("could not rename '{}' to '{}': {}", tempFilePath.string(), cacheFilePath.string(), error.message()));
+    }
+    removeTempFile.release();
+}
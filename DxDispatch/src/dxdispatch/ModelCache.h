@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Model.h"
+
+// Stores fully parsed JSON models on disk so that later runs of the same model can skip parsing.
+//
+// A cache file is named after a hash of the JSON text and the paths used to resolve its inputs. It also
+// records the size and last write time of every file the parser read (e.g. .npy initial values), and is only
+// used if all of those files are unchanged. Initial values read in place from a mapped file are stored as a
+// range of that file rather than copied, and are mapped again on load. The DML operator descs live in the cache file exactly as they
+// were laid out by the parser's BucketAllocator; loading the model maps the file, patches the pointers
+// within the descs using a relocation table, and hands the mapping to the loaded model's allocator.
+class ModelCache
+{
+public:
+    ModelCache(std::filesystem::path cacheDirectory, IDxDispatchLogger* logger);
+
+    // Returns the cached model if it is still valid; otherwise parses the JSON model and updates the cache.
+    Model LoadOrParse(
+        const std::filesystem::path& modelPath,
+        const std::filesystem::path& inputPath,
+        const std::filesystem::path& outputPath,
+        uint32_t parseThreadCount = 1,
+        bool useLargePages = false);
+
+private:
+    std::optional<Model> TryLoad(const std::filesystem::path& cacheFilePath, uint64_t key);
+    void Store(const Model& model, const std::filesystem::path& cacheFilePath, uint64_t key);
+
+private:
+    std::filesystem::path m_cacheDirectory;
+    Microsoft::WRL::ComPtr<IDxDispatchLogger> m_logger;
+};
@@ -7,6 +7,9 @@
 #include "Executor.h"
 #include "CommandLineArgs.h"
 #include "ModuleInfo.h"
+#include "ModelCache.h"
+#include "ContentHasher.h"
+#include "ResultsFile.h"
 #include "dxDispatchWrapper.h"
 
 using namespace Microsoft::WRL;
@@ -169,6 +172,7 @@ HRESULT DxDispatch::RuntimeClassInitialize(
                 m_options->DebugLayersEnabled(),
                 m_options->CommandListType(),
                 m_options->DispatchRepeat(),
+                m_options->FramesInFlight(),
                 m_options->GetUavBarrierAfterDispatch(),
                 m_options->GetAliasingBarrierAfterDispatch(),
                 m_options->ClearShaderCaches(),
@@ -193,6 +197,41 @@ HRESULT DxDispatch::RuntimeClassInitialize(
 
     m_logger->LogInfo(fmt::format("Running on '{}'", dxDispatchAdapter->GetDescription()).c_str());
 
+    if (m_options->ResultsFilePath() || m_options->BaselineFilePath())
+    {
+        // The hash identifies the version of the model that produced the results.
+        ContentHasher modelHasher;
+        if (jsonConfig)
+        {
+            modelHasher.Append(std::string_view(jsonConfig));
+        }
+        else
+        {
+            // Hash the file the model is loaded from, which may be relative to the input path.
+            auto modelPath = JsonParsers::ResolveModelPath(model.value(), m_options->InputPath().value_or(model.value().parent_path()));
+            if (!modelHasher.AppendFile(modelPath))
+            {
+                m_logger->LogWarning(fmt::format("Could not read '{}' to identify the model in the results", modelPath.string()).c_str());
+            }
+        }
+
+        m_runInfo = ResultsFile::RunInfo{
+            model ? model->string() : std::string(),
+            modelHasher.Value(),
+            std::string(dxDispatchAdapter->GetDescription()),
+            std::string(dxDispatchAdapter->GetDriverVersion()),
+            m_options->DispatchRepeat(),
+            m_options->MaxWarmupSamples(),
+            m_options->DispatchBatchSize(),
+            m_options->FramesInFlight()
+        };
+
+        if (m_options->ResultsFilePath())
+        {
+            m_resultsFile = std::make_shared<ResultsFile>(m_options->ResultsFilePath().value(), *m_runInfo);
+        }
+    }
+
     auto inputPath = m_options->InputPath();
     auto outputPath = m_options->OutputPath();
 
@@ -233,14 +272,28 @@ HRESULT DxDispatch::RuntimeClassInitialize(
                     doc,
                     fileContent,
                     inputPath.value(),
-                    outputPath.value())));
+                    outputPath.value(),
+                    m_options->ParseThreadCount(),
+                    m_options->UseLargePages())));
+        }
+        else if (model.value().extension() == ".json" && m_options->ModelCachePath())
+        {
+            ModelCache modelCache(m_options->ModelCachePath().value(), m_logger.Get());
+            m_modelWrapper = std::unique_ptr<ModelWrapper>(new ModelWrapper(modelCache.LoadOrParse(
+                model.value(),
+                inputPath.value(),
+                outputPath.value(),
+                m_options->ParseThreadCount(),
+                m_options->UseLargePages())));
         }
         else if (model.value().extension() == ".json")
         {
             m_modelWrapper = std::unique_ptr<ModelWrapper>(new ModelWrapper(JsonParsers::ParseModel(
                 model.value(),
                 inputPath.value(),
-                outputPath.value())));
+                outputPath.value(),
+                m_options->ParseThreadCount(),
+                m_options->UseLargePages())));
         }
         else if (model.value().extension() == ".onnx")
         {
@@ -264,6 +317,41 @@ HRESULT DxDispatch::RuntimeClassInitialize(
             m_logger->LogError("Expected a .json or .onnx file");
             return E_NOTIMPL;
         }
+
+        if (m_options->GetTimingVerbosity() >= TimingVerbosity::All)
+        {
+            auto statistics = m_modelWrapper->Value().GetAllocator().GetStatistics();
+            m_logger->LogInfo(fmt::format(
+                "Model allocator: {} buckets ({} large page), {} bytes reserved, {} bytes used, {} bytes wasted",
+                statistics.bucketCount,
+                statistics.largePageBucketCount,
+                statistics.reservedBytes,
+                statistics.usedBytes,
+                statistics.wastedBytes).c_str());
+        }
+
+        // A batch with fewer images than slots repeats them, which is easy to miss (e.g. with a mistyped pattern).
+        for (auto& resourceDesc : m_modelWrapper->Value().GetResourceDescs())
+        {
+            auto buffer = std::get_if<Model::BufferDesc>(&resourceDesc.value);
+            if (!buffer || buffer->sourceImagePaths.empty())
+            {
+                continue;
+            }
+
+            auto imagePaths = buffer->sourceImagePaths;
+            std::sort(imagePaths.begin(), imagePaths.end());
+            auto imageCount = std::unique(imagePaths.begin(), imagePaths.end()) - imagePaths.begin();
+            if (static_cast<size_t>(imageCount) < imagePaths.size())
+            {
+                m_logger->LogWarning(fmt::format(
+                    "Only {} images match '{}', so they're repeated to fill the batch of {} in buffer '{}'.",
+                    imageCount,
+                    buffer->sourcePath.string(),
+                    imagePaths.size(),
+                    resourceDesc.name).c_str());
+            }
+        }
     }
     catch(const std::exception& e) 
     {
@@ -284,7 +372,7 @@ HRESULT DxDispatch::RunAll() try
     try
     {
         RETURN_IF_FAILED(m_pixCaptureHelper->BeginCapturableWork());
-        m_executor = std::make_unique<Executor>(m_modelWrapper->Value(), m_device, *m_options, m_logger.Get());
+        m_executor = std::make_unique<Executor>(m_modelWrapper->Value(), m_device, *m_options, m_logger.Get(), m_resultsFile, m_runInfo);
         m_executor->Run();
         RETURN_IF_FAILED(m_pixCaptureHelper->EndCapturableWork());
     }
@@ -293,6 +381,12 @@ HRESULT DxDispatch::RunAll() try
         m_logger->LogError(fmt::format("Failed to execute the model: {}", e.what()).c_str());
         throw;
     }
+
+    if (m_executor->GetRegressionCount() > 0)
+    {
+        m_logger->LogError(fmt::format("{} dispatch(es) were significantly slower than the baseline.", m_executor->GetRegressionCount()).c_str());
+        return DXDISPATCH_E_PERFORMANCE_REGRESSION;
+    }
     
     return S_OK;
     
@@ -308,7 +402,7 @@ UINT32 DxDispatch::GetCommandCount()
     }
     if (m_executor == nullptr)
     {
-        m_executor = std::make_unique<Executor>(m_modelWrapper->Value(), m_device, *m_options, m_logger.Get());
+        m_executor = std::make_unique<Executor>(m_modelWrapper->Value(), m_device, *m_options, m_logger.Get(), m_resultsFile, m_runInfo);
     }
     return m_executor->GetCommandCount();
 }
@@ -324,8 +418,9 @@ HRESULT DxDispatch::RunCommand(
     }
     if (m_executor == nullptr)
     {
-        m_executor = std::make_unique<Executor>(m_modelWrapper->Value(), m_device, *m_options, m_logger.Get());
+        m_executor = std::make_unique<Executor>(m_modelWrapper->Value(), m_device, *m_options, m_logger.Get(), m_resultsFile, m_runInfo);
     }
+    const uint32_t previousRegressionCount = m_executor->GetRegressionCount();
     try
     {
         m_executor->RunCommand(index);
@@ -335,6 +430,10 @@ HRESULT DxDispatch::RunCommand(
         m_logger->LogError(fmt::format("Failed to execute the model Index: {} {}", index, e.what()).c_str());
         throw;
     }
+    if (m_executor->GetRegressionCount() > previousRegressionCount)
+    {
+        return DXDISPATCH_E_PERFORMANCE_REGRESSION;
+    }
     return S_OK;
 }  CATCH_RETURN();
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ResultsFile.h"
+
 class Device;
 class DmlModule;
 class D3d12Module;
@@ -67,4 +69,6 @@ protected:
     std::shared_ptr<PixCaptureHelper>           m_pixCaptureHelper;
     std::shared_ptr<CommandLineArgs>            m_options;
     std::shared_ptr<Executor>                   m_executor;
+    std::shared_ptr<ResultsFile>                m_resultsFile;
+    std::optional<ResultsFile::RunInfo>         m_runInfo; // Set with --results_file or --baseline_file.
 };
\ No newline at end of file
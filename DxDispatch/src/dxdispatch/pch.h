@@ -26,6 +26,7 @@
 #include <thread>
 #include <mutex>
 #include <map>
+#include <unordered_set>
 
 #ifndef _WIN32
 #include <wsl/winadapter.h>
@@ -0,0 +1,90 @@
+#include "pch.h"
+#include "BackgroundFileWriter.h"
+
+BackgroundFileWriter::~BackgroundFileWriter()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_stopping = true;
+    }
+    m_writeQueued.notify_one();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void BackgroundFileWriter::Enqueue(std::function<Result()> write, uint64_t sizeInBytes)
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_writeFinished.wait(lock, [&] { return m_queuedBytes == 0 || m_queuedBytes + sizeInBytes <= m_maxQueuedBytes; });
+        m_queue.emplace_back(std::move(write), sizeInBytes);
+        m_queuedBytes += sizeInBytes;
+
+        // The thread is only started once there's something to write.
+        if (!m_thread.joinable())
+        {
+            m_thread = std::thread(&BackgroundFileWriter::ThreadProc, this);
+        }
+    }
+    m_writeQueued.notify_one();
+}
+
+std::vector<BackgroundFileWriter::Result> BackgroundFileWriter::TakeResults()
+{
+    std::scoped_lock lock(m_mutex);
+    return std::exchange(m_results, {});
+}
+
+std::vector<BackgroundFileWriter::Result> BackgroundFileWriter::Flush()
+{
+    std::unique_lock lock(m_mutex);
+    m_writeFinished.wait(lock, [this] { return m_queue.empty() && !m_isWriting; });
+    return std::exchange(m_results, {});
+}
+
+void BackgroundFileWriter::ThreadProc()
+{
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        // Queued writes are finished before stopping.
+        m_writeQueued.wait(lock, [this] { return !m_queue.empty() || m_stopping; });
+        if (m_queue.empty())
+        {
+            break;
+        }
+
+        auto [write, sizeInBytes] = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_isWriting = true;
+        lock.unlock();
+
+        Result result;
+        try
+        {
+            result = write();
+        }
+        catch (const std::exception& e)
+        {
+            result = { false, e.what() };
+        }
+        catch (...)
+        {
+            result = { false, "Unknown error" };
+        }
+
+        // The write (and the data it holds) is released before the result is reported.
+        write = nullptr;
+
+        lock.lock();
+        m_results.push_back(std::move(result));
+        m_isWriting = false;
+        m_queuedBytes -= sizeInBytes;
+
+        // Wakes producers waiting for space as well as Flush.
+        m_writeFinished.notify_all();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs file writes on a single background thread, so commands that follow a WriteFile command don't wait for
+// large outputs to reach the disk. Writes run in the order they were queued, so later writes to the same file win.
+//
+// Each write returns a message describing its result rather than logging it, since loggers aren't required to be
+// thread safe; the caller collects the messages with TakeResults (or Flush) on its own thread.
+//
+// Queued writes hold their data until they finish, so the queue is bounded by the number of bytes it holds:
+// Enqueue blocks while the queued writes would exceed the budget. A single write larger than the budget is still
+// accepted once the queue is empty.
+class BackgroundFileWriter
+{
+public:
+    struct Result
+    {
+        bool succeeded;
+        std::string message;
+    };
+
+    static constexpr uint64_t c_defaultMaxQueuedBytes = 1024 * 1024 * 1024;
+
+    explicit BackgroundFileWriter(uint64_t maxQueuedBytes = c_defaultMaxQueuedBytes) : m_maxQueuedBytes(maxQueuedBytes) {}
+    BackgroundFileWriter(const BackgroundFileWriter&) = delete;
+    BackgroundFileWriter& operator=(const BackgroundFileWriter&) = delete;
+
+    // Waits for queued writes to finish. Results that weren't taken are discarded.
+    ~BackgroundFileWriter();
+
+    // Queues a write of sizeInBytes bytes, waiting for earlier writes to finish if the queue is full. The function
+    // must capture (and so keep alive) everything it writes.
+    void Enqueue(std::function<Result()> write, uint64_t sizeInBytes);
+
+    // Returns the results of the writes completed since the last call, without waiting.
+    std::vector<Result> TakeResults();
+
+    // Waits for all queued writes to finish and returns their results.
+    std::vector<Result> Flush();
+
+private:
+    void ThreadProc();
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_writeQueued;
+    std::condition_variable m_writeFinished;
+    std::deque<std::pair<std::function<Result()>, uint64_t>> m_queue;
+    uint64_t m_maxQueuedBytes;
+    uint64_t m_queuedBytes = 0; // Includes the write in progress.
+    std::vector<Result> m_results;
+    bool m_isWriting = false;
+    bool m_stopping = false;
+    std::thread m_thread;
+};
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <deque>
+#include <vector>
+#include <gsl/gsl>
 #include <wil/result.h>
 #include <half.hpp>
 #ifndef WIN32
@@ -14,10 +17,36 @@
 #include <cerrno>
 #endif
 
+// Arena for descs and other data that lives as long as a model. Memory is reserved in buckets that grow
+// geometrically (64 KB, 128 KB, ... up to 64 MB), so parsing a large model takes a handful of mmap/VirtualAlloc
+// calls rather than one per allocation. Requests too large for the current bucket get a dedicated bucket,
+// which leaves the current bucket open for the small allocations that typically follow.
 class BucketAllocator
 {
 public:
-    BucketAllocator() { m_buckets.emplace_back(1); }
+    static constexpr size_t c_minBucketSize = 64 * 1024;
+    static constexpr size_t c_maxBucketSize = 64 * 1024 * 1024;
+    static constexpr size_t c_largePageBucketSize = 2 * 1024 * 1024;
+
+    struct Statistics
+    {
+        size_t bucketCount = 0;      // Includes adopted file views.
+        size_t largePageBucketCount = 0;
+        size_t reservedBytes = 0;    // Total capacity of all buckets.
+        size_t usedBytes = 0;        // Bytes requested by callers (or held by file views).
+        size_t wastedBytes = 0;      // Alignment padding and bucket tails that can no longer be allocated from.
+    };
+
+    BucketAllocator() = default;
+
+    // When large pages are requested, buckets are at least 2 MB and are backed by huge pages where the OS allows
+    // it: MAP_HUGETLB (falling back to transparent huge pages) on Linux, or MEM_LARGE_PAGES on Windows (which
+    // requires SeLockMemoryPrivilege). Buckets silently fall back to regular pages otherwise.
+    explicit BucketAllocator(bool useLargePages) :
+        m_nextBucketSize(useLargePages ? c_largePageBucketSize : c_minBucketSize),
+        m_useLargePages(useLargePages)
+    {
+    }
 
     BucketAllocator(const BucketAllocator&) = delete;
     BucketAllocator& operator=(const BucketAllocator&) = delete;
@@ -26,14 +55,14 @@ public:
     {
         if (this != &other)
         {
-            std::swap(m_buckets, other.m_buckets);
+            Swap(other);
         }
         return *this;
     }
 
     BucketAllocator(BucketAllocator&& other)
     {
-        std::swap(m_buckets, other.m_buckets);
+        Swap(other);
     }
 
     template <typename T>
@@ -42,36 +71,210 @@ public:
         static_assert(std::is_trivial_v<T> || std::is_same_v<T, half_float::half>, "This class does not invoke constructors.");
 
         size_t sizeInBytes = sizeof(T) * count;
+        m_usedBytes += sizeInBytes;
+
+        // Retained buckets (after Reset) are reused in order before any new bucket is reserved.
+        while (m_currentBucket < m_buckets.size())
+        {
+            auto& bucket = m_buckets[m_currentBucket];
+            size_t previousSize = bucket.allocatedSize;
+            void* memory = bucket.TryAllocate(sizeInBytes, alignof(T));
+            if (memory)
+            {
+                m_wastedBytes += bucket.allocatedSize - previousSize - sizeInBytes;
+                return reinterpret_cast<T*>(memory);
+            }
+
+            if (sizeInBytes > m_nextBucketSize / 2)
+            {
+                break;
+            }
 
-        void* memory = m_buckets.back().TryAllocate(sizeInBytes, alignof(T));
-        if (!memory)
+            // The request doesn't fit in the rest of this bucket, and neither will most that follow it.
+            m_wastedBytes += bucket.capacity - bucket.allocatedSize;
+            m_currentBucket++;
+        }
+
+        void* memory;
+        if (m_currentBucket < m_buckets.size())
         {
-            m_buckets.emplace_back(sizeInBytes);
-            memory = m_buckets.back().TryAllocate(sizeInBytes, alignof(T));
+            // Dedicated bucket for a large request: insert it behind the current bucket, which stays open.
+            auto dedicated = m_buckets.emplace(m_buckets.begin() + m_currentBucket, sizeInBytes + alignof(T), m_useLargePages);
+            m_currentBucket++;
+            memory = dedicated->TryAllocate(sizeInBytes, alignof(T));
+            m_wastedBytes += dedicated->capacity - sizeInBytes;
+        }
+        else
+        {
+            size_t bucketSize = std::max(sizeInBytes + alignof(T), m_nextBucketSize);
+            m_nextBucketSize = std::min(m_nextBucketSize * 2, c_maxBucketSize);
+            auto& bucket = m_buckets.emplace_back(bucketSize, m_useLargePages);
+            m_currentBucket = m_buckets.size() - 1;
+            memory = bucket.TryAllocate(sizeInBytes, alignof(T));
+            m_wastedBytes += bucket.allocatedSize - sizeInBytes;
         }
 
         assert(memory != nullptr);
         return reinterpret_cast<T*>(memory);
     }
 
+    // Discards all allocations so the allocator can be reused (e.g. when a model is reloaded). Reserved buckets
+    // are kept and refilled in order, so parsing a similar model again doesn't touch the OS at all. Adopted file
+    // views are unmapped. Pointers previously returned by Allocate must not be used after calling this.
+    void Reset()
+    {
+        m_buckets.erase(
+            std::remove_if(m_buckets.begin(), m_buckets.end(), [](const Bucket& bucket) { return bucket.isFileView; }),
+            m_buckets.end());
+
+        for (auto& bucket : m_buckets)
+        {
+            bucket.allocatedSize = 0;
+        }
+
+        m_currentBucket = 0;
+        m_usedBytes = 0;
+        m_wastedBytes = 0;
+    }
+
+    // Moves the buckets of another allocator into this one, so memory allocated from it lives as long as this
+    // allocator does. This allows independent allocators (e.g. one per thread) to be merged after the fact.
+    // New allocations continue in this allocator's current bucket.
+    void Splice(BucketAllocator&& other)
+    {
+        for (size_t i = 0; i < other.m_buckets.size(); i++)
+        {
+            auto& bucket = other.m_buckets[i];
+            if (bucket.allocatedSize > 0)
+            {
+                // The unused tail of the other allocator's current bucket is no longer reachable.
+                if (i == other.m_currentBucket)
+                {
+                    other.m_wastedBytes += bucket.capacity - bucket.allocatedSize;
+                }
+                m_buckets.insert(m_buckets.begin() + m_currentBucket, std::move(bucket));
+                m_currentBucket++;
+            }
+        }
+
+        m_usedBytes += other.m_usedBytes;
+        m_wastedBytes += other.m_wastedBytes;
+        other.m_buckets.clear();
+        other.m_currentBucket = 0;
+        other.m_usedBytes = 0;
+        other.m_wastedBytes = 0;
+    }
+
+    // Returns the allocated (used) bytes of each bucket.
+    std::vector<gsl::span<const std::byte>> GetAllocatedRegions() const
+    {
+        std::vector<gsl::span<const std::byte>> regions;
+        for (auto& bucket : m_buckets)
+        {
+            if (bucket.allocatedSize > 0)
+            {
+                regions.emplace_back(static_cast<const std::byte*>(bucket.data), bucket.allocatedSize);
+            }
+        }
+        return regions;
+    }
+
+    Statistics GetStatistics() const
+    {
+        Statistics statistics = {};
+        statistics.bucketCount = m_buckets.size();
+        statistics.usedBytes = m_usedBytes;
+        statistics.wastedBytes = m_wastedBytes;
+        for (auto& bucket : m_buckets)
+        {
+            statistics.reservedBytes += bucket.capacity;
+            statistics.largePageBucketCount += bucket.isLargePage ? 1 : 0;
+        }
+        return statistics;
+    }
+
+    // Takes ownership of a memory-mapped file view that already holds allocated data (e.g. a model
+    // cache). The view is unmapped when the allocator is destroyed, and new allocations are never
+    // placed in it.
+    void AdoptFileView(void* data, size_t sizeInBytes)
+    {
+        m_buckets.emplace_front(Bucket::FromFileView(data, sizeInBytes));
+        m_currentBucket++;
+        m_usedBytes += sizeInBytes;
+    }
+
 private:
+    void Swap(BucketAllocator& other)
+    {
+        std::swap(m_buckets, other.m_buckets);
+        std::swap(m_currentBucket, other.m_currentBucket);
+        std::swap(m_nextBucketSize, other.m_nextBucketSize);
+        std::swap(m_usedBytes, other.m_usedBytes);
+        std::swap(m_wastedBytes, other.m_wastedBytes);
+        std::swap(m_useLargePages, other.m_useLargePages);
+    }
+
     struct Bucket
     {
         void* data = nullptr;
         size_t allocatedSize = 0;
         size_t capacity = 0;
+        bool isFileView = false;
+        bool isLargePage = false;
+
+        static Bucket FromFileView(void* data, size_t sizeInBytes)
+        {
+            Bucket bucket;
+            bucket.data = data;
+            bucket.allocatedSize = sizeInBytes;
+            bucket.capacity = sizeInBytes;
+            bucket.isFileView = true;
+            return bucket;
+        }
 
-        explicit Bucket(size_t minimumSize)
+        Bucket(size_t minimumSize, bool useLargePages)
         {
             this->allocatedSize = 0;
             this->capacity = RoundUpToMultiple<size_t>(minimumSize, 4096);
 #ifdef WIN32
+            if (useLargePages)
+            {
+                size_t largePageSize = GetLargePageMinimum();
+                if (largePageSize != 0)
+                {
+                    size_t largeCapacity = RoundUpToMultiple<size_t>(this->capacity, largePageSize);
+                    this->data = VirtualAlloc(nullptr, largeCapacity, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+                    if (this->data)
+                    {
+                        this->capacity = largeCapacity;
+                        this->isLargePage = true;
+                        return;
+                    }
+                }
+            }
+
             this->data = VirtualAlloc(nullptr, this->capacity, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
             THROW_LAST_ERROR_IF_NULL(this->data);
 #else
-            this->data = mmap(nullptr, this->capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+            if (useLargePages)
+            {
+                this->capacity = RoundUpToMultiple<size_t>(this->capacity, c_largePageBucketSize);
+#ifdef MAP_HUGETLB
+                // Fails unless huge pages have been reserved (vm.nr_hugepages), which is the common case.
+                void* hugePages = mmap(nullptr, this->capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (hugePages != MAP_FAILED)
+                {
+                    this->data = hugePages;
+                    this->isLargePage = true;
+                    return;
+                }
+#endif
+            }
+
+            this->data = mmap(nullptr, this->capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
             if (this->data == MAP_FAILED)
             {
+                this->data = nullptr;
                 switch (errno)
                 {
                 case EINVAL: THROW_HR(E_INVALIDARG); break;
@@ -80,9 +283,18 @@ private:
                 default: THROW_HR(E_UNEXPECTED); break;
                 }
             }
+
+#ifdef MADV_HUGEPAGE
+            if (useLargePages)
+            {
+                // Transparent huge pages; only a hint, so failure is harmless.
+                (void)madvise(this->data, this->capacity, MADV_HUGEPAGE);
+            }
+#endif
 #endif
         }
 
+        Bucket() = default;
         Bucket(const Bucket&) = delete;
         Bucket& operator=(const Bucket&) = delete;
 
@@ -91,6 +303,8 @@ private:
             std::swap(data, other.data);
             std::swap(allocatedSize, other.allocatedSize);
             std::swap(capacity, other.capacity);
+            std::swap(isFileView, other.isFileView);
+            std::swap(isLargePage, other.isLargePage);
             return *this;
         }
 
@@ -99,6 +313,8 @@ private:
             std::swap(data, other.data);
             std::swap(allocatedSize, other.allocatedSize);
             std::swap(capacity, other.capacity);
+            std::swap(isFileView, other.isFileView);
+            std::swap(isLargePage, other.isLargePage);
         }
 
         ~Bucket()
@@ -106,9 +322,16 @@ private:
             if (data)
             {
 #ifdef WIN32
-                (void)VirtualFree(data, 0, MEM_RELEASE);
+                if (isFileView)
+                {
+                    (void)UnmapViewOfFile(data);
+                }
+                else
+                {
+                    (void)VirtualFree(data, 0, MEM_RELEASE);
+                }
 #else
-                int result = munmap(this->data, this->capacity);
+                (void)munmap(this->data, this->capacity);
 #endif
             }
         }
@@ -143,4 +366,9 @@ private:
     };
 
     std::deque<Bucket> m_buckets;
+    size_t m_currentBucket = 0; // Index of the bucket new allocations are placed in.
+    size_t m_nextBucketSize = c_minBucketSize;
+    size_t m_usedBytes = 0;
+    size_t m_wastedBytes = 0;
+    bool m_useLargePages = false;
 };
\ No newline at end of file
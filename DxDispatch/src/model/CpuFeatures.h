@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CPU_FEATURES_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// Optional x86 instruction sets, detected at runtime. The build only assumes SSE2 (the x64 baseline), so kernels
+// that use newer instructions are compiled for them individually with TARGET_INSTRUCTIONS and only called when
+// GetCpuFeatures reports them. A kernel must be a separate function from its check, so that none of its
+// instructions run on processors without them. MSVC compiles any intrinsic without a switch, so the attribute
+// is only needed for GCC and Clang.
+#if defined(CPU_FEATURES_X86) && !defined(_MSC_VER)
+#define TARGET_INSTRUCTIONS(instructions) __attribute__((target(instructions)))
+#else
+#define TARGET_INSTRUCTIONS(instructions)
+#endif
+
+struct CpuFeatures
+{
+    bool ssse3 = false;
+    bool avx2 = false;
+    bool f16c = false; // Also implies AVX, which the 256-bit conversions need.
+};
+
+inline const CpuFeatures& GetCpuFeatures()
+{
+    static const CpuFeatures s_features = []
+    {
+        CpuFeatures features;
+#if defined(CPU_FEATURES_X86)
+        auto cpuid = [](uint32_t leaf, uint32_t (&registers)[4])
+        {
+#ifdef _MSC_VER
+            int values[4];
+            __cpuidex(values, static_cast<int>(leaf), 0);
+            for (int i = 0; i < 4; i++)
+            {
+                registers[i] = static_cast<uint32_t>(values[i]);
+            }
+#else
+            __cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#endif
+        };
+
+        uint32_t registers[4] = {};
+        cpuid(0, registers);
+        const uint32_t maxLeaf = registers[0];
+
+        cpuid(1, registers);
+        const uint32_t features1 = registers[2];
+        features.ssse3 = (features1 & (1u << 9)) != 0;
+
+        // AVX registers can only be used if the OS saves them on context switches (OSXSAVE, then XCR0 bits 1-2).
+        bool osSavesAvxState = false;
+        if (features1 & (1u << 27))
+        {
+#ifdef _MSC_VER
+            osSavesAvxState = (_xgetbv(0) & 6) == 6;
+#else
+            uint32_t xcr0Low, xcr0High;
+            __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+            osSavesAvxState = (xcr0Low & 6) == 6;
+#endif
+        }
+        const bool avx = osSavesAvxState && (features1 & (1u << 28));
+        features.f16c = avx && (features1 & (1u << 29));
+
+        if (maxLeaf >= 7)
+        {
+            cpuid(7, registers);
+            features.avx2 = avx && (registers[1] & (1u << 5));
+        }
+#endif
+        return features;
+    }();
+    return s_features;
+}
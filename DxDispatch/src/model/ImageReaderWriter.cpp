@@ -1,91 +1,1185 @@
 #include "pch.h"
 #include "StdSupport.h"
 #include "ImageReaderWriter.h"
+#include "ParallelFor.h"
+#include "SafeArithmetic.h"
+#include "TensorCast.h"
+#include "CpuFeatures.h"
 
-#ifndef WIN32
-std::vector<std::byte> ReadTensorFromImage(
-    std::filesystem::path srcPath,
-    const ImageTensorInfo& dstTensorInfo)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define IMAGE_SSE2
+#endif
+#if defined(IMAGE_SSE2) && defined(CPU_FEATURES_X86)
+// SSSE3 is detected at runtime (see CpuFeatures.h).
+#include <tmmintrin.h>
+#define IMAGE_SSSE3
+#endif
+#if defined(_M_ARM64) || defined(__aarch64__)
+#include <arm_neon.h>
+#define IMAGE_NEON
+#endif
+
+////////////////////////////////////////
+// Pixel <-> tensor conversion, shared by all image backends
+
+size_t GetDataTypeSize(DML_TENSOR_DATA_TYPE dataType)
 {
-    throw std::runtime_error("ReadTensorFromImage is not implemented on this platform.");
+    switch (dataType)
+    {
+        case DML_TENSOR_DATA_TYPE_FLOAT32: return sizeof(float);
+        case DML_TENSOR_DATA_TYPE_FLOAT16: return sizeof(uint16_t);
+        case DML_TENSOR_DATA_TYPE_UINT8: return sizeof(uint8_t);
+        case DML_TENSOR_DATA_TYPE_INT8: return sizeof(int8_t);
+
+        default: throw std::invalid_argument("Unsupported data type");
+    }
+
+    return 0;
 }
 
-void WriteTensorToImage(
-    std::filesystem::path dstPath,
-    std::span<const std::byte> srcData,
-    const ImageTensorInfo& srcInfo)
+// Channels of pixels and tensors, one letter per channel: R, G, B, A(lpha), or Y (luma).
+std::string_view GetChannelLetters(ImageTensorChannelOrder channelOrder)
 {
-    throw std::runtime_error("WriteTensorToImage is not implemented on this platform.");
+    switch (channelOrder)
+    {
+        case ImageTensorChannelOrder::RGB: return "RGB";
+        case ImageTensorChannelOrder::RGBA: return "RGBA";
+        case ImageTensorChannelOrder::BGR: return "BGR";
+        case ImageTensorChannelOrder::BGRA: return "BGRA";
+        case ImageTensorChannelOrder::Grayscale: return "Y";
+        default: throw std::invalid_argument("Unsupported channel order");
+    }
 }
 
-#else // Win32
+constexpr int opaqueChannel = -1;
 
-#include <wincodec.h>
+// Returns, for each channel in dstChannels, the index of the pixel channel it's read from. A missing alpha
+// channel is opaque (opaqueChannel), an extra one is dropped, and luma fills R, G, and B when the pixels are
+// grayscale.
+std::array<int, 4> GetChannelMap(std::string_view srcChannels, std::string_view dstChannels)
+{
+    std::array<int, 4> srcChannelIndices = {};
+    for (size_t c = 0; c < dstChannels.size(); c++)
+    {
+        size_t index = srcChannels.find(dstChannels[c]);
+        if (index == std::string_view::npos && dstChannels[c] != 'A' && dstChannels[c] != 'Y')
+        {
+            index = srcChannels.find('Y');
+        }
+        if (index == std::string_view::npos && dstChannels[c] != 'A')
+        {
+            throw std::invalid_argument(fmt::format("Pixels with channels {} can't be converted to {}.", srcChannels, dstChannels));
+        }
+        srcChannelIndices[c] = (index == std::string_view::npos) ? opaqueChannel : static_cast<int>(index);
+    }
+    return srcChannelIndices;
+}
 
-using Microsoft::WRL::ComPtr;
+// How one tensor channel relates to the pixels: float elements are (pixel - offset) / divisor, which is
+// (pixel / 255 - mean) / std with the 255 folded in. Dividing (rather than multiplying by a reciprocal) keeps
+// unnormalized elements exactly pixel / 255.
+struct ChannelTransform
+{
+    int pixelChannel = 0;
+    float offset = 0;
+    float divisor = 255;
+};
 
-size_t GetDataTypeSize(DML_TENSOR_DATA_TYPE dataType)
+std::array<ChannelTransform, 4> GetChannelTransforms(const ImageTensorInfo& tensorInfo, std::string_view pixelChannels)
+{
+    std::string_view tensorChannels = GetChannelLetters(tensorInfo.channelOrder);
+    if (tensorInfo.channels != tensorChannels.size())
+    {
+        throw std::invalid_argument("The tensor's channel count doesn't match its channel order");
+    }
+
+    auto checkSize = [&](const std::vector<float>& values, std::string_view name)
+    {
+        if (!values.empty() && values.size() != 1 && values.size() != tensorInfo.channels)
+        {
+            throw std::invalid_argument(fmt::format("'{}' must have 1 or {} values (one per channel).", name, tensorInfo.channels));
+        }
+    };
+    checkSize(tensorInfo.normalizeMean, "normalizeMean");
+    checkSize(tensorInfo.normalizeStd, "normalizeStd");
+
+    bool isNormalized = !tensorInfo.normalizeMean.empty() || !tensorInfo.normalizeStd.empty();
+    if (isNormalized && tensorInfo.dataType != DML_TENSOR_DATA_TYPE_FLOAT32 && tensorInfo.dataType != DML_TENSOR_DATA_TYPE_FLOAT16)
+    {
+        throw std::invalid_argument("Normalized image tensors must have a FLOAT32 or FLOAT16 data type.");
+    }
+
+    auto channelValue = [](const std::vector<float>& values, size_t c, float defaultValue)
+    {
+        return values.empty() ? defaultValue : values[values.size() == 1 ? 0 : c];
+    };
+
+    std::array<int, 4> channelMap = GetChannelMap(pixelChannels, tensorChannels);
+    std::array<ChannelTransform, 4> transforms = {};
+    for (uint32_t c = 0; c < tensorInfo.channels; c++)
+    {
+        float mean = channelValue(tensorInfo.normalizeMean, c, 0.0f);
+        float std = channelValue(tensorInfo.normalizeStd, c, 1.0f);
+        if (std == 0.0f || !std::isfinite(std) || !std::isfinite(mean))
+        {
+            throw std::invalid_argument("'normalizeStd' values must be finite and non-zero, and 'normalizeMean' values finite.");
+        }
+
+        transforms[c].pixelChannel = channelMap[c];
+        transforms[c].offset = 255.0f * mean;
+        transforms[c].divisor = 255.0f * std;
+    }
+    return transforms;
+}
+
+#if defined(IMAGE_SSSE3)
+// The vector loop of NormalizeChannelRow for 3-channel pixels, which needs pshufb to gather one channel. Returns
+// the number of pixels converted.
+TARGET_INSTRUCTIONS("ssse3")
+uint32_t NormalizeChannelRowRgbSsse3(const uint8_t* pixelRow, uint32_t width, const ChannelTransform& transform, /*out*/ float* values)
+{
+    const __m128 offset = _mm_set1_ps(transform.offset);
+    const __m128 divisor = _mm_set1_ps(transform.divisor);
+
+    // Four pixels take 12 of the 16 bytes loaded, so stop while the load stays within the row.
+    alignas(16) int8_t shuffle[16];
+    for (int i = 0; i < 16; i++)
+    {
+        shuffle[i] = (i % 4 == 0) ? static_cast<int8_t>(i / 4 * 3 + transform.pixelChannel) : -1;
+    }
+    const __m128i gather = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle));
+
+    uint32_t x = 0;
+    for (; x + 6 <= width; x += 4)
+    {
+        __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixelRow + x * 3));
+        __m128 pixels = _mm_cvtepi32_ps(_mm_shuffle_epi8(p, gather));
+        _mm_storeu_ps(values + x, _mm_div_ps(_mm_sub_ps(pixels, offset), divisor));
+    }
+    return x;
+}
+#endif
+
+// Reads one channel of a row of interleaved pixels and writes it as normalized floats, in a single pass over
+// the pixels. The arithmetic is identical in the vector and scalar loops, so results don't depend on the
+// instruction set or the width of the image.
+void NormalizeChannelRow(
+    const uint8_t* pixelRow,
+    uint32_t width,
+    uint32_t pixelChannelCount,
+    const ChannelTransform& transform,
+    /*out*/ float* values)
+{
+    uint32_t x = 0;
+
+    if (transform.pixelChannel == opaqueChannel)
+    {
+        std::fill(values, values + width, (255.0f - transform.offset) / transform.divisor);
+        return;
+    }
+
+    const uint8_t* channel = pixelRow + transform.pixelChannel;
+
+#if defined(IMAGE_SSE2)
+    const __m128 offset = _mm_set1_ps(transform.offset);
+    const __m128 divisor = _mm_set1_ps(transform.divisor);
+    auto store = [&](__m128i pixels32, uint32_t index)
+    {
+        _mm_storeu_ps(values + index, _mm_div_ps(_mm_sub_ps(_mm_cvtepi32_ps(pixels32), offset), divisor));
+    };
+
+    if (pixelChannelCount == 1)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(channel + x));
+            __m128i lo = _mm_unpacklo_epi8(p, zero);
+            __m128i hi = _mm_unpackhi_epi8(p, zero);
+            store(_mm_unpacklo_epi16(lo, zero), x);
+            store(_mm_unpackhi_epi16(lo, zero), x + 4);
+            store(_mm_unpacklo_epi16(hi, zero), x + 8);
+            store(_mm_unpackhi_epi16(hi, zero), x + 12);
+        }
+    }
+    else if (pixelChannelCount == 4)
+    {
+        // Four pixels fill a vector; shifting each 32-bit pixel moves the wanted channel to the low byte.
+        const __m128i shift = _mm_cvtsi32_si128(8 * transform.pixelChannel);
+        const __m128i lowByte = _mm_set1_epi32(0xFF);
+        for (; x + 4 <= width; x += 4)
+        {
+            __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixelRow + x * 4));
+            store(_mm_and_si128(_mm_srl_epi32(p, shift), lowByte), x);
+        }
+    }
+#if defined(IMAGE_SSSE3)
+    else if (pixelChannelCount == 3 && GetCpuFeatures().ssse3)
+    {
+        x = NormalizeChannelRowRgbSsse3(pixelRow, width, transform, values);
+    }
+#endif
+    else
+    {
+        const uint32_t c = pixelChannelCount;
+        for (; x + 4 <= width; x += 4)
+        {
+            const uint8_t* p = channel + x * c;
+            store(_mm_setr_epi32(p[0], p[c], p[2 * c], p[3 * c]), x);
+        }
+    }
+#elif defined(IMAGE_NEON)
+    // The structured loads deinterleave eight pixels into one register per channel.
+    const float32x4_t offset = vdupq_n_f32(transform.offset);
+    const float32x4_t divisor = vdupq_n_f32(transform.divisor);
+    if (pixelChannelCount >= 1 && pixelChannelCount <= 4)
+    {
+        for (; x + 8 <= width; x += 8)
+        {
+            const uint8_t* p = pixelRow + x * pixelChannelCount;
+            uint8x8_t channelPixels;
+            switch (pixelChannelCount)
+            {
+                case 1: channelPixels = vld1_u8(p); break;
+                case 2: channelPixels = vld2_u8(p).val[transform.pixelChannel]; break;
+                case 3: channelPixels = vld3_u8(p).val[transform.pixelChannel]; break;
+                default: channelPixels = vld4_u8(p).val[transform.pixelChannel]; break;
+            }
+
+            uint16x8_t p16 = vmovl_u8(channelPixels);
+            float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(p16)));
+            float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(p16)));
+            vst1q_f32(values + x, vdivq_f32(vsubq_f32(lo, offset), divisor));
+            vst1q_f32(values + x + 4, vdivq_f32(vsubq_f32(hi, offset), divisor));
+        }
+    }
+#endif
+
+    for (; x < width; x++)
+    {
+        values[x] = (static_cast<float>(channel[x * pixelChannelCount]) - transform.offset) / transform.divisor;
+    }
+}
+
+// Rows are converted in bands so threads don't contend over small amounts of work.
+constexpr uint32_t rowsPerBand = 16;
+
+// Converts a pixel buffer (HWC layout with uint8 components, in the channel order given by pixelChannels) to a
+// tensor. Channel reordering, normalization, layout, and casting happen in one pass over each row of pixels,
+// with rows split across threads. Rows are staged as floats only when the tensor isn't FLOAT32 NCHW, and then
+// in a buffer small enough to stay in cache. Elements are written to dstRaw, which holds tensorInfo.sizeInBytes.
+void ConvertPixelsToTensor(
+    std::span<const std::byte> src,
+    std::string_view pixelChannels,
+    const ImageTensorInfo& tensorInfo,
+    std::span<std::byte> dstRaw)
+{
+    const std::array<ChannelTransform, 4> transforms = GetChannelTransforms(tensorInfo, pixelChannels);
+    const uint32_t pixelChannelCount = static_cast<uint32_t>(pixelChannels.size());
+    const uint32_t channels = tensorInfo.channels;
+    const uint32_t width = tensorInfo.width;
+    const size_t elementSize = GetDataTypeSize(tensorInfo.dataType);
+    const size_t planeElementCount = size_t(width) * tensorInfo.height;
+    const size_t pixelRowSize = size_t(width) * pixelChannelCount;
+
+    if (tensorInfo.sizeInBytes < SafeMultiply(SafeMultiply(planeElementCount, channels), elementSize) || dstRaw.size() < tensorInfo.sizeInBytes)
+    {
+        throw std::invalid_argument("Unexpected tensor size (too small)");
+    }
+    if (src.size() < planeElementCount * pixelChannelCount)
+    {
+        throw std::invalid_argument("Unexpected pixel buffer size (too small)");
+    }
+
+    const bool isFloat = tensorInfo.dataType == DML_TENSOR_DATA_TYPE_FLOAT32 || tensorInfo.dataType == DML_TENSOR_DATA_TYPE_FLOAT16;
+    const bool isNhwc = tensorInfo.layout == ImageTensorLayout::NHWC;
+    const bool isFloat32 = tensorInfo.dataType == DML_TENSOR_DATA_TYPE_FLOAT32;
+
+    // Returns the offset in elements of a row of channel c (NCHW) or of a row of all channels (NHWC).
+    auto dstRowOffset = [&](uint32_t y, uint32_t c)
+    {
+        return isNhwc ? size_t(y) * width * channels : c * planeElementCount + size_t(y) * width;
+    };
+
+    const uint32_t bandCount = (tensorInfo.height + rowsPerBand - 1) / rowsPerBand;
+    ParallelFor(bandCount, 0, [&](size_t bandIndex, uint32_t /*workerIndex*/)
+    {
+        std::vector<float> channelRow(width);
+        std::vector<float> interleavedRow(isNhwc && !isFloat32 ? size_t(width) * channels : 0);
+
+        const uint32_t rowBegin = static_cast<uint32_t>(bandIndex) * rowsPerBand;
+        const uint32_t rowEnd = std::min(rowBegin + rowsPerBand, tensorInfo.height);
+        for (uint32_t y = rowBegin; y < rowEnd; y++)
+        {
+            const uint8_t* pixelRow = reinterpret_cast<const uint8_t*>(src.data()) + y * pixelRowSize;
+
+            if (!isFloat)
+            {
+                // UINT8 elements are the pixels themselves, and INT8 elements are offset by -128.
+                const uint8_t signFlip = (tensorInfo.dataType == DML_TENSOR_DATA_TYPE_INT8) ? 0x80 : 0x00;
+                auto dstBytes = reinterpret_cast<uint8_t*>(dstRaw.data());
+                for (uint32_t c = 0; c < channels; c++)
+                {
+                    const int pixelChannel = transforms[c].pixelChannel;
+                    const size_t dstStride = isNhwc ? channels : 1;
+                    uint8_t* dst = dstBytes + dstRowOffset(y, c) + (isNhwc ? c : 0);
+                    for (uint32_t x = 0; x < width; x++)
+                    {
+                        uint8_t value = (pixelChannel == opaqueChannel) ? 255 : pixelRow[x * pixelChannelCount + pixelChannel];
+                        dst[x * dstStride] = value ^ signFlip;
+                    }
+                }
+                continue;
+            }
+
+            // FLOAT32 rows are written straight into the tensor.
+            float* interleaved = isFloat32 ? reinterpret_cast<float*>(dstRaw.data()) + dstRowOffset(y, 0) : interleavedRow.data();
+
+            for (uint32_t c = 0; c < channels; c++)
+            {
+                if (!isNhwc && isFloat32)
+                {
+                    auto dst = reinterpret_cast<float*>(dstRaw.data()) + dstRowOffset(y, c);
+                    NormalizeChannelRow(pixelRow, width, pixelChannelCount, transforms[c], dst);
+                    continue;
+                }
+
+                NormalizeChannelRow(pixelRow, width, pixelChannelCount, transforms[c], channelRow.data());
+                if (isNhwc)
+                {
+                    for (uint32_t x = 0; x < width; x++)
+                    {
+                        interleaved[x * channels + c] = channelRow[x];
+                    }
+                }
+                else
+                {
+                    CastTensorData(
+                        std::span<const std::byte>(reinterpret_cast<const std::byte*>(channelRow.data()), width * sizeof(float)),
+                        DML_TENSOR_DATA_TYPE_FLOAT32,
+                        std::span<std::byte>(dstRaw.data() + dstRowOffset(y, c) * elementSize, width * elementSize),
+                        tensorInfo.dataType,
+                        1);
+                }
+            }
+
+            if (isNhwc && !isFloat32)
+            {
+                CastTensorData(
+                    std::span<const std::byte>(reinterpret_cast<const std::byte*>(interleavedRow.data()), interleavedRow.size() * sizeof(float)),
+                    DML_TENSOR_DATA_TYPE_FLOAT32,
+                    std::span<std::byte>(dstRaw.data() + dstRowOffset(y, 0) * elementSize, interleavedRow.size() * elementSize),
+                    tensorInfo.dataType,
+                    1);
+            }
+        }
+    });
+}
+
+// Converts one row of tensor elements back to uint8 channel values, undoing normalization and rounding and
+// clamping to [0, 255]. Element i belongs to the channel of transforms[i % transforms.size()].
+void ConvertTensorRowToPixels(
+    std::span<const std::byte> tensorRow,
+    DML_TENSOR_DATA_TYPE dataType,
+    std::span<const ChannelTransform> transforms,
+    std::span<uint8_t> pixels,
+    /*scratch*/ std::vector<float>& floatRow)
 {
+    auto pixelBytes = std::span<std::byte>(reinterpret_cast<std::byte*>(pixels.data()), pixels.size());
+
     switch (dataType)
     {
-        case DML_TENSOR_DATA_TYPE_FLOAT32: return sizeof(float);
-        case DML_TENSOR_DATA_TYPE_FLOAT16: return sizeof(uint16_t);
-        case DML_TENSOR_DATA_TYPE_UINT8: return sizeof(uint8_t);
-        case DML_TENSOR_DATA_TYPE_INT8: return sizeof(int8_t);
+        case DML_TENSOR_DATA_TYPE_UINT8:
+            std::copy(tensorRow.begin(), tensorRow.end(), pixelBytes.begin());
+            break;
+
+        case DML_TENSOR_DATA_TYPE_INT8:
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i] = static_cast<uint8_t>(tensorRow[i]) ^ 0x80;
+            }
+            break;
+
+        case DML_TENSOR_DATA_TYPE_FLOAT32:
+        case DML_TENSOR_DATA_TYPE_FLOAT16:
+        {
+            floatRow.resize(pixels.size());
+            auto floatBytes = std::span<std::byte>(reinterpret_cast<std::byte*>(floatRow.data()), floatRow.size() * sizeof(float));
+            CastTensorData(tensorRow, dataType, floatBytes, DML_TENSOR_DATA_TYPE_FLOAT32, 1);
+            for (size_t i = 0; i < floatRow.size(); i++)
+            {
+                const ChannelTransform& transform = transforms[i % transforms.size()];
+                floatRow[i] = floatRow[i] * transform.divisor + transform.offset;
+            }
+            CastTensorData(floatBytes, DML_TENSOR_DATA_TYPE_FLOAT32, pixelBytes, DML_TENSOR_DATA_TYPE_UINT8, 1);
+            break;
+        }
 
         default: throw std::invalid_argument("Unsupported data type");
     }
+}
+
+// Converts a tensor to a pixel buffer (HWC layout with uint8 components, in the tensor's channel order).
+std::vector<std::byte> ConvertTensorToPixels(std::span<const std::byte> srcRaw, const ImageTensorInfo& tensorInfo)
+{
+    const std::array<ChannelTransform, 4> transforms = GetChannelTransforms(tensorInfo, GetChannelLetters(tensorInfo.channelOrder));
+    const size_t elementSize = GetDataTypeSize(tensorInfo.dataType);
+    const size_t rowElementCount = size_t(tensorInfo.width) * tensorInfo.channels;
+    const size_t planeElementCount = size_t(tensorInfo.width) * tensorInfo.height;
+
+    if (srcRaw.size() < SafeMultiply(SafeMultiply(planeElementCount, tensorInfo.channels), elementSize))
+    {
+        throw std::invalid_argument("Unexpected tensor size (too small)");
+    }
+
+    std::vector<std::byte> dst(planeElementCount * tensorInfo.channels);
+    auto pixels = reinterpret_cast<uint8_t*>(dst.data());
+
+    const uint32_t bandCount = (tensorInfo.height + rowsPerBand - 1) / rowsPerBand;
+    ParallelFor(bandCount, 0, [&](size_t bandIndex, uint32_t /*workerIndex*/)
+    {
+        std::vector<uint8_t> channelRow(tensorInfo.width);
+        std::vector<float> floatRow;
+
+        const uint32_t rowBegin = static_cast<uint32_t>(bandIndex) * rowsPerBand;
+        const uint32_t rowEnd = std::min(rowBegin + rowsPerBand, tensorInfo.height);
+        for (uint32_t y = rowBegin; y < rowEnd; y++)
+        {
+            uint8_t* pixelRow = pixels + y * rowElementCount;
+
+            if (tensorInfo.layout == ImageTensorLayout::NHWC)
+            {
+                ConvertTensorRowToPixels(
+                    srcRaw.subspan(y * rowElementCount * elementSize, rowElementCount * elementSize),
+                    tensorInfo.dataType,
+                    std::span<const ChannelTransform>(transforms.data(), tensorInfo.channels),
+                    std::span<uint8_t>(pixelRow, rowElementCount),
+                    floatRow);
+                continue;
+            }
 
+            for (uint32_t c = 0; c < tensorInfo.channels; c++)
+            {
+                size_t srcOffset = (c * planeElementCount + size_t(y) * tensorInfo.width) * elementSize;
+                ConvertTensorRowToPixels(
+                    srcRaw.subspan(srcOffset, tensorInfo.width * elementSize),
+                    tensorInfo.dataType,
+                    std::span<const ChannelTransform>(&transforms[c], 1),
+                    channelRow,
+                    floatRow);
+
+                for (uint32_t x = 0; x < tensorInfo.width; x++)
+                {
+                    pixelRow[x * tensorInfo.channels + c] = channelRow[x];
+                }
+            }
+        }
+    });
+
+    return dst;
+}
+
+////////////////////////////////////////
+// Resampling, shared by all image backends
+
+// Catmull-Rom cubic, the same family WIC's high quality cubic interpolation uses.
+float CubicWeight(float x)
+{
+    constexpr float a = -0.5f;
+    x = std::abs(x);
+    if (x < 1.0f)
+    {
+        return ((a + 2) * x - (a + 3)) * x * x + 1;
+    }
+    if (x < 2.0f)
+    {
+        return ((a * x - 5 * a) * x + 8 * a) * x - 4 * a;
+    }
     return 0;
 }
 
-// Converts a pixel buffer (HWC layout with uint8 components) to a tensor.
-template <typename T>
-std::vector<std::byte> ConvertPixelsToTensor(std::span<const std::byte> src, const ImageTensorInfo& tensorInfo)
+// The source indices and normalized weights that produce each destination sample along one axis; edges are
+// clamped.
+struct ResampleTaps
+{
+    uint32_t tapCount = 0;
+    std::vector<uint32_t> indices; // [dstCount][tapCount]
+    std::vector<float> weights;    // [dstCount][tapCount]
+};
+
+// Computes taps for destination samples [dstBegin, dstBegin + dstCount) of an axis scaled from srcSize to
+// dstSize. Samples are at pixel centers. The cubic filter is widened by the scale factor when downscaling so
+// every source pixel contributes (i.e. it's antialiased); the linear filter isn't, matching the bilinear
+// resize of most ML preprocessing libraries; the area filter weighs each source pixel by how much of it the
+// destination pixel covers.
+ResampleTaps ComputeResampleTaps(uint32_t srcSize, uint32_t dstSize, uint32_t dstBegin, uint32_t dstCount, ImageResampleFilter filter)
 {
-    if (sizeof(T) != GetDataTypeSize(tensorInfo.dataType))
+    const double scale = double(srcSize) / dstSize;
+    const double filterScale = std::max(scale, 1.0);
+    const double cubicSupport = 2 * filterScale;
+
+    ResampleTaps taps;
+    switch (filter)
     {
-        throw std::invalid_argument("Unexpected data type size");
+        case ImageResampleFilter::Cubic: taps.tapCount = static_cast<uint32_t>(std::ceil(cubicSupport)) * 2 + 1; break;
+        case ImageResampleFilter::Linear: taps.tapCount = 2; break;
+        case ImageResampleFilter::Area: taps.tapCount = static_cast<uint32_t>(std::ceil(scale)) + 1; break;
+        default: throw std::invalid_argument("Unsupported resample filter");
     }
+    taps.indices.resize(size_t(dstCount) * taps.tapCount);
+    taps.weights.resize(size_t(dstCount) * taps.tapCount);
 
-    if (tensorInfo.sizeInBytes < tensorInfo.channels * tensorInfo.height * tensorInfo.width * GetDataTypeSize(tensorInfo.dataType))
+    for (uint32_t i = 0; i < dstCount; i++)
     {
-        throw std::invalid_argument("Unexpected tensor size (too small)");
+        const double center = (dstBegin + i + 0.5) * scale - 0.5;
+        const double areaBegin = (dstBegin + i) * scale;
+        const double areaEnd = areaBegin + scale;
+
+        int64_t first = 0;
+        switch (filter)
+        {
+            case ImageResampleFilter::Cubic: first = static_cast<int64_t>(std::floor(center - cubicSupport)) + 1; break;
+            case ImageResampleFilter::Linear: first = static_cast<int64_t>(std::floor(center)); break;
+            case ImageResampleFilter::Area: first = static_cast<int64_t>(std::floor(areaBegin)); break;
+        }
+
+        uint32_t* indices = &taps.indices[size_t(i) * taps.tapCount];
+        float* weights = &taps.weights[size_t(i) * taps.tapCount];
+        double weightSum = 0;
+        for (uint32_t t = 0; t < taps.tapCount; t++)
+        {
+            const int64_t srcIndex = first + t;
+            double weight = 0;
+            switch (filter)
+            {
+                case ImageResampleFilter::Cubic: weight = CubicWeight(static_cast<float>((srcIndex - center) / filterScale)); break;
+                case ImageResampleFilter::Linear: weight = std::max(0.0, 1 - std::abs(srcIndex - center)); break;
+                case ImageResampleFilter::Area: weight = std::max(0.0, std::min<double>(areaEnd, srcIndex + 1) - std::max<double>(areaBegin, srcIndex)); break;
+            }
+            indices[t] = static_cast<uint32_t>(std::clamp<int64_t>(srcIndex, 0, srcSize - 1));
+            weights[t] = static_cast<float>(weight);
+            weightSum += weight;
+        }
+        for (uint32_t t = 0; t < taps.tapCount; t++)
+        {
+            weights[t] = static_cast<float>(weights[t] / weightSum);
+        }
+    }
+
+    return taps;
+}
+
+// Where a resampled image lands in a tensor: the image is scaled to scaledWidth x scaledHeight, the region at
+// (cropX, cropY) of that is kept, and the kept region is placed at (padX, padY) in the tensor, with padding
+// around it.
+struct ResampleRegion
+{
+    uint32_t scaledWidth = 0;
+    uint32_t scaledHeight = 0;
+    uint32_t cropX = 0;
+    uint32_t cropY = 0;
+    uint32_t padX = 0;
+    uint32_t padY = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+ResampleRegion ComputeResampleRegion(uint32_t imageWidth, uint32_t imageHeight, const ImageTensorInfo& tensorInfo)
+{
+    if (imageWidth == 0 || imageHeight == 0 || tensorInfo.width == 0 || tensorInfo.height == 0)
+    {
+        throw std::invalid_argument("Images and image tensors must have a non-zero width and height.");
+    }
+
+    ResampleRegion region = {};
+    if (tensorInfo.resampleMode == ImageResampleMode::Scale)
+    {
+        region.scaledWidth = tensorInfo.width;
+        region.scaledHeight = tensorInfo.height;
+    }
+    else
+    {
+        // The aspect ratio is kept, so the image covers the tensor (CenterCrop) or fits inside it.
+        const double scaleX = double(tensorInfo.width) / imageWidth;
+        const double scaleY = double(tensorInfo.height) / imageHeight;
+        const bool cover = tensorInfo.resampleMode == ImageResampleMode::CenterCrop;
+        const double scale = cover ? std::max(scaleX, scaleY) : std::min(scaleX, scaleY);
+        auto scaledSize = [&](uint32_t imageSize, uint32_t tensorSize)
+        {
+            auto size = static_cast<uint32_t>(std::max(1.0, std::round(imageSize * scale)));
+            return cover ? std::max(size, tensorSize) : std::min(size, tensorSize);
+        };
+        region.scaledWidth = scaledSize(imageWidth, tensorInfo.width);
+        region.scaledHeight = scaledSize(imageHeight, tensorInfo.height);
     }
 
-    std::vector<std::byte> dstRaw(tensorInfo.sizeInBytes);
-    std::span<T> dst(reinterpret_cast<T*>(dstRaw.data()), dstRaw.size() / sizeof(T));
+    region.width = std::min(region.scaledWidth, tensorInfo.width);
+    region.height = std::min(region.scaledHeight, tensorInfo.height);
+    region.cropX = (region.scaledWidth - region.width) / 2;
+    region.cropY = (region.scaledHeight - region.height) / 2;
+    if (tensorInfo.resampleMode == ImageResampleMode::Letterbox)
+    {
+        region.padX = (tensorInfo.width - region.width) / 2;
+        region.padY = (tensorInfo.height - region.height) / 2;
+    }
+    return region;
+}
 
-    for (size_t pixelIndex = 0; pixelIndex < tensorInfo.height * tensorInfo.width; pixelIndex++)
+// Resamples one row of interleaved pixels horizontally. With SIMD, each pixel's channels share a vector, so
+// pixels with fewer than four channels are stored with extra lanes that spill into the next pixel (which
+// overwrites them) or, after the last pixel, into the row's padding.
+template <uint32_t channels>
+void ResampleRowHorizontal(const uint8_t* srcRow, const ResampleTaps& taps, uint32_t dstWidth, float* dstRow)
+{
+    for (uint32_t x = 0; x < dstWidth; x++)
     {
-        for (size_t channelIndex = 0; channelIndex < tensorInfo.channels; channelIndex++)
+        const uint32_t* indices = &taps.indices[size_t(x) * taps.tapCount];
+        const float* weights = &taps.weights[size_t(x) * taps.tapCount];
+
+#if defined(IMAGE_SSE2) || defined(IMAGE_NEON)
+        if constexpr (channels > 1)
         {
-            // src is always HWC layout.
-            size_t srcOffset = pixelIndex * tensorInfo.channels + channelIndex;
+#if defined(IMAGE_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            __m128 sum = _mm_setzero_ps();
+            for (uint32_t t = 0; t < taps.tapCount; t++)
+            {
+                uint32_t pixel = 0;
+                memcpy(&pixel, srcRow + indices[t] * channels, channels);
+                __m128i p = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(pixel), zero), zero);
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(p), _mm_set1_ps(weights[t])));
+            }
+            _mm_storeu_ps(dstRow + x * channels, sum);
+#else
+            float32x4_t sum = vdupq_n_f32(0);
+            for (uint32_t t = 0; t < taps.tapCount; t++)
+            {
+                uint32_t pixel = 0;
+                memcpy(&pixel, srcRow + indices[t] * channels, channels);
+                uint16x8_t p = vmovl_u8(vcreate_u8(pixel));
+                sum = vmlaq_n_f32(sum, vcvtq_f32_u32(vmovl_u16(vget_low_u16(p))), weights[t]);
+            }
+            vst1q_f32(dstRow + x * channels, sum);
+#endif
+            continue;
+        }
+#endif
+
+        for (uint32_t c = 0; c < channels; c++)
+        {
+            float sum = 0;
+            for (uint32_t t = 0; t < taps.tapCount; t++)
+            {
+                sum += weights[t] * srcRow[indices[t] * channels + c];
+            }
+            dstRow[x * channels + c] = sum;
+        }
+    }
+}
 
-            // dst is either HWC or CHW layout.
-            size_t dstOffset = tensorInfo.layout == ImageTensorLayout::NHWC ?
-                srcOffset :
-                pixelIndex + channelIndex * tensorInfo.height * tensorInfo.width;
+// Resamples rows vertically: dstRow[i] is the weighted sum of srcRows[t][i].
+void ResampleRowVertical(const float* const* srcRows, const float* weights, uint32_t tapCount, size_t rowSize, float* dstRow)
+{
+    size_t i = 0;
 
-            dst[dstOffset] = static_cast<float>(src[srcOffset]) / 255.0f;
+#if defined(IMAGE_SSE2)
+    for (; i + 4 <= rowSize; i += 4)
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (uint32_t t = 0; t < tapCount; t++)
+        {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(srcRows[t] + i), _mm_set1_ps(weights[t])));
         }
+        _mm_storeu_ps(dstRow + i, sum);
     }
+#elif defined(IMAGE_NEON)
+    for (; i + 4 <= rowSize; i += 4)
+    {
+        float32x4_t sum = vdupq_n_f32(0);
+        for (uint32_t t = 0; t < tapCount; t++)
+        {
+            sum = vmlaq_n_f32(sum, vld1q_f32(srcRows[t] + i), weights[t]);
+        }
+        vst1q_f32(dstRow + i, sum);
+    }
+#endif
 
-    return dstRaw;
+    for (; i < rowSize; i++)
+    {
+        float sum = 0;
+        for (uint32_t t = 0; t < tapCount; t++)
+        {
+            sum += weights[t] * srcRows[t][i];
+        }
+        dstRow[i] = sum;
+    }
 }
 
-std::vector<std::byte> ReadTensorFromImage(const std::filesystem::path& srcPath, const ImageTensorInfo& dstTensorInfo)
+// Resizes interleaved uint8 pixels to region.scaledWidth x region.scaledHeight with separable filtering,
+// producing only the region's kept pixels. The source rows the kept rows need are resampled horizontally into
+// a float image, which is then resampled vertically, with both passes split across threads by rows.
+std::vector<uint8_t> ResizePixels(
+    std::span<const uint8_t> src,
+    uint32_t srcWidth,
+    uint32_t srcHeight,
+    uint32_t channels,
+    const ResampleRegion& region,
+    ImageResampleFilter filter)
+{
+    const size_t srcStride = size_t(srcWidth) * channels;
+    const size_t dstStride = size_t(region.width) * channels;
+    std::vector<uint8_t> dst(region.height * dstStride);
+
+    if (region.scaledWidth == srcWidth && region.scaledHeight == srcHeight)
+    {
+        // Only cropped.
+        for (uint32_t y = 0; y < region.height; y++)
+        {
+            auto srcRow = src.begin() + (region.cropY + y) * srcStride + region.cropX * channels;
+            std::copy(srcRow, srcRow + dstStride, dst.begin() + y * dstStride);
+        }
+        return dst;
+    }
+
+    ResampleTaps columnTaps = ComputeResampleTaps(srcWidth, region.scaledWidth, region.cropX, region.width, filter);
+    ResampleTaps rowTaps = ComputeResampleTaps(srcHeight, region.scaledHeight, region.cropY, region.height, filter);
+    const uint32_t srcRowBegin = *std::min_element(rowTaps.indices.begin(), rowTaps.indices.end());
+    const uint32_t srcRowEnd = *std::max_element(rowTaps.indices.begin(), rowTaps.indices.end()) + 1;
+
+    // Rows are padded for the vector stores of ResampleRowHorizontal. Rows no tap reads (e.g. between the two
+    // taps of each row when downscaling with the linear filter) are skipped.
+    const size_t horizontalStride = dstStride + 4;
+    std::vector<float> horizontal((srcRowEnd - srcRowBegin) * horizontalStride);
+    std::vector<bool> isRowRead(srcRowEnd - srcRowBegin);
+    for (uint32_t index : rowTaps.indices)
+    {
+        isRowRead[index - srcRowBegin] = true;
+    }
+
+    auto bandCount = [](uint32_t rowCount) { return (rowCount + rowsPerBand - 1) / rowsPerBand; };
+
+    ParallelFor(bandCount(srcRowEnd - srcRowBegin), 0, [&](size_t bandIndex, uint32_t /*workerIndex*/)
+    {
+        const uint32_t rowBegin = srcRowBegin + static_cast<uint32_t>(bandIndex) * rowsPerBand;
+        const uint32_t rowEnd = std::min(rowBegin + rowsPerBand, srcRowEnd);
+        for (uint32_t y = rowBegin; y < rowEnd; y++)
+        {
+            if (!isRowRead[y - srcRowBegin])
+            {
+                continue;
+            }
+
+            const uint8_t* srcRow = src.data() + y * srcStride;
+            float* dstRow = horizontal.data() + (y - srcRowBegin) * horizontalStride;
+            switch (channels)
+            {
+                case 1: ResampleRowHorizontal<1>(srcRow, columnTaps, region.width, dstRow); break;
+                case 2: ResampleRowHorizontal<2>(srcRow, columnTaps, region.width, dstRow); break;
+                case 3: ResampleRowHorizontal<3>(srcRow, columnTaps, region.width, dstRow); break;
+                case 4: ResampleRowHorizontal<4>(srcRow, columnTaps, region.width, dstRow); break;
+                default: throw std::invalid_argument("Unsupported channel count");
+            }
+        }
+    });
+
+    ParallelFor(bandCount(region.height), 0, [&](size_t bandIndex, uint32_t /*workerIndex*/)
+    {
+        std::vector<float> sums(dstStride);
+        std::vector<const float*> srcRows(rowTaps.tapCount);
+        const uint32_t rowBegin = static_cast<uint32_t>(bandIndex) * rowsPerBand;
+        const uint32_t rowEnd = std::min(rowBegin + rowsPerBand, region.height);
+        for (uint32_t y = rowBegin; y < rowEnd; y++)
+        {
+            for (uint32_t t = 0; t < rowTaps.tapCount; t++)
+            {
+                srcRows[t] = horizontal.data() + (rowTaps.indices[y * rowTaps.tapCount + t] - srcRowBegin) * horizontalStride;
+            }
+            ResampleRowVertical(srcRows.data(), &rowTaps.weights[y * rowTaps.tapCount], rowTaps.tapCount, dstStride, sums.data());
+
+            // Rounds to the nearest value and clamps to [0, 255].
+            CastTensorData(
+                std::span<const std::byte>(reinterpret_cast<const std::byte*>(sums.data()), dstStride * sizeof(float)),
+                DML_TENSOR_DATA_TYPE_FLOAT32,
+                std::span<std::byte>(reinterpret_cast<std::byte*>(dst.data()) + y * dstStride, dstStride),
+                DML_TENSOR_DATA_TYPE_UINT8,
+                1);
+        }
+    });
+
+    return dst;
+}
+
+// Places a region's pixels in an image the size of the tensor, surrounded by padding: pixels whose channels
+// are all the tensor's padValue, except that alpha is opaque.
+std::vector<uint8_t> PadPixels(
+    std::vector<uint8_t>&& src,
+    const ResampleRegion& region,
+    std::string_view pixelChannels,
+    const ImageTensorInfo& tensorInfo)
+{
+    if (region.width == tensorInfo.width && region.height == tensorInfo.height)
+    {
+        return std::move(src);
+    }
+
+    const size_t channels = pixelChannels.size();
+    const size_t srcStride = region.width * channels;
+    const size_t dstStride = tensorInfo.width * channels;
+
+    std::vector<uint8_t> padPixel(channels, tensorInfo.padValue);
+    size_t alphaIndex = pixelChannels.find('A');
+    if (alphaIndex != std::string_view::npos)
+    {
+        padPixel[alphaIndex] = 255;
+    }
+
+    std::vector<uint8_t> dst(tensorInfo.height * dstStride);
+    for (size_t i = 0; i < dst.size(); i += channels)
+    {
+        std::copy(padPixel.begin(), padPixel.end(), dst.begin() + i);
+    }
+    for (uint32_t y = 0; y < region.height; y++)
+    {
+        auto srcRow = src.begin() + y * srcStride;
+        std::copy(srcRow, srcRow + srcStride, dst.begin() + (region.padY + y) * dstStride + region.padX * channels);
+    }
+    return dst;
+}
+
+// Resamples decoded pixels to the tensor's width and height as its resampleMode and resampleFilter describe.
+std::vector<uint8_t> ResamplePixels(
+    std::vector<uint8_t>&& pixels,
+    uint32_t width,
+    uint32_t height,
+    std::string_view pixelChannels,
+    const ImageTensorInfo& tensorInfo)
+{
+    if (width == tensorInfo.width && height == tensorInfo.height)
+    {
+        return std::move(pixels);
+    }
+
+    ResampleRegion region = ComputeResampleRegion(width, height, tensorInfo);
+    uint32_t channels = static_cast<uint32_t>(pixelChannels.size());
+    std::vector<uint8_t> resized = ResizePixels(pixels, width, height, channels, region, tensorInfo.resampleFilter);
+    return PadPixels(std::move(resized), region, pixelChannels, tensorInfo);
+}
+
+#ifndef WIN32
+
+#include <cstdio>
+#include <csetjmp>
+#include <png.h>
+// winadapter.h already defines INT16 and INT32 (the latter as int, where libjpeg would use long), as the X11
+// headers do.
+#define XMD_H
+#include <jpeglib.h>
+
+////////////////////////////////////////
+// Channel reordering
+
+// Rearranges interleaved pixels from one set of channels to another, as described for GetChannelMap.
+std::vector<uint8_t> ReorderChannels(std::vector<uint8_t>&& src, std::string_view srcChannels, std::string_view dstChannels)
 {
+    if (srcChannels == dstChannels)
+    {
+        return std::move(src);
+    }
+
+    std::array<int, 4> srcChannelIndices = GetChannelMap(srcChannels, dstChannels);
+
+    size_t pixelCount = src.size() / srcChannels.size();
+    std::vector<uint8_t> dst(pixelCount * dstChannels.size());
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        for (size_t c = 0; c < dstChannels.size(); c++)
+        {
+            int srcIndex = srcChannelIndices[c];
+            dst[i * dstChannels.size() + c] = (srcIndex == opaqueChannel) ? 255 : src[i * srcChannels.size() + srcIndex];
+        }
+    }
+    return dst;
+}
+
+////////////////////////////////////////
+// PNG and JPEG files (libpng and libjpeg)
+
+struct DecodedImage
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::string_view channels;
+    std::vector<uint8_t> pixels;
+};
+
+DecodedImage DecodePng(const std::filesystem::path& path, bool grayscale)
+{
+    png_image image = {};
+    image.version = PNG_IMAGE_VERSION;
+    auto cleanup = gsl::finally([&] { png_image_free(&image); });
+
+    auto throwIfFailed = [&](int succeeded)
+    {
+        if (!succeeded)
+        {
+            throw std::ios::failure(fmt::format("Failed to read PNG file '{}': {}", path.string(), image.message));
+        }
+    };
+
+    throwIfFailed(png_image_begin_read_from_file(&image, path.string().c_str()));
+
+    // Alpha is always decoded and then dropped if unwanted; asking libpng not to decode it would composite
+    // transparent pixels onto a background instead.
+    DecodedImage decoded;
+    decoded.width = image.width;
+    decoded.height = image.height;
+    decoded.channels = grayscale ? "YA" : "RGBA";
+    image.format = grayscale ? PNG_FORMAT_GA : PNG_FORMAT_RGBA;
+    decoded.pixels.resize(PNG_IMAGE_SIZE(image));
+    throwIfFailed(png_image_finish_read(&image, nullptr, decoded.pixels.data(), 0, nullptr));
+
+    return decoded;
+}
+
+void EncodePng(const std::filesystem::path& path, std::span<const uint8_t> pixels, uint32_t width, uint32_t height, ImageTensorChannelOrder channelOrder)
+{
+    png_image image = {};
+    image.version = PNG_IMAGE_VERSION;
+    image.width = width;
+    image.height = height;
+
+    switch (channelOrder)
+    {
+        case ImageTensorChannelOrder::RGB: image.format = PNG_FORMAT_RGB; break;
+        case ImageTensorChannelOrder::RGBA: image.format = PNG_FORMAT_RGBA; break;
+        case ImageTensorChannelOrder::BGR: image.format = PNG_FORMAT_BGR; break;
+        case ImageTensorChannelOrder::BGRA: image.format = PNG_FORMAT_BGRA; break;
+        case ImageTensorChannelOrder::Grayscale: image.format = PNG_FORMAT_GRAY; break;
+        default: throw std::invalid_argument("Unsupported channel order");
+    }
+
+    if (!png_image_write_to_file(&image, path.string().c_str(), 0, pixels.data(), 0, nullptr))
+    {
+        std::string message = image.message;
+        png_image_free(&image);
+        throw std::ios::failure(fmt::format("Failed to write PNG file '{}': {}", path.string(), message));
+    }
+}
+
+// libjpeg reports errors through a callback that must not return, so it jumps back to the caller, which
+// throws once no libjpeg frames are on the stack.
+struct JpegErrorManager
+{
+    jpeg_error_mgr manager;
+    std::jmp_buf returnPoint;
+    char message[JMSG_LENGTH_MAX];
+};
+
+jpeg_error_mgr* InitializeJpegErrorManager(JpegErrorManager& errorManager)
+{
+    jpeg_std_error(&errorManager.manager);
+    errorManager.manager.error_exit = [](j_common_ptr info)
+    {
+        auto errorManager = reinterpret_cast<JpegErrorManager*>(info->err);
+        (*info->err->format_message)(info, errorManager->message);
+        std::longjmp(errorManager->returnPoint, 1);
+    };
+    return &errorManager.manager;
+}
+
+struct FileCloser
+{
+    void operator()(FILE* file) const { fclose(file); }
+};
+
+std::unique_ptr<FILE, FileCloser> OpenFile(const std::filesystem::path& path, const char* mode)
+{
+    std::unique_ptr<FILE, FileCloser> file(fopen(path.string().c_str(), mode));
+    if (!file)
+    {
+        throw std::ios::failure(fmt::format("Could not open file '{}'.", path.string()));
+    }
+    return file;
+}
+
+DecodedImage DecodeJpeg(const std::filesystem::path& path, bool grayscale)
+{
+    auto file = OpenFile(path, "rb");
+
+    DecodedImage decoded;
+    jpeg_decompress_struct info = {};
+    JpegErrorManager errorManager;
+    info.err = InitializeJpegErrorManager(errorManager);
+
+    // Nothing with a destructor may be created between here and the end of decoding.
+    if (setjmp(errorManager.returnPoint))
+    {
+        jpeg_destroy_decompress(&info);
+        throw std::ios::failure(fmt::format("Failed to read JPEG file '{}': {}", path.string(), errorManager.message));
+    }
+
+    jpeg_create_decompress(&info);
+    jpeg_stdio_src(&info, file.get());
+    jpeg_read_header(&info, TRUE);
+    info.out_color_space = grayscale ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_start_decompress(&info);
+
+    decoded.width = info.output_width;
+    decoded.height = info.output_height;
+    decoded.channels = grayscale ? "Y" : "RGB";
+    decoded.pixels.resize(size_t(info.output_width) * info.output_height * info.output_components);
+
+    const size_t stride = size_t(info.output_width) * info.output_components;
+    while (info.output_scanline < info.output_height)
+    {
+        JSAMPROW row = decoded.pixels.data() + info.output_scanline * stride;
+        jpeg_read_scanlines(&info, &row, 1);
+    }
+
+    jpeg_finish_decompress(&info);
+    jpeg_destroy_decompress(&info);
+    return decoded;
+}
+
+void EncodeJpeg(const std::filesystem::path& path, std::span<const uint8_t> pixels, uint32_t width, uint32_t height, ImageTensorChannelOrder channelOrder)
+{
+    // JPEG stores RGB or grayscale; other channel orders are converted and alpha is dropped.
+    bool grayscale = channelOrder == ImageTensorChannelOrder::Grayscale;
+    std::vector<uint8_t> jpegPixels = ReorderChannels(
+        std::vector<uint8_t>(pixels.begin(), pixels.end()),
+        GetChannelLetters(channelOrder),
+        grayscale ? "Y" : "RGB");
+
+    auto file = OpenFile(path, "wb");
+
+    jpeg_compress_struct info = {};
+    JpegErrorManager errorManager;
+    info.err = InitializeJpegErrorManager(errorManager);
+
+    if (setjmp(errorManager.returnPoint))
+    {
+        jpeg_destroy_compress(&info);
+        throw std::ios::failure(fmt::format("Failed to write JPEG file '{}': {}", path.string(), errorManager.message));
+    }
+
+    jpeg_create_compress(&info);
+    jpeg_stdio_dest(&info, file.get());
+    info.image_width = width;
+    info.image_height = height;
+    info.input_components = grayscale ? 1 : 3;
+    info.in_color_space = grayscale ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_set_defaults(&info);
+    jpeg_set_quality(&info, 90, TRUE); // Matches WIC's default image quality (0.9).
+    jpeg_start_compress(&info, TRUE);
+
+    const size_t stride = size_t(width) * info.input_components;
+    while (info.next_scanline < info.image_height)
+    {
+        JSAMPROW row = jpegPixels.data() + info.next_scanline * stride;
+        jpeg_write_scanlines(&info, &row, 1);
+    }
+
+    jpeg_finish_compress(&info);
+    jpeg_destroy_compress(&info);
+}
+
+bool IsJpegPath(const std::filesystem::path& path)
+{
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    if (extension == ".jpg" || extension == ".jpeg")
+    {
+        return true;
+    }
+    if (extension != ".png")
+    {
+        throw std::invalid_argument("Unsupported image format");
+    }
+    return false;
+}
+
+void ReadTensorFromImage(const std::filesystem::path& srcPath, const ImageTensorInfo& dstTensorInfo, std::span<std::byte> dstData)
+{
+    std::string_view dstChannels = GetChannelLetters(dstTensorInfo.channelOrder);
+    if (dstTensorInfo.channels != dstChannels.size())
+    {
+        throw std::invalid_argument("The tensor's channel count doesn't match its channel order");
+    }
+
+    bool grayscale = dstTensorInfo.channelOrder == ImageTensorChannelOrder::Grayscale;
+    DecodedImage image = IsJpegPath(srcPath) ? DecodeJpeg(srcPath, grayscale) : DecodePng(srcPath, grayscale);
+
+    // Channels are reordered as the pixels are converted to the tensor, except that channels the tensor
+    // doesn't use are dropped before resampling rather than resampled.
+    std::string_view pixelChannels = image.channels;
+    std::vector<uint8_t> pixels = std::move(image.pixels);
+
+    if (image.width != dstTensorInfo.width || image.height != dstTensorInfo.height)
+    {
+        if (pixelChannels.size() > dstChannels.size())
+        {
+            pixels = ReorderChannels(std::move(pixels), pixelChannels, dstChannels);
+            pixelChannels = dstChannels;
+        }
+
+        pixels = ResamplePixels(std::move(pixels), image.width, image.height, pixelChannels, dstTensorInfo);
+    }
+
+    auto pixelBytes = std::span<const std::byte>(reinterpret_cast<const std::byte*>(pixels.data()), pixels.size());
+    ConvertPixelsToTensor(pixelBytes, pixelChannels, dstTensorInfo, dstData);
+}
+
+void WriteTensorToImage(const std::filesystem::path& dstPath, std::span<const std::byte> srcData, const ImageTensorInfo& srcTensorInfo)
+{
+    if (srcTensorInfo.channels != GetChannelLetters(srcTensorInfo.channelOrder).size())
+    {
+        throw std::invalid_argument("The tensor's channel count doesn't match its channel order");
+    }
+
+    std::vector<std::byte> pixelBuffer = ConvertTensorToPixels(srcData, srcTensorInfo);
+    auto pixels = std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(pixelBuffer.data()), pixelBuffer.size());
+
+    if (IsJpegPath(dstPath))
+    {
+        EncodeJpeg(dstPath, pixels, srcTensorInfo.width, srcTensorInfo.height, srcTensorInfo.channelOrder);
+    }
+    else
+    {
+        EncodePng(dstPath, pixels, srcTensorInfo.width, srcTensorInfo.height, srcTensorInfo.channelOrder);
+    }
+}
+
+#else // Win32
+
+#include <wincodec.h>
+
+using Microsoft::WRL::ComPtr;
+
+void ReadTensorFromImage(const std::filesystem::path& srcPath, const ImageTensorInfo& dstTensorInfo, std::span<std::byte> dstData)
+{
+    // Pixels are decoded in the BGR orders most codecs produce natively; converting them to the tensor
+    // reorders the channels in the same pass.
     WICPixelFormatGUID desiredImagePixelFormat = GUID_WICPixelFormatDontCare;
+    std::string_view pixelChannels;
 
     switch (dstTensorInfo.channelOrder)
     {
-        case ImageTensorChannelOrder::RGB: desiredImagePixelFormat = GUID_WICPixelFormat24bppRGB; break;
-        case ImageTensorChannelOrder::RGBA: desiredImagePixelFormat = GUID_WICPixelFormat32bppRGBA; break;
-        case ImageTensorChannelOrder::BGR: desiredImagePixelFormat = GUID_WICPixelFormat24bppBGR; break;
-        case ImageTensorChannelOrder::BGRA: desiredImagePixelFormat = GUID_WICPixelFormat32bppBGRA; break;
-        case ImageTensorChannelOrder::Grayscale: desiredImagePixelFormat = GUID_WICPixelFormat8bppGray; break;
+        case ImageTensorChannelOrder::RGB:
+        case ImageTensorChannelOrder::BGR:
+            desiredImagePixelFormat = GUID_WICPixelFormat24bppBGR;
+            pixelChannels = "BGR";
+            break;
+        case ImageTensorChannelOrder::RGBA:
+        case ImageTensorChannelOrder::BGRA:
+            desiredImagePixelFormat = GUID_WICPixelFormat32bppBGRA;
+            pixelChannels = "BGRA";
+            break;
+        case ImageTensorChannelOrder::Grayscale:
+            desiredImagePixelFormat = GUID_WICPixelFormat8bppGray;
+            pixelChannels = "Y";
+            break;
         default: throw std::invalid_argument("Unsupported channel order");
     }
 
@@ -134,67 +1228,58 @@ std::vector<std::byte> ReadTensorFromImage(const std::filesystem::path& srcPath,
         bitmapSource = formatConverter;
     }
 
-    if (imageWidth != dstTensorInfo.width || imageHeight != dstTensorInfo.height)
+    // WIC CopyPixels writes to an interleaved (HWC) buffer with 8 bits (uint8) per channel element.
+    const uint32_t pixelChannelCount = static_cast<uint32_t>(pixelChannels.size());
+    auto copyPixels = [&](IWICBitmapSource* source, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
     {
-        // Scale image to match the tensor dimensions.
-        ComPtr<IWICBitmapScaler> scaler;
-        THROW_IF_FAILED(wicFactory->CreateBitmapScaler(&scaler));
-        THROW_IF_FAILED(scaler->Initialize(
-            bitmapSource.Get(),
-            dstTensorInfo.width,
-            dstTensorInfo.height,
-            WICBitmapInterpolationModeHighQualityCubic
+        std::vector<uint8_t> pixels(size_t(height) * width * pixelChannelCount);
+        WICRect pixelBufferRect = { static_cast<INT>(x), static_cast<INT>(y), static_cast<INT>(width), static_cast<INT>(height) };
+        const uint32_t pixelBufferStride = width * pixelChannelCount * sizeof(uint8_t);
+
+        THROW_IF_FAILED(source->CopyPixels(
+            &pixelBufferRect,
+            pixelBufferStride,
+            static_cast<uint32_t>(pixels.size()),
+            reinterpret_cast<BYTE*>(pixels.data())
         ));
+        return pixels;
+    };
 
-        bitmapSource = scaler;
+    std::vector<uint8_t> pixelBuffer;
+    if (imageWidth == dstTensorInfo.width && imageHeight == dstTensorInfo.height)
+    {
+        pixelBuffer = copyPixels(bitmapSource.Get(), 0, 0, imageWidth, imageHeight);
     }
-
-    // WIC CopyPixels writes to an interleaved (HWC) buffer with 8 bits (uint8) per channel element.
-    std::vector<std::byte> pixelBuffer(dstTensorInfo.height * dstTensorInfo.width * dstTensorInfo.channels);
-    WICRect pixelBufferRect = { 0, 0, static_cast<INT>(dstTensorInfo.width), static_cast<INT>(dstTensorInfo.height) };
-    const uint32_t pixelBufferStride = dstTensorInfo.width * dstTensorInfo.channels * sizeof(uint8_t);
-
-    THROW_IF_FAILED(bitmapSource->CopyPixels(
-        &pixelBufferRect,
-        pixelBufferStride,
-        static_cast<uint32_t>(pixelBuffer.size()),
-        reinterpret_cast<BYTE*>(pixelBuffer.data())
-    ));
-
-    switch (dstTensorInfo.dataType)
+    else if (dstTensorInfo.resampleFilter != ImageResampleFilter::Cubic)
     {
-        case DML_TENSOR_DATA_TYPE_FLOAT32: return ConvertPixelsToTensor<float>(pixelBuffer, dstTensorInfo);
-        case DML_TENSOR_DATA_TYPE_FLOAT16: return ConvertPixelsToTensor<half_float::half>(pixelBuffer, dstTensorInfo);
-
-        default: throw std::invalid_argument("Unsupported data type");
+        // The linear and area filters aren't WIC's, so they give the same results as on other platforms.
+        pixelBuffer = copyPixels(bitmapSource.Get(), 0, 0, imageWidth, imageHeight);
+        pixelBuffer = ResamplePixels(std::move(pixelBuffer), imageWidth, imageHeight, pixelChannels, dstTensorInfo);
     }
-}
-
-// Converts a tensor to a pixel buffer (HWC layout with uint8 components).
-template <typename T>
-std::vector<std::byte> ConvertTensorToPixels(std::span<const std::byte> srcRaw, const ImageTensorInfo& tensorInfo)
-{
-    std::span<const T> src(reinterpret_cast<const T*>(srcRaw.data()), srcRaw.size_bytes() / sizeof(T));
-
-    std::vector<std::byte> dst(tensorInfo.height * tensorInfo.width * tensorInfo.channels);
-
-    for (size_t pixelIndex = 0; pixelIndex < tensorInfo.height * tensorInfo.width; pixelIndex++)
+    else
     {
-        for (size_t channelIndex = 0; channelIndex < tensorInfo.channels; channelIndex++)
+        // Scale image to match the tensor dimensions (or to cover or fit in them), then crop and pad.
+        ResampleRegion region = ComputeResampleRegion(imageWidth, imageHeight, dstTensorInfo);
+        if (region.scaledWidth != imageWidth || region.scaledHeight != imageHeight)
         {
-            // dst is always HWC layout.
-            size_t dstOffset = pixelIndex * tensorInfo.channels + channelIndex;
-
-            // src is either HWC or CHW layout.
-            size_t srcOffset = tensorInfo.layout == ImageTensorLayout::NHWC ?
-                dstOffset :
-                pixelIndex + channelIndex * tensorInfo.height * tensorInfo.width;
+            ComPtr<IWICBitmapScaler> scaler;
+            THROW_IF_FAILED(wicFactory->CreateBitmapScaler(&scaler));
+            THROW_IF_FAILED(scaler->Initialize(
+                bitmapSource.Get(),
+                region.scaledWidth,
+                region.scaledHeight,
+                WICBitmapInterpolationModeHighQualityCubic
+            ));
 
-            dst[dstOffset] = static_cast<std::byte>(std::max(0.0f, std::min(1.0f, (float)src[srcOffset])) * 255.0f);
+            bitmapSource = scaler;
         }
+
+        pixelBuffer = copyPixels(bitmapSource.Get(), region.cropX, region.cropY, region.width, region.height);
+        pixelBuffer = PadPixels(std::move(pixelBuffer), region, pixelChannels, dstTensorInfo);
     }
 
-    return dst;
+    auto pixelBytes = std::span<const std::byte>(reinterpret_cast<const std::byte*>(pixelBuffer.data()), pixelBuffer.size());
+    ConvertPixelsToTensor(pixelBytes, pixelChannels, dstTensorInfo, dstData);
 }
 
 void WriteTensorToImage(const std::filesystem::path& dstPath, std::span<const std::byte> srcData, const ImageTensorInfo& srcTensorInfo)
@@ -211,13 +1296,7 @@ void WriteTensorToImage(const std::filesystem::path& dstPath, std::span<const st
         default: throw std::invalid_argument("Unsupported channel order");
     }
 
-    std::vector<std::byte> pixelBuffer;
-    switch (srcTensorInfo.dataType)
-    {
-        case DML_TENSOR_DATA_TYPE_FLOAT32: pixelBuffer = ConvertTensorToPixels<float>(srcData, srcTensorInfo); break;
-        case DML_TENSOR_DATA_TYPE_FLOAT16: pixelBuffer = ConvertTensorToPixels<half_float::half>(srcData, srcTensorInfo); break;
-        default: throw std::invalid_argument("Unsupported data type");
-    }
+    std::vector<std::byte> pixelBuffer = ConvertTensorToPixels(srcData, srcTensorInfo);
 
     std::span<BYTE> byteSpan(reinterpret_cast<BYTE*>(pixelBuffer.data()), pixelBuffer.size());
 
@@ -275,3 +1354,27 @@ void WriteTensorToImage(const std::filesystem::path& dstPath, std::span<const st
 }
 
 #endif
+
+////////////////////////////////////////
+// Reading into new buffers, shared by all image backends
+
+std::vector<std::byte> ReadTensorFromImage(const std::filesystem::path& srcPath, const ImageTensorInfo& dstTensorInfo)
+{
+    std::vector<std::byte> dstData(SafeSizeCast(dstTensorInfo.sizeInBytes));
+    ReadTensorFromImage(srcPath, dstTensorInfo, dstData);
+    return dstData;
+}
+
+std::vector<std::byte> ReadTensorFromImages(std::span<const std::filesystem::path> srcPaths, const ImageTensorInfo& dstTensorInfo)
+{
+    const size_t imageSize = SafeSizeCast(dstTensorInfo.sizeInBytes);
+    std::vector<std::byte> dstData(SafeSizeCast(SafeMultiply(dstTensorInfo.sizeInBytes, srcPaths.size())));
+
+    // Each image is decoded on its own thread, straight into its slot of the batch.
+    ParallelFor(srcPaths.size(), 0, [&](size_t index, uint32_t /*workerIndex*/)
+    {
+        ReadTensorFromImage(srcPaths[index], dstTensorInfo, std::span<std::byte>(dstData.data() + index * imageSize, imageSize));
+    });
+
+    return dstData;
+}
@@ -16,6 +16,22 @@ enum class ImageTensorChannelOrder
     Grayscale,
 };
 
+// How an image is fit to a tensor whose width and height differ from the image's.
+enum class ImageResampleMode
+{
+    Scale,      // Stretched to the tensor's size.
+    CenterCrop, // Scaled, keeping its aspect ratio, to cover the tensor; the center is kept.
+    Letterbox,  // Scaled, keeping its aspect ratio, to fit in the tensor; centered and padded.
+    Fit,        // Like Letterbox, but placed at the top left, so tensor coordinates are image coordinates times a scale.
+};
+
+enum class ImageResampleFilter
+{
+    Cubic,  // Catmull-Rom, antialiased when downscaling.
+    Linear, // Bilinear, as in most ML preprocessing libraries (not antialiased).
+    Area,   // Averages the source pixels each pixel covers.
+};
+
 struct ImageTensorInfo
 {
     DML_TENSOR_DATA_TYPE dataType;
@@ -25,13 +41,50 @@ struct ImageTensorInfo
     uint64_t sizeInBytes;
     ImageTensorLayout layout;
     ImageTensorChannelOrder channelOrder;
+
+    // Per-channel normalization of FLOAT32 and FLOAT16 elements, in the tensor's channel order: each element is
+    // (v / 255 - mean) / std. Either may hold one value for all channels, or be empty (mean 0, std 1).
+    std::vector<float> normalizeMean;
+    std::vector<float> normalizeStd;
+
+    // How images are resampled when read; padding (Letterbox and Fit) has padValue in every channel but alpha,
+    // which is opaque.
+    ImageResampleMode resampleMode = ImageResampleMode::Scale;
+    ImageResampleFilter resampleFilter = ImageResampleFilter::Cubic;
+    uint8_t padValue = 0;
 };
 
+// Images (.png or .jpg) are read and written with WIC on Windows, and with libpng and libjpeg elsewhere. Each
+// 8-bit channel value v maps to a tensor element as follows (and back, rounding and clamping, when writing):
+// - FLOAT32, FLOAT16: v / 255, in [0, 1], then normalized if normalizeMean or normalizeStd is set
+// - UINT8: v
+// - INT8: v - 128
+// Channel reordering, normalization, layout, and casting are fused into one vectorized pass over the pixels,
+// split across threads by rows.
+
+// Decodes an image, resampling it to the tensor's width and height if they differ from the image's. On
+// Windows, the cubic filter is WIC's; the other filters are the same on every platform. Resizing is vectorized
+// and split across threads by rows.
 std::vector<std::byte> ReadTensorFromImage(
     const std::filesystem::path& srcPath,
     const ImageTensorInfo& dstTensorInfo
 );
 
+// Decodes an image into dstData, which must hold dstTensorInfo.sizeInBytes.
+void ReadTensorFromImage(
+    const std::filesystem::path& srcPath,
+    const ImageTensorInfo& dstTensorInfo,
+    std::span<std::byte> dstData
+);
+
+// Decodes images, in parallel, into consecutive slots of a batch (e.g. the N dimension of an NCHW tensor);
+// dstTensorInfo describes one slot.
+std::vector<std::byte> ReadTensorFromImages(
+    std::span<const std::filesystem::path> srcPaths,
+    const ImageTensorInfo& dstTensorInfo
+);
+
+// Encodes a tensor as an image; the file extension determines the format.
 void WriteTensorToImage(
     const std::filesystem::path& dstPath,
     std::span<const std::byte> srcData,
@@ -2,9 +2,15 @@
 #include "JsonParsers.h"
 #include "StdSupport.h"
 #include "NpyReaderWriter.h"
+#include "NpzReaderWriter.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/stringbuffer.h"
 #include "ImageReaderWriter.h"
+#include "ParallelFor.h"
+#include "Philox.h"
+#include "SafeArithmetic.h"
+#include "TensorCast.h"
+#include "DirectMLSchema.h"
 #ifndef WIN32
 #define _stricmp strcasecmp
 #endif
@@ -319,6 +325,91 @@ T* AsPointer(gsl::span<T> s)
     return s.empty() ? nullptr : s.data();
 }
 
+constexpr size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Lays out all the parts of a desc (e.g. an operator desc and its tensor descs, sizes, and fused operators) in a
+// single block of memory. A desc is parsed twice with the same sequence of allocations: the first pass has no
+// memory and only measures the total size, and the second pass carves the parts out of a block of that size.
+class DescArena
+{
+public:
+    // All DML API structs are aligned to at most 8 bytes.
+    static constexpr size_t maxAlignment = alignof(uint64_t);
+
+    DescArena() = default;
+    DescArena(std::byte* data, size_t capacity) : m_data(data), m_capacity(capacity) {}
+
+    // True during the first pass. Allocations return null, so nothing may be read or written.
+    bool IsMeasuring() const { return m_data == nullptr; }
+
+    size_t GetSizeInBytes() const { return m_offset; }
+
+    std::byte* Allocate(size_t sizeInBytes, size_t alignment)
+    {
+        assert(alignment <= maxAlignment && (alignment & (alignment - 1)) == 0);
+        size_t offset = AlignUp(m_offset, alignment);
+        m_offset = offset + sizeInBytes;
+        if (IsMeasuring())
+        {
+            return nullptr;
+        }
+        assert(m_offset <= m_capacity);
+        return m_data + offset;
+    }
+
+    template <typename T>
+    T* Allocate(size_t count = 1)
+    {
+        static_assert(std::is_trivial_v<T>, "This class does not invoke constructors.");
+        return reinterpret_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+private:
+    std::byte* m_data = nullptr;
+    size_t m_capacity = 0;
+    size_t m_offset = 0;
+};
+
+// Invokes parse(DescArena&) once to measure and once more to fill a single allocation from the allocator.
+template <typename TParse>
+auto ParseInSingleAllocation(BucketAllocator& allocator, TParse&& parse)
+{
+    DescArena measuringArena;
+    parse(measuringArena);
+
+    size_t sizeInBytes = measuringArena.GetSizeInBytes();
+    static_assert(DescArena::maxAlignment == alignof(uint64_t));
+    auto data = allocator.Allocate<uint64_t>((sizeInBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    DescArena arena(reinterpret_cast<std::byte*>(data), sizeInBytes);
+    return parse(arena);
+}
+
+template <typename T, T (*ElementParser)(const rapidjson::Value&)>
+gsl::span<T> ParseArray(const rapidjson::Value& value, DescArena& arena)
+{
+    if (value.GetType() != rapidjson::Type::kArrayType)
+    {
+        throw std::invalid_argument("Expected an array.");
+    }
+
+    auto valueArray = value.GetArray();
+    auto outputElements = arena.Allocate<T>(valueArray.Size());
+    if (!outputElements || valueArray.Empty())
+    {
+        return {};
+    }
+
+    for (uint32_t i = 0; i < valueArray.Size(); i++)
+    {
+        outputElements[i] = ElementParser(valueArray[i]);
+    }
+
+    return gsl::make_span(outputElements, valueArray.Size());
+}
+
 namespace JsonParsers
 {
 // ----------------------------------------------------------------------------
@@ -418,6 +509,18 @@ gsl::span<float> ParseFloat32ArrayField(const rapidjson::Value& object, std::str
     });
 }
 
+std::vector<float> ParseFloat32ArrayAsVector(const rapidjson::Value& object)
+{
+    return ParseArrayAsVector<float>(object, ParseFloat32);
+}
+
+std::vector<float> ParseFloat32ArrayAsVectorField(const rapidjson::Value& object, std::string_view fieldName, bool required, std::vector<float> defaultValue)
+{
+    return ParseFieldHelper<std::vector<float>>(object, fieldName, required, defaultValue, [](auto& value){ 
+        return ParseFloat32ArrayAsVector(value); 
+    });
+}
+
 // ----------------------------------------------------------------------------
 // FLOAT64
 // ----------------------------------------------------------------------------
@@ -642,6 +745,18 @@ uint64_t ParseUInt64Field(const rapidjson::Value& object, std::string_view field
     });
 }
 
+std::vector<uint64_t> ParseUInt64ArrayAsVector(const rapidjson::Value& object)
+{
+    return ParseArrayAsVector<uint64_t>(object, ParseUInt64);
+}
+
+std::vector<uint64_t> ParseUInt64ArrayAsVectorField(const rapidjson::Value& object, std::string_view fieldName, bool required, std::vector<uint64_t> defaultValue)
+{
+    return ParseFieldHelper<std::vector<uint64_t>>(object, fieldName, required, defaultValue, [](auto& value){ 
+        return ParseUInt64ArrayAsVector(value); 
+    });
+}
+
 // ----------------------------------------------------------------------------
 // Mixed Primitives
 // ----------------------------------------------------------------------------
@@ -842,17 +957,23 @@ DML_SCALE_BIAS* ParseDmlScaleBiasField(const rapidjson::Value& object, std::stri
 // DML_BUFFER_TENSOR_DESC
 // ----------------------------------------------------------------------------
 
-DML_BUFFER_TENSOR_DESC* ParseDmlBufferTensorDesc(const rapidjson::Value& value, BucketAllocator& allocator)
+static DML_BUFFER_TENSOR_DESC* ParseDmlBufferTensorDesc(const rapidjson::Value& value, DescArena& arena)
 {
     if (!value.IsObject())
     {
         throw std::invalid_argument("Expected a non-null JSON object.");
     }
 
-    auto sizes = ParseUInt32ArrayField(value, "Sizes", allocator);
-    auto strides = ParseUInt32ArrayField(value, "Strides", allocator, false);
+    auto parseUInt32Array = [&arena](auto& value){ return ParseArray<uint32_t, ParseUInt32>(value, arena); };
+    auto sizes = ParseFieldHelper<gsl::span<uint32_t>>(value, "Sizes", true, {}, parseUInt32Array);
+    auto strides = ParseFieldHelper<gsl::span<uint32_t>>(value, "Strides", false, {}, parseUInt32Array);
+
+    auto desc = arena.Allocate<DML_BUFFER_TENSOR_DESC>();
+    if (arena.IsMeasuring())
+    {
+        return nullptr;
+    }
 
-    auto desc = allocator.Allocate<DML_BUFFER_TENSOR_DESC>();
     desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", false, static_cast<uint32_t>(sizes.size()));
     desc->DataType = ParseDmlTensorDataTypeField(value, "DataType");
     desc->Flags = ParseDmlTensorFlagsField(value, "Flags", false, DML_TENSOR_FLAG_NONE);
@@ -872,6 +993,13 @@ DML_BUFFER_TENSOR_DESC* ParseDmlBufferTensorDesc(const rapidjson::Value& value,
     return desc;
 }
 
+DML_BUFFER_TENSOR_DESC* ParseDmlBufferTensorDesc(const rapidjson::Value& value, BucketAllocator& allocator)
+{
+    return ParseInSingleAllocation(allocator, [&value](DescArena& arena){ 
+        return ParseDmlBufferTensorDesc(value, arena); 
+    });
+}
+
 DML_BUFFER_TENSOR_DESC* ParseDmlBufferTensorDescField(const rapidjson::Value& object, std::string_view fieldName, BucketAllocator& allocator, bool required, DML_BUFFER_TENSOR_DESC* defaultValue)
 {
     return ParseFieldHelper<DML_BUFFER_TENSOR_DESC*>(object, fieldName, required, defaultValue, [&allocator](auto& value){ 
@@ -883,34 +1011,31 @@ DML_BUFFER_TENSOR_DESC* ParseDmlBufferTensorDescField(const rapidjson::Value& ob
 // DML_TENSOR_DESC
 // ----------------------------------------------------------------------------
 
-DML_TENSOR_DESC* ParseDmlTensorDesc(const rapidjson::Value& value, BucketAllocator& allocator)
+// Fills in a tensor desc that was already allocated from the arena (null when measuring).
+static void ParseDmlTensorDesc(const rapidjson::Value& value, DescArena& arena, DML_TENSOR_DESC* desc)
 {
     if (!value.IsObject())
     {
         throw std::invalid_argument("Expected a non-null JSON object.");
     }
 
-    auto desc = allocator.Allocate<DML_TENSOR_DESC>();
-    desc->Type = ParseDmlTensorTypeField(value, "Type", false, DML_TENSOR_TYPE_BUFFER);
-    if (value.HasMember("Desc"))
-    {
-        desc->Desc = ParseDmlBufferTensorDesc(value["Desc"], allocator);
-    }
-    else
+    auto descMember = value.FindMember("Desc");
+    auto bufferDesc = ParseDmlBufferTensorDesc(descMember != value.MemberEnd() ? descMember->value : value, arena);
+    if (desc)
     {
-        desc->Desc = ParseDmlBufferTensorDesc(value, allocator);
+        desc->Type = ParseDmlTensorTypeField(value, "Type", false, DML_TENSOR_TYPE_BUFFER);
+        desc->Desc = bufferDesc;
     }
-    return desc;
 }
 
-DML_TENSOR_DESC* ParseDmlTensorDescField(const rapidjson::Value& object, std::string_view fieldName, BucketAllocator& allocator, bool required, DML_TENSOR_DESC* defaultValue)
+static DML_TENSOR_DESC* ParseDmlTensorDesc(const rapidjson::Value& value, DescArena& arena)
 {
-    return ParseFieldHelper<DML_TENSOR_DESC*>(object, fieldName, required, defaultValue, [&allocator](auto& value){ 
-        return ParseDmlTensorDesc(value, allocator); 
-    });
+    auto desc = arena.Allocate<DML_TENSOR_DESC>();
+    ParseDmlTensorDesc(value, arena, desc);
+    return desc;
 }
 
-gsl::span<DML_TENSOR_DESC> ParseDmlTensorDescArray(const rapidjson::Value& value, BucketAllocator& allocator)
+static gsl::span<DML_TENSOR_DESC> ParseDmlTensorDescArray(const rapidjson::Value& value, DescArena& arena)
 {
     if (value.GetType() != rapidjson::Type::kArrayType)
     {
@@ -918,15 +1043,40 @@ gsl::span<DML_TENSOR_DESC> ParseDmlTensorDescArray(const rapidjson::Value& value
     }
 
     auto valueArray = value.GetArray();
-    auto outputElements = allocator.Allocate<DML_TENSOR_DESC>(valueArray.Size());
+    auto outputElements = arena.Allocate<DML_TENSOR_DESC>(valueArray.Size());
     for (uint32_t i = 0; i < valueArray.Size(); i++)
     {
-        outputElements[i] = *ParseDmlTensorDesc(valueArray[i], allocator);
+        ParseDmlTensorDesc(valueArray[i], arena, outputElements ? &outputElements[i] : nullptr);
     }
 
+    if (!outputElements || valueArray.Empty())
+    {
+        return {};
+    }
     return gsl::make_span(outputElements, valueArray.Size());
 }
 
+DML_TENSOR_DESC* ParseDmlTensorDesc(const rapidjson::Value& value, BucketAllocator& allocator)
+{
+    return ParseInSingleAllocation(allocator, [&value](DescArena& arena){ 
+        return ParseDmlTensorDesc(value, arena); 
+    });
+}
+
+DML_TENSOR_DESC* ParseDmlTensorDescField(const rapidjson::Value& object, std::string_view fieldName, BucketAllocator& allocator, bool required, DML_TENSOR_DESC* defaultValue)
+{
+    return ParseFieldHelper<DML_TENSOR_DESC*>(object, fieldName, required, defaultValue, [&allocator](auto& value){ 
+        return ParseDmlTensorDesc(value, allocator); 
+    });
+}
+
+gsl::span<DML_TENSOR_DESC> ParseDmlTensorDescArray(const rapidjson::Value& value, BucketAllocator& allocator)
+{
+    return ParseInSingleAllocation(allocator, [&value](DescArena& arena){ 
+        return ParseDmlTensorDescArray(value, arena); 
+    });
+}
+
 gsl::span<DML_TENSOR_DESC> ParseDmlTensorDescArrayField(const rapidjson::Value& object, std::string_view fieldName, BucketAllocator& allocator, bool required, gsl::span<DML_TENSOR_DESC> defaultValue)
 {
     return ParseFieldHelper<gsl::span<DML_TENSOR_DESC>>(object, fieldName, required, defaultValue, [&allocator](auto& value){ 
@@ -935,38 +1085,102 @@ gsl::span<DML_TENSOR_DESC> ParseDmlTensorDescArrayField(const rapidjson::Value&
 }
 
 // ----------------------------------------------------------------------------
-// DML_OPERATOR_DESC
+// NAME LOOKUP
 // ----------------------------------------------------------------------------
 
-DML_OPERATOR_DESC* ParseDmlOperatorDescField(const rapidjson::Value& object, std::string_view fieldName, bool fused, BucketAllocator& allocator, bool required, DML_OPERATOR_DESC* defaultValue)
+// FNV-1a hash of a name.
+constexpr uint32_t HashName(std::string_view name)
 {
-    return ParseFieldHelper<DML_OPERATOR_DESC*>(object, fieldName, required, defaultValue, [=,&allocator](auto& value){ 
-        return ParseDmlOperatorDesc(value, fused, allocator); 
-    });
+    uint32_t hash = 2166136261u;
+    for (char c : name)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
 }
 
-gsl::span<DML_OPERATOR_DESC> ParseDmlOperatorDescArray(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+// Rehashes a name's hash with a seed (murmur3 finalizer), so that different seeds scatter names independently.
+constexpr uint32_t MixHash(uint32_t hash, uint32_t seed)
 {
-    if (value.GetType() != rapidjson::Type::kArrayType)
+    hash ^= seed * 0x9E3779B9u;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+// Maps the names of enum values (both the full name, e.g. "DML_TENSOR_DATA_TYPE_FLOAT32", and the short name,
+// e.g. "FLOAT32") to their values. The tables are perfect hashes computed by GenerateParsingHelpers.ps1 using
+// hash-and-displace: each name's hash selects a bucket, and the bucket's displacement was chosen so that every
+// name lands in its own slot. A lookup is a hash of the name and a single string comparison.
+template <typename T, size_t BucketCount, size_t SlotCount>
+struct NameTable
+{
+    static_assert((SlotCount & (SlotCount - 1)) == 0, "SlotCount must be a power of two.");
+
+    struct Slot
     {
-        throw std::invalid_argument("Expected an array.");
-    }
+        std::string_view name;
+        T value;
+    };
 
-    auto valueArray = value.GetArray();
-    auto outputElements = allocator.Allocate<DML_OPERATOR_DESC>(valueArray.Size());
-    for (uint32_t i = 0; i < valueArray.Size(); i++)
+    std::array<uint32_t, BucketCount> displacements;
+    std::array<Slot, SlotCount> slots;
+
+    // Returns the value with the given name, or null if the name is not in the table.
+    constexpr const T* Find(std::string_view name) const
     {
-        outputElements[i] = *ParseDmlOperatorDesc(valueArray[i], fused, allocator);
+        uint32_t hash = HashName(name);
+        auto& slot = slots[MixHash(hash, displacements[hash % BucketCount]) & (SlotCount - 1)];
+        return (!slot.name.empty() && slot.name == name) ? &slot.value : nullptr;
     }
+};
 
-    return gsl::make_span(outputElements, valueArray.Size());
+// ----------------------------------------------------------------------------
+// OPERATOR SCHEMA
+// ----------------------------------------------------------------------------
+
+// Parses an operator desc field that the schema types as UINT but that holds an enum value or a BOOL.
+using DmlUInt32FieldParser = uint32_t (*)(const rapidjson::Value& value);
+
+template <typename T, T (*Parser)(const rapidjson::Value&)>
+uint32_t ParseAsUInt32(const rapidjson::Value& value)
+{
+    return static_cast<uint32_t>(Parser(value));
 }
 
-gsl::span<DML_OPERATOR_DESC> ParseDmlOperatorDescArrayField(const rapidjson::Value& object, std::string_view fieldName, bool fused, BucketAllocator& allocator, bool required, gsl::span<DML_OPERATOR_DESC> defaultValue)
+// The schema of an operator type (from DirectMLSchema.h) and, if any of its UINT fields are enums or BOOLs,
+// an array with a parser for each field. UINT fields with a null parser (and all other fields) are parsed
+// according to their schema type.
+struct DmlOperatorSchemaInfo
 {
-    return ParseFieldHelper<gsl::span<DML_OPERATOR_DESC>>(object, fieldName, required, defaultValue, [=,&allocator](auto& value){ 
-        return ParseDmlOperatorDescArray(value, fused, allocator); 
-    });
+    const DML_OPERATOR_SCHEMA* schema;
+    const DmlUInt32FieldParser* uint32FieldParsers;
+};
+
+// Size and alignment of a field in an operator desc struct (e.g. DML_CONVOLUTION_OPERATOR_DESC).
+struct DmlSchemaFieldLayout
+{
+    size_t size;
+    size_t alignment;
+};
+
+static constexpr DmlSchemaFieldLayout GetDmlSchemaFieldLayout(DML_SCHEMA_FIELD_TYPE type)
+{
+    switch (type)
+    {
+    case DML_SCHEMA_FIELD_TYPE_UINT:
+    case DML_SCHEMA_FIELD_TYPE_INT:
+    case DML_SCHEMA_FIELD_TYPE_FLOAT:
+    case DML_SCHEMA_FIELD_TYPE_BOOL: return { sizeof(uint32_t), alignof(uint32_t) };
+    case DML_SCHEMA_FIELD_TYPE_UINT64: return { sizeof(uint64_t), alignof(uint64_t) };
+    case DML_SCHEMA_FIELD_TYPE_SIZE_2D: return { sizeof(DML_SIZE_2D), alignof(DML_SIZE_2D) };
+    case DML_SCHEMA_FIELD_TYPE_SCALAR_UNION: return { sizeof(DML_SCALAR_UNION), alignof(DML_SCALAR_UNION) };
+    default: return { sizeof(void*), alignof(void*) };
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -984,6 +1198,233 @@ uint64_t GetTensorSize(const DML_TENSOR_DESC& desc)
 
 #include "JsonParsersGenerated.cpp"
 
+// ----------------------------------------------------------------------------
+// DML_OPERATOR_DESC
+// ----------------------------------------------------------------------------
+
+static void ParseDmlOperatorDesc(const rapidjson::Value& value, bool fused, DescArena& arena, DML_OPERATOR_DESC* opDesc);
+
+static DML_OPERATOR_DESC* ParseDmlOperatorDesc(const rapidjson::Value& value, bool fused, DescArena& arena)
+{
+    auto opDesc = arena.Allocate<DML_OPERATOR_DESC>();
+    ParseDmlOperatorDesc(value, fused, arena, opDesc);
+    return opDesc;
+}
+
+static gsl::span<DML_OPERATOR_DESC> ParseDmlOperatorDescArray(const rapidjson::Value& value, bool fused, DescArena& arena)
+{
+    if (value.GetType() != rapidjson::Type::kArrayType)
+    {
+        throw std::invalid_argument("Expected an array.");
+    }
+
+    auto valueArray = value.GetArray();
+    auto outputElements = arena.Allocate<DML_OPERATOR_DESC>(valueArray.Size());
+    for (uint32_t i = 0; i < valueArray.Size(); i++)
+    {
+        ParseDmlOperatorDesc(valueArray[i], fused, arena, outputElements ? &outputElements[i] : nullptr);
+    }
+
+    if (!outputElements || valueArray.Empty())
+    {
+        return {};
+    }
+    return gsl::make_span(outputElements, valueArray.Size());
+}
+
+// Parses the value of an operator desc field according to its schema type. The value is written to fieldData,
+// which is null when measuring: values stored in the desc struct itself are only parsed when filling it.
+static void ParseDmlOperatorDescField(
+    const DML_SCHEMA_FIELD& field,
+    DmlUInt32FieldParser uint32FieldParser,
+    std::optional<DML_TENSOR_DATA_TYPE> scalarUnionDataType,
+    const rapidjson::Value& value,
+    DescArena& arena,
+    std::byte* fieldData)
+{
+    auto write = [fieldData](auto fieldValue) {
+        if (fieldData)
+        {
+            memcpy(fieldData, &fieldValue, sizeof(fieldValue));
+        }
+    };
+
+    switch (field.Type)
+    {
+    case DML_SCHEMA_FIELD_TYPE_TENSOR_DESC: write(ParseDmlTensorDesc(value, arena)); return;
+    case DML_SCHEMA_FIELD_TYPE_TENSOR_DESC_ARRAY: write(AsPointer(ParseDmlTensorDescArray(value, arena))); return;
+    case DML_SCHEMA_FIELD_TYPE_OPERATOR_DESC: write(ParseDmlOperatorDesc(value, true, arena)); return;
+    case DML_SCHEMA_FIELD_TYPE_OPERATOR_DESC_ARRAY: write(AsPointer(ParseDmlOperatorDescArray(value, true, arena))); return;
+    case DML_SCHEMA_FIELD_TYPE_UINT_ARRAY: write(AsPointer(ParseArray<uint32_t, ParseUInt32>(value, arena))); return;
+    case DML_SCHEMA_FIELD_TYPE_INT_ARRAY: write(AsPointer(ParseArray<int32_t, ParseInt32>(value, arena))); return;
+    case DML_SCHEMA_FIELD_TYPE_FLOAT_ARRAY: write(AsPointer(ParseArray<float, ParseFloat32>(value, arena))); return;
+    case DML_SCHEMA_FIELD_TYPE_SCALE_BIAS:
+    {
+        auto scaleBias = arena.Allocate<DML_SCALE_BIAS>();
+        if (scaleBias)
+        {
+            *scaleBias = ParseDmlScaleBias(value);
+        }
+        write(scaleBias);
+        return;
+    }
+    default: break;
+    }
+
+    if (!fieldData)
+    {
+        return;
+    }
+
+    switch (field.Type)
+    {
+    case DML_SCHEMA_FIELD_TYPE_UINT: write(uint32FieldParser ? uint32FieldParser(value) : ParseUInt32(value)); break;
+    case DML_SCHEMA_FIELD_TYPE_UINT64: write(ParseUInt64(value)); break;
+    case DML_SCHEMA_FIELD_TYPE_INT: write(ParseInt32(value)); break;
+    case DML_SCHEMA_FIELD_TYPE_FLOAT: write(ParseFloat32(value)); break;
+    case DML_SCHEMA_FIELD_TYPE_BOOL: write(static_cast<uint32_t>(ParseBool(value) ? 1 : 0)); break;
+    case DML_SCHEMA_FIELD_TYPE_SIZE_2D: write(ParseDmlSize2d(value)); break;
+    case DML_SCHEMA_FIELD_TYPE_SCALAR_UNION:
+    {
+        if (!scalarUnionDataType)
+        {
+            throw std::invalid_argument("The data type of the scalar is unknown.");
+        }
+        write(ParseDmlScalarUnion(value, *scalarUnionDataType));
+        break;
+    }
+    default: throw std::invalid_argument("Unsupported schema field type.");
+    }
+}
+
+// Parses any operator desc using its schema. The desc struct's layout is computed from the schema, so there is no
+// per-operator parsing code: only the UINT fields that hold enums need a hint, which is generated.
+static void ParseDmlOperatorDesc(const rapidjson::Value& value, bool fused, DescArena& arena, DML_OPERATOR_DESC* opDesc)
+{
+    if (!value.IsObject())
+    {
+        throw std::invalid_argument("Expected a non-null JSON object.");
+    }
+    auto typeMember = value.FindMember("Type");
+    if (typeMember == value.MemberEnd())
+    {
+        typeMember = value.FindMember("type");
+    }
+    if (typeMember == value.MemberEnd())
+    {
+        throw std::invalid_argument("Expected a member 'Type' with the operator type.");
+    }
+    if (typeMember->value.GetType() != rapidjson::Type::kStringType)
+    {
+        throw std::invalid_argument("The member 'Type' must be a string.");
+    }
+    auto descMember = value.FindMember("Desc");
+    if (descMember == value.MemberEnd())
+    {
+        descMember = value.FindMember("desc");
+    }
+    const rapidjson::Value& descValue = descMember != value.MemberEnd() ? descMember->value : value;
+    auto type = c_dmlOperatorTypeNames.Find({typeMember->value.GetString(), typeMember->value.GetStringLength()});
+    if (!type)
+    {
+        throw std::invalid_argument("Unknown operator type.");
+    }
+
+    auto [schema, uint32FieldParsers] = GetDmlOperatorSchemaInfo(*type);
+    auto fields = gsl::make_span(schema->Fields, schema->FieldCount);
+
+    size_t descSize = 0;
+    size_t descAlignment = 1;
+    for (auto& field : fields)
+    {
+        auto layout = GetDmlSchemaFieldLayout(field.Type);
+        descSize = AlignUp(descSize, layout.alignment) + layout.size;
+        descAlignment = std::max(descAlignment, layout.alignment);
+    }
+    descSize = AlignUp(descSize, descAlignment);
+
+    auto desc = arena.Allocate(descSize, descAlignment);
+    if (desc)
+    {
+        memset(desc, 0, descSize);
+        opDesc->Type = *type;
+        opDesc->Desc = desc;
+    }
+
+    std::optional<DML_TENSOR_DATA_TYPE> scalarUnionDataType;
+    size_t fieldOffset = 0;
+    for (size_t i = 0; i < fields.size(); i++)
+    {
+        auto& field = fields[i];
+        auto layout = GetDmlSchemaFieldLayout(field.Type);
+        fieldOffset = AlignUp(fieldOffset, layout.alignment);
+        std::byte* fieldData = desc ? desc + fieldOffset : nullptr;
+        fieldOffset += layout.size;
+
+        // Fused operators have no tensors of their own; they are left null.
+        if (fused && (field.Type == DML_SCHEMA_FIELD_TYPE_TENSOR_DESC || field.Type == DML_SCHEMA_FIELD_TYPE_TENSOR_DESC_ARRAY))
+        {
+            continue;
+        }
+
+        auto fieldMember = descValue.FindMember(field.Name);
+        if (fieldMember == descValue.MemberEnd())
+        {
+            if (!field.Optional)
+            {
+                throw std::invalid_argument(fmt::format("Field '{}' is required.", field.Name));
+            }
+            continue;
+        }
+
+        auto uint32FieldParser = uint32FieldParsers ? uint32FieldParsers[i] : nullptr;
+        try
+        {
+            ParseDmlOperatorDescField(field, uint32FieldParser, scalarUnionDataType, fieldMember->value, arena, fieldData);
+        }
+        catch (const std::exception& e)
+        {
+            throw std::invalid_argument(fmt::format("Error parsing field '{}': {}", field.Name, e.what()));
+        }
+
+        // A scalar union holds a value of the type given by the nearest data type field before it.
+        if (fieldData && uint32FieldParser == &ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>)
+        {
+            uint32_t dataType;
+            memcpy(&dataType, fieldData, sizeof(dataType));
+            scalarUnionDataType = static_cast<DML_TENSOR_DATA_TYPE>(dataType);
+        }
+    }
+}
+
+DML_OPERATOR_DESC* ParseDmlOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+{
+    return ParseInSingleAllocation(allocator, [&value, fused](DescArena& arena){ 
+        return ParseDmlOperatorDesc(value, fused, arena); 
+    });
+}
+
+DML_OPERATOR_DESC* ParseDmlOperatorDescField(const rapidjson::Value& object, std::string_view fieldName, bool fused, BucketAllocator& allocator, bool required, DML_OPERATOR_DESC* defaultValue)
+{
+    return ParseFieldHelper<DML_OPERATOR_DESC*>(object, fieldName, required, defaultValue, [=,&allocator](auto& value){ 
+        return ParseDmlOperatorDesc(value, fused, allocator); 
+    });
+}
+
+gsl::span<DML_OPERATOR_DESC> ParseDmlOperatorDescArray(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+{
+    return ParseInSingleAllocation(allocator, [&value, fused](DescArena& arena){ 
+        return ParseDmlOperatorDescArray(value, fused, arena); 
+    });
+}
+
+gsl::span<DML_OPERATOR_DESC> ParseDmlOperatorDescArrayField(const rapidjson::Value& object, std::string_view fieldName, bool fused, BucketAllocator& allocator, bool required, gsl::span<DML_OPERATOR_DESC> defaultValue)
+{
+    return ParseFieldHelper<gsl::span<DML_OPERATOR_DESC>>(object, fieldName, required, defaultValue, [=,&allocator](auto& value){ 
+        return ParseDmlOperatorDescArray(value, fused, allocator); 
+    });
+}
+
 std::vector<std::byte> GenerateInitialValuesFromList(DML_TENSOR_DATA_TYPE dataType, const rapidjson::Value& object)
 {
     switch (dataType)
@@ -1005,7 +1446,7 @@ std::vector<std::byte> GenerateInitialValuesFromList(DML_TENSOR_DATA_TYPE dataTy
 
 std::vector<std::byte> GenerateInitialValuesFromConstant(DML_TENSOR_DATA_TYPE dataType, const rapidjson::Value& object)
 {
-    auto valueCount = ParseUInt32Field(object, "valueCount");
+    auto valueCount = ParseUInt64Field(object, "valueCount");
 
     auto AsBytes = [=](auto value)->std::vector<std::byte>
     {
@@ -1015,7 +1456,7 @@ std::vector<std::byte> GenerateInitialValuesFromConstant(DML_TENSOR_DATA_TYPE da
             valueBytes.push_back(byte);
         }
 
-        std::vector<std::byte> allBytes(valueBytes.size() * valueCount);
+        std::vector<std::byte> allBytes(SafeSizeCast(SafeMultiply(valueBytes.size(), valueCount)));
         for (size_t i = 0; i < valueCount; i++)
         {
             std::copy(valueBytes.begin(), valueBytes.end(), allBytes.begin() + i * valueBytes.size());
@@ -1042,7 +1483,7 @@ std::vector<std::byte> GenerateInitialValuesFromConstant(DML_TENSOR_DATA_TYPE da
 
 std::vector<std::byte> GenerateInitialValuesFromSequence(DML_TENSOR_DATA_TYPE dataType, const rapidjson::Value& object)
 {
-    auto valueCount = ParseUInt32Field(object, "valueCount");
+    auto valueCount = ParseUInt64Field(object, "valueCount");
 
     auto AsBytes = [=,&object](auto& parser, auto defaultValue)->std::vector<std::byte>
     {
@@ -1050,7 +1491,7 @@ std::vector<std::byte> GenerateInitialValuesFromSequence(DML_TENSOR_DATA_TYPE da
         auto valueDelta = parser(object, "valueDelta", true, defaultValue);
 
         std::vector<std::byte> allBytes;
-        allBytes.reserve(sizeof(value) * valueCount);
+        allBytes.reserve(SafeSizeCast(SafeMultiply(sizeof(value), valueCount)));
         for (size_t i = 0; i < valueCount; i++)
         {
             for (auto byte : gsl::as_bytes(gsl::make_span(&value, 1)))
@@ -1079,6 +1520,226 @@ std::vector<std::byte> GenerateInitialValuesFromSequence(DML_TENSOR_DATA_TYPE da
     }
 }
 
+// Returns a uniformly distributed float in [0, 1) from the high 24 bits of a random word.
+static float ToUnitFloat(uint32_t bits)
+{
+    return (bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// Returns a uniformly distributed double in [0, 1) from the high 53 bits of two random words.
+static double ToUnitDouble(uint32_t highBits, uint32_t lowBits)
+{
+    return (((static_cast<uint64_t>(highBits) << 32) | lowBits) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Converts to T, rounding and clamping to T's range if T is an integer type.
+template <typename T>
+T SaturateCast(double value)
+{
+    if constexpr (std::is_integral_v<T>)
+    {
+        value = std::nearbyint(value);
+        if (!(value > static_cast<double>(std::numeric_limits<T>::lowest()))) { return std::numeric_limits<T>::lowest(); }
+        if (value >= static_cast<double>(std::numeric_limits<T>::max())) { return std::numeric_limits<T>::max(); }
+    }
+    return static_cast<T>(value);
+}
+
+// Generates valueCount values with convert(const Philox4x32::Result&, uint64_t group, std::array<T, ValuesPerGroup>&),
+// which turns the 128 random bits of one Philox call into a group of values (the group index is only needed to draw
+// more bits for rejection sampling). A value only depends on the seed and its index,
+// so the buffer is split into chunks that are filled in parallel, and the result is the same for any number of
+// threads. The inner loop is straight-line integer math over independent groups, which compilers vectorize.
+template <typename T, size_t ValuesPerGroup, typename TConvert>
+std::vector<std::byte> GenerateRandomValues(uint64_t valueCount, uint64_t seed, TConvert&& convert)
+{
+    constexpr uint64_t groupsPerChunk = 16384;
+    std::vector<std::byte> bytes(SafeSizeCast(SafeMultiply(valueCount, sizeof(T))));
+    uint64_t groupCount = valueCount / ValuesPerGroup + (valueCount % ValuesPerGroup != 0);
+    uint64_t chunkCount = (groupCount + groupsPerChunk - 1) / groupsPerChunk;
+
+    T* values = reinterpret_cast<T*>(bytes.data());
+    Philox4x32 generator(seed);
+
+    ParallelFor(chunkCount, 0, [&](size_t chunkIndex, uint32_t workerIndex)
+    {
+        uint64_t groupBegin = chunkIndex * groupsPerChunk;
+        uint64_t groupEnd = std::min(groupBegin + groupsPerChunk, groupCount);
+        for (uint64_t group = groupBegin; group < groupEnd; group++)
+        {
+            std::array<T, ValuesPerGroup> groupValues;
+            convert(generator(group), group, groupValues);
+
+            uint64_t valueBegin = group * ValuesPerGroup;
+            uint64_t groupValueCount = std::min<uint64_t>(ValuesPerGroup, valueCount - valueBegin);
+            std::copy_n(groupValues.begin(), groupValueCount, values + valueBegin);
+        }
+    });
+
+    return bytes;
+}
+
+template <typename T>
+std::vector<std::byte> GenerateRandomValues(const rapidjson::Value& object)
+{
+    constexpr bool isFloatingPoint = !std::is_integral_v<T>;
+
+    // Each Philox call makes four 32-bit words: one per value for types up to 32 bits, or two per 64-bit value.
+    constexpr uint32_t wordsPerValue = sizeof(T) == 8 ? 2 : 1;
+    constexpr size_t valuesPerGroup = 4 / wordsPerValue;
+    using Group = std::array<T, valuesPerGroup>;
+
+    auto valueCount = ParseUInt64Field(object, "valueCount");
+    auto seed = ParseUInt64Field(object, "seed", false, 0);
+    auto distribution = ParseStringField(object, "distribution");
+
+    if (distribution == "uniform")
+    {
+        if constexpr (isFloatingPoint)
+        {
+            double min = ParseFloat64Field(object, "min", false, 0.0);
+            double max = ParseFloat64Field(object, "max", false, 1.0);
+            if (!std::isfinite(min) || !std::isfinite(max) || !(min <= max))
+            {
+                throw std::invalid_argument("Fields 'min' and 'max' must be finite with min <= max.");
+            }
+
+            // Values are in [min, max), but rounding to T (especially FLOAT16) can still land on max, so results
+            // are clamped to the largest T below max. That is never less than T(min), so min == max gives min.
+            using std::nextafter;
+            T upper = static_cast<T>(max);
+            if (min < max && !(static_cast<double>(upper) < max))
+            {
+                upper = std::max(nextafter(upper, static_cast<T>(min)), static_cast<T>(min));
+            }
+
+            return GenerateRandomValues<T, valuesPerGroup>(valueCount, seed, [=](const Philox4x32::Result& bits, uint64_t group, Group& values)
+            {
+                for (uint32_t i = 0; i < valuesPerGroup; i++)
+                {
+                    double unit = wordsPerValue == 2 ? ToUnitDouble(bits[2 * i], bits[2 * i + 1]) : ToUnitFloat(bits[i]);
+                    T value = static_cast<T>(min + unit * (max - min));
+                    values[i] = value < upper ? value : upper;
+                }
+            });
+        }
+        else
+        {
+            // Integers are uniform over [min, max], which defaults to the entire range of the type.
+            using WideType = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+            auto parseLimit = [&object](std::string_view fieldName, WideType defaultValue) -> WideType
+            {
+                if constexpr (std::is_signed_v<T>) { return ParseInt64Field(object, fieldName, false, defaultValue); }
+                else { return ParseUInt64Field(object, fieldName, false, defaultValue); }
+            };
+            WideType min = parseLimit("min", std::numeric_limits<T>::lowest());
+            WideType max = parseLimit("max", std::numeric_limits<T>::max());
+            if (min < std::numeric_limits<T>::lowest() || max > std::numeric_limits<T>::max() || min > max)
+            {
+                throw std::invalid_argument("Fields 'min' and 'max' must be in the range of 'initialValuesDataType' with min <= max.");
+            }
+
+            // A range of 0 means all 2^64 values.
+            uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+
+            // Rejection sampling keeps the offsets unbiased when range doesn't divide 2^32 (or 2^64): the random
+            // words that would map onto the low offsets one extra time are redrawn. Redraws use the value's
+            // index with a nonzero high counter word, so they never overlap the main sequence and stay
+            // independent of the thread count. Fewer than half of the draws are rejected in the worst case.
+            constexpr uint64_t wordRange = wordsPerValue == 1 ? (uint64_t(1) << 32) : 0;
+            uint64_t rejectBelow = range ? (wordRange - range) % range : 0;
+            Philox4x32 redrawGenerator(seed);
+
+            return GenerateRandomValues<T, valuesPerGroup>(valueCount, seed, [=](const Philox4x32::Result& bits, uint64_t group, Group& values)
+            {
+                for (uint32_t i = 0; i < valuesPerGroup; i++)
+                {
+                    uint64_t offset;
+                    if constexpr (wordsPerValue == 1)
+                    {
+                        // Multiply-shift (Lemire): the high word is the offset, and the low word detects bias.
+                        uint64_t product = static_cast<uint64_t>(bits[i]) * range;
+                        for (uint64_t attempt = 1; static_cast<uint32_t>(product) < rejectBelow; attempt++)
+                        {
+                            product = static_cast<uint64_t>(redrawGenerator(group * valuesPerGroup + i, attempt)[0]) * range;
+                        }
+                        offset = product >> 32;
+                    }
+                    else
+                    {
+                        uint64_t wideBits = (static_cast<uint64_t>(bits[2 * i]) << 32) | bits[2 * i + 1];
+                        for (uint64_t attempt = 1; wideBits < rejectBelow; attempt++)
+                        {
+                            auto redraw = redrawGenerator(group * valuesPerGroup + i, attempt);
+                            wideBits = (static_cast<uint64_t>(redraw[0]) << 32) | redraw[1];
+                        }
+                        offset = range ? wideBits % range : wideBits;
+                    }
+                    values[i] = static_cast<T>(static_cast<uint64_t>(min) + offset);
+                }
+            });
+        }
+    }
+    else if (distribution == "normal")
+    {
+        double mean = ParseFloat64Field(object, "mean", false, 0.0);
+        double stddev = ParseFloat64Field(object, "stddev", false, 1.0);
+
+        // Box-Muller transform: each pair of uniform values makes a pair of normally distributed values.
+        return GenerateRandomValues<T, valuesPerGroup>(valueCount, seed, [=](const Philox4x32::Result& bits, uint64_t group, Group& values)
+        {
+            constexpr double twoPi = 6.283185307179586;
+            for (uint32_t i = 0; i < valuesPerGroup; i += 2)
+            {
+                double u0 = 1.0 - (wordsPerValue == 2 ? ToUnitDouble(bits[0], bits[1]) : ToUnitFloat(bits[i])); // (0, 1]
+                double u1 = wordsPerValue == 2 ? ToUnitDouble(bits[2], bits[3]) : ToUnitFloat(bits[i + 1]);
+                double radius = stddev * std::sqrt(-2.0 * std::log(u0));
+                values[i] = SaturateCast<T>(mean + radius * std::cos(twoPi * u1));
+                values[i + 1] = SaturateCast<T>(mean + radius * std::sin(twoPi * u1));
+            }
+        });
+    }
+    else if (distribution == "bernoulli")
+    {
+        double probability = ParseFloat64Field(object, "probability", false, 0.5);
+        if (!(probability >= 0.0 && probability <= 1.0))
+        {
+            throw std::invalid_argument("Field 'probability' must be in the range [0, 1].");
+        }
+
+        // Each value is 1 with the given probability and 0 otherwise.
+        uint64_t threshold = static_cast<uint64_t>(probability * 4294967296.0);
+        return GenerateRandomValues<T, valuesPerGroup>(valueCount, seed, [=](const Philox4x32::Result& bits, uint64_t group, Group& values)
+        {
+            for (uint32_t i = 0; i < valuesPerGroup; i++)
+            {
+                values[i] = static_cast<T>(bits[i * wordsPerValue] < threshold ? 1.0f : 0.0f);
+            }
+        });
+    }
+
+    throw std::invalid_argument(fmt::format("'{}' is not a recognized distribution. Expected 'uniform', 'normal', or 'bernoulli'.", distribution));
+}
+
+std::vector<std::byte> GenerateInitialValuesFromRandom(DML_TENSOR_DATA_TYPE dataType, const rapidjson::Value& object)
+{
+    switch (dataType)
+    {
+    case DML_TENSOR_DATA_TYPE_FLOAT16: return GenerateRandomValues<half_float::half>(object);
+    case DML_TENSOR_DATA_TYPE_FLOAT32: return GenerateRandomValues<float>(object);
+    case DML_TENSOR_DATA_TYPE_FLOAT64: return GenerateRandomValues<double>(object);
+    case DML_TENSOR_DATA_TYPE_UINT8: return GenerateRandomValues<uint8_t>(object);
+    case DML_TENSOR_DATA_TYPE_UINT16: return GenerateRandomValues<uint16_t>(object);
+    case DML_TENSOR_DATA_TYPE_UINT32: return GenerateRandomValues<uint32_t>(object);
+    case DML_TENSOR_DATA_TYPE_UINT64: return GenerateRandomValues<uint64_t>(object);
+    case DML_TENSOR_DATA_TYPE_INT8: return GenerateRandomValues<int8_t>(object);
+    case DML_TENSOR_DATA_TYPE_INT16: return GenerateRandomValues<int16_t>(object);
+    case DML_TENSOR_DATA_TYPE_INT32: return GenerateRandomValues<int32_t>(object);
+    case DML_TENSOR_DATA_TYPE_INT64: return GenerateRandomValues<int64_t>(object);
+    default: throw std::invalid_argument(fmt::format("Invalid tensor data type."));
+    }
+}
+
 std::filesystem::path ResolveInputFilePath(const std::filesystem::path& parentPath, std::string_view sourcePath)
 {
     auto filePathRelativeToParent = std::filesystem::absolute(parentPath / sourcePath);
@@ -1097,29 +1758,297 @@ std::filesystem::path ResolveOutputFilePath(const std::filesystem::path& parentP
     return filePathRelativeToParent;
 }
 
-std::vector<std::byte> ReadFileContent(const std::string& fileName)
+// Returns whether name matches a pattern in which * matches any run of characters and ? matches one character.
+bool MatchesWildcardPattern(std::string_view name, std::string_view pattern)
+{
+    size_t n = 0, p = 0;
+    size_t starPattern = std::string_view::npos, starName = 0;
+    while (n < name.size())
+    {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+        {
+            n++;
+            p++;
+        }
+        else if (p < pattern.size() && pattern[p] == '*')
+        {
+            starPattern = p++;
+            starName = n;
+        }
+        else if (starPattern != std::string_view::npos)
+        {
+            // Let the last * match one more character.
+            p = starPattern + 1;
+            n = ++starName;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*')
+    {
+        p++;
+    }
+    return p == pattern.size();
+}
+
+bool IsImageFilePath(const std::filesystem::path& path)
+{
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg";
+}
+
+// A sourcePath naming a directory or a wildcard pattern (e.g. "images/*.jpg") selects a batch of images.
+bool IsImageBatchSourcePath(const std::filesystem::path& parentPath, std::string_view sourcePath)
+{
+    return sourcePath.find_first_of("*?") != std::string_view::npos ||
+        std::filesystem::is_directory(ResolveInputFilePath(parentPath, sourcePath));
+}
+
+// Resolves a batch's sourcePath. Only the directory of a wildcard pattern is resolved like other input paths,
+// since the pattern itself never names an existing file.
+std::filesystem::path ResolveImageBatchSourcePath(const std::filesystem::path& parentPath, std::string_view sourcePath)
+{
+    if (sourcePath.find_first_of("*?") == std::string_view::npos)
+    {
+        return ResolveInputFilePath(parentPath, sourcePath);
+    }
+
+    auto patternPath = std::filesystem::path(sourcePath);
+    if (patternPath.parent_path().string().find_first_of("*?") != std::string::npos)
+    {
+        throw std::invalid_argument("Wildcards in 'sourcePath' may only appear in the file name.");
+    }
+    return ResolveInputFilePath(parentPath, patternPath.parent_path().string()) / patternPath.filename();
+}
+
+std::vector<std::filesystem::path> ListImageBatchPaths(const std::filesystem::path& parentPath, std::string_view sourcePath)
+{
+    auto resolvedPath = ResolveImageBatchSourcePath(parentPath, sourcePath);
+    std::filesystem::path directory = resolvedPath;
+    std::string pattern = "*";
+    if (sourcePath.find_first_of("*?") != std::string_view::npos)
+    {
+        directory = resolvedPath.parent_path();
+        pattern = resolvedPath.filename().string();
+    }
+
+    std::vector<std::filesystem::path> imagePaths;
+    for (auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        if (entry.is_regular_file() && IsImageFilePath(entry.path()) && MatchesWildcardPattern(entry.path().filename().string(), pattern))
+        {
+            imagePaths.push_back(entry.path());
+        }
+    }
+    if (imagePaths.empty())
+    {
+        throw std::ios::failure(fmt::format("No .png, .jpg, or .jpeg images match 'sourcePath' '{}'.", sourcePath));
+    }
+
+    std::sort(imagePaths.begin(), imagePaths.end());
+    return imagePaths;
+}
+
+// Returns the images of a batch (see ListImageBatchPaths) in slot order. The first batchSize images are used,
+// and if there are fewer, they're repeated to fill the batch.
+std::vector<std::filesystem::path> ResolveImageBatchPaths(const std::filesystem::path& parentPath, std::string_view sourcePath, uint32_t batchSize)
+{
+    std::vector<std::filesystem::path> imagePaths = ListImageBatchPaths(parentPath, sourcePath);
+    const size_t imageCount = std::min<size_t>(imagePaths.size(), batchSize);
+    imagePaths.resize(batchSize);
+    for (size_t i = imageCount; i < batchSize; i++)
+    {
+        imagePaths[i] = imagePaths[i % imageCount];
+    }
+    return imagePaths;
+}
+
+std::vector<std::byte> ReadFileContent(const std::string& fileName)
+{
+    std::ifstream file(fileName.c_str(), std::ifstream::ate | std::ifstream::binary);
+    if (!file.is_open())
+    {
+        throw std::ios::failure(fmt::format("Given filename '{}' could not be opened.", fileName));
+    }
+
+    size_t fileSize = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+    std::vector<std::byte> allBytes(fileSize);
+    file.read(reinterpret_cast<char*>(allBytes.data()), fileSize);
+
+    return allBytes;
+}
+
+// Returns the array data of a .npy file (or of a .npy file stored within a larger file, such as an .npz archive)
+// as a range of the mapped file when it can be used in place (the common case of little-endian, C-ordered data).
+// Otherwise the array is converted into owned memory. The size of the array itself (without any bytes following
+// it) is returned in arraySizeInBytes.
+ByteBuffer ReadNpyFileData(
+    const std::shared_ptr<MappedFile>& file, 
+    size_t offset, 
+    size_t sizeInBytes, 
+    /*out*/ DML_TENSOR_DATA_TYPE& tensorDataType,
+    /*out*/ uint64_t& arraySizeInBytes)
+{
+    auto fileData = file->GetData();
+    std::span<const std::byte> npyData(fileData.data() + offset, sizeInBytes);
+
+    NpyHeader header = ReadNpyHeader(npyData);
+    tensorDataType = header.dataType;
+    arraySizeInBytes = header.dataSizeInBytes;
+
+    std::vector<std::byte> convertedData;
+    auto arrayData = ReadNpyArrayData(npyData, header, /*out*/ convertedData);
+    if (arrayData.data() != convertedData.data())
+    {
+        // Like ReadNpy, any bytes following the array are kept.
+        return ByteBuffer(file, offset + header.dataByteOffset, arrayData.size());
+    }
+
+    return std::move(convertedData);
+}
+
+// Returns the array data of a .npy file held in memory, reusing the memory when the array can be used as it is.
+ByteBuffer ReadNpyFileData(
+    std::vector<std::byte>&& npyFileData, 
+    /*out*/ DML_TENSOR_DATA_TYPE& tensorDataType,
+    /*out*/ uint64_t& arraySizeInBytes)
+{
+    NpyHeader header = ReadNpyHeader(npyFileData);
+    tensorDataType = header.dataType;
+    arraySizeInBytes = header.dataSizeInBytes;
+
+    std::vector<std::byte> convertedData;
+    auto arrayData = ReadNpyArrayData(npyFileData, header, /*out*/ convertedData);
+    if (arrayData.data() != convertedData.data())
+    {
+        npyFileData.erase(npyFileData.begin(), npyFileData.begin() + header.dataByteOffset);
+        return std::move(npyFileData);
+    }
+
+    return std::move(convertedData);
+}
+
+// An .npz archive opened while parsing a model, with the index of its members.
+struct OpenedNpzArchive
+{
+    std::shared_ptr<MappedFile> file;
+    std::filesystem::file_time_type lastWriteTime;
+    NpzArchive index;
+};
+
+// While a model is parsed, archives are opened and indexed once, however many of their members are used. The
+// cache lives as long as a NpzArchiveCacheScope (one per ParseModel call; concurrent parses share it), so it's
+// released even when parsing fails. Members read in place keep their mapping alive. Outside of a scope (e.g. a
+// resource parsed on its own) each member opens the archive again.
+class NpzArchiveCacheScope
+{
+public:
+    NpzArchiveCacheScope()
+    {
+        std::scoped_lock lock(s_mutex);
+        s_scopeCount++;
+    }
+
+    ~NpzArchiveCacheScope()
+    {
+        std::scoped_lock lock(s_mutex);
+        if (--s_scopeCount == 0)
+        {
+            s_archives.clear();
+        }
+    }
+
+    NpzArchiveCacheScope(const NpzArchiveCacheScope&) = delete;
+    NpzArchiveCacheScope& operator=(const NpzArchiveCacheScope&) = delete;
+
+    static std::shared_ptr<const OpenedNpzArchive> Open(const std::filesystem::path& archivePath)
+    {
+        auto lastWriteTime = std::filesystem::last_write_time(archivePath);
+
+        std::scoped_lock lock(s_mutex);
+        if (s_scopeCount == 0)
+        {
+            return OpenUncached(archivePath, lastWriteTime);
+        }
+
+        auto& archive = s_archives[archivePath];
+        if (!archive || archive->lastWriteTime != lastWriteTime)
+        {
+            archive = OpenUncached(archivePath, lastWriteTime);
+        }
+        return archive;
+    }
+
+private:
+    static std::shared_ptr<const OpenedNpzArchive> OpenUncached(
+        const std::filesystem::path& archivePath, 
+        std::filesystem::file_time_type lastWriteTime)
+    {
+        auto file = MappedFile::Open(archivePath);
+        auto fileData = file->GetData();
+        return std::make_shared<const OpenedNpzArchive>(OpenedNpzArchive{
+            file, 
+            lastWriteTime, 
+            NpzArchive(std::span<const std::byte>(fileData.data(), fileData.size()))
+        });
+    }
+
+    static inline std::mutex s_mutex;
+    static inline uint32_t s_scopeCount = 0;
+    static inline std::map<std::filesystem::path, std::shared_ptr<const OpenedNpzArchive>> s_archives;
+};
+
+// Returns the array data of a member of an .npz archive. Stored (uncompressed) members are read from the mapped
+// archive like .npy files. Deflated members are decompressed; since resources are parsed in parallel, different
+// members are decompressed at the same time.
+ByteBuffer ReadNpzMemberData(
+    const std::filesystem::path& archivePath, 
+    std::string_view memberName, 
+    /*out*/ DML_TENSOR_DATA_TYPE& tensorDataType,
+    /*out*/ uint64_t& arraySizeInBytes)
 {
-    std::ifstream file(fileName.c_str(), std::ifstream::ate | std::ifstream::binary);
-    if (!file.is_open())
+    auto archive = NpzArchiveCacheScope::Open(archivePath);
+    auto member = archive->index.FindMember(memberName);
+    if (!member)
     {
-        throw std::ios::failure(fmt::format("Given filename '{}' could not be opened.", fileName));
+        throw std::invalid_argument(fmt::format("Archive '{}' has no member named '{}'.", archivePath.string(), memberName));
     }
 
-    size_t fileSize = static_cast<size_t>(file.tellg());
-    file.seekg(0);
-    std::vector<std::byte> allBytes(fileSize);
-    file.read(reinterpret_cast<char*>(allBytes.data()), fileSize);
+    std::vector<std::byte> decompressedData;
+    auto memberData = archive->index.ReadMember(*member, /*out*/ decompressedData);
+    if (memberData.data() != decompressedData.data())
+    {
+        auto offset = static_cast<size_t>(memberData.data() - archive->file->GetData().data());
+        return ReadNpyFileData(archive->file, offset, memberData.size(), /*out*/ tensorDataType, /*out*/ arraySizeInBytes);
+    }
 
-    return allBytes;
+    return ReadNpyFileData(std::move(decompressedData), /*out*/ tensorDataType, /*out*/ arraySizeInBytes);
 }
 
-std::tuple<std::vector<std::byte>, DML_TENSOR_DATA_TYPE, std::filesystem::path> GenerateInitialValuesFromFile(
+// Returns the file's bytes, their data type (unknown for raw data), the size of the typed data within the bytes
+// (e.g. a .npy array without any bytes stored after it), and the resolved path.
+std::tuple<ByteBuffer, DML_TENSOR_DATA_TYPE, uint64_t, std::filesystem::path> GenerateInitialValuesFromFile(
     const std::filesystem::path& parentPath,
     const rapidjson::Value& object,
-    const ImageTensorInfo& resampleTensorInfo,
-    const std::string& resampleMode)
+    const ImageTensorInfo& resampleTensorInfo)
 {
     auto sourcePath = ParseStringField(object, "sourcePath");
+
+    // e.g. "sourcePath": "weights.npz:layer3.bias"
+    std::string_view archivePath, memberName;
+    if (SplitNpzMemberPath(sourcePath, /*out*/ archivePath, /*out*/ memberName))
+    {
+        DML_TENSOR_DATA_TYPE tensorDataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
+        uint64_t arraySizeInBytes = 0;
+        auto filePath = ResolveInputFilePath(parentPath, archivePath);
+        auto allBytes = ReadNpzMemberData(filePath, memberName, /*out*/ tensorDataType, /*out*/ arraySizeInBytes);
+        return {std::move(allBytes), tensorDataType, arraySizeInBytes, filePath};
+    }
+
     auto filePath = ResolveInputFilePath(parentPath, sourcePath);
 
     auto fileExtension = filePath.extension().string();
@@ -1128,36 +2057,48 @@ std::tuple<std::vector<std::byte>, DML_TENSOR_DATA_TYPE, std::filesystem::path>
     );
 
     DML_TENSOR_DATA_TYPE tensorDataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
-    std::vector<std::byte> allBytes;
+    uint64_t typedSizeInBytes = 0;
+    ByteBuffer allBytes;
 
     if (fileExtension == ".npy")
     {
-        allBytes = ReadFileContent(filePath.string());
-
-        std::vector<uint32_t> dimensions;
-        std::vector<std::byte> arrayByteData;
-        ReadNpy(allBytes, /*out*/ tensorDataType, /*out*/ dimensions, /*out*/ arrayByteData);
-        allBytes = std::move(arrayByteData);
+        auto file = MappedFile::Open(filePath);
+        size_t fileSize = file->GetData().size();
+        allBytes = ReadNpyFileData(file, 0, fileSize, /*out*/ tensorDataType, /*out*/ typedSizeInBytes);
     }
-    else if (fileExtension == ".jpg" || fileExtension == ".png")
+    else if (IsImageFilePath(filePath))
     {
-        if (resampleMode != "scale")
-        {
-            // Could support cropping or other transforms in the future.
-            throw std::invalid_argument("Field 'resampleMode' must be 'scale' for image files.");
-        }
-
         allBytes = ReadTensorFromImage(filePath, resampleTensorInfo);
     }
     else
     {
-        allBytes = ReadFileContent(filePath.string());
+        // Raw data (e.g. .dat or .bin) is used exactly as stored.
+        auto file = MappedFile::Open(filePath);
+        size_t fileSize = file->GetData().size();
+        allBytes = ByteBuffer(std::move(file), 0, fileSize);
     }
 
-    return {std::move(allBytes), tensorDataType, filePath};
+    return {std::move(allBytes), tensorDataType, typedSizeInBytes, filePath};
+}
+
+// Reads a batch of images (see ResolveImageBatchPaths) into consecutive slots of one buffer.
+std::tuple<ByteBuffer, DML_TENSOR_DATA_TYPE, uint64_t, std::filesystem::path> GenerateInitialValuesFromImages(
+    const std::filesystem::path& parentPath,
+    const rapidjson::Value& object,
+    const ImageTensorInfo& resampleTensorInfo,
+    uint32_t batchSize,
+    /*out*/ std::vector<std::filesystem::path>& imagePaths)
+{
+    auto sourcePath = ParseStringField(object, "sourcePath");
+    imagePaths = ResolveImageBatchPaths(parentPath, sourcePath, batchSize);
+    ByteBuffer allBytes = ReadTensorFromImages(imagePaths, resampleTensorInfo);
+    return {std::move(allBytes), DML_TENSOR_DATA_TYPE_UNKNOWN, 0, ResolveImageBatchSourcePath(parentPath, sourcePath)};
 }
 
-Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath, const rapidjson::Value& object)
+Model::BufferDesc ParseModelBufferDesc(
+    const std::filesystem::path& parentPath, 
+    const rapidjson::Value& object,
+    std::vector<std::byte>* streamedInitialValues)
 {
     if (!object.IsObject())
     {
@@ -1200,6 +2141,11 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
         {
             buffer.initialValues = ParseMixedPrimitiveArray(initialValuesField->value);
         }
+        // e.g. "initialValues": [1,2,3] (already decoded while reading the JSON text)
+        else if (streamedInitialValues)
+        {
+            buffer.initialValues = std::move(*streamedInitialValues);
+        }
         // e.g. "initialValues": [1,2,3]
         else
         {
@@ -1211,9 +2157,9 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
         // e.g. "initialValues": { "value": 0, "valueCount": 3 }
         if (initialValuesField->value.HasMember("value"))
         {
-            if (initialValuesField->value.HasMember("valueStart") || initialValuesField->value.HasMember("sourcePath"))
+            if (initialValuesField->value.HasMember("valueStart") || initialValuesField->value.HasMember("distribution") || initialValuesField->value.HasMember("sourcePath"))
             {
-                throw std::invalid_argument("The 'initialValuesDataType' may contain a value, valueStart, or sourcePath, but they are mutually exclusive.");
+                throw std::invalid_argument("The 'initialValuesDataType' may contain a value, valueStart, distribution, or sourcePath, but they are mutually exclusive.");
             }
 
             ensureInitialValuesDataType();
@@ -1225,6 +2171,12 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
             ensureInitialValuesDataType();
             buffer.initialValues = GenerateInitialValuesFromSequence(buffer.initialValuesDataType, initialValuesField->value);
         }
+        // e.g. "initialValues": { "distribution": "normal", "mean": 0, "stddev": 1, "valueCount": 10, "seed": 42 }
+        else if (initialValuesField->value.HasMember("distribution"))
+        {
+            ensureInitialValuesDataType();
+            buffer.initialValues = GenerateInitialValuesFromRandom(buffer.initialValuesDataType, initialValuesField->value);
+        }
         // e.g. "initialValues": { "sourcePath": "inputFile.npy" }
         else if (initialValuesField->value.HasMember("sourcePath"))
         {
@@ -1232,32 +2184,80 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
 
             if (!resampleSize.empty() && resampleSize.size() != 4)
             {
-                throw std::invalid_argument("Field 'resampleSize' must be empty or have four dimensions in N,C,H,W order. N must be 1.");
+                throw std::invalid_argument("Field 'resampleSize' must be empty or have four dimensions in N,C,H,W order.");
             }
 
-            std::string extension = std::filesystem::path(initialValuesField->value["sourcePath"].GetString()).extension().string();
-            std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+            // e.g. "sourcePath": "images/*.jpg", "resampleSize": [8, 3, 224, 224]
+            std::string_view sourcePath = initialValuesField->value["sourcePath"].GetString();
+            const bool isImageBatch = IsImageBatchSourcePath(parentPath, sourcePath);
+            const uint32_t batchSize = resampleSize.empty() ? 1 : resampleSize[0];
+            if (isImageBatch && (resampleSize.empty() || batchSize == 0))
+            {
+                throw std::invalid_argument("Field 'resampleSize' must have an N of at least 1 when 'sourcePath' is a directory or wildcard pattern.");
+            }
+            if (!isImageBatch && batchSize != 1)
+            {
+                throw std::invalid_argument("Field 'resampleSize' must have an N of 1 unless 'sourcePath' is a directory or wildcard pattern.");
+            }
 
             ImageTensorInfo dstTensorInfo = {};
-            if (extension == ".jpg" || extension == ".png")
+            if (isImageBatch || IsImageFilePath(sourcePath))
             {
                 dstTensorInfo.dataType = buffer.initialValuesDataType;
                 dstTensorInfo.channels = resampleSize.size() > 1 ? resampleSize[1] : 0;
                 dstTensorInfo.height = resampleSize.size() > 2 ? resampleSize[2] : 0;
                 dstTensorInfo.width = resampleSize.size() > 3 ? resampleSize[3] : 0;
                 dstTensorInfo.sizeInBytes = GetSizeInBytes(dstTensorInfo.dataType) * dstTensorInfo.channels * dstTensorInfo.height * dstTensorInfo.width;
-                dstTensorInfo.layout = ImageTensorLayout::NCHW;
-                dstTensorInfo.channelOrder = dstTensorInfo.channels == 3 ? ImageTensorChannelOrder::RGB : ImageTensorChannelOrder::RGBA;
+
+                // e.g. "layout": "nhwc", "channelOrder": "bgr"
+                std::string layout = ParseStringField(object, "layout", false, "nchw");
+                if (layout == "nchw") dstTensorInfo.layout = ImageTensorLayout::NCHW;
+                else if (layout == "nhwc") dstTensorInfo.layout = ImageTensorLayout::NHWC;
+                else throw std::invalid_argument("Field 'layout' must be 'nchw' or 'nhwc'.");
+
+                std::string channelOrder = ParseStringField(object, "channelOrder", false,
+                    dstTensorInfo.channels == 1 ? "grayscale" : dstTensorInfo.channels == 3 ? "rgb" : "rgba");
+                uint32_t channelOrderChannels = 0;
+                if (channelOrder == "rgb") { dstTensorInfo.channelOrder = ImageTensorChannelOrder::RGB; channelOrderChannels = 3; }
+                else if (channelOrder == "bgr") { dstTensorInfo.channelOrder = ImageTensorChannelOrder::BGR; channelOrderChannels = 3; }
+                else if (channelOrder == "rgba") { dstTensorInfo.channelOrder = ImageTensorChannelOrder::RGBA; channelOrderChannels = 4; }
+                else if (channelOrder == "bgra") { dstTensorInfo.channelOrder = ImageTensorChannelOrder::BGRA; channelOrderChannels = 4; }
+                else if (channelOrder == "grayscale") { dstTensorInfo.channelOrder = ImageTensorChannelOrder::Grayscale; channelOrderChannels = 1; }
+                else throw std::invalid_argument("Field 'channelOrder' must be 'rgb', 'bgr', 'rgba', 'bgra', or 'grayscale'.");
+
+                if (!resampleSize.empty() && channelOrderChannels != dstTensorInfo.channels)
+                {
+                    throw std::invalid_argument(fmt::format(
+                        "Field 'channelOrder' is '{}', which has {} channels, but 'resampleSize' has {}.",
+                        channelOrder,
+                        channelOrderChannels,
+                        dstTensorInfo.channels));
+                }
+
+                // e.g. "normalizeMean": [0.485, 0.456, 0.406], "normalizeStd": [0.229, 0.224, 0.225]
+                dstTensorInfo.normalizeMean = ParseFloat32ArrayAsVectorField(object, "normalizeMean", false);
+                dstTensorInfo.normalizeStd = ParseFloat32ArrayAsVectorField(object, "normalizeStd", false);
+
+                // e.g. "resampleMode": "letterbox", "resampleFilter": "linear", "padValue": 114
+                std::string resampleMode = ParseStringField(object, "resampleMode", false, "scale");
+                if (resampleMode == "scale") dstTensorInfo.resampleMode = ImageResampleMode::Scale;
+                else if (resampleMode == "centerCrop") dstTensorInfo.resampleMode = ImageResampleMode::CenterCrop;
+                else if (resampleMode == "letterbox") dstTensorInfo.resampleMode = ImageResampleMode::Letterbox;
+                else if (resampleMode == "fit") dstTensorInfo.resampleMode = ImageResampleMode::Fit;
+                else throw std::invalid_argument("Field 'resampleMode' must be 'scale', 'centerCrop', 'letterbox', or 'fit'.");
+
+                std::string resampleFilter = ParseStringField(object, "resampleFilter", false, "cubic");
+                if (resampleFilter == "cubic") dstTensorInfo.resampleFilter = ImageResampleFilter::Cubic;
+                else if (resampleFilter == "linear") dstTensorInfo.resampleFilter = ImageResampleFilter::Linear;
+                else if (resampleFilter == "area") dstTensorInfo.resampleFilter = ImageResampleFilter::Area;
+                else throw std::invalid_argument("Field 'resampleFilter' must be 'cubic', 'linear', or 'area'.");
+
+                dstTensorInfo.padValue = ParseUInt8Field(object, "padValue", false, 0);
             }
-            
-            std::string resampleMode = ParseStringField(object, "resampleMode", false, "scale");
 
-            auto [initialValues, fileBufferDataType, fileName] = GenerateInitialValuesFromFile(
-                parentPath, 
-                initialValuesField->value,
-                dstTensorInfo,
-                resampleMode
-            );
+            auto [initialValues, fileBufferDataType, typedSizeInBytes, fileName] = isImageBatch ?
+                GenerateInitialValuesFromImages(parentPath, initialValuesField->value, dstTensorInfo, batchSize, /*out*/ buffer.sourceImagePaths) :
+                GenerateInitialValuesFromFile(parentPath, initialValuesField->value, dstTensorInfo);
 
             // Depending on the file type (.npy vs .dat), the file may have an explict data type.
             // Use the data type if present, else require initialValuesDataType if not.
@@ -1266,13 +2266,29 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
                 buffer.initialValuesDataType = fileBufferDataType;
             }
 
+            // Typed data of another type (e.g. a float32 .npy file loaded into a float16 buffer) is converted.
+            // Only the array itself is converted; bytes stored after a .npy array have no type and are dropped.
             if ((fileBufferDataType != DML_TENSOR_DATA_TYPE_UNKNOWN) && (fileBufferDataType != buffer.initialValuesDataType))
             {
-                throw std::invalid_argument(fmt::format("Data type from file '{}' does not match field 'initialValuesDataType'.", fileName.string()));
+                try
+                {
+                    initialValues = CastTensorData(
+                        std::span<const std::byte>(initialValues.data(), SafeSizeCast(typedSizeInBytes)),
+                        fileBufferDataType,
+                        buffer.initialValuesDataType);
+                }
+                catch (const std::invalid_argument& e)
+                {
+                    throw std::invalid_argument(fmt::format(
+                        "Data from file '{}' can't be converted to field 'initialValuesDataType': {}",
+                        fileName.string(),
+                        e.what()));
+                }
             }
 
             ensureInitialValuesDataType(); // Raw data requires 'initialValuesDataType'. Typed data (e.g. .npy) already had a type.
             buffer.initialValues = std::move(initialValues);
+            buffer.sourcePath = fileName;
         }
         else
         {
@@ -1298,7 +2314,7 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
 
     buffer.initialValuesOffsetInBytes = ParseUInt64Field(object, "initialValuesOffsetInBytes", false, 0);
 
-    if (buffer.initialValues.size() + buffer.initialValuesOffsetInBytes > buffer.sizeInBytes)
+    if (SafeAdd(buffer.initialValues.size(), buffer.initialValuesOffsetInBytes) > buffer.sizeInBytes)
     {
         throw std::invalid_argument(fmt::format(
             "The buffer size ({} bytes) is too small for the initialValues ({} bytes) at offset {} bytes.", 
@@ -1313,7 +2329,8 @@ Model::BufferDesc ParseModelBufferDesc(const std::filesystem::path& parentPath,
 Model::ResourceDesc ParseModelResourceDesc(
     std::string_view name,
     const std::filesystem::path& parentPath,
-    const rapidjson::Value& object)
+    const rapidjson::Value& object,
+    std::vector<std::byte>* streamedInitialValues)
 {
     Model::ResourceDesc desc;
     desc.name = name;
@@ -1350,7 +2367,7 @@ Model::ResourceDesc ParseModelResourceDesc(
 
     if (iequals(kind, "buffer"))
     {
-        desc.value = ParseModelBufferDesc(parentPath, object);
+        desc.value = ParseModelBufferDesc(parentPath, object, streamedInitialValues);
     }
     else if (iequals(kind, "texture"))
     {
@@ -1395,8 +2412,9 @@ Model::ResourceDesc ParseModelResourceDesc(
         {
             if (initIt->value.IsObject() && initIt->value.HasMember("sourcePath"))
             {
-                auto [fileData, fileType, fileName] = GenerateInitialValuesFromFile(parentPath, initIt->value, {/*unused*/}, "scale");
+                auto [fileData, fileType, typedSizeInBytes, fileName] = GenerateInitialValuesFromFile(parentPath, initIt->value, {/*unused*/});
                 tex.initialData = std::move(fileData);
+                tex.sourcePath = fileName;
             }
             else if (initIt->value.IsArray())
             {
@@ -1493,7 +2511,7 @@ Model::ResourceDesc ParseModelResourceDesc(
     }
     else
     {
-        throw std::invalid_argument("Unknown resource kind");
+        throw std::invalid_argument(fmt::format("Unknown resource kind '{}'.", kind));
     }
     return desc;
 }
@@ -1813,9 +2831,7 @@ Model::WriteFileCommand ParseWriteFileCommand(const rapidjson::Value& object, co
     Model::WriteFileCommand command = {};
     command.resourceName = ParseStringField(object, "resource");
     command.targetPath = ResolveOutputFilePath(outputPath, ParseStringField(object, "targetPath")).string();
-    BucketAllocator allocator;
-    auto dimensions = ParseUInt32ArrayField(object, "dimensions", allocator, false);
-    command.dimensions.assign(dimensions.begin(), dimensions.end());
+    command.dimensions = ParseUInt64ArrayAsVectorField(object, "dimensions", false);
 
     return command;
 }
@@ -1905,13 +2921,13 @@ void MapCharacterOffsetToLineColumn(
 }
 
 std::string GetJsonParseErrorMessage(
-    const rapidjson::Document& jsonDocument,
+    const rapidjson::ParseResult& parseResult,
     std::string_view jsonDocumentText
     )
 {
     // Gather a snippet of preview text at the error, stripping any new lines for preview sake.
     // Note RapidJSON doesn't include the line number, just document offset.
-    std::string_view applicableText = jsonDocumentText.substr(jsonDocument.GetErrorOffset(), 40);
+    std::string_view applicableText = jsonDocumentText.substr(parseResult.Offset(), 40);
     std::string newLineStrippedText(applicableText);
 
     for (auto& ch : newLineStrippedText)
@@ -1921,71 +2937,461 @@ std::string GetJsonParseErrorMessage(
     }
 
     uint32_t line = 0, column = 0;
-    MapCharacterOffsetToLineColumn(jsonDocumentText, jsonDocument.GetErrorOffset(), /*out*/ line, /*out*/ column);
+    MapCharacterOffsetToLineColumn(jsonDocumentText, parseResult.Offset(), /*out*/ line, /*out*/ column);
 
     std::string formattedErrorMessage = fmt::format(
         "JSON parse error at char offset:{}, line:{}, column:{}, error:{} {}\nSnippet: >>>{}<<<",
-        int(jsonDocument.GetErrorOffset()),
+        int(parseResult.Offset()),
         line + 1,
         column + 1,
-        int(jsonDocument.GetParseError()),
-        rapidjson::GetParseError_En(jsonDocument.GetParseError()),
+        int(parseResult.Code()),
+        rapidjson::GetParseError_En(parseResult.Code()),
         newLineStrippedText.c_str()
     );
 
     return formattedErrorMessage;
 }
 
-Model ParseModel(
-    const rapidjson::Document& doc,
-    const std::string_view& jsonDocumentText,
-    const std::filesystem::path& inputPath,
-    const std::filesystem::path& outputPath)
+// ----------------------------------------------------------------------------
+// STREAMED INITIAL VALUES
+// ----------------------------------------------------------------------------
+
+using StreamedInitialValues = std::unordered_map<std::string, std::vector<std::byte>>;
+
+template <typename T, T(*ElementParser)(const rapidjson::Value&)>
+void AppendInitialValue(const rapidjson::Value& value, std::vector<std::byte>& bytes)
 {
-    if (doc.HasParseError())
+    T element = ElementParser(value);
+    size_t offset = bytes.size();
+    bytes.resize(offset + sizeof(T));
+    memcpy(bytes.data() + offset, &element, sizeof(T));
+}
+
+using AppendInitialValueFunc = void(*)(const rapidjson::Value&, std::vector<std::byte>&);
+
+AppendInitialValueFunc GetAppendInitialValueFunc(DML_TENSOR_DATA_TYPE dataType)
+{
+    switch (dataType)
     {
-        std::string errorMessage = GetJsonParseErrorMessage(doc, jsonDocumentText);
-        throw std::invalid_argument(errorMessage);
+    case DML_TENSOR_DATA_TYPE_FLOAT16: return AppendInitialValue<half_float::half, ParseFloat16>;
+    case DML_TENSOR_DATA_TYPE_FLOAT32: return AppendInitialValue<float, ParseFloat32>;
+    case DML_TENSOR_DATA_TYPE_FLOAT64: return AppendInitialValue<double, ParseFloat64>;
+    case DML_TENSOR_DATA_TYPE_UINT8: return AppendInitialValue<uint8_t, ParseUInt8>;
+    case DML_TENSOR_DATA_TYPE_UINT16: return AppendInitialValue<uint16_t, ParseUInt16>;
+    case DML_TENSOR_DATA_TYPE_UINT32: return AppendInitialValue<uint32_t, ParseUInt32>;
+    case DML_TENSOR_DATA_TYPE_UINT64: return AppendInitialValue<uint64_t, ParseUInt64>;
+    case DML_TENSOR_DATA_TYPE_INT8: return AppendInitialValue<int8_t, ParseInt8>;
+    case DML_TENSOR_DATA_TYPE_INT16: return AppendInitialValue<int16_t, ParseInt16>;
+    case DML_TENSOR_DATA_TYPE_INT32: return AppendInitialValue<int32_t, ParseInt32>;
+    case DML_TENSOR_DATA_TYPE_INT64: return AppendInitialValue<int64_t, ParseInt64>;
+    default: return nullptr;
+    }
+}
+
+// SAX handler that builds a DOM like rapidjson::Document::Parse, except for the "initialValues" arrays of
+// buffer resources: when a resource has already declared its "initialValuesDataType", the array elements
+// are converted to that type as they are read and never stored in the DOM (the DOM gets an empty array).
+// This keeps peak memory for large inline arrays close to the size of the final buffer.
+//
+// Only arrays whose data type precedes them in the resource object can be streamed. Anything else (e.g.
+// the data type appears after the array, or a mixed-type array) is left in the DOM for ParseModelBufferDesc.
+// The resource kind follows the same rules as ParseModelResourceDesc: an explicit "kind", or else a buffer
+// unless the texture/sampler fields are present.
+class InitialValuesStreamingHandler
+{
+public:
+    InitialValuesStreamingHandler(rapidjson::Document& document, StreamedInitialValues& streamedInitialValues) : 
+        m_document(document),
+        m_streamedInitialValues(streamedInitialValues)
+    {}
+
+    const std::string& GetStreamingError() const { return m_streamingError; }
+
+    bool Null() { return m_append ? Append(rapidjson::Value()) : (OnValue(), m_document.Null()); }
+    bool Bool(bool b) { return m_append ? Append(rapidjson::Value(b)) : (OnValue(), m_document.Bool(b)); }
+    bool Int(int i) { return m_append ? Append(rapidjson::Value(i)) : (OnValue(), m_document.Int(i)); }
+    bool Uint(unsigned u) { return m_append ? Append(rapidjson::Value(u)) : (OnValue(), m_document.Uint(u)); }
+    bool Int64(int64_t i) { return m_append ? Append(rapidjson::Value(i)) : (OnValue(), m_document.Int64(i)); }
+    bool Uint64(uint64_t u) { return m_append ? Append(rapidjson::Value(u)) : (OnValue(), m_document.Uint64(u)); }
+    bool Double(double d) { return m_append ? Append(rapidjson::Value(d)) : (OnValue(), m_document.Double(d)); }
+
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        // Only produced with kParseNumbersAsStringsFlag, which is never used for models.
+        return m_append ? Append(rapidjson::Value(rapidjson::StringRef(str, length))) : (OnValue(), m_document.RawNumber(str, length, copy));
+    }
+
+    bool String(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_append)
+        {
+            return Append(rapidjson::Value(rapidjson::StringRef(str, length)));
+        }
+
+        if (m_pendingField == PendingField::InitialValuesDataType)
+        {
+            try
+            {
+                m_dataType = ParseDmlTensorDataType(rapidjson::Value(rapidjson::StringRef(str, length)));
+            }
+            catch (const std::exception&)
+            {
+                // Leave the error to ParseModelBufferDesc, which reports it with the usual context.
+                m_dataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
+            }
+        }
+        else if (m_pendingField == PendingField::Kind)
+        {
+            std::string kind(str, length);
+            if (!_stricmp(kind.c_str(), "buffer"))
+            {
+                m_resourceKind = ResourceKind::Buffer;
+            }
+            else if (!_stricmp(kind.c_str(), "texture") || !_stricmp(kind.c_str(), "sampler"))
+            {
+                m_resourceKind = ResourceKind::Other;
+            }
+            else
+            {
+                m_streamingError = fmt::format("Resource {} has an unknown kind '{}'.", m_resourceName, kind);
+                return false;
+            }
+        }
+
+        OnValue();
+        return m_document.String(str, length, copy);
     }
 
-    BucketAllocator allocator;
+    bool Key(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        std::string_view key(str, length);
 
-    std::vector<Model::ResourceDesc> resources;
-    auto resourcesField = doc.FindMember("resources");
-    if (resourcesField == doc.MemberEnd() || !resourcesField->value.IsObject())
+        if (m_depth == 1)
+        {
+            m_pendingField = (key == "resources") ? PendingField::Resources : PendingField::None;
+        }
+        else if (m_resourcesDepth && m_depth == m_resourcesDepth)
+        {
+            m_resourceName = key;
+            m_pendingField = PendingField::Resource;
+        }
+        else if (m_resourcesDepth && m_depth == m_resourcesDepth + 1)
+        {
+            if (key == "initialValuesDataType") { m_pendingField = PendingField::InitialValuesDataType; }
+            else if (key == "initialValues") { m_pendingField = PendingField::InitialValues; }
+            else if (key == "kind") { m_pendingField = PendingField::Kind; }
+            else { m_pendingField = PendingField::None; }
+
+            if (key == "width") { m_inferenceFields |= InferenceField::Width; }
+            else if (key == "height") { m_inferenceFields |= InferenceField::Height; }
+            else if (key == "filter") { m_inferenceFields |= InferenceField::Filter; }
+            else if (key == "addressU") { m_inferenceFields |= InferenceField::AddressU; }
+        }
+        else
+        {
+            m_pendingField = PendingField::None;
+        }
+
+        return m_document.Key(str, length, copy);
+    }
+
+    bool StartObject()
     {
-        throw std::invalid_argument("Expected an object named 'resources'");
+        if (m_append)
+        {
+            return Append(rapidjson::Value(rapidjson::kObjectType));
+        }
+
+        if (m_pendingField == PendingField::Resources)
+        {
+            m_resourcesDepth = m_depth + 1;
+        }
+        else if (m_pendingField == PendingField::Resource)
+        {
+            m_dataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
+            m_resourceKind = ResourceKind::Unknown;
+            m_inferenceFields = 0;
+            m_streamedResource = false;
+        }
+
+        OnValue();
+        m_depth++;
+        return m_document.StartObject();
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount)
+    {
+        m_depth--;
+        if (m_resourcesDepth && m_depth == m_resourcesDepth && m_streamedResource && !IsBufferResource())
+        {
+            // The texture/sampler fields came after an array that was already streamed as buffer data.
+            m_streamingError = fmt::format(
+                "Resource {} has typed initialValues but is not a buffer. Give it an explicit \"kind\".",
+                m_resourceName);
+            return false;
+        }
+        if (m_depth < m_resourcesDepth)
+        {
+            m_resourcesDepth = 0;
+        }
+        m_pendingField = PendingField::None;
+        return m_document.EndObject(memberCount);
+    }
+
+    bool StartArray()
+    {
+        if (m_append)
+        {
+            return Append(rapidjson::Value(rapidjson::kArrayType));
+        }
+
+        if (m_pendingField == PendingField::InitialValues && IsBufferResource())
+        {
+            m_append = GetAppendInitialValueFunc(m_dataType);
+            if (m_append)
+            {
+                m_initialValues = &m_streamedInitialValues[m_resourceName];
+                m_initialValues->clear();
+                m_streamedResource = true;
+            }
+        }
+
+        OnValue();
+        m_depth++;
+        return m_document.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount)
+    {
+        m_depth--;
+        if (m_append)
+        {
+            m_append = nullptr;
+            m_initialValues->shrink_to_fit();
+            m_initialValues = nullptr;
+            elementCount = 0;
+        }
+        m_pendingField = PendingField::None;
+        return m_document.EndArray(elementCount);
     }
-    for (auto field = resourcesField->value.MemberBegin(); field != resourcesField->value.MemberEnd(); field++)
+
+private:
+    enum class PendingField
+    {
+        None,
+        Resources,
+        Resource,
+        Kind,
+        InitialValuesDataType,
+        InitialValues,
+    };
+
+    enum class ResourceKind
+    {
+        Unknown, // No "kind" (yet), so it's inferred from the other fields.
+        Buffer,
+        Other,
+    };
+
+    struct InferenceField
+    {
+        static constexpr uint32_t Width = 1;
+        static constexpr uint32_t Height = 2;
+        static constexpr uint32_t Filter = 4;
+        static constexpr uint32_t AddressU = 8;
+    };
+
+    bool IsBufferResource() const
+    {
+        if (m_resourceKind != ResourceKind::Unknown)
+        {
+            return m_resourceKind == ResourceKind::Buffer;
+        }
+
+        constexpr uint32_t textureFields = InferenceField::Width | InferenceField::Height;
+        constexpr uint32_t samplerFields = InferenceField::Filter | InferenceField::AddressU;
+        return (m_inferenceFields & textureFields) != textureFields && (m_inferenceFields & samplerFields) != samplerFields;
+    }
+
+    void OnValue()
+    {
+        m_pendingField = PendingField::None;
+    }
+
+    bool Append(const rapidjson::Value& value)
     {
         try
         {
-            resources.emplace_back(std::move(ParseModelResourceDesc(field->name.GetString(), inputPath, field->value)));
+            m_append(value, *m_initialValues);
+            return true;
         }
-        catch (std::exception& e)
+        catch (const std::exception& e)
+        {
+            m_streamingError = fmt::format("Failed to parse resource {}: {}", m_resourceName, e.what());
+            return false;
+        }
+    }
+
+    rapidjson::Document& m_document;
+    StreamedInitialValues& m_streamedInitialValues;
+    std::string m_streamingError;
+    uint32_t m_depth = 0;
+    uint32_t m_resourcesDepth = 0;
+    PendingField m_pendingField = PendingField::None;
+    std::string m_resourceName;
+    DML_TENSOR_DATA_TYPE m_dataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
+    ResourceKind m_resourceKind = ResourceKind::Unknown;
+    uint32_t m_inferenceFields = 0;
+    bool m_streamedResource = false;
+    AppendInitialValueFunc m_append = nullptr;
+    std::vector<std::byte>* m_initialValues = nullptr;
+};
+
+// Makes buffers with identical initial values share a single copy of the bytes (e.g. the zero-filled biases or
+// constant scales that generated models tend to repeat). Only owned bytes are considered: hashing file-backed
+// values would read the entire mapping during parsing, and those bytes aren't held in memory anyway. Buffers are
+// only hashed if another buffer has the same size, and the hashes are computed in parallel.
+static void ShareIdenticalInitialValues(std::vector<Model::ResourceDesc>& resources, uint32_t threadCount)
+{
+    std::unordered_map<size_t, std::vector<Model::BufferDesc*>> buffersBySize;
+    for (auto& resource : resources)
+    {
+        auto buffer = std::get_if<Model::BufferDesc>(&resource.value);
+        if (buffer && !buffer->initialValues.empty() && !buffer->initialValues.GetFile())
+        {
+            buffersBySize[buffer->initialValues.size()].push_back(buffer);
+        }
+    }
+
+    std::vector<Model::BufferDesc*> candidates;
+    for (auto& [sizeInBytes, buffers] : buffersBySize)
+    {
+        if (buffers.size() > 1)
+        {
+            candidates.insert(candidates.end(), buffers.begin(), buffers.end());
+        }
+    }
+
+    std::vector<size_t> hashes(candidates.size());
+    ParallelFor(candidates.size(), threadCount, [&](size_t index, uint32_t workerIndex)
+    {
+        const ByteBuffer& bytes = candidates[index]->initialValues;
+        hashes[index] = std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+    });
+
+    // Buffers with the same size and hash are compared in full before sharing, so a hash collision is harmless.
+    std::unordered_map<size_t, std::vector<const Model::BufferDesc*>> uniqueBuffersByHash;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        auto& buffer = *candidates[i];
+        const ByteBuffer& bytes = buffer.initialValues;
+        auto& uniqueBuffers = uniqueBuffersByHash[hashes[i] ^ bytes.size()];
+
+        auto match = std::find_if(uniqueBuffers.begin(), uniqueBuffers.end(), [&](const Model::BufferDesc* other)
+        {
+            const ByteBuffer& otherBytes = other->initialValues;
+            return otherBytes.size() == bytes.size() && std::equal(bytes.begin(), bytes.end(), otherBytes.begin());
+        });
+
+        if (match == uniqueBuffers.end())
+        {
+            uniqueBuffers.push_back(&buffer);
+        }
+        else
         {
-            throw std::invalid_argument(fmt::format("Failed to parse resource {}: {}", field->name.GetString(), e.what()));
+            buffer.initialValues = (*match)->initialValues;
         }
     }
+}
+
+static Model ParseModel(
+    const rapidjson::Document& doc,
+    const std::string_view& jsonDocumentText,
+    const std::filesystem::path& inputPath,
+    const std::filesystem::path& outputPath,
+    StreamedInitialValues* streamedInitialValues,
+    uint32_t parseThreadCount,
+    bool useLargePages)
+{
+    NpzArchiveCacheScope npzArchiveCache;
+    BucketAllocator allocator(useLargePages);
+
+    auto resourcesField = doc.FindMember("resources");
+    if (resourcesField == doc.MemberEnd() || !resourcesField->value.IsObject())
+    {
+        throw std::invalid_argument("Expected an object named 'resources'");
+    }
 
-    std::vector<Model::DispatchableDesc> operators;
     auto dispatchablesField = doc.FindMember("dispatchables");
     if (dispatchablesField == doc.MemberEnd() || !dispatchablesField->value.IsObject())
     {
         throw std::invalid_argument("Expected an object named 'dispatchables'");
     }
-    for (auto field = dispatchablesField->value.MemberBegin(); field != dispatchablesField->value.MemberEnd(); field++)
+
+    // Resources and dispatchables are independent of each other, so they're parsed as a single batch of tasks
+    // (resources first). Results are stored by index, so the model is the same regardless of the thread count.
+    // Each worker allocates dispatchable descs from its own allocator; these are spliced into the model's
+    // allocator afterward (worker 0 uses the model's allocator directly).
+    size_t resourceCount = resourcesField->value.MemberCount();
+    size_t dispatchableCount = dispatchablesField->value.MemberCount();
+    std::vector<Model::ResourceDesc> resources(resourceCount);
+    std::vector<Model::DispatchableDesc> operators(dispatchableCount);
+
+    uint32_t threadCount = parseThreadCount ? parseThreadCount : GetDefaultThreadCount();
+    threadCount = static_cast<uint32_t>(std::max<size_t>(1, std::min<size_t>(threadCount, resourceCount + dispatchableCount)));
+    std::vector<BucketAllocator> workerAllocators;
+    workerAllocators.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; i++)
     {
-        try
+        workerAllocators.emplace_back(useLargePages);
+    }
+
+    ParallelFor(resourceCount + dispatchableCount, threadCount, [&](size_t index, uint32_t workerIndex)
+    {
+        if (index < resourceCount)
         {
-            operators.emplace_back(std::move(ParseModelDispatchableDesc(field->name.GetString(), inputPath, field->value, allocator)));
+            auto field = resourcesField->value.MemberBegin() + static_cast<ptrdiff_t>(index);
+            try
+            {
+                std::vector<std::byte>* streamedResourceValues = nullptr;
+                if (streamedInitialValues)
+                {
+                    auto streamedValues = streamedInitialValues->find(field->name.GetString());
+                    if (streamedValues != streamedInitialValues->end())
+                    {
+                        streamedResourceValues = &streamedValues->second;
+                    }
+                }
+
+                resources[index] = ParseModelResourceDesc(field->name.GetString(), inputPath, field->value, streamedResourceValues);
+            }
+            catch (std::exception& e)
+            {
+                throw std::invalid_argument(fmt::format("Failed to parse resource {}: {}", field->name.GetString(), e.what()));
+            }
         }
-        catch (std::exception& e)
+        else
         {
-            throw std::invalid_argument(fmt::format("Failed to parse dispatchable {}: {}", field->name.GetString(), e.what()));
+            auto field = dispatchablesField->value.MemberBegin() + static_cast<ptrdiff_t>(index - resourceCount);
+            auto& workerAllocator = workerIndex == 0 ? allocator : workerAllocators[workerIndex - 1];
+            try
+            {
+                operators[index - resourceCount] = ParseModelDispatchableDesc(field->name.GetString(), inputPath, field->value, workerAllocator);
+            }
+            catch (std::exception& e)
+            {
+                throw std::invalid_argument(fmt::format("Failed to parse dispatchable {}: {}", field->name.GetString(), e.what()));
+            }
         }
+    });
+
+    for (auto& workerAllocator : workerAllocators)
+    {
+        allocator.Splice(std::move(workerAllocator));
     }
 
+    ShareIdenticalInitialValues(resources, threadCount);
+
     std::vector<Model::CommandDesc> commands;
     auto commandsField = doc.FindMember("commands");
     if (commandsField == doc.MemberEnd() || !commandsField->value.IsArray())
@@ -2008,19 +3414,90 @@ Model ParseModel(
     return {std::move(resources), std::move(operators), std::move(commands), std::move(allocator)};
 }
 
+Model ParseModel(
+    const rapidjson::Document& doc,
+    const std::string_view& jsonDocumentText,
+    const std::filesystem::path& inputPath,
+    const std::filesystem::path& outputPath,
+    uint32_t parseThreadCount,
+    bool useLargePages)
+{
+    if (doc.HasParseError())
+    {
+        std::string errorMessage = GetJsonParseErrorMessage(doc, jsonDocumentText);
+        throw std::invalid_argument(errorMessage);
+    }
+
+    return ParseModel(doc, jsonDocumentText, inputPath, outputPath, nullptr, parseThreadCount, useLargePages);
+}
+
+Model ParseModelInsitu(
+    gsl::span<char> jsonDocumentText,
+    const std::filesystem::path& inputPath,
+    const std::filesystem::path& outputPath,
+    uint32_t parseThreadCount,
+    bool useLargePages)
+{
+    if (jsonDocumentText.empty() || jsonDocumentText.back() != '\0')
+    {
+        throw std::invalid_argument("JSON text must be null terminated.");
+    }
+
+    std::string_view textView(jsonDocumentText.data(), jsonDocumentText.size());
+
+    constexpr unsigned parseFlags =
+        rapidjson::kParseInsituFlag |
+        rapidjson::kParseFullPrecisionFlag | 
+        rapidjson::kParseCommentsFlag |
+        rapidjson::kParseTrailingCommasFlag |
+        rapidjson::kParseStopWhenDoneFlag;
+
+    rapidjson::Document doc;
+    StreamedInitialValues streamedInitialValues;
+    InitialValuesStreamingHandler handler(doc, streamedInitialValues);
+    rapidjson::ParseResult parseResult;
+
+    auto generator = [&](rapidjson::Document&)
+    {
+        rapidjson::InsituStringStream stream(jsonDocumentText.data());
+        rapidjson::Reader reader;
+        parseResult = reader.Parse<parseFlags>(stream, handler);
+        return !parseResult.IsError();
+    };
+    doc.Populate(generator);
+
+    if (!handler.GetStreamingError().empty())
+    {
+        throw std::invalid_argument(handler.GetStreamingError());
+    }
+    if (parseResult.IsError())
+    {
+        throw std::invalid_argument(GetJsonParseErrorMessage(parseResult, textView));
+    }
+
+    return ParseModel(doc, textView, inputPath, outputPath, &streamedInitialValues, parseThreadCount, useLargePages);
+}
+
+std::filesystem::path ResolveModelPath(const std::filesystem::path& filePath, const std::filesystem::path& inputPath)
+{
+    if (std::filesystem::exists(filePath))
+    {
+        return filePath;
+    }
+    return inputPath / filePath;
+}
+
 Model ParseModel(
     const std::filesystem::path& filePath,
     std::filesystem::path inputPath,
-    std::filesystem::path outputPath)
+    std::filesystem::path outputPath,
+    uint32_t parseThreadCount,
+    bool useLargePages)
 {
-    std::filesystem::path modelPath = filePath;
-    if (!std::filesystem::exists(filePath))
+    std::filesystem::path modelPath = ResolveModelPath(filePath, inputPath);
+    if (!std::filesystem::exists(modelPath))
     {
-        modelPath = inputPath / filePath;
-        if (!std::filesystem::exists(modelPath))
-        {
-            throw std::invalid_argument(fmt::format("Model does not exist. Path given: '{}'.", filePath.string()));
-        }
+        throw std::invalid_argument(fmt::format("Model does not exist. Path given: '{}'.", filePath.string()));
     }
     if (std::filesystem::is_directory(modelPath))
     {
@@ -2029,20 +3506,13 @@ Model ParseModel(
 
     std::vector<std::byte> allBytes = ReadFileContent(modelPath.string());
     allBytes.push_back(std::byte(0)); // Ensure null terminated for parser.
-    char* fileContentBegin = reinterpret_cast<char*>(allBytes.data());
-    std::string_view fileContent{fileContentBegin, allBytes.size()};
-
-    rapidjson::Document doc;
-
-    constexpr rapidjson::ParseFlag parseFlags = rapidjson::ParseFlag(
-        rapidjson::kParseFullPrecisionFlag | 
-        rapidjson::kParseCommentsFlag |
-        rapidjson::kParseTrailingCommasFlag |
-        rapidjson::kParseStopWhenDoneFlag);
-
-    doc.ParseInsitu<parseFlags>(fileContentBegin);
 
-    return ParseModel(doc, fileContent, inputPath, outputPath);
+    return ParseModelInsitu(
+        gsl::make_span(reinterpret_cast<char*>(allBytes.data()), allBytes.size()), 
+        inputPath, 
+        outputPath,
+        parseThreadCount,
+        useLargePages);
 }
 
 } // namespace JsonParsers
\ No newline at end of file
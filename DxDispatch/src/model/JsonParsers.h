@@ -26,6 +26,8 @@ namespace JsonParsers
     float ParseFloat32Field(const rapidjson::Value& object, std::string_view fieldName, bool required = true, float defaultValue = 0.0f);
     gsl::span<float> ParseFloat32Array(const rapidjson::Value& object, BucketAllocator& allocator);
     gsl::span<float> ParseFloat32ArrayField(const rapidjson::Value& object, std::string_view fieldName, BucketAllocator& allocator, bool required = true, gsl::span<float> defaultValue = {});
+    std::vector<float> ParseFloat32ArrayAsVector(const rapidjson::Value& object);
+    std::vector<float> ParseFloat32ArrayAsVectorField(const rapidjson::Value& object, std::string_view fieldName, bool required = true, std::vector<float> defaultValue = {});
 
     // FLOAT64
     double ParseFloat64(const rapidjson::Value& object);
@@ -68,6 +70,8 @@ namespace JsonParsers
     // UINT64
     uint64_t ParseUInt64(const rapidjson::Value& object);
     uint64_t ParseUInt64Field(const rapidjson::Value& object, std::string_view fieldName, bool required = true, uint64_t defaultValue = 0);
+    std::vector<uint64_t> ParseUInt64ArrayAsVector(const rapidjson::Value& object);
+    std::vector<uint64_t> ParseUInt64ArrayAsVectorField(const rapidjson::Value& object, std::string_view fieldName, bool required = true, std::vector<uint64_t> defaultValue = {});
 
     // Mixed primitives array
     std::vector<std::byte> ParseMixedPrimitiveArray(const rapidjson::Value& object);
@@ -131,19 +135,45 @@ namespace JsonParsers
     // MODEL STRUCTS
     // ------------------------------------------------------------------------
 
-    Model::ResourceDesc ParseModelResourceDesc(std::string_view name, const std::filesystem::path& parentPath, const rapidjson::Value& object);
+    // If streamedInitialValues is provided, it holds the already-decoded contents of the object's typed "initialValues" array.
+    Model::ResourceDesc ParseModelResourceDesc(std::string_view name, const std::filesystem::path& parentPath, const rapidjson::Value& object, std::vector<std::byte>* streamedInitialValues = nullptr);
     Model::DispatchableDesc ParseModelDispatchableDesc(std::string_view name, const std::filesystem::path& parentPath, const rapidjson::Value& object, BucketAllocator& allocator);
     Model::Command ParseModelCommand(const rapidjson::Value& object, const std::filesystem::path& outputPath);
     Model::CommandDesc ParseModelCommandDesc(const rapidjson::Value& object, const std::filesystem::path& outputPath);
 
+    // Returns the .png, .jpg, and .jpeg images a buffer's directory or wildcard "sourcePath" selects for a batch, in
+    // name order.
+    std::vector<std::filesystem::path> ListImageBatchPaths(const std::filesystem::path& parentPath, std::string_view sourcePath);
+
+    // The parseThreadCount is the number of threads used to parse resources and dispatchables in parallel:
+    // 1 parses on the calling thread only, and 0 uses one thread per hardware thread. The model's descs are
+    // allocated from large pages when useLargePages is set (see BucketAllocator).
+
     Model ParseModel(
         const rapidjson::Document& doc,
         const std::string_view &jsonDocumentText,
         const std::filesystem::path& inputPath,
-        const std::filesystem::path& outputPath);
+        const std::filesystem::path& outputPath,
+        uint32_t parseThreadCount = 1,
+        bool useLargePages = false);
+
+    // Parses null-terminated JSON text in place. Typed inline "initialValues" arrays are decoded directly into
+    // their buffers as the text is read, rather than first being stored in the DOM.
+    Model ParseModelInsitu(
+        gsl::span<char> jsonDocumentText,
+        const std::filesystem::path& inputPath,
+        const std::filesystem::path& outputPath,
+        uint32_t parseThreadCount = 1,
+        bool useLargePages = false);
+
+    // Returns the path of the model file ParseModel reads: filePath if it exists, otherwise filePath relative to
+    // the inputPath.
+    std::filesystem::path ResolveModelPath(const std::filesystem::path& filePath, const std::filesystem::path& inputPath);
 
     Model ParseModel(
         const std::filesystem::path& filePath, 
         std::filesystem::path inputPath,
-        std::filesystem::path outputPath);
+        std::filesystem::path outputPath,
+        uint32_t parseThreadCount = 1,
+        bool useLargePages = false);
 }
\ No newline at end of file
@@ -4,6 +4,47 @@
 // DIRECTML ENUMS
 // ====================================================================================================
 
+constexpr NameTable<DML_TENSOR_DATA_TYPE, 14, 32> c_dmlTensorDataTypeNames =
+{
+    {
+        1, 3, 0, 0, 0, 0, 0, 13, 6, 1, 10, 10, 1, 2,
+    },
+    {{
+        {"DML_TENSOR_DATA_TYPE_UINT4", DML_TENSOR_DATA_TYPE_UINT4},
+        {"INT64", DML_TENSOR_DATA_TYPE_INT64},
+        {"UINT64", DML_TENSOR_DATA_TYPE_UINT64},
+        {"UINT4", DML_TENSOR_DATA_TYPE_UINT4},
+        {"DML_TENSOR_DATA_TYPE_UINT64", DML_TENSOR_DATA_TYPE_UINT64},
+        {"DML_TENSOR_DATA_TYPE_UINT8", DML_TENSOR_DATA_TYPE_UINT8},
+        {"FLOAT64", DML_TENSOR_DATA_TYPE_FLOAT64},
+        {"DML_TENSOR_DATA_TYPE_UINT32", DML_TENSOR_DATA_TYPE_UINT32},
+        {"INT16", DML_TENSOR_DATA_TYPE_INT16},
+        {"DML_TENSOR_DATA_TYPE_INT16", DML_TENSOR_DATA_TYPE_INT16},
+        {"DML_TENSOR_DATA_TYPE_INT4", DML_TENSOR_DATA_TYPE_INT4},
+        {"UINT32", DML_TENSOR_DATA_TYPE_UINT32},
+        {"DML_TENSOR_DATA_TYPE_INT32", DML_TENSOR_DATA_TYPE_INT32},
+        {},
+        {"DML_TENSOR_DATA_TYPE_UNKNOWN", DML_TENSOR_DATA_TYPE_UNKNOWN},
+        {},
+        {"INT32", DML_TENSOR_DATA_TYPE_INT32},
+        {"UNKNOWN", DML_TENSOR_DATA_TYPE_UNKNOWN},
+        {"UINT16", DML_TENSOR_DATA_TYPE_UINT16},
+        {"DML_TENSOR_DATA_TYPE_UINT16", DML_TENSOR_DATA_TYPE_UINT16},
+        {},
+        {"INT4", DML_TENSOR_DATA_TYPE_INT4},
+        {"DML_TENSOR_DATA_TYPE_INT8", DML_TENSOR_DATA_TYPE_INT8},
+        {},
+        {"DML_TENSOR_DATA_TYPE_INT64", DML_TENSOR_DATA_TYPE_INT64},
+        {"FLOAT32", DML_TENSOR_DATA_TYPE_FLOAT32},
+        {"INT8", DML_TENSOR_DATA_TYPE_INT8},
+        {"DML_TENSOR_DATA_TYPE_FLOAT64", DML_TENSOR_DATA_TYPE_FLOAT64},
+        {"DML_TENSOR_DATA_TYPE_FLOAT16", DML_TENSOR_DATA_TYPE_FLOAT16},
+        {"FLOAT16", DML_TENSOR_DATA_TYPE_FLOAT16},
+        {"DML_TENSOR_DATA_TYPE_FLOAT32", DML_TENSOR_DATA_TYPE_FLOAT32},
+        {"UINT8", DML_TENSOR_DATA_TYPE_UINT8},
+    }}
+};
+
 DML_TENSOR_DATA_TYPE ParseDmlTensorDataType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -11,20 +52,7 @@ DML_TENSOR_DATA_TYPE ParseDmlTensorDataType(const rapidjson::Value& value)
         throw std::invalid_argument("DML_TENSOR_DATA_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_UNKNOWN") || !strcmp(valueString, "UNKNOWN")) { return DML_TENSOR_DATA_TYPE_UNKNOWN; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_FLOAT32") || !strcmp(valueString, "FLOAT32")) { return DML_TENSOR_DATA_TYPE_FLOAT32; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_FLOAT16") || !strcmp(valueString, "FLOAT16")) { return DML_TENSOR_DATA_TYPE_FLOAT16; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_UINT32") || !strcmp(valueString, "UINT32")) { return DML_TENSOR_DATA_TYPE_UINT32; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_UINT16") || !strcmp(valueString, "UINT16")) { return DML_TENSOR_DATA_TYPE_UINT16; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_UINT8") || !strcmp(valueString, "UINT8")) { return DML_TENSOR_DATA_TYPE_UINT8; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_INT32") || !strcmp(valueString, "INT32")) { return DML_TENSOR_DATA_TYPE_INT32; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_INT16") || !strcmp(valueString, "INT16")) { return DML_TENSOR_DATA_TYPE_INT16; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_INT8") || !strcmp(valueString, "INT8")) { return DML_TENSOR_DATA_TYPE_INT8; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_FLOAT64") || !strcmp(valueString, "FLOAT64")) { return DML_TENSOR_DATA_TYPE_FLOAT64; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_UINT64") || !strcmp(valueString, "UINT64")) { return DML_TENSOR_DATA_TYPE_UINT64; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_INT64") || !strcmp(valueString, "INT64")) { return DML_TENSOR_DATA_TYPE_INT64; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_UINT4") || !strcmp(valueString, "UINT4")) { return DML_TENSOR_DATA_TYPE_UINT4; }
-    if (!strcmp(valueString, "DML_TENSOR_DATA_TYPE_INT4") || !strcmp(valueString, "INT4")) { return DML_TENSOR_DATA_TYPE_INT4; }
+    if (auto result = c_dmlTensorDataTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_TENSOR_DATA_TYPE.", valueString));
 }
 
@@ -35,6 +63,19 @@ DML_TENSOR_DATA_TYPE ParseDmlTensorDataTypeField(const rapidjson::Value& object,
     });
 }
 
+constexpr NameTable<DML_TENSOR_TYPE, 2, 4> c_dmlTensorTypeNames =
+{
+    {
+        0, 4,
+    },
+    {{
+        {"INVALID", DML_TENSOR_TYPE_INVALID},
+        {"BUFFER", DML_TENSOR_TYPE_BUFFER},
+        {"DML_TENSOR_TYPE_BUFFER", DML_TENSOR_TYPE_BUFFER},
+        {"DML_TENSOR_TYPE_INVALID", DML_TENSOR_TYPE_INVALID},
+    }}
+};
+
 DML_TENSOR_TYPE ParseDmlTensorType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -42,8 +83,7 @@ DML_TENSOR_TYPE ParseDmlTensorType(const rapidjson::Value& value)
         throw std::invalid_argument("DML_TENSOR_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_TENSOR_TYPE_INVALID") || !strcmp(valueString, "INVALID")) { return DML_TENSOR_TYPE_INVALID; }
-    if (!strcmp(valueString, "DML_TENSOR_TYPE_BUFFER") || !strcmp(valueString, "BUFFER")) { return DML_TENSOR_TYPE_BUFFER; }
+    if (auto result = c_dmlTensorTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_TENSOR_TYPE.", valueString));
 }
 
@@ -54,6 +94,537 @@ DML_TENSOR_TYPE ParseDmlTensorTypeField(const rapidjson::Value& object, std::str
     });
 }
 
+constexpr NameTable<DML_OPERATOR_TYPE, 174, 512> c_dmlOperatorTypeNames =
+{
+    {
+        0, 1, 1, 0, 0, 0, 0, 6, 2, 0, 0, 4, 1, 3, 1, 10,
+        5, 0, 2, 0, 2, 2, 1, 2, 2, 0, 0, 0, 1, 0, 1, 0,
+        0, 2, 0, 0, 2, 0, 2, 2, 0, 1, 7, 1, 0, 0, 4, 1,
+        2, 2, 1, 2, 2, 0, 0, 1, 0, 0, 1, 2, 0, 0, 1, 0,
+        0, 19, 5, 4, 0, 0, 0, 0, 1, 2, 1, 3, 1, 1, 2, 0,
+        0, 1, 0, 15, 1, 0, 0, 0, 4, 1, 1, 0, 5, 2, 1, 9,
+        2, 0, 3, 10, 1, 4, 0, 4, 1, 0, 0, 0, 0, 0, 0, 10,
+        0, 3, 3, 0, 6, 0, 0, 0, 1, 2, 0, 1, 0, 3, 0, 0,
+        6, 6, 0, 2, 6, 0, 0, 7, 0, 0, 7, 0, 10, 1, 0, 3,
+        0, 1, 4, 6, 3, 2, 5, 11, 2, 1, 6, 1, 1, 2, 14, 2,
+        0, 0, 0, 0, 1, 0, 4, 0, 2, 1, 12, 0, 8, 0,
+    },
+    {{
+        {},
+        {},
+        {"DML_OPERATOR_ACTIVATION_SCALED_ELU", DML_OPERATOR_ACTIVATION_SCALED_ELU},
+        {"DML_OPERATOR_AVERAGE_POOLING_GRAD", DML_OPERATOR_AVERAGE_POOLING_GRAD},
+        {},
+        {"VALUE_SCALE_2D", DML_OPERATOR_VALUE_SCALE_2D},
+        {},
+        {"MEAN_VARIANCE_NORMALIZATION", DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION},
+        {"FILL_VALUE_SEQUENCE", DML_OPERATOR_FILL_VALUE_SEQUENCE},
+        {"ELEMENT_WISE_FLOOR", DML_OPERATOR_ELEMENT_WISE_FLOOR},
+        {"DML_OPERATOR_ELEMENT_WISE_ASINH", DML_OPERATOR_ELEMENT_WISE_ASINH},
+        {"ELEMENT_WISE_BIT_COUNT", DML_OPERATOR_ELEMENT_WISE_BIT_COUNT},
+        {"DML_OPERATOR_LSTM", DML_OPERATOR_LSTM},
+        {"DML_OPERATOR_GATHER", DML_OPERATOR_GATHER},
+        {},
+        {"DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY", DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY},
+        {"ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL", DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL},
+        {"GATHER_ND1", DML_OPERATOR_GATHER_ND1},
+        {"LSTM", DML_OPERATOR_LSTM},
+        {"ELEMENT_WISE_CLIP_GRAD", DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD},
+        {"ACTIVATION_HARD_SIGMOID", DML_OPERATOR_ACTIVATION_HARD_SIGMOID},
+        {"DML_OPERATOR_ELEMENT_WISE_SIN", DML_OPERATOR_ELEMENT_WISE_SIN},
+        {"ACTIVATION_SCALED_TANH", DML_OPERATOR_ACTIVATION_SCALED_TANH},
+        {"DML_OPERATOR_ROI_ALIGN", DML_OPERATOR_ROI_ALIGN},
+        {"QUANTIZED_LINEAR_CONVOLUTION", DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION},
+        {"ELEMENT_WISE_CLIP", DML_OPERATOR_ELEMENT_WISE_CLIP},
+        {"DML_OPERATOR_RESAMPLE2", DML_OPERATOR_RESAMPLE2},
+        {"ELEMENT_WISE_LOGICAL_EQUALS", DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_OR", DML_OPERATOR_ELEMENT_WISE_BIT_OR},
+        {},
+        {},
+        {"MAX_POOLING1", DML_OPERATOR_MAX_POOLING1},
+        {"DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS", DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS},
+        {},
+        {"ELEMENT_WISE_ATAN", DML_OPERATOR_ELEMENT_WISE_ATAN},
+        {"ARGMAX", DML_OPERATOR_ARGMAX},
+        {},
+        {"DML_OPERATOR_BATCH_NORMALIZATION_TRAINING", DML_OPERATOR_BATCH_NORMALIZATION_TRAINING},
+        {"ELEMENT_WISE_SIN", DML_OPERATOR_ELEMENT_WISE_SIN},
+        {"DML_OPERATOR_SLICE_GRAD", DML_OPERATOR_SLICE_GRAD},
+        {},
+        {"ELEMENT_WISE_ATANH", DML_OPERATOR_ELEMENT_WISE_ATANH},
+        {"DML_OPERATOR_ELEMENT_WISE_SIGN", DML_OPERATOR_ELEMENT_WISE_SIGN},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_ACOS", DML_OPERATOR_ELEMENT_WISE_ACOS},
+        {"DML_OPERATOR_GEMM", DML_OPERATOR_GEMM},
+        {"DML_OPERATOR_ACTIVATION_SOFTPLUS", DML_OPERATOR_ACTIVATION_SOFTPLUS},
+        {"DML_OPERATOR_ACTIVATION_TANH", DML_OPERATOR_ACTIVATION_TANH},
+        {"DML_OPERATOR_LP_POOLING1", DML_OPERATOR_LP_POOLING1},
+        {"ELEMENT_WISE_MIN", DML_OPERATOR_ELEMENT_WISE_MIN},
+        {},
+        {"ELEMENT_WISE_LOGICAL_NOT", DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT},
+        {"DML_OPERATOR_ACTIVATION_RELU_GRAD", DML_OPERATOR_ACTIVATION_RELU_GRAD},
+        {"QUANTIZED_LINEAR_AVERAGE_POOLING", DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING},
+        {},
+        {"DML_OPERATOR_NONZERO_COORDINATES", DML_OPERATOR_NONZERO_COORDINATES},
+        {"DML_OPERATOR_DIAGONAL_MATRIX", DML_OPERATOR_DIAGONAL_MATRIX},
+        {"DML_OPERATOR_ACTIVATION_HARD_SIGMOID", DML_OPERATOR_ACTIVATION_HARD_SIGMOID},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL", DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL},
+        {"ELEMENT_WISE_BIT_XOR", DML_OPERATOR_ELEMENT_WISE_BIT_XOR},
+        {"ELEMENT_WISE_DIVIDE", DML_OPERATOR_ELEMENT_WISE_DIVIDE},
+        {},
+        {},
+        {"ACTIVATION_PARAMETERIZED_RELU", DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU},
+        {"ELEMENT_WISE_BIT_OR", DML_OPERATOR_ELEMENT_WISE_BIT_OR},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN", DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN},
+        {"DML_OPERATOR_CUMULATIVE_PRODUCT", DML_OPERATOR_CUMULATIVE_PRODUCT},
+        {"DML_OPERATOR_DEPTH_TO_SPACE", DML_OPERATOR_DEPTH_TO_SPACE},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_ACOSH", DML_OPERATOR_ELEMENT_WISE_ACOSH},
+        {"DML_OPERATOR_ELEMENT_WISE_CEIL", DML_OPERATOR_ELEMENT_WISE_CEIL},
+        {},
+        {"INVALID", DML_OPERATOR_INVALID},
+        {"ROI_POOLING", DML_OPERATOR_ROI_POOLING},
+        {"MAX_POOLING2", DML_OPERATOR_MAX_POOLING2},
+        {"RESAMPLE_GRAD1", DML_OPERATOR_RESAMPLE_GRAD1},
+        {},
+        {"DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD", DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD},
+        {"LP_NORMALIZATION", DML_OPERATOR_LP_NORMALIZATION},
+        {"MULTIHEAD_ATTENTION", DML_OPERATOR_MULTIHEAD_ATTENTION},
+        {"DML_OPERATOR_ACTIVATION_SCALED_TANH", DML_OPERATOR_ACTIVATION_SCALED_TANH},
+        {"DML_OPERATOR_CONVOLUTION", DML_OPERATOR_CONVOLUTION},
+        {},
+        {"ACTIVATION_SIGMOID", DML_OPERATOR_ACTIVATION_SIGMOID},
+        {"DML_OPERATOR_ELEMENT_WISE_MIN", DML_OPERATOR_ELEMENT_WISE_MIN},
+        {"DML_OPERATOR_ACTIVATION_HARDMAX", DML_OPERATOR_ACTIVATION_HARDMAX},
+        {"DML_OPERATOR_ACTIVATION_SOFTSIGN", DML_OPERATOR_ACTIVATION_SOFTSIGN},
+        {"ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL", DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_COUNT", DML_OPERATOR_ELEMENT_WISE_BIT_COUNT},
+        {"BATCH_NORMALIZATION_GRAD", DML_OPERATOR_BATCH_NORMALIZATION_GRAD},
+        {"DML_OPERATOR_TOP_K", DML_OPERATOR_TOP_K},
+        {"BATCH_NORMALIZATION_TRAINING", DML_OPERATOR_BATCH_NORMALIZATION_TRAINING},
+        {"DML_OPERATOR_ELEMENT_WISE_MEAN", DML_OPERATOR_ELEMENT_WISE_MEAN},
+        {},
+        {"DML_OPERATOR_LP_POOLING", DML_OPERATOR_LP_POOLING},
+        {"ACTIVATION_PARAMETRIC_SOFTPLUS", DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS},
+        {},
+        {"JOIN", DML_OPERATOR_JOIN},
+        {"ACTIVATION_LEAKY_RELU", DML_OPERATOR_ACTIVATION_LEAKY_RELU},
+        {},
+        {"DML_OPERATOR_CUMULATIVE_SUMMATION", DML_OPERATOR_CUMULATIVE_SUMMATION},
+        {"DML_OPERATOR_INVALID", DML_OPERATOR_INVALID},
+        {"DML_OPERATOR_VALUE_SCALE_2D", DML_OPERATOR_VALUE_SCALE_2D},
+        {"DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE", DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE},
+        {"RESAMPLE1", DML_OPERATOR_RESAMPLE1},
+        {"ACTIVATION_CELU", DML_OPERATOR_ACTIVATION_CELU},
+        {"PADDING", DML_OPERATOR_PADDING},
+        {"DML_OPERATOR_ARGMIN", DML_OPERATOR_ARGMIN},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_THRESHOLD", DML_OPERATOR_ELEMENT_WISE_THRESHOLD},
+        {"ACTIVATION_HARD_SWISH", DML_OPERATOR_ACTIVATION_HARD_SWISH},
+        {},
+        {"AVERAGE_POOLING", DML_OPERATOR_AVERAGE_POOLING},
+        {"DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR", DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR},
+        {"SLICE_GRAD", DML_OPERATOR_SLICE_GRAD},
+        {"ELEMENT_WISE_LOGICAL_LESS_THAN", DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN},
+        {},
+        {"MATRIX_MULTIPLY_INTEGER", DML_OPERATOR_MATRIX_MULTIPLY_INTEGER},
+        {"MULTIHEAD_ATTENTION1", DML_OPERATOR_MULTIHEAD_ATTENTION1},
+        {},
+        {"DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION", DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION},
+        {},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_ERF", DML_OPERATOR_ELEMENT_WISE_ERF},
+        {"ELEMENT_WISE_BIT_NOT", DML_OPERATOR_ELEMENT_WISE_BIT_NOT},
+        {},
+        {"ELEMENT_WISE_IS_INFINITY", DML_OPERATOR_ELEMENT_WISE_IS_INFINITY},
+        {"DML_OPERATOR_ACTIVATION_HARD_SWISH", DML_OPERATOR_ACTIVATION_HARD_SWISH},
+        {"DML_OPERATOR_FILL_VALUE_CONSTANT", DML_OPERATOR_FILL_VALUE_CONSTANT},
+        {},
+        {},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_CLIP", DML_OPERATOR_ELEMENT_WISE_CLIP},
+        {"ELEMENT_WISE_DEQUANTIZE_LINEAR", DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR},
+        {"ELEMENT_WISE_CONSTANT_POW", DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW},
+        {"DML_OPERATOR_MAX_POOLING_GRAD", DML_OPERATOR_MAX_POOLING_GRAD},
+        {"ELEMENT_WISE_ADD", DML_OPERATOR_ELEMENT_WISE_ADD},
+        {},
+        {},
+        {"LOCAL_RESPONSE_NORMALIZATION_GRAD", DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD},
+        {},
+        {"ELEMENT_WISE_LOGICAL_AND", DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND},
+        {"ELEMENT_WISE_IS_NAN", DML_OPERATOR_ELEMENT_WISE_IS_NAN},
+        {"ELEMENT_WISE_ABS", DML_OPERATOR_ELEMENT_WISE_ABS},
+        {"DML_OPERATOR_MAX_UNPOOLING", DML_OPERATOR_MAX_UNPOOLING},
+        {},
+        {},
+        {"ELEMENT_WISE_MEAN", DML_OPERATOR_ELEMENT_WISE_MEAN},
+        {},
+        {"ACTIVATION_RELU", DML_OPERATOR_ACTIVATION_RELU},
+        {},
+        {"ACTIVATION_SOFTMAX", DML_OPERATOR_ACTIVATION_SOFTMAX},
+        {"DML_OPERATOR_CAST", DML_OPERATOR_CAST},
+        {"ELEMENT_WISE_BIT_AND", DML_OPERATOR_ELEMENT_WISE_BIT_AND},
+        {},
+        {"ACTIVATION_SCALED_ELU", DML_OPERATOR_ACTIVATION_SCALED_ELU},
+        {"CUMULATIVE_PRODUCT", DML_OPERATOR_CUMULATIVE_PRODUCT},
+        {"ELEMENT_WISE_IF", DML_OPERATOR_ELEMENT_WISE_IF},
+        {"DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE", DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE},
+        {"DML_OPERATOR_ELEMENT_WISE_SINH", DML_OPERATOR_ELEMENT_WISE_SINH},
+        {"ELEMENT_WISE_QUANTIZED_LINEAR_ADD", DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD},
+        {"SPACE_TO_DEPTH", DML_OPERATOR_SPACE_TO_DEPTH},
+        {"ELEMENT_WISE_EXP", DML_OPERATOR_ELEMENT_WISE_EXP},
+        {"SCATTER", DML_OPERATOR_SCATTER},
+        {"ELEMENT_WISE_ATAN_YX", DML_OPERATOR_ELEMENT_WISE_ATAN_YX},
+        {"CAST", DML_OPERATOR_CAST},
+        {"DML_OPERATOR_ROI_ALIGN1", DML_OPERATOR_ROI_ALIGN1},
+        {},
+        {"UPSAMPLE_2D", DML_OPERATOR_UPSAMPLE_2D},
+        {},
+        {"GEMM", DML_OPERATOR_GEMM},
+        {},
+        {"DML_OPERATOR_ACTIVATION_ELU", DML_OPERATOR_ACTIVATION_ELU},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_FLOOR", DML_OPERATOR_ELEMENT_WISE_FLOOR},
+        {"DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW", DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW},
+        {"RESAMPLE", DML_OPERATOR_RESAMPLE},
+        {},
+        {},
+        {"DML_OPERATOR_AVERAGE_POOLING", DML_OPERATOR_AVERAGE_POOLING},
+        {},
+        {},
+        {},
+        {},
+        {"ELEMENT_WISE_ACOS", DML_OPERATOR_ELEMENT_WISE_ACOS},
+        {"ELEMENT_WISE_ASINH", DML_OPERATOR_ELEMENT_WISE_ASINH},
+        {"DML_OPERATOR_ELEMENT_WISE_SUBTRACT", DML_OPERATOR_ELEMENT_WISE_SUBTRACT},
+        {"DML_OPERATOR_ELEMENT_WISE_LOG", DML_OPERATOR_ELEMENT_WISE_LOG},
+        {"DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD", DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD},
+        {"ELEMENT_WISE_ASIN", DML_OPERATOR_ELEMENT_WISE_ASIN},
+        {"DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION", DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION},
+        {},
+        {"MAX_POOLING_GRAD", DML_OPERATOR_MAX_POOLING_GRAD},
+        {},
+        {"DML_OPERATOR_ACTIVATION_CELU", DML_OPERATOR_ACTIVATION_CELU},
+        {"DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD", DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD},
+        {"ELEMENT_WISE_ACOSH", DML_OPERATOR_ELEMENT_WISE_ACOSH},
+        {"DML_OPERATOR_ACTIVATION_RELU", DML_OPERATOR_ACTIVATION_RELU},
+        {"DML_OPERATOR_MAX_POOLING2", DML_OPERATOR_MAX_POOLING2},
+        {"DML_OPERATOR_DEPTH_TO_SPACE1", DML_OPERATOR_DEPTH_TO_SPACE1},
+        {},
+        {},
+        {"DML_OPERATOR_SCATTER_ND", DML_OPERATOR_SCATTER_ND},
+        {},
+        {"ELEMENT_WISE_IDENTITY", DML_OPERATOR_ELEMENT_WISE_IDENTITY},
+        {},
+        {"DML_OPERATOR_MULTIHEAD_ATTENTION", DML_OPERATOR_MULTIHEAD_ATTENTION},
+        {},
+        {},
+        {},
+        {"MEAN_VARIANCE_NORMALIZATION1", DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1},
+        {"DML_OPERATOR_ELEMENT_WISE_SQRT", DML_OPERATOR_ELEMENT_WISE_SQRT},
+        {"ELEMENT_WISE_LOGICAL_XOR", DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR},
+        {},
+        {"DML_OPERATOR_PADDING1", DML_OPERATOR_PADDING1},
+        {},
+        {"DML_OPERATOR_GATHER_ELEMENTS", DML_OPERATOR_GATHER_ELEMENTS},
+        {"ELEMENT_WISE_SQRT", DML_OPERATOR_ELEMENT_WISE_SQRT},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR", DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR},
+        {"QUANTIZED_LINEAR_MATRIX_MULTIPLY", DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY},
+        {},
+        {"DML_OPERATOR_SLICE1", DML_OPERATOR_SLICE1},
+        {"ACTIVATION_HARDMAX1", DML_OPERATOR_ACTIVATION_HARDMAX1},
+        {"DML_OPERATOR_ELEMENT_WISE_IF", DML_OPERATOR_ELEMENT_WISE_IF},
+        {"ROI_ALIGN", DML_OPERATOR_ROI_ALIGN},
+        {"ELEMENT_WISE_QUANTIZE_LINEAR", DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR},
+        {"DML_OPERATOR_ELEMENT_WISE_IS_INFINITY", DML_OPERATOR_ELEMENT_WISE_IS_INFINITY},
+        {},
+        {},
+        {"ADAM_OPTIMIZER", DML_OPERATOR_ADAM_OPTIMIZER},
+        {"DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR", DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR},
+        {"DML_OPERATOR_RESAMPLE_GRAD1", DML_OPERATOR_RESAMPLE_GRAD1},
+        {"ELEMENT_WISE_MODULUS_TRUNCATE", DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE},
+        {},
+        {"ELEMENT_WISE_POW", DML_OPERATOR_ELEMENT_WISE_POW},
+        {"ACTIVATION_HARDMAX", DML_OPERATOR_ACTIVATION_HARDMAX},
+        {"DML_OPERATOR_QUANTIZE", DML_OPERATOR_QUANTIZE},
+        {"PADDING1", DML_OPERATOR_PADDING1},
+        {},
+        {"DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION", DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION},
+        {},
+        {"ELEMENT_WISE_TAN", DML_OPERATOR_ELEMENT_WISE_TAN},
+        {},
+        {"MEAN_VARIANCE_NORMALIZATION2", DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2},
+        {"GRU", DML_OPERATOR_GRU},
+        {"ELEMENT_WISE_COS", DML_OPERATOR_ELEMENT_WISE_COS},
+        {},
+        {},
+        {},
+        {},
+        {"DML_OPERATOR_TOP_K1", DML_OPERATOR_TOP_K1},
+        {},
+        {},
+        {"SLICE", DML_OPERATOR_SLICE},
+        {"DML_OPERATOR_ELEMENT_WISE_ATANH", DML_OPERATOR_ELEMENT_WISE_ATANH},
+        {},
+        {"ELEMENT_WISE_LOG", DML_OPERATOR_ELEMENT_WISE_LOG},
+        {"DML_OPERATOR_GATHER_ND", DML_OPERATOR_GATHER_ND},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_COSH", DML_OPERATOR_ELEMENT_WISE_COSH},
+        {"GATHER", DML_OPERATOR_GATHER},
+        {},
+        {"ACTIVATION_LOG_SOFTMAX", DML_OPERATOR_ACTIVATION_LOG_SOFTMAX},
+        {"DML_OPERATOR_ADAM_OPTIMIZER", DML_OPERATOR_ADAM_OPTIMIZER},
+        {"DEPTH_TO_SPACE", DML_OPERATOR_DEPTH_TO_SPACE},
+        {"DML_OPERATOR_ELEMENT_WISE_TANH", DML_OPERATOR_ELEMENT_WISE_TANH},
+        {"DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING", DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING},
+        {"DEPTH_TO_SPACE1", DML_OPERATOR_DEPTH_TO_SPACE1},
+        {},
+        {"DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1", DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1},
+        {"DML_OPERATOR_DIAGONAL_MATRIX1", DML_OPERATOR_DIAGONAL_MATRIX1},
+        {},
+        {"DML_OPERATOR_RESAMPLE", DML_OPERATOR_RESAMPLE},
+        {"ELEMENT_WISE_BIT_SHIFT_LEFT", DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT},
+        {"SLICE1", DML_OPERATOR_SLICE1},
+        {"DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1", DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1},
+        {"DML_OPERATOR_ELEMENT_WISE_IDENTITY", DML_OPERATOR_ELEMENT_WISE_IDENTITY},
+        {},
+        {"DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD", DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD},
+        {"ELEMENT_WISE_THRESHOLD", DML_OPERATOR_ELEMENT_WISE_THRESHOLD},
+        {},
+        {"LOCAL_RESPONSE_NORMALIZATION", DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION},
+        {"DML_OPERATOR_ACTIVATION_IDENTITY", DML_OPERATOR_ACTIVATION_IDENTITY},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_XOR", DML_OPERATOR_ELEMENT_WISE_BIT_XOR},
+        {"ELEMENT_WISE_NEGATE", DML_OPERATOR_ELEMENT_WISE_NEGATE},
+        {},
+        {"DML_OPERATOR_GATHER_ND1", DML_OPERATOR_GATHER_ND1},
+        {},
+        {},
+        {"DML_OPERATOR_AVERAGE_POOLING1", DML_OPERATOR_AVERAGE_POOLING1},
+        {},
+        {"DML_OPERATOR_RESAMPLE1", DML_OPERATOR_RESAMPLE1},
+        {},
+        {},
+        {"CONVOLUTION_INTEGER", DML_OPERATOR_CONVOLUTION_INTEGER},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_ATAN_YX", DML_OPERATOR_ELEMENT_WISE_ATAN_YX},
+        {"DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR", DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR},
+        {"DML_OPERATOR_SLICE", DML_OPERATOR_SLICE},
+        {},
+        {},
+        {},
+        {"TOP_K1", DML_OPERATOR_TOP_K1},
+        {"DML_OPERATOR_ACTIVATION_LOG_SOFTMAX", DML_OPERATOR_ACTIVATION_LOG_SOFTMAX},
+        {"DML_OPERATOR_ELEMENT_WISE_MULTIPLY", DML_OPERATOR_ELEMENT_WISE_MULTIPLY},
+        {},
+        {},
+        {"DML_OPERATOR_ONE_HOT", DML_OPERATOR_ONE_HOT},
+        {},
+        {"NONZERO_COORDINATES", DML_OPERATOR_NONZERO_COORDINATES},
+        {"ACTIVATION_SWISH", DML_OPERATOR_ACTIVATION_SWISH},
+        {"ONE_HOT", DML_OPERATOR_ONE_HOT},
+        {"ELEMENT_WISE_MULTIPLY", DML_OPERATOR_ELEMENT_WISE_MULTIPLY},
+        {"RESAMPLE2", DML_OPERATOR_RESAMPLE2},
+        {},
+        {"BATCH_NORMALIZATION", DML_OPERATOR_BATCH_NORMALIZATION},
+        {"GATHER_ELEMENTS", DML_OPERATOR_GATHER_ELEMENTS},
+        {"ACTIVATION_SOFTSIGN", DML_OPERATOR_ACTIVATION_SOFTSIGN},
+        {"DML_OPERATOR_ELEMENT_WISE_ADD1", DML_OPERATOR_ELEMENT_WISE_ADD1},
+        {"DML_OPERATOR_SPLIT", DML_OPERATOR_SPLIT},
+        {"GATHER_ND", DML_OPERATOR_GATHER_ND},
+        {"ELEMENT_WISE_RECIP", DML_OPERATOR_ELEMENT_WISE_RECIP},
+        {},
+        {"BATCH_NORMALIZATION_TRAINING_GRAD", DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD},
+        {"ELEMENT_WISE_ERF", DML_OPERATOR_ELEMENT_WISE_ERF},
+        {"DML_OPERATOR_ACTIVATION_SOFTMAX", DML_OPERATOR_ACTIVATION_SOFTMAX},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND", DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS", DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS},
+        {},
+        {"MAX_UNPOOLING", DML_OPERATOR_MAX_UNPOOLING},
+        {},
+        {"AVERAGE_POOLING_GRAD", DML_OPERATOR_AVERAGE_POOLING_GRAD},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR", DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR},
+        {},
+        {"ELEMENT_WISE_BIT_SHIFT_RIGHT", DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT},
+        {},
+        {},
+        {"ACTIVATION_SOFTPLUS", DML_OPERATOR_ACTIVATION_SOFTPLUS},
+        {},
+        {"ELEMENT_WISE_MAX", DML_OPERATOR_ELEMENT_WISE_MAX},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT", DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT},
+        {"DML_OPERATOR_ACTIVATION_HARDMAX1", DML_OPERATOR_ACTIVATION_HARDMAX1},
+        {"DML_OPERATOR_ACTIVATION_SWISH", DML_OPERATOR_ACTIVATION_SWISH},
+        {"DML_OPERATOR_PADDING", DML_OPERATOR_PADDING},
+        {},
+        {"DML_OPERATOR_SPACE_TO_DEPTH1", DML_OPERATOR_SPACE_TO_DEPTH1},
+        {"DEQUANTIZE", DML_OPERATOR_DEQUANTIZE},
+        {},
+        {"DML_OPERATOR_SPACE_TO_DEPTH", DML_OPERATOR_SPACE_TO_DEPTH},
+        {"REVERSE_SUBSEQUENCES", DML_OPERATOR_REVERSE_SUBSEQUENCES},
+        {},
+        {"DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2", DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2},
+        {"DML_OPERATOR_GRU", DML_OPERATOR_GRU},
+        {"ACTIVATION_TANH", DML_OPERATOR_ACTIVATION_TANH},
+        {"ACTIVATION_RELU_GRAD", DML_OPERATOR_ACTIVATION_RELU_GRAD},
+        {"ELEMENT_WISE_CLIP_GRAD1", DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1},
+        {},
+        {"DML_OPERATOR_MATRIX_MULTIPLY_INTEGER", DML_OPERATOR_MATRIX_MULTIPLY_INTEGER},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_NOT", DML_OPERATOR_ELEMENT_WISE_BIT_NOT},
+        {},
+        {"DML_OPERATOR_RESAMPLE_GRAD", DML_OPERATOR_RESAMPLE_GRAD},
+        {"DML_OPERATOR_ACTIVATION_LEAKY_RELU", DML_OPERATOR_ACTIVATION_LEAKY_RELU},
+        {"RESAMPLE_GRAD", DML_OPERATOR_RESAMPLE_GRAD},
+        {},
+        {"ELEMENT_WISE_SINH", DML_OPERATOR_ELEMENT_WISE_SINH},
+        {"DML_OPERATOR_ELEMENT_WISE_ADD", DML_OPERATOR_ELEMENT_WISE_ADD},
+        {"DML_OPERATOR_MAX_POOLING", DML_OPERATOR_MAX_POOLING},
+        {"CUMULATIVE_SUMMATION", DML_OPERATOR_CUMULATIVE_SUMMATION},
+        {},
+        {"DML_OPERATOR_SCATTER", DML_OPERATOR_SCATTER},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN", DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN},
+        {"TILE", DML_OPERATOR_TILE},
+        {"ARGMIN", DML_OPERATOR_ARGMIN},
+        {},
+        {},
+        {"ELEMENT_WISE_ROUND", DML_OPERATOR_ELEMENT_WISE_ROUND},
+        {},
+        {},
+        {"ELEMENT_WISE_SIGN", DML_OPERATOR_ELEMENT_WISE_SIGN},
+        {},
+        {},
+        {},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_CLIP1", DML_OPERATOR_ELEMENT_WISE_CLIP1},
+        {},
+        {},
+        {"DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU", DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU},
+        {"DML_OPERATOR_ELEMENT_WISE_TAN", DML_OPERATOR_ELEMENT_WISE_TAN},
+        {"DML_OPERATOR_ACTIVATION_SHRINK", DML_OPERATOR_ACTIVATION_SHRINK},
+        {},
+        {"LP_POOLING", DML_OPERATOR_LP_POOLING},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_DIVIDE", DML_OPERATOR_ELEMENT_WISE_DIVIDE},
+        {"DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU", DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU},
+        {"DML_OPERATOR_BATCH_NORMALIZATION_GRAD", DML_OPERATOR_BATCH_NORMALIZATION_GRAD},
+        {"ELEMENT_WISE_DIFFERENCE_SQUARE", DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE},
+        {"ELEMENT_WISE_MODULUS_FLOOR", DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_COS", DML_OPERATOR_ELEMENT_WISE_COS},
+        {"ELEMENT_WISE_CEIL", DML_OPERATOR_ELEMENT_WISE_CEIL},
+        {"DML_OPERATOR_FILL_VALUE_SEQUENCE", DML_OPERATOR_FILL_VALUE_SEQUENCE},
+        {"DML_OPERATOR_RNN", DML_OPERATOR_RNN},
+        {"DIAGONAL_MATRIX1", DML_OPERATOR_DIAGONAL_MATRIX1},
+        {"DML_OPERATOR_ELEMENT_WISE_EXP", DML_OPERATOR_ELEMENT_WISE_EXP},
+        {"DML_OPERATOR_ACTIVATION_SOFTMAX1", DML_OPERATOR_ACTIVATION_SOFTMAX1},
+        {"TOP_K", DML_OPERATOR_TOP_K},
+        {"ELEMENT_WISE_TANH", DML_OPERATOR_ELEMENT_WISE_TANH},
+        {"DML_OPERATOR_ELEMENT_WISE_NEGATE", DML_OPERATOR_ELEMENT_WISE_NEGATE},
+        {"ACTIVATION_THRESHOLDED_RELU", DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU},
+        {},
+        {"DML_OPERATOR_BATCH_NORMALIZATION", DML_OPERATOR_BATCH_NORMALIZATION},
+        {"DML_OPERATOR_ACTIVATION_GELU", DML_OPERATOR_ACTIVATION_GELU},
+        {"DML_OPERATOR_ELEMENT_WISE_MAX", DML_OPERATOR_ELEMENT_WISE_MAX},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_AND", DML_OPERATOR_ELEMENT_WISE_BIT_AND},
+        {"DML_OPERATOR_ELEMENT_WISE_IS_NAN", DML_OPERATOR_ELEMENT_WISE_IS_NAN},
+        {},
+        {},
+        {},
+        {},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT", DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT},
+        {"DYNAMIC_QUANTIZE_LINEAR", DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR},
+        {"DML_OPERATOR_DEQUANTIZE", DML_OPERATOR_DEQUANTIZE},
+        {"AVERAGE_POOLING1", DML_OPERATOR_AVERAGE_POOLING1},
+        {},
+        {"DML_OPERATOR_LP_NORMALIZATION", DML_OPERATOR_LP_NORMALIZATION},
+        {"ACTIVATION_ELU", DML_OPERATOR_ACTIVATION_ELU},
+        {},
+        {"DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT", DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT},
+        {"SPACE_TO_DEPTH1", DML_OPERATOR_SPACE_TO_DEPTH1},
+        {},
+        {"SPLIT", DML_OPERATOR_SPLIT},
+        {"ACTIVATION_LOG_SOFTMAX1", DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1},
+        {},
+        {"FILL_VALUE_CONSTANT", DML_OPERATOR_FILL_VALUE_CONSTANT},
+        {"DIAGONAL_MATRIX", DML_OPERATOR_DIAGONAL_MATRIX},
+        {"DML_OPERATOR_TILE", DML_OPERATOR_TILE},
+        {"DML_OPERATOR_MAX_POOLING1", DML_OPERATOR_MAX_POOLING1},
+        {"RNN", DML_OPERATOR_RNN},
+        {},
+        {"ACTIVATION_IDENTITY", DML_OPERATOR_ACTIVATION_IDENTITY},
+        {"ELEMENT_WISE_SUBTRACT", DML_OPERATOR_ELEMENT_WISE_SUBTRACT},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL", DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL},
+        {"ACTIVATION_GELU", DML_OPERATOR_ACTIVATION_GELU},
+        {},
+        {"DML_OPERATOR_JOIN", DML_OPERATOR_JOIN},
+        {"DML_OPERATOR_RANDOM_GENERATOR", DML_OPERATOR_RANDOM_GENERATOR},
+        {},
+        {},
+        {"DML_OPERATOR_MULTIHEAD_ATTENTION1", DML_OPERATOR_MULTIHEAD_ATTENTION1},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_RECIP", DML_OPERATOR_ELEMENT_WISE_RECIP},
+        {},
+        {},
+        {},
+        {},
+        {"DML_OPERATOR_REVERSE_SUBSEQUENCES", DML_OPERATOR_REVERSE_SUBSEQUENCES},
+        {"ELEMENT_WISE_ADD1", DML_OPERATOR_ELEMENT_WISE_ADD1},
+        {},
+        {"MATRIX_MULTIPLY_INTEGER_TO_FLOAT", DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT},
+        {"ELEMENT_WISE_CLIP1", DML_OPERATOR_ELEMENT_WISE_CLIP1},
+        {"DML_OPERATOR_ELEMENT_WISE_ASIN", DML_OPERATOR_ELEMENT_WISE_ASIN},
+        {},
+        {},
+        {"DML_OPERATOR_ARGMAX", DML_OPERATOR_ARGMAX},
+        {"DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT", DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT},
+        {},
+        {"QUANTIZE", DML_OPERATOR_QUANTIZE},
+        {"DML_OPERATOR_CONVOLUTION_INTEGER", DML_OPERATOR_CONVOLUTION_INTEGER},
+        {"DML_OPERATOR_ELEMENT_WISE_ABS", DML_OPERATOR_ELEMENT_WISE_ABS},
+        {"ACTIVATION_SOFTMAX1", DML_OPERATOR_ACTIVATION_SOFTMAX1},
+        {"ELEMENT_WISE_LOGICAL_OR", DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR},
+        {"DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR", DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR},
+        {"ACTIVATION_SHRINK", DML_OPERATOR_ACTIVATION_SHRINK},
+        {"ACTIVATION_LINEAR", DML_OPERATOR_ACTIVATION_LINEAR},
+        {},
+        {"DML_OPERATOR_ACTIVATION_LINEAR", DML_OPERATOR_ACTIVATION_LINEAR},
+        {"ROI_ALIGN1", DML_OPERATOR_ROI_ALIGN1},
+        {"ELEMENT_WISE_LOGICAL_GREATER_THAN", DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN},
+        {"DML_OPERATOR_ELEMENT_WISE_ATAN", DML_OPERATOR_ELEMENT_WISE_ATAN},
+        {"SCATTER_ND", DML_OPERATOR_SCATTER_ND},
+        {"DML_OPERATOR_ACTIVATION_SIGMOID", DML_OPERATOR_ACTIVATION_SIGMOID},
+        {},
+        {"DML_OPERATOR_REDUCE", DML_OPERATOR_REDUCE},
+        {},
+        {"DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1", DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1},
+        {"ELEMENT_WISE_COSH", DML_OPERATOR_ELEMENT_WISE_COSH},
+        {"DML_OPERATOR_ROI_POOLING", DML_OPERATOR_ROI_POOLING},
+        {"LP_POOLING1", DML_OPERATOR_LP_POOLING1},
+        {"RANDOM_GENERATOR", DML_OPERATOR_RANDOM_GENERATOR},
+        {"DML_OPERATOR_UPSAMPLE_2D", DML_OPERATOR_UPSAMPLE_2D},
+        {"CONVOLUTION", DML_OPERATOR_CONVOLUTION},
+        {},
+        {},
+        {},
+        {"MAX_POOLING", DML_OPERATOR_MAX_POOLING},
+        {},
+        {"DML_OPERATOR_ELEMENT_WISE_ROUND", DML_OPERATOR_ELEMENT_WISE_ROUND},
+        {"REDUCE", DML_OPERATOR_REDUCE},
+        {"DML_OPERATOR_ELEMENT_WISE_POW", DML_OPERATOR_ELEMENT_WISE_POW},
+    }}
+};
+
 DML_OPERATOR_TYPE ParseDmlOperatorType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -61,180 +632,7 @@ DML_OPERATOR_TYPE ParseDmlOperatorType(const rapidjson::Value& value)
         throw std::invalid_argument("DML_OPERATOR_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_OPERATOR_INVALID") || !strcmp(valueString, "INVALID")) { return DML_OPERATOR_INVALID; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_IDENTITY") || !strcmp(valueString, "ELEMENT_WISE_IDENTITY")) { return DML_OPERATOR_ELEMENT_WISE_IDENTITY; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ABS") || !strcmp(valueString, "ELEMENT_WISE_ABS")) { return DML_OPERATOR_ELEMENT_WISE_ABS; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ACOS") || !strcmp(valueString, "ELEMENT_WISE_ACOS")) { return DML_OPERATOR_ELEMENT_WISE_ACOS; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ADD") || !strcmp(valueString, "ELEMENT_WISE_ADD")) { return DML_OPERATOR_ELEMENT_WISE_ADD; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ASIN") || !strcmp(valueString, "ELEMENT_WISE_ASIN")) { return DML_OPERATOR_ELEMENT_WISE_ASIN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ATAN") || !strcmp(valueString, "ELEMENT_WISE_ATAN")) { return DML_OPERATOR_ELEMENT_WISE_ATAN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_CEIL") || !strcmp(valueString, "ELEMENT_WISE_CEIL")) { return DML_OPERATOR_ELEMENT_WISE_CEIL; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_CLIP") || !strcmp(valueString, "ELEMENT_WISE_CLIP")) { return DML_OPERATOR_ELEMENT_WISE_CLIP; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_COS") || !strcmp(valueString, "ELEMENT_WISE_COS")) { return DML_OPERATOR_ELEMENT_WISE_COS; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_DIVIDE") || !strcmp(valueString, "ELEMENT_WISE_DIVIDE")) { return DML_OPERATOR_ELEMENT_WISE_DIVIDE; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_EXP") || !strcmp(valueString, "ELEMENT_WISE_EXP")) { return DML_OPERATOR_ELEMENT_WISE_EXP; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_FLOOR") || !strcmp(valueString, "ELEMENT_WISE_FLOOR")) { return DML_OPERATOR_ELEMENT_WISE_FLOOR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOG") || !strcmp(valueString, "ELEMENT_WISE_LOG")) { return DML_OPERATOR_ELEMENT_WISE_LOG; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_AND")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_EQUALS")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_GREATER_THAN")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_LESS_THAN")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_NOT")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_OR")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR") || !strcmp(valueString, "ELEMENT_WISE_LOGICAL_XOR")) { return DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_MAX") || !strcmp(valueString, "ELEMENT_WISE_MAX")) { return DML_OPERATOR_ELEMENT_WISE_MAX; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_MEAN") || !strcmp(valueString, "ELEMENT_WISE_MEAN")) { return DML_OPERATOR_ELEMENT_WISE_MEAN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_MIN") || !strcmp(valueString, "ELEMENT_WISE_MIN")) { return DML_OPERATOR_ELEMENT_WISE_MIN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_MULTIPLY") || !strcmp(valueString, "ELEMENT_WISE_MULTIPLY")) { return DML_OPERATOR_ELEMENT_WISE_MULTIPLY; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_POW") || !strcmp(valueString, "ELEMENT_WISE_POW")) { return DML_OPERATOR_ELEMENT_WISE_POW; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW") || !strcmp(valueString, "ELEMENT_WISE_CONSTANT_POW")) { return DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_RECIP") || !strcmp(valueString, "ELEMENT_WISE_RECIP")) { return DML_OPERATOR_ELEMENT_WISE_RECIP; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_SIN") || !strcmp(valueString, "ELEMENT_WISE_SIN")) { return DML_OPERATOR_ELEMENT_WISE_SIN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_SQRT") || !strcmp(valueString, "ELEMENT_WISE_SQRT")) { return DML_OPERATOR_ELEMENT_WISE_SQRT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_SUBTRACT") || !strcmp(valueString, "ELEMENT_WISE_SUBTRACT")) { return DML_OPERATOR_ELEMENT_WISE_SUBTRACT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_TAN") || !strcmp(valueString, "ELEMENT_WISE_TAN")) { return DML_OPERATOR_ELEMENT_WISE_TAN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_THRESHOLD") || !strcmp(valueString, "ELEMENT_WISE_THRESHOLD")) { return DML_OPERATOR_ELEMENT_WISE_THRESHOLD; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR") || !strcmp(valueString, "ELEMENT_WISE_QUANTIZE_LINEAR")) { return DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR") || !strcmp(valueString, "ELEMENT_WISE_DEQUANTIZE_LINEAR")) { return DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_ELU") || !strcmp(valueString, "ACTIVATION_ELU")) { return DML_OPERATOR_ACTIVATION_ELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_CELU") || !strcmp(valueString, "ACTIVATION_CELU")) { return DML_OPERATOR_ACTIVATION_CELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_HARDMAX") || !strcmp(valueString, "ACTIVATION_HARDMAX")) { return DML_OPERATOR_ACTIVATION_HARDMAX; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_HARDMAX1") || !strcmp(valueString, "ACTIVATION_HARDMAX1")) { return DML_OPERATOR_ACTIVATION_HARDMAX1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_HARD_SIGMOID") || !strcmp(valueString, "ACTIVATION_HARD_SIGMOID")) { return DML_OPERATOR_ACTIVATION_HARD_SIGMOID; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_IDENTITY") || !strcmp(valueString, "ACTIVATION_IDENTITY")) { return DML_OPERATOR_ACTIVATION_IDENTITY; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_LEAKY_RELU") || !strcmp(valueString, "ACTIVATION_LEAKY_RELU")) { return DML_OPERATOR_ACTIVATION_LEAKY_RELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_LINEAR") || !strcmp(valueString, "ACTIVATION_LINEAR")) { return DML_OPERATOR_ACTIVATION_LINEAR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_LOG_SOFTMAX") || !strcmp(valueString, "ACTIVATION_LOG_SOFTMAX")) { return DML_OPERATOR_ACTIVATION_LOG_SOFTMAX; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1") || !strcmp(valueString, "ACTIVATION_LOG_SOFTMAX1")) { return DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU") || !strcmp(valueString, "ACTIVATION_PARAMETERIZED_RELU")) { return DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS") || !strcmp(valueString, "ACTIVATION_PARAMETRIC_SOFTPLUS")) { return DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_RELU") || !strcmp(valueString, "ACTIVATION_RELU")) { return DML_OPERATOR_ACTIVATION_RELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SCALED_ELU") || !strcmp(valueString, "ACTIVATION_SCALED_ELU")) { return DML_OPERATOR_ACTIVATION_SCALED_ELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SCALED_TANH") || !strcmp(valueString, "ACTIVATION_SCALED_TANH")) { return DML_OPERATOR_ACTIVATION_SCALED_TANH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SIGMOID") || !strcmp(valueString, "ACTIVATION_SIGMOID")) { return DML_OPERATOR_ACTIVATION_SIGMOID; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SOFTMAX") || !strcmp(valueString, "ACTIVATION_SOFTMAX")) { return DML_OPERATOR_ACTIVATION_SOFTMAX; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SOFTMAX1") || !strcmp(valueString, "ACTIVATION_SOFTMAX1")) { return DML_OPERATOR_ACTIVATION_SOFTMAX1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SOFTPLUS") || !strcmp(valueString, "ACTIVATION_SOFTPLUS")) { return DML_OPERATOR_ACTIVATION_SOFTPLUS; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SOFTSIGN") || !strcmp(valueString, "ACTIVATION_SOFTSIGN")) { return DML_OPERATOR_ACTIVATION_SOFTSIGN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_TANH") || !strcmp(valueString, "ACTIVATION_TANH")) { return DML_OPERATOR_ACTIVATION_TANH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU") || !strcmp(valueString, "ACTIVATION_THRESHOLDED_RELU")) { return DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_CONVOLUTION") || !strcmp(valueString, "CONVOLUTION")) { return DML_OPERATOR_CONVOLUTION; }
-    if (!strcmp(valueString, "DML_OPERATOR_GEMM") || !strcmp(valueString, "GEMM")) { return DML_OPERATOR_GEMM; }
-    if (!strcmp(valueString, "DML_OPERATOR_REDUCE") || !strcmp(valueString, "REDUCE")) { return DML_OPERATOR_REDUCE; }
-    if (!strcmp(valueString, "DML_OPERATOR_AVERAGE_POOLING") || !strcmp(valueString, "AVERAGE_POOLING")) { return DML_OPERATOR_AVERAGE_POOLING; }
-    if (!strcmp(valueString, "DML_OPERATOR_AVERAGE_POOLING1") || !strcmp(valueString, "AVERAGE_POOLING1")) { return DML_OPERATOR_AVERAGE_POOLING1; }
-    if (!strcmp(valueString, "DML_OPERATOR_LP_POOLING") || !strcmp(valueString, "LP_POOLING")) { return DML_OPERATOR_LP_POOLING; }
-    if (!strcmp(valueString, "DML_OPERATOR_LP_POOLING1") || !strcmp(valueString, "LP_POOLING1")) { return DML_OPERATOR_LP_POOLING1; }
-    if (!strcmp(valueString, "DML_OPERATOR_MAX_POOLING") || !strcmp(valueString, "MAX_POOLING")) { return DML_OPERATOR_MAX_POOLING; }
-    if (!strcmp(valueString, "DML_OPERATOR_ROI_POOLING") || !strcmp(valueString, "ROI_POOLING")) { return DML_OPERATOR_ROI_POOLING; }
-    if (!strcmp(valueString, "DML_OPERATOR_SLICE") || !strcmp(valueString, "SLICE")) { return DML_OPERATOR_SLICE; }
-    if (!strcmp(valueString, "DML_OPERATOR_CAST") || !strcmp(valueString, "CAST")) { return DML_OPERATOR_CAST; }
-    if (!strcmp(valueString, "DML_OPERATOR_SPLIT") || !strcmp(valueString, "SPLIT")) { return DML_OPERATOR_SPLIT; }
-    if (!strcmp(valueString, "DML_OPERATOR_JOIN") || !strcmp(valueString, "JOIN")) { return DML_OPERATOR_JOIN; }
-    if (!strcmp(valueString, "DML_OPERATOR_PADDING") || !strcmp(valueString, "PADDING")) { return DML_OPERATOR_PADDING; }
-    if (!strcmp(valueString, "DML_OPERATOR_PADDING1") || !strcmp(valueString, "PADDING1")) { return DML_OPERATOR_PADDING1; }
-    if (!strcmp(valueString, "DML_OPERATOR_VALUE_SCALE_2D") || !strcmp(valueString, "VALUE_SCALE_2D")) { return DML_OPERATOR_VALUE_SCALE_2D; }
-    if (!strcmp(valueString, "DML_OPERATOR_UPSAMPLE_2D") || !strcmp(valueString, "UPSAMPLE_2D")) { return DML_OPERATOR_UPSAMPLE_2D; }
-    if (!strcmp(valueString, "DML_OPERATOR_GATHER") || !strcmp(valueString, "GATHER")) { return DML_OPERATOR_GATHER; }
-    if (!strcmp(valueString, "DML_OPERATOR_SPACE_TO_DEPTH") || !strcmp(valueString, "SPACE_TO_DEPTH")) { return DML_OPERATOR_SPACE_TO_DEPTH; }
-    if (!strcmp(valueString, "DML_OPERATOR_DEPTH_TO_SPACE") || !strcmp(valueString, "DEPTH_TO_SPACE")) { return DML_OPERATOR_DEPTH_TO_SPACE; }
-    if (!strcmp(valueString, "DML_OPERATOR_TILE") || !strcmp(valueString, "TILE")) { return DML_OPERATOR_TILE; }
-    if (!strcmp(valueString, "DML_OPERATOR_TOP_K") || !strcmp(valueString, "TOP_K")) { return DML_OPERATOR_TOP_K; }
-    if (!strcmp(valueString, "DML_OPERATOR_BATCH_NORMALIZATION") || !strcmp(valueString, "BATCH_NORMALIZATION")) { return DML_OPERATOR_BATCH_NORMALIZATION; }
-    if (!strcmp(valueString, "DML_OPERATOR_BATCH_NORMALIZATION_TRAINING") || !strcmp(valueString, "BATCH_NORMALIZATION_TRAINING")) { return DML_OPERATOR_BATCH_NORMALIZATION_TRAINING; }
-    if (!strcmp(valueString, "DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION") || !strcmp(valueString, "MEAN_VARIANCE_NORMALIZATION")) { return DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION; }
-    if (!strcmp(valueString, "DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION") || !strcmp(valueString, "LOCAL_RESPONSE_NORMALIZATION")) { return DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION; }
-    if (!strcmp(valueString, "DML_OPERATOR_LP_NORMALIZATION") || !strcmp(valueString, "LP_NORMALIZATION")) { return DML_OPERATOR_LP_NORMALIZATION; }
-    if (!strcmp(valueString, "DML_OPERATOR_RNN") || !strcmp(valueString, "RNN")) { return DML_OPERATOR_RNN; }
-    if (!strcmp(valueString, "DML_OPERATOR_LSTM") || !strcmp(valueString, "LSTM")) { return DML_OPERATOR_LSTM; }
-    if (!strcmp(valueString, "DML_OPERATOR_GRU") || !strcmp(valueString, "GRU")) { return DML_OPERATOR_GRU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_SIGN") || !strcmp(valueString, "ELEMENT_WISE_SIGN")) { return DML_OPERATOR_ELEMENT_WISE_SIGN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_IS_NAN") || !strcmp(valueString, "ELEMENT_WISE_IS_NAN")) { return DML_OPERATOR_ELEMENT_WISE_IS_NAN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ERF") || !strcmp(valueString, "ELEMENT_WISE_ERF")) { return DML_OPERATOR_ELEMENT_WISE_ERF; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_SINH") || !strcmp(valueString, "ELEMENT_WISE_SINH")) { return DML_OPERATOR_ELEMENT_WISE_SINH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_COSH") || !strcmp(valueString, "ELEMENT_WISE_COSH")) { return DML_OPERATOR_ELEMENT_WISE_COSH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_TANH") || !strcmp(valueString, "ELEMENT_WISE_TANH")) { return DML_OPERATOR_ELEMENT_WISE_TANH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ASINH") || !strcmp(valueString, "ELEMENT_WISE_ASINH")) { return DML_OPERATOR_ELEMENT_WISE_ASINH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ACOSH") || !strcmp(valueString, "ELEMENT_WISE_ACOSH")) { return DML_OPERATOR_ELEMENT_WISE_ACOSH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ATANH") || !strcmp(valueString, "ELEMENT_WISE_ATANH")) { return DML_OPERATOR_ELEMENT_WISE_ATANH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_IF") || !strcmp(valueString, "ELEMENT_WISE_IF")) { return DML_OPERATOR_ELEMENT_WISE_IF; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ADD1") || !strcmp(valueString, "ELEMENT_WISE_ADD1")) { return DML_OPERATOR_ELEMENT_WISE_ADD1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SHRINK") || !strcmp(valueString, "ACTIVATION_SHRINK")) { return DML_OPERATOR_ACTIVATION_SHRINK; }
-    if (!strcmp(valueString, "DML_OPERATOR_MAX_POOLING1") || !strcmp(valueString, "MAX_POOLING1")) { return DML_OPERATOR_MAX_POOLING1; }
-    if (!strcmp(valueString, "DML_OPERATOR_MAX_UNPOOLING") || !strcmp(valueString, "MAX_UNPOOLING")) { return DML_OPERATOR_MAX_UNPOOLING; }
-    if (!strcmp(valueString, "DML_OPERATOR_DIAGONAL_MATRIX") || !strcmp(valueString, "DIAGONAL_MATRIX")) { return DML_OPERATOR_DIAGONAL_MATRIX; }
-    if (!strcmp(valueString, "DML_OPERATOR_SCATTER") || !strcmp(valueString, "SCATTER")) { return DML_OPERATOR_SCATTER; }
-    if (!strcmp(valueString, "DML_OPERATOR_ONE_HOT") || !strcmp(valueString, "ONE_HOT")) { return DML_OPERATOR_ONE_HOT; }
-    if (!strcmp(valueString, "DML_OPERATOR_RESAMPLE") || !strcmp(valueString, "RESAMPLE")) { return DML_OPERATOR_RESAMPLE; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT") || !strcmp(valueString, "ELEMENT_WISE_BIT_SHIFT_LEFT")) { return DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT") || !strcmp(valueString, "ELEMENT_WISE_BIT_SHIFT_RIGHT")) { return DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ROUND") || !strcmp(valueString, "ELEMENT_WISE_ROUND")) { return DML_OPERATOR_ELEMENT_WISE_ROUND; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_IS_INFINITY") || !strcmp(valueString, "ELEMENT_WISE_IS_INFINITY")) { return DML_OPERATOR_ELEMENT_WISE_IS_INFINITY; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE") || !strcmp(valueString, "ELEMENT_WISE_MODULUS_TRUNCATE")) { return DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR") || !strcmp(valueString, "ELEMENT_WISE_MODULUS_FLOOR")) { return DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR; }
-    if (!strcmp(valueString, "DML_OPERATOR_FILL_VALUE_SEQUENCE") || !strcmp(valueString, "FILL_VALUE_SEQUENCE")) { return DML_OPERATOR_FILL_VALUE_SEQUENCE; }
-    if (!strcmp(valueString, "DML_OPERATOR_FILL_VALUE_CONSTANT") || !strcmp(valueString, "FILL_VALUE_CONSTANT")) { return DML_OPERATOR_FILL_VALUE_CONSTANT; }
-    if (!strcmp(valueString, "DML_OPERATOR_CUMULATIVE_SUMMATION") || !strcmp(valueString, "CUMULATIVE_SUMMATION")) { return DML_OPERATOR_CUMULATIVE_SUMMATION; }
-    if (!strcmp(valueString, "DML_OPERATOR_REVERSE_SUBSEQUENCES") || !strcmp(valueString, "REVERSE_SUBSEQUENCES")) { return DML_OPERATOR_REVERSE_SUBSEQUENCES; }
-    if (!strcmp(valueString, "DML_OPERATOR_GATHER_ELEMENTS") || !strcmp(valueString, "GATHER_ELEMENTS")) { return DML_OPERATOR_GATHER_ELEMENTS; }
-    if (!strcmp(valueString, "DML_OPERATOR_GATHER_ND") || !strcmp(valueString, "GATHER_ND")) { return DML_OPERATOR_GATHER_ND; }
-    if (!strcmp(valueString, "DML_OPERATOR_SCATTER_ND") || !strcmp(valueString, "SCATTER_ND")) { return DML_OPERATOR_SCATTER_ND; }
-    if (!strcmp(valueString, "DML_OPERATOR_MAX_POOLING2") || !strcmp(valueString, "MAX_POOLING2")) { return DML_OPERATOR_MAX_POOLING2; }
-    if (!strcmp(valueString, "DML_OPERATOR_SLICE1") || !strcmp(valueString, "SLICE1")) { return DML_OPERATOR_SLICE1; }
-    if (!strcmp(valueString, "DML_OPERATOR_TOP_K1") || !strcmp(valueString, "TOP_K1")) { return DML_OPERATOR_TOP_K1; }
-    if (!strcmp(valueString, "DML_OPERATOR_DEPTH_TO_SPACE1") || !strcmp(valueString, "DEPTH_TO_SPACE1")) { return DML_OPERATOR_DEPTH_TO_SPACE1; }
-    if (!strcmp(valueString, "DML_OPERATOR_SPACE_TO_DEPTH1") || !strcmp(valueString, "SPACE_TO_DEPTH1")) { return DML_OPERATOR_SPACE_TO_DEPTH1; }
-    if (!strcmp(valueString, "DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1") || !strcmp(valueString, "MEAN_VARIANCE_NORMALIZATION1")) { return DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1; }
-    if (!strcmp(valueString, "DML_OPERATOR_RESAMPLE1") || !strcmp(valueString, "RESAMPLE1")) { return DML_OPERATOR_RESAMPLE1; }
-    if (!strcmp(valueString, "DML_OPERATOR_MATRIX_MULTIPLY_INTEGER") || !strcmp(valueString, "MATRIX_MULTIPLY_INTEGER")) { return DML_OPERATOR_MATRIX_MULTIPLY_INTEGER; }
-    if (!strcmp(valueString, "DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY") || !strcmp(valueString, "QUANTIZED_LINEAR_MATRIX_MULTIPLY")) { return DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY; }
-    if (!strcmp(valueString, "DML_OPERATOR_CONVOLUTION_INTEGER") || !strcmp(valueString, "CONVOLUTION_INTEGER")) { return DML_OPERATOR_CONVOLUTION_INTEGER; }
-    if (!strcmp(valueString, "DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION") || !strcmp(valueString, "QUANTIZED_LINEAR_CONVOLUTION")) { return DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_AND") || !strcmp(valueString, "ELEMENT_WISE_BIT_AND")) { return DML_OPERATOR_ELEMENT_WISE_BIT_AND; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_OR") || !strcmp(valueString, "ELEMENT_WISE_BIT_OR")) { return DML_OPERATOR_ELEMENT_WISE_BIT_OR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_XOR") || !strcmp(valueString, "ELEMENT_WISE_BIT_XOR")) { return DML_OPERATOR_ELEMENT_WISE_BIT_XOR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_NOT") || !strcmp(valueString, "ELEMENT_WISE_BIT_NOT")) { return DML_OPERATOR_ELEMENT_WISE_BIT_NOT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_BIT_COUNT") || !strcmp(valueString, "ELEMENT_WISE_BIT_COUNT")) { return DML_OPERATOR_ELEMENT_WISE_BIT_COUNT; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_RELU_GRAD") || !strcmp(valueString, "ACTIVATION_RELU_GRAD")) { return DML_OPERATOR_ACTIVATION_RELU_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_AVERAGE_POOLING_GRAD") || !strcmp(valueString, "AVERAGE_POOLING_GRAD")) { return DML_OPERATOR_AVERAGE_POOLING_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_MAX_POOLING_GRAD") || !strcmp(valueString, "MAX_POOLING_GRAD")) { return DML_OPERATOR_MAX_POOLING_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_RANDOM_GENERATOR") || !strcmp(valueString, "RANDOM_GENERATOR")) { return DML_OPERATOR_RANDOM_GENERATOR; }
-    if (!strcmp(valueString, "DML_OPERATOR_NONZERO_COORDINATES") || !strcmp(valueString, "NONZERO_COORDINATES")) { return DML_OPERATOR_NONZERO_COORDINATES; }
-    if (!strcmp(valueString, "DML_OPERATOR_RESAMPLE_GRAD") || !strcmp(valueString, "RESAMPLE_GRAD")) { return DML_OPERATOR_RESAMPLE_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_SLICE_GRAD") || !strcmp(valueString, "SLICE_GRAD")) { return DML_OPERATOR_SLICE_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_ADAM_OPTIMIZER") || !strcmp(valueString, "ADAM_OPTIMIZER")) { return DML_OPERATOR_ADAM_OPTIMIZER; }
-    if (!strcmp(valueString, "DML_OPERATOR_ARGMIN") || !strcmp(valueString, "ARGMIN")) { return DML_OPERATOR_ARGMIN; }
-    if (!strcmp(valueString, "DML_OPERATOR_ARGMAX") || !strcmp(valueString, "ARGMAX")) { return DML_OPERATOR_ARGMAX; }
-    if (!strcmp(valueString, "DML_OPERATOR_ROI_ALIGN") || !strcmp(valueString, "ROI_ALIGN")) { return DML_OPERATOR_ROI_ALIGN; }
-    if (!strcmp(valueString, "DML_OPERATOR_GATHER_ND1") || !strcmp(valueString, "GATHER_ND1")) { return DML_OPERATOR_GATHER_ND1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_ATAN_YX") || !strcmp(valueString, "ELEMENT_WISE_ATAN_YX")) { return DML_OPERATOR_ELEMENT_WISE_ATAN_YX; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD") || !strcmp(valueString, "ELEMENT_WISE_CLIP_GRAD")) { return DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE") || !strcmp(valueString, "ELEMENT_WISE_DIFFERENCE_SQUARE")) { return DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE; }
-    if (!strcmp(valueString, "DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD") || !strcmp(valueString, "LOCAL_RESPONSE_NORMALIZATION_GRAD")) { return DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_CUMULATIVE_PRODUCT") || !strcmp(valueString, "CUMULATIVE_PRODUCT")) { return DML_OPERATOR_CUMULATIVE_PRODUCT; }
-    if (!strcmp(valueString, "DML_OPERATOR_BATCH_NORMALIZATION_GRAD") || !strcmp(valueString, "BATCH_NORMALIZATION_GRAD")) { return DML_OPERATOR_BATCH_NORMALIZATION_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD") || !strcmp(valueString, "BATCH_NORMALIZATION_TRAINING_GRAD")) { return DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD") || !strcmp(valueString, "ELEMENT_WISE_QUANTIZED_LINEAR_ADD")) { return DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD; }
-    if (!strcmp(valueString, "DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR") || !strcmp(valueString, "DYNAMIC_QUANTIZE_LINEAR")) { return DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR; }
-    if (!strcmp(valueString, "DML_OPERATOR_ROI_ALIGN1") || !strcmp(valueString, "ROI_ALIGN1")) { return DML_OPERATOR_ROI_ALIGN1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_CLIP1") || !strcmp(valueString, "ELEMENT_WISE_CLIP1")) { return DML_OPERATOR_ELEMENT_WISE_CLIP1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1") || !strcmp(valueString, "ELEMENT_WISE_CLIP_GRAD1")) { return DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1; }
-    if (!strcmp(valueString, "DML_OPERATOR_ELEMENT_WISE_NEGATE") || !strcmp(valueString, "ELEMENT_WISE_NEGATE")) { return DML_OPERATOR_ELEMENT_WISE_NEGATE; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_GELU") || !strcmp(valueString, "ACTIVATION_GELU")) { return DML_OPERATOR_ACTIVATION_GELU; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_SWISH") || !strcmp(valueString, "ACTIVATION_SWISH")) { return DML_OPERATOR_ACTIVATION_SWISH; }
-    if (!strcmp(valueString, "DML_OPERATOR_ACTIVATION_HARD_SWISH") || !strcmp(valueString, "ACTIVATION_HARD_SWISH")) { return DML_OPERATOR_ACTIVATION_HARD_SWISH; }
-    if (!strcmp(valueString, "DML_OPERATOR_RESAMPLE2") || !strcmp(valueString, "RESAMPLE2")) { return DML_OPERATOR_RESAMPLE2; }
-    if (!strcmp(valueString, "DML_OPERATOR_RESAMPLE_GRAD1") || !strcmp(valueString, "RESAMPLE_GRAD1")) { return DML_OPERATOR_RESAMPLE_GRAD1; }
-    if (!strcmp(valueString, "DML_OPERATOR_DIAGONAL_MATRIX1") || !strcmp(valueString, "DIAGONAL_MATRIX1")) { return DML_OPERATOR_DIAGONAL_MATRIX1; }
-    if (!strcmp(valueString, "DML_OPERATOR_MULTIHEAD_ATTENTION") || !strcmp(valueString, "MULTIHEAD_ATTENTION")) { return DML_OPERATOR_MULTIHEAD_ATTENTION; }
-    if (!strcmp(valueString, "DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING") || !strcmp(valueString, "QUANTIZED_LINEAR_AVERAGE_POOLING")) { return DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING; }
-    if (!strcmp(valueString, "DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT") || !strcmp(valueString, "MATRIX_MULTIPLY_INTEGER_TO_FLOAT")) { return DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT; }
-    if (!strcmp(valueString, "DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2") || !strcmp(valueString, "MEAN_VARIANCE_NORMALIZATION2")) { return DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2; }
-    if (!strcmp(valueString, "DML_OPERATOR_MULTIHEAD_ATTENTION1") || !strcmp(valueString, "MULTIHEAD_ATTENTION1")) { return DML_OPERATOR_MULTIHEAD_ATTENTION1; }
-    if (!strcmp(valueString, "DML_OPERATOR_QUANTIZE") || !strcmp(valueString, "QUANTIZE")) { return DML_OPERATOR_QUANTIZE; }
-    if (!strcmp(valueString, "DML_OPERATOR_DEQUANTIZE") || !strcmp(valueString, "DEQUANTIZE")) { return DML_OPERATOR_DEQUANTIZE; }
+    if (auto result = c_dmlOperatorTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_OPERATOR_TYPE.", valueString));
 }
 
@@ -245,6 +643,23 @@ DML_OPERATOR_TYPE ParseDmlOperatorTypeField(const rapidjson::Value& object, std:
     });
 }
 
+constexpr NameTable<DML_BINDING_TYPE, 3, 8> c_dmlBindingTypeNames =
+{
+    {
+        4, 0, 0,
+    },
+    {{
+        {},
+        {"BUFFER", DML_BINDING_TYPE_BUFFER},
+        {"DML_BINDING_TYPE_BUFFER", DML_BINDING_TYPE_BUFFER},
+        {},
+        {"DML_BINDING_TYPE_BUFFER_ARRAY", DML_BINDING_TYPE_BUFFER_ARRAY},
+        {"DML_BINDING_TYPE_NONE", DML_BINDING_TYPE_NONE},
+        {"NONE", DML_BINDING_TYPE_NONE},
+        {"BUFFER_ARRAY", DML_BINDING_TYPE_BUFFER_ARRAY},
+    }}
+};
+
 DML_BINDING_TYPE ParseDmlBindingType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -252,9 +667,7 @@ DML_BINDING_TYPE ParseDmlBindingType(const rapidjson::Value& value)
         throw std::invalid_argument("DML_BINDING_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_BINDING_TYPE_NONE") || !strcmp(valueString, "NONE")) { return DML_BINDING_TYPE_NONE; }
-    if (!strcmp(valueString, "DML_BINDING_TYPE_BUFFER") || !strcmp(valueString, "BUFFER")) { return DML_BINDING_TYPE_BUFFER; }
-    if (!strcmp(valueString, "DML_BINDING_TYPE_BUFFER_ARRAY") || !strcmp(valueString, "BUFFER_ARRAY")) { return DML_BINDING_TYPE_BUFFER_ARRAY; }
+    if (auto result = c_dmlBindingTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_BINDING_TYPE.", valueString));
 }
 
@@ -265,6 +678,47 @@ DML_BINDING_TYPE ParseDmlBindingTypeField(const rapidjson::Value& object, std::s
     });
 }
 
+constexpr NameTable<DML_REDUCE_FUNCTION, 12, 32> c_dmlReduceFunctionNames =
+{
+    {
+        0, 2, 1, 0, 0, 0, 0, 1, 0, 0, 4, 0,
+    },
+    {{
+        {"LOG_SUM_EXP", DML_REDUCE_FUNCTION_LOG_SUM_EXP},
+        {"DML_REDUCE_FUNCTION_SUM", DML_REDUCE_FUNCTION_SUM},
+        {"L1", DML_REDUCE_FUNCTION_L1},
+        {"MULTIPLY", DML_REDUCE_FUNCTION_MULTIPLY},
+        {"DML_REDUCE_FUNCTION_AVERAGE", DML_REDUCE_FUNCTION_AVERAGE},
+        {"DML_REDUCE_FUNCTION_MIN", DML_REDUCE_FUNCTION_MIN},
+        {"DML_REDUCE_FUNCTION_ARGMIN", DML_REDUCE_FUNCTION_ARGMIN},
+        {"DML_REDUCE_FUNCTION_LOG_SUM", DML_REDUCE_FUNCTION_LOG_SUM},
+        {},
+        {},
+        {},
+        {"DML_REDUCE_FUNCTION_ARGMAX", DML_REDUCE_FUNCTION_ARGMAX},
+        {},
+        {"DML_REDUCE_FUNCTION_LOG_SUM_EXP", DML_REDUCE_FUNCTION_LOG_SUM_EXP},
+        {"SUM", DML_REDUCE_FUNCTION_SUM},
+        {"MIN", DML_REDUCE_FUNCTION_MIN},
+        {"DML_REDUCE_FUNCTION_MAX", DML_REDUCE_FUNCTION_MAX},
+        {"MAX", DML_REDUCE_FUNCTION_MAX},
+        {},
+        {"ARGMAX", DML_REDUCE_FUNCTION_ARGMAX},
+        {},
+        {"LOG_SUM", DML_REDUCE_FUNCTION_LOG_SUM},
+        {"DML_REDUCE_FUNCTION_L2", DML_REDUCE_FUNCTION_L2},
+        {"AVERAGE", DML_REDUCE_FUNCTION_AVERAGE},
+        {"DML_REDUCE_FUNCTION_SUM_SQUARE", DML_REDUCE_FUNCTION_SUM_SQUARE},
+        {"DML_REDUCE_FUNCTION_MULTIPLY", DML_REDUCE_FUNCTION_MULTIPLY},
+        {"L2", DML_REDUCE_FUNCTION_L2},
+        {},
+        {"SUM_SQUARE", DML_REDUCE_FUNCTION_SUM_SQUARE},
+        {},
+        {"DML_REDUCE_FUNCTION_L1", DML_REDUCE_FUNCTION_L1},
+        {"ARGMIN", DML_REDUCE_FUNCTION_ARGMIN},
+    }}
+};
+
 DML_REDUCE_FUNCTION ParseDmlReduceFunction(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -272,18 +726,7 @@ DML_REDUCE_FUNCTION ParseDmlReduceFunction(const rapidjson::Value& value)
         throw std::invalid_argument("DML_REDUCE_FUNCTION must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_ARGMAX") || !strcmp(valueString, "ARGMAX")) { return DML_REDUCE_FUNCTION_ARGMAX; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_ARGMIN") || !strcmp(valueString, "ARGMIN")) { return DML_REDUCE_FUNCTION_ARGMIN; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_AVERAGE") || !strcmp(valueString, "AVERAGE")) { return DML_REDUCE_FUNCTION_AVERAGE; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_L1") || !strcmp(valueString, "L1")) { return DML_REDUCE_FUNCTION_L1; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_L2") || !strcmp(valueString, "L2")) { return DML_REDUCE_FUNCTION_L2; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_LOG_SUM") || !strcmp(valueString, "LOG_SUM")) { return DML_REDUCE_FUNCTION_LOG_SUM; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_LOG_SUM_EXP") || !strcmp(valueString, "LOG_SUM_EXP")) { return DML_REDUCE_FUNCTION_LOG_SUM_EXP; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_MAX") || !strcmp(valueString, "MAX")) { return DML_REDUCE_FUNCTION_MAX; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_MIN") || !strcmp(valueString, "MIN")) { return DML_REDUCE_FUNCTION_MIN; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_MULTIPLY") || !strcmp(valueString, "MULTIPLY")) { return DML_REDUCE_FUNCTION_MULTIPLY; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_SUM") || !strcmp(valueString, "SUM")) { return DML_REDUCE_FUNCTION_SUM; }
-    if (!strcmp(valueString, "DML_REDUCE_FUNCTION_SUM_SQUARE") || !strcmp(valueString, "SUM_SQUARE")) { return DML_REDUCE_FUNCTION_SUM_SQUARE; }
+    if (auto result = c_dmlReduceFunctionNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_REDUCE_FUNCTION.", valueString));
 }
 
@@ -294,6 +737,19 @@ DML_REDUCE_FUNCTION ParseDmlReduceFunctionField(const rapidjson::Value& object,
     });
 }
 
+constexpr NameTable<DML_MATRIX_TRANSFORM, 2, 4> c_dmlMatrixTransformNames =
+{
+    {
+        0, 22,
+    },
+    {{
+        {"DML_MATRIX_TRANSFORM_NONE", DML_MATRIX_TRANSFORM_NONE},
+        {"NONE", DML_MATRIX_TRANSFORM_NONE},
+        {"DML_MATRIX_TRANSFORM_TRANSPOSE", DML_MATRIX_TRANSFORM_TRANSPOSE},
+        {"TRANSPOSE", DML_MATRIX_TRANSFORM_TRANSPOSE},
+    }}
+};
+
 DML_MATRIX_TRANSFORM ParseDmlMatrixTransform(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -301,8 +757,7 @@ DML_MATRIX_TRANSFORM ParseDmlMatrixTransform(const rapidjson::Value& value)
         throw std::invalid_argument("DML_MATRIX_TRANSFORM must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_MATRIX_TRANSFORM_NONE") || !strcmp(valueString, "NONE")) { return DML_MATRIX_TRANSFORM_NONE; }
-    if (!strcmp(valueString, "DML_MATRIX_TRANSFORM_TRANSPOSE") || !strcmp(valueString, "TRANSPOSE")) { return DML_MATRIX_TRANSFORM_TRANSPOSE; }
+    if (auto result = c_dmlMatrixTransformNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_MATRIX_TRANSFORM.", valueString));
 }
 
@@ -313,6 +768,19 @@ DML_MATRIX_TRANSFORM ParseDmlMatrixTransformField(const rapidjson::Value& object
     });
 }
 
+constexpr NameTable<DML_CONVOLUTION_MODE, 2, 4> c_dmlConvolutionModeNames =
+{
+    {
+        0, 0,
+    },
+    {{
+        {"DML_CONVOLUTION_MODE_CROSS_CORRELATION", DML_CONVOLUTION_MODE_CROSS_CORRELATION},
+        {"DML_CONVOLUTION_MODE_CONVOLUTION", DML_CONVOLUTION_MODE_CONVOLUTION},
+        {"CROSS_CORRELATION", DML_CONVOLUTION_MODE_CROSS_CORRELATION},
+        {"CONVOLUTION", DML_CONVOLUTION_MODE_CONVOLUTION},
+    }}
+};
+
 DML_CONVOLUTION_MODE ParseDmlConvolutionMode(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -320,8 +788,7 @@ DML_CONVOLUTION_MODE ParseDmlConvolutionMode(const rapidjson::Value& value)
         throw std::invalid_argument("DML_CONVOLUTION_MODE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_CONVOLUTION_MODE_CONVOLUTION") || !strcmp(valueString, "CONVOLUTION")) { return DML_CONVOLUTION_MODE_CONVOLUTION; }
-    if (!strcmp(valueString, "DML_CONVOLUTION_MODE_CROSS_CORRELATION") || !strcmp(valueString, "CROSS_CORRELATION")) { return DML_CONVOLUTION_MODE_CROSS_CORRELATION; }
+    if (auto result = c_dmlConvolutionModeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_CONVOLUTION_MODE.", valueString));
 }
 
@@ -332,6 +799,19 @@ DML_CONVOLUTION_MODE ParseDmlConvolutionModeField(const rapidjson::Value& object
     });
 }
 
+constexpr NameTable<DML_CONVOLUTION_DIRECTION, 2, 4> c_dmlConvolutionDirectionNames =
+{
+    {
+        1, 1,
+    },
+    {{
+        {"DML_CONVOLUTION_DIRECTION_BACKWARD", DML_CONVOLUTION_DIRECTION_BACKWARD},
+        {"FORWARD", DML_CONVOLUTION_DIRECTION_FORWARD},
+        {"BACKWARD", DML_CONVOLUTION_DIRECTION_BACKWARD},
+        {"DML_CONVOLUTION_DIRECTION_FORWARD", DML_CONVOLUTION_DIRECTION_FORWARD},
+    }}
+};
+
 DML_CONVOLUTION_DIRECTION ParseDmlConvolutionDirection(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -339,8 +819,7 @@ DML_CONVOLUTION_DIRECTION ParseDmlConvolutionDirection(const rapidjson::Value& v
         throw std::invalid_argument("DML_CONVOLUTION_DIRECTION must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_CONVOLUTION_DIRECTION_FORWARD") || !strcmp(valueString, "FORWARD")) { return DML_CONVOLUTION_DIRECTION_FORWARD; }
-    if (!strcmp(valueString, "DML_CONVOLUTION_DIRECTION_BACKWARD") || !strcmp(valueString, "BACKWARD")) { return DML_CONVOLUTION_DIRECTION_BACKWARD; }
+    if (auto result = c_dmlConvolutionDirectionNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_CONVOLUTION_DIRECTION.", valueString));
 }
 
@@ -351,6 +830,23 @@ DML_CONVOLUTION_DIRECTION ParseDmlConvolutionDirectionField(const rapidjson::Val
     });
 }
 
+constexpr NameTable<DML_PADDING_MODE, 4, 8> c_dmlPaddingModeNames =
+{
+    {
+        0, 1, 0, 3,
+    },
+    {{
+        {"DML_PADDING_MODE_SYMMETRIC", DML_PADDING_MODE_SYMMETRIC},
+        {"CONSTANT", DML_PADDING_MODE_CONSTANT},
+        {"DML_PADDING_MODE_CONSTANT", DML_PADDING_MODE_CONSTANT},
+        {"SYMMETRIC", DML_PADDING_MODE_SYMMETRIC},
+        {"DML_PADDING_MODE_REFLECTION", DML_PADDING_MODE_REFLECTION},
+        {"DML_PADDING_MODE_EDGE", DML_PADDING_MODE_EDGE},
+        {"EDGE", DML_PADDING_MODE_EDGE},
+        {"REFLECTION", DML_PADDING_MODE_REFLECTION},
+    }}
+};
+
 DML_PADDING_MODE ParseDmlPaddingMode(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -358,10 +854,7 @@ DML_PADDING_MODE ParseDmlPaddingMode(const rapidjson::Value& value)
         throw std::invalid_argument("DML_PADDING_MODE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_PADDING_MODE_CONSTANT") || !strcmp(valueString, "CONSTANT")) { return DML_PADDING_MODE_CONSTANT; }
-    if (!strcmp(valueString, "DML_PADDING_MODE_EDGE") || !strcmp(valueString, "EDGE")) { return DML_PADDING_MODE_EDGE; }
-    if (!strcmp(valueString, "DML_PADDING_MODE_REFLECTION") || !strcmp(valueString, "REFLECTION")) { return DML_PADDING_MODE_REFLECTION; }
-    if (!strcmp(valueString, "DML_PADDING_MODE_SYMMETRIC") || !strcmp(valueString, "SYMMETRIC")) { return DML_PADDING_MODE_SYMMETRIC; }
+    if (auto result = c_dmlPaddingModeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_PADDING_MODE.", valueString));
 }
 
@@ -372,6 +865,19 @@ DML_PADDING_MODE ParseDmlPaddingModeField(const rapidjson::Value& object, std::s
     });
 }
 
+constexpr NameTable<DML_INTERPOLATION_MODE, 2, 4> c_dmlInterpolationModeNames =
+{
+    {
+        0, 0,
+    },
+    {{
+        {"DML_INTERPOLATION_MODE_LINEAR", DML_INTERPOLATION_MODE_LINEAR},
+        {"DML_INTERPOLATION_MODE_NEAREST_NEIGHBOR", DML_INTERPOLATION_MODE_NEAREST_NEIGHBOR},
+        {"NEAREST_NEIGHBOR", DML_INTERPOLATION_MODE_NEAREST_NEIGHBOR},
+        {"LINEAR", DML_INTERPOLATION_MODE_LINEAR},
+    }}
+};
+
 DML_INTERPOLATION_MODE ParseDmlInterpolationMode(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -379,8 +885,7 @@ DML_INTERPOLATION_MODE ParseDmlInterpolationMode(const rapidjson::Value& value)
         throw std::invalid_argument("DML_INTERPOLATION_MODE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_INTERPOLATION_MODE_NEAREST_NEIGHBOR") || !strcmp(valueString, "NEAREST_NEIGHBOR")) { return DML_INTERPOLATION_MODE_NEAREST_NEIGHBOR; }
-    if (!strcmp(valueString, "DML_INTERPOLATION_MODE_LINEAR") || !strcmp(valueString, "LINEAR")) { return DML_INTERPOLATION_MODE_LINEAR; }
+    if (auto result = c_dmlInterpolationModeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_INTERPOLATION_MODE.", valueString));
 }
 
@@ -391,6 +896,23 @@ DML_INTERPOLATION_MODE ParseDmlInterpolationModeField(const rapidjson::Value& ob
     });
 }
 
+constexpr NameTable<DML_RECURRENT_NETWORK_DIRECTION, 3, 8> c_dmlRecurrentNetworkDirectionNames =
+{
+    {
+        0, 1, 0,
+    },
+    {{
+        {"DML_RECURRENT_NETWORK_DIRECTION_BIDIRECTIONAL", DML_RECURRENT_NETWORK_DIRECTION_BIDIRECTIONAL},
+        {},
+        {},
+        {"BIDIRECTIONAL", DML_RECURRENT_NETWORK_DIRECTION_BIDIRECTIONAL},
+        {"DML_RECURRENT_NETWORK_DIRECTION_BACKWARD", DML_RECURRENT_NETWORK_DIRECTION_BACKWARD},
+        {"DML_RECURRENT_NETWORK_DIRECTION_FORWARD", DML_RECURRENT_NETWORK_DIRECTION_FORWARD},
+        {"BACKWARD", DML_RECURRENT_NETWORK_DIRECTION_BACKWARD},
+        {"FORWARD", DML_RECURRENT_NETWORK_DIRECTION_FORWARD},
+    }}
+};
+
 DML_RECURRENT_NETWORK_DIRECTION ParseDmlRecurrentNetworkDirection(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -398,9 +920,7 @@ DML_RECURRENT_NETWORK_DIRECTION ParseDmlRecurrentNetworkDirection(const rapidjso
         throw std::invalid_argument("DML_RECURRENT_NETWORK_DIRECTION must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_RECURRENT_NETWORK_DIRECTION_FORWARD") || !strcmp(valueString, "FORWARD")) { return DML_RECURRENT_NETWORK_DIRECTION_FORWARD; }
-    if (!strcmp(valueString, "DML_RECURRENT_NETWORK_DIRECTION_BACKWARD") || !strcmp(valueString, "BACKWARD")) { return DML_RECURRENT_NETWORK_DIRECTION_BACKWARD; }
-    if (!strcmp(valueString, "DML_RECURRENT_NETWORK_DIRECTION_BIDIRECTIONAL") || !strcmp(valueString, "BIDIRECTIONAL")) { return DML_RECURRENT_NETWORK_DIRECTION_BIDIRECTIONAL; }
+    if (auto result = c_dmlRecurrentNetworkDirectionNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_RECURRENT_NETWORK_DIRECTION.", valueString));
 }
 
@@ -411,6 +931,19 @@ DML_RECURRENT_NETWORK_DIRECTION ParseDmlRecurrentNetworkDirectionField(const rap
     });
 }
 
+constexpr NameTable<DML_FEATURE, 2, 4> c_dmlFeatureNames =
+{
+    {
+        0, 27,
+    },
+    {{
+        {"DML_FEATURE_TENSOR_DATA_TYPE_SUPPORT", DML_FEATURE_TENSOR_DATA_TYPE_SUPPORT},
+        {"DML_FEATURE_FEATURE_LEVELS", DML_FEATURE_FEATURE_LEVELS},
+        {"TENSOR_DATA_TYPE_SUPPORT", DML_FEATURE_TENSOR_DATA_TYPE_SUPPORT},
+        {"FEATURE_LEVELS", DML_FEATURE_FEATURE_LEVELS},
+    }}
+};
+
 DML_FEATURE ParseDmlFeature(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -418,8 +951,7 @@ DML_FEATURE ParseDmlFeature(const rapidjson::Value& value)
         throw std::invalid_argument("DML_FEATURE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_FEATURE_TENSOR_DATA_TYPE_SUPPORT") || !strcmp(valueString, "TENSOR_DATA_TYPE_SUPPORT")) { return DML_FEATURE_TENSOR_DATA_TYPE_SUPPORT; }
-    if (!strcmp(valueString, "DML_FEATURE_FEATURE_LEVELS") || !strcmp(valueString, "FEATURE_LEVELS")) { return DML_FEATURE_FEATURE_LEVELS; }
+    if (auto result = c_dmlFeatureNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_FEATURE.", valueString));
 }
 
@@ -430,6 +962,47 @@ DML_FEATURE ParseDmlFeatureField(const rapidjson::Value& object, std::string_vie
     });
 }
 
+constexpr NameTable<DML_FEATURE_LEVEL, 14, 32> c_dmlFeatureLevelNames =
+{
+    {
+        0, 0, 1, 0, 1, 0, 0, 0, 10, 4, 5, 1, 0, 35,
+    },
+    {{
+        {"6_3", DML_FEATURE_LEVEL_6_3},
+        {"DML_FEATURE_LEVEL_6_1", DML_FEATURE_LEVEL_6_1},
+        {"DML_FEATURE_LEVEL_6_3", DML_FEATURE_LEVEL_6_3},
+        {"DML_FEATURE_LEVEL_3_0", DML_FEATURE_LEVEL_3_0},
+        {"6_1", DML_FEATURE_LEVEL_6_1},
+        {"4_1", DML_FEATURE_LEVEL_4_1},
+        {"1_0", DML_FEATURE_LEVEL_1_0},
+        {"DML_FEATURE_LEVEL_2_0", DML_FEATURE_LEVEL_2_0},
+        {"4_0", DML_FEATURE_LEVEL_4_0},
+        {"DML_FEATURE_LEVEL_3_1", DML_FEATURE_LEVEL_3_1},
+        {"DML_FEATURE_LEVEL_5_0", DML_FEATURE_LEVEL_5_0},
+        {"5_1", DML_FEATURE_LEVEL_5_1},
+        {"DML_FEATURE_LEVEL_4_1", DML_FEATURE_LEVEL_4_1},
+        {},
+        {},
+        {"5_0", DML_FEATURE_LEVEL_5_0},
+        {"2_1", DML_FEATURE_LEVEL_2_1},
+        {"6_0", DML_FEATURE_LEVEL_6_0},
+        {},
+        {"DML_FEATURE_LEVEL_5_2", DML_FEATURE_LEVEL_5_2},
+        {"DML_FEATURE_LEVEL_1_0", DML_FEATURE_LEVEL_1_0},
+        {"5_2", DML_FEATURE_LEVEL_5_2},
+        {"3_1", DML_FEATURE_LEVEL_3_1},
+        {"6_2", DML_FEATURE_LEVEL_6_2},
+        {"DML_FEATURE_LEVEL_5_1", DML_FEATURE_LEVEL_5_1},
+        {"DML_FEATURE_LEVEL_6_2", DML_FEATURE_LEVEL_6_2},
+        {"DML_FEATURE_LEVEL_4_0", DML_FEATURE_LEVEL_4_0},
+        {"2_0", DML_FEATURE_LEVEL_2_0},
+        {"DML_FEATURE_LEVEL_2_1", DML_FEATURE_LEVEL_2_1},
+        {},
+        {"3_0", DML_FEATURE_LEVEL_3_0},
+        {"DML_FEATURE_LEVEL_6_0", DML_FEATURE_LEVEL_6_0},
+    }}
+};
+
 DML_FEATURE_LEVEL ParseDmlFeatureLevel(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -437,20 +1010,7 @@ DML_FEATURE_LEVEL ParseDmlFeatureLevel(const rapidjson::Value& value)
         throw std::invalid_argument("DML_FEATURE_LEVEL must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_1_0") || !strcmp(valueString, "1_0")) { return DML_FEATURE_LEVEL_1_0; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_2_0") || !strcmp(valueString, "2_0")) { return DML_FEATURE_LEVEL_2_0; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_2_1") || !strcmp(valueString, "2_1")) { return DML_FEATURE_LEVEL_2_1; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_3_0") || !strcmp(valueString, "3_0")) { return DML_FEATURE_LEVEL_3_0; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_3_1") || !strcmp(valueString, "3_1")) { return DML_FEATURE_LEVEL_3_1; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_4_0") || !strcmp(valueString, "4_0")) { return DML_FEATURE_LEVEL_4_0; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_4_1") || !strcmp(valueString, "4_1")) { return DML_FEATURE_LEVEL_4_1; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_5_0") || !strcmp(valueString, "5_0")) { return DML_FEATURE_LEVEL_5_0; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_5_1") || !strcmp(valueString, "5_1")) { return DML_FEATURE_LEVEL_5_1; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_5_2") || !strcmp(valueString, "5_2")) { return DML_FEATURE_LEVEL_5_2; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_6_0") || !strcmp(valueString, "6_0")) { return DML_FEATURE_LEVEL_6_0; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_6_1") || !strcmp(valueString, "6_1")) { return DML_FEATURE_LEVEL_6_1; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_6_2") || !strcmp(valueString, "6_2")) { return DML_FEATURE_LEVEL_6_2; }
-    if (!strcmp(valueString, "DML_FEATURE_LEVEL_6_3") || !strcmp(valueString, "6_3")) { return DML_FEATURE_LEVEL_6_3; }
+    if (auto result = c_dmlFeatureLevelNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_FEATURE_LEVEL.", valueString));
 }
 
@@ -461,6 +1021,23 @@ DML_FEATURE_LEVEL ParseDmlFeatureLevelField(const rapidjson::Value& object, std:
     });
 }
 
+constexpr NameTable<DML_IS_INFINITY_MODE, 3, 8> c_dmlIsInfinityModeNames =
+{
+    {
+        0, 1, 1,
+    },
+    {{
+        {"DML_IS_INFINITY_MODE_NEGATIVE", DML_IS_INFINITY_MODE_NEGATIVE},
+        {"POSITIVE", DML_IS_INFINITY_MODE_POSITIVE},
+        {"NEGATIVE", DML_IS_INFINITY_MODE_NEGATIVE},
+        {},
+        {},
+        {"DML_IS_INFINITY_MODE_POSITIVE", DML_IS_INFINITY_MODE_POSITIVE},
+        {"DML_IS_INFINITY_MODE_EITHER", DML_IS_INFINITY_MODE_EITHER},
+        {"EITHER", DML_IS_INFINITY_MODE_EITHER},
+    }}
+};
+
 DML_IS_INFINITY_MODE ParseDmlIsInfinityMode(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -468,9 +1045,7 @@ DML_IS_INFINITY_MODE ParseDmlIsInfinityMode(const rapidjson::Value& value)
         throw std::invalid_argument("DML_IS_INFINITY_MODE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_IS_INFINITY_MODE_EITHER") || !strcmp(valueString, "EITHER")) { return DML_IS_INFINITY_MODE_EITHER; }
-    if (!strcmp(valueString, "DML_IS_INFINITY_MODE_POSITIVE") || !strcmp(valueString, "POSITIVE")) { return DML_IS_INFINITY_MODE_POSITIVE; }
-    if (!strcmp(valueString, "DML_IS_INFINITY_MODE_NEGATIVE") || !strcmp(valueString, "NEGATIVE")) { return DML_IS_INFINITY_MODE_NEGATIVE; }
+    if (auto result = c_dmlIsInfinityModeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_IS_INFINITY_MODE.", valueString));
 }
 
@@ -481,6 +1056,19 @@ DML_IS_INFINITY_MODE ParseDmlIsInfinityModeField(const rapidjson::Value& object,
     });
 }
 
+constexpr NameTable<DML_DEPTH_SPACE_ORDER, 2, 4> c_dmlDepthSpaceOrderNames =
+{
+    {
+        1, 0,
+    },
+    {{
+        {"DEPTH_COLUMN_ROW", DML_DEPTH_SPACE_ORDER_DEPTH_COLUMN_ROW},
+        {"COLUMN_ROW_DEPTH", DML_DEPTH_SPACE_ORDER_COLUMN_ROW_DEPTH},
+        {"DML_DEPTH_SPACE_ORDER_DEPTH_COLUMN_ROW", DML_DEPTH_SPACE_ORDER_DEPTH_COLUMN_ROW},
+        {"DML_DEPTH_SPACE_ORDER_COLUMN_ROW_DEPTH", DML_DEPTH_SPACE_ORDER_COLUMN_ROW_DEPTH},
+    }}
+};
+
 DML_DEPTH_SPACE_ORDER ParseDmlDepthSpaceOrder(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -488,8 +1076,7 @@ DML_DEPTH_SPACE_ORDER ParseDmlDepthSpaceOrder(const rapidjson::Value& value)
         throw std::invalid_argument("DML_DEPTH_SPACE_ORDER must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_DEPTH_SPACE_ORDER_DEPTH_COLUMN_ROW") || !strcmp(valueString, "DEPTH_COLUMN_ROW")) { return DML_DEPTH_SPACE_ORDER_DEPTH_COLUMN_ROW; }
-    if (!strcmp(valueString, "DML_DEPTH_SPACE_ORDER_COLUMN_ROW_DEPTH") || !strcmp(valueString, "COLUMN_ROW_DEPTH")) { return DML_DEPTH_SPACE_ORDER_COLUMN_ROW_DEPTH; }
+    if (auto result = c_dmlDepthSpaceOrderNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_DEPTH_SPACE_ORDER.", valueString));
 }
 
@@ -500,6 +1087,19 @@ DML_DEPTH_SPACE_ORDER ParseDmlDepthSpaceOrderField(const rapidjson::Value& objec
     });
 }
 
+constexpr NameTable<DML_AXIS_DIRECTION, 2, 4> c_dmlAxisDirectionNames =
+{
+    {
+        30, 0,
+    },
+    {{
+        {"INCREASING", DML_AXIS_DIRECTION_INCREASING},
+        {"DML_AXIS_DIRECTION_DECREASING", DML_AXIS_DIRECTION_DECREASING},
+        {"DECREASING", DML_AXIS_DIRECTION_DECREASING},
+        {"DML_AXIS_DIRECTION_INCREASING", DML_AXIS_DIRECTION_INCREASING},
+    }}
+};
+
 DML_AXIS_DIRECTION ParseDmlAxisDirection(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -507,8 +1107,7 @@ DML_AXIS_DIRECTION ParseDmlAxisDirection(const rapidjson::Value& value)
         throw std::invalid_argument("DML_AXIS_DIRECTION must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_AXIS_DIRECTION_INCREASING") || !strcmp(valueString, "INCREASING")) { return DML_AXIS_DIRECTION_INCREASING; }
-    if (!strcmp(valueString, "DML_AXIS_DIRECTION_DECREASING") || !strcmp(valueString, "DECREASING")) { return DML_AXIS_DIRECTION_DECREASING; }
+    if (auto result = c_dmlAxisDirectionNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_AXIS_DIRECTION.", valueString));
 }
 
@@ -519,6 +1118,23 @@ DML_AXIS_DIRECTION ParseDmlAxisDirectionField(const rapidjson::Value& object, st
     });
 }
 
+constexpr NameTable<DML_ROUNDING_MODE, 3, 8> c_dmlRoundingModeNames =
+{
+    {
+        0, 0, 7,
+    },
+    {{
+        {"HALVES_TO_NEAREST_EVEN", DML_ROUNDING_MODE_HALVES_TO_NEAREST_EVEN},
+        {},
+        {"DML_ROUNDING_MODE_HALVES_TO_NEAREST_EVEN", DML_ROUNDING_MODE_HALVES_TO_NEAREST_EVEN},
+        {"TOWARD_INFINITY", DML_ROUNDING_MODE_TOWARD_INFINITY},
+        {"DML_ROUNDING_MODE_TOWARD_INFINITY", DML_ROUNDING_MODE_TOWARD_INFINITY},
+        {"DML_ROUNDING_MODE_TOWARD_ZERO", DML_ROUNDING_MODE_TOWARD_ZERO},
+        {"TOWARD_ZERO", DML_ROUNDING_MODE_TOWARD_ZERO},
+        {},
+    }}
+};
+
 DML_ROUNDING_MODE ParseDmlRoundingMode(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -526,9 +1142,7 @@ DML_ROUNDING_MODE ParseDmlRoundingMode(const rapidjson::Value& value)
         throw std::invalid_argument("DML_ROUNDING_MODE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_ROUNDING_MODE_HALVES_TO_NEAREST_EVEN") || !strcmp(valueString, "HALVES_TO_NEAREST_EVEN")) { return DML_ROUNDING_MODE_HALVES_TO_NEAREST_EVEN; }
-    if (!strcmp(valueString, "DML_ROUNDING_MODE_TOWARD_ZERO") || !strcmp(valueString, "TOWARD_ZERO")) { return DML_ROUNDING_MODE_TOWARD_ZERO; }
-    if (!strcmp(valueString, "DML_ROUNDING_MODE_TOWARD_INFINITY") || !strcmp(valueString, "TOWARD_INFINITY")) { return DML_ROUNDING_MODE_TOWARD_INFINITY; }
+    if (auto result = c_dmlRoundingModeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_ROUNDING_MODE.", valueString));
 }
 
@@ -539,6 +1153,17 @@ DML_ROUNDING_MODE ParseDmlRoundingModeField(const rapidjson::Value& object, std:
     });
 }
 
+constexpr NameTable<DML_RANDOM_GENERATOR_TYPE, 1, 2> c_dmlRandomGeneratorTypeNames =
+{
+    {
+        5,
+    },
+    {{
+        {"DML_RANDOM_GENERATOR_TYPE_PHILOX_4X32_10", DML_RANDOM_GENERATOR_TYPE_PHILOX_4X32_10},
+        {"PHILOX_4X32_10", DML_RANDOM_GENERATOR_TYPE_PHILOX_4X32_10},
+    }}
+};
+
 DML_RANDOM_GENERATOR_TYPE ParseDmlRandomGeneratorType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -546,7 +1171,7 @@ DML_RANDOM_GENERATOR_TYPE ParseDmlRandomGeneratorType(const rapidjson::Value& va
         throw std::invalid_argument("DML_RANDOM_GENERATOR_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_RANDOM_GENERATOR_TYPE_PHILOX_4X32_10") || !strcmp(valueString, "PHILOX_4X32_10")) { return DML_RANDOM_GENERATOR_TYPE_PHILOX_4X32_10; }
+    if (auto result = c_dmlRandomGeneratorTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_RANDOM_GENERATOR_TYPE.", valueString));
 }
 
@@ -557,6 +1182,31 @@ DML_RANDOM_GENERATOR_TYPE ParseDmlRandomGeneratorTypeField(const rapidjson::Valu
     });
 }
 
+constexpr NameTable<DML_MULTIHEAD_ATTENTION_MASK_TYPE, 5, 16> c_dmlMultiheadAttentionMaskTypeNames =
+{
+    {
+        0, 0, 0, 0, 1,
+    },
+    {{
+        {},
+        {"KEY_SEQUENCE_LENGTH", DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_LENGTH},
+        {"DML_MULTIHEAD_ATTENTION_MASK_TYPE_BOOLEAN", DML_MULTIHEAD_ATTENTION_MASK_TYPE_BOOLEAN},
+        {"DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_QUERY_SEQUENCE_LENGTH_START_END", DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_QUERY_SEQUENCE_LENGTH_START_END},
+        {"DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_LENGTH", DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_LENGTH},
+        {},
+        {"DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_END_START", DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_END_START},
+        {},
+        {},
+        {"NONE", DML_MULTIHEAD_ATTENTION_MASK_TYPE_NONE},
+        {"KEY_SEQUENCE_END_START", DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_END_START},
+        {"KEY_QUERY_SEQUENCE_LENGTH_START_END", DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_QUERY_SEQUENCE_LENGTH_START_END},
+        {"DML_MULTIHEAD_ATTENTION_MASK_TYPE_NONE", DML_MULTIHEAD_ATTENTION_MASK_TYPE_NONE},
+        {"BOOLEAN", DML_MULTIHEAD_ATTENTION_MASK_TYPE_BOOLEAN},
+        {},
+        {},
+    }}
+};
+
 DML_MULTIHEAD_ATTENTION_MASK_TYPE ParseDmlMultiheadAttentionMaskType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -564,11 +1214,7 @@ DML_MULTIHEAD_ATTENTION_MASK_TYPE ParseDmlMultiheadAttentionMaskType(const rapid
         throw std::invalid_argument("DML_MULTIHEAD_ATTENTION_MASK_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_MULTIHEAD_ATTENTION_MASK_TYPE_NONE") || !strcmp(valueString, "NONE")) { return DML_MULTIHEAD_ATTENTION_MASK_TYPE_NONE; }
-    if (!strcmp(valueString, "DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_LENGTH") || !strcmp(valueString, "KEY_SEQUENCE_LENGTH")) { return DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_LENGTH; }
-    if (!strcmp(valueString, "DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_END_START") || !strcmp(valueString, "KEY_SEQUENCE_END_START")) { return DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_SEQUENCE_END_START; }
-    if (!strcmp(valueString, "DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_QUERY_SEQUENCE_LENGTH_START_END") || !strcmp(valueString, "KEY_QUERY_SEQUENCE_LENGTH_START_END")) { return DML_MULTIHEAD_ATTENTION_MASK_TYPE_KEY_QUERY_SEQUENCE_LENGTH_START_END; }
-    if (!strcmp(valueString, "DML_MULTIHEAD_ATTENTION_MASK_TYPE_BOOLEAN") || !strcmp(valueString, "BOOLEAN")) { return DML_MULTIHEAD_ATTENTION_MASK_TYPE_BOOLEAN; }
+    if (auto result = c_dmlMultiheadAttentionMaskTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_MULTIHEAD_ATTENTION_MASK_TYPE.", valueString));
 }
 
@@ -579,6 +1225,23 @@ DML_MULTIHEAD_ATTENTION_MASK_TYPE ParseDmlMultiheadAttentionMaskTypeField(const
     });
 }
 
+constexpr NameTable<DML_QUANTIZATION_TYPE, 3, 8> c_dmlQuantizationTypeNames =
+{
+    {
+        10, 0, 1,
+    },
+    {{
+        {},
+        {"SCALE_ZERO_POINT", DML_QUANTIZATION_TYPE_SCALE_ZERO_POINT},
+        {"DML_QUANTIZATION_TYPE_NONE", DML_QUANTIZATION_TYPE_NONE},
+        {},
+        {"DML_QUANTIZATION_TYPE_SCALE", DML_QUANTIZATION_TYPE_SCALE},
+        {"SCALE", DML_QUANTIZATION_TYPE_SCALE},
+        {"NONE", DML_QUANTIZATION_TYPE_NONE},
+        {"DML_QUANTIZATION_TYPE_SCALE_ZERO_POINT", DML_QUANTIZATION_TYPE_SCALE_ZERO_POINT},
+    }}
+};
+
 DML_QUANTIZATION_TYPE ParseDmlQuantizationType(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -586,9 +1249,7 @@ DML_QUANTIZATION_TYPE ParseDmlQuantizationType(const rapidjson::Value& value)
         throw std::invalid_argument("DML_QUANTIZATION_TYPE must be a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_QUANTIZATION_TYPE_NONE") || !strcmp(valueString, "NONE")) { return DML_QUANTIZATION_TYPE_NONE; }
-    if (!strcmp(valueString, "DML_QUANTIZATION_TYPE_SCALE") || !strcmp(valueString, "SCALE")) { return DML_QUANTIZATION_TYPE_SCALE; }
-    if (!strcmp(valueString, "DML_QUANTIZATION_TYPE_SCALE_ZERO_POINT") || !strcmp(valueString, "SCALE_ZERO_POINT")) { return DML_QUANTIZATION_TYPE_SCALE_ZERO_POINT; }
+    if (auto result = c_dmlQuantizationTypeNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_QUANTIZATION_TYPE.", valueString));
 }
 
@@ -603,6 +1264,19 @@ DML_QUANTIZATION_TYPE ParseDmlQuantizationTypeField(const rapidjson::Value& obje
 // DIRECTML FLAGS
 // ====================================================================================================
 
+constexpr NameTable<DML_TENSOR_FLAGS, 2, 4> c_dmlTensorFlagsNames =
+{
+    {
+        0, 2,
+    },
+    {{
+        {"OWNED_BY_DML", DML_TENSOR_FLAG_OWNED_BY_DML},
+        {"DML_TENSOR_FLAG_NONE", DML_TENSOR_FLAG_NONE},
+        {"NONE", DML_TENSOR_FLAG_NONE},
+        {"DML_TENSOR_FLAG_OWNED_BY_DML", DML_TENSOR_FLAG_OWNED_BY_DML},
+    }}
+};
+
 DML_TENSOR_FLAGS ParseSingleFlagFromDmlTensorFlags(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -610,8 +1284,7 @@ DML_TENSOR_FLAGS ParseSingleFlagFromDmlTensorFlags(const rapidjson::Value& value
         throw std::invalid_argument("Expected a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_TENSOR_FLAG_NONE") || !strcmp(valueString, "NONE")) { return DML_TENSOR_FLAG_NONE; }
-    if (!strcmp(valueString, "DML_TENSOR_FLAG_OWNED_BY_DML") || !strcmp(valueString, "OWNED_BY_DML")) { return DML_TENSOR_FLAG_OWNED_BY_DML; }
+    if (auto result = c_dmlTensorFlagsNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_TENSOR_FLAGS.", valueString));
 }
 
@@ -627,6 +1300,23 @@ DML_TENSOR_FLAGS ParseDmlTensorFlagsField(const rapidjson::Value& object, std::s
     });
 }
 
+constexpr NameTable<DML_EXECUTION_FLAGS, 4, 8> c_dmlExecutionFlagsNames =
+{
+    {
+        0, 0, 0, 62,
+    },
+    {{
+        {"DML_EXECUTION_FLAG_DISABLE_META_COMMANDS", DML_EXECUTION_FLAG_DISABLE_META_COMMANDS},
+        {"DISABLE_META_COMMANDS", DML_EXECUTION_FLAG_DISABLE_META_COMMANDS},
+        {"DML_EXECUTION_FLAG_ALLOW_HALF_PRECISION_COMPUTATION", DML_EXECUTION_FLAG_ALLOW_HALF_PRECISION_COMPUTATION},
+        {"DML_EXECUTION_FLAG_NONE", DML_EXECUTION_FLAG_NONE},
+        {"ALLOW_HALF_PRECISION_COMPUTATION", DML_EXECUTION_FLAG_ALLOW_HALF_PRECISION_COMPUTATION},
+        {"NONE", DML_EXECUTION_FLAG_NONE},
+        {"DML_EXECUTION_FLAG_DESCRIPTORS_VOLATILE", DML_EXECUTION_FLAG_DESCRIPTORS_VOLATILE},
+        {"DESCRIPTORS_VOLATILE", DML_EXECUTION_FLAG_DESCRIPTORS_VOLATILE},
+    }}
+};
+
 DML_EXECUTION_FLAGS ParseSingleFlagFromDmlExecutionFlags(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -634,10 +1324,7 @@ DML_EXECUTION_FLAGS ParseSingleFlagFromDmlExecutionFlags(const rapidjson::Value&
         throw std::invalid_argument("Expected a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_EXECUTION_FLAG_NONE") || !strcmp(valueString, "NONE")) { return DML_EXECUTION_FLAG_NONE; }
-    if (!strcmp(valueString, "DML_EXECUTION_FLAG_ALLOW_HALF_PRECISION_COMPUTATION") || !strcmp(valueString, "ALLOW_HALF_PRECISION_COMPUTATION")) { return DML_EXECUTION_FLAG_ALLOW_HALF_PRECISION_COMPUTATION; }
-    if (!strcmp(valueString, "DML_EXECUTION_FLAG_DISABLE_META_COMMANDS") || !strcmp(valueString, "DISABLE_META_COMMANDS")) { return DML_EXECUTION_FLAG_DISABLE_META_COMMANDS; }
-    if (!strcmp(valueString, "DML_EXECUTION_FLAG_DESCRIPTORS_VOLATILE") || !strcmp(valueString, "DESCRIPTORS_VOLATILE")) { return DML_EXECUTION_FLAG_DESCRIPTORS_VOLATILE; }
+    if (auto result = c_dmlExecutionFlagsNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_EXECUTION_FLAGS.", valueString));
 }
 
@@ -653,6 +1340,19 @@ DML_EXECUTION_FLAGS ParseDmlExecutionFlagsField(const rapidjson::Value& object,
     });
 }
 
+constexpr NameTable<DML_CREATE_DEVICE_FLAGS, 2, 4> c_dmlCreateDeviceFlagsNames =
+{
+    {
+        0, 9,
+    },
+    {{
+        {"DEBUG", DML_CREATE_DEVICE_FLAG_DEBUG},
+        {"NONE", DML_CREATE_DEVICE_FLAG_NONE},
+        {"DML_CREATE_DEVICE_FLAG_NONE", DML_CREATE_DEVICE_FLAG_NONE},
+        {"DML_CREATE_DEVICE_FLAG_DEBUG", DML_CREATE_DEVICE_FLAG_DEBUG},
+    }}
+};
+
 DML_CREATE_DEVICE_FLAGS ParseSingleFlagFromDmlCreateDeviceFlags(const rapidjson::Value& value)
 {
     if (value.GetType() != rapidjson::Type::kStringType)
@@ -660,8 +1360,7 @@ DML_CREATE_DEVICE_FLAGS ParseSingleFlagFromDmlCreateDeviceFlags(const rapidjson:
         throw std::invalid_argument("Expected a string.");
     }
     auto valueString = value.GetString();
-    if (!strcmp(valueString, "DML_CREATE_DEVICE_FLAG_NONE") || !strcmp(valueString, "NONE")) { return DML_CREATE_DEVICE_FLAG_NONE; }
-    if (!strcmp(valueString, "DML_CREATE_DEVICE_FLAG_DEBUG") || !strcmp(valueString, "DEBUG")) { return DML_CREATE_DEVICE_FLAG_DEBUG; }
+    if (auto result = c_dmlCreateDeviceFlagsNames.Find({valueString, value.GetStringLength()})) { return *result; }
     throw std::invalid_argument(fmt::format("'{}' is not a recognized value for DML_CREATE_DEVICE_FLAGS.", valueString));
 }
 
@@ -681,19 +1380,6 @@ DML_CREATE_DEVICE_FLAGS ParseDmlCreateDeviceFlagsField(const rapidjson::Value& o
 // DIRECTML OPERATORS
 // ====================================================================================================
 
-DML_OPERATOR_DESC* ParseDmlElementWiseIdentityOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_IDENTITY_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_IDENTITY;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IDENTITY_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -702,19 +1388,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IDEN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAbsOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ABS_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ABS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ABS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -723,19 +1396,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ABS_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAcosOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ACOS_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ACOS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ACOS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -744,19 +1404,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ACOS
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAddOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ADD_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ADD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ADD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -766,19 +1413,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ADD_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAsinOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ASIN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ASIN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ASIN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -787,19 +1421,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ASIN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAtanOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ATAN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ATAN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ATAN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -808,19 +1429,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ATAN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseCeilOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_CEIL_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_CEIL;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CEIL_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -829,21 +1437,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CEIL
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseClipOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_CLIP_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    desc->Min = ParseFloat32Field(value, "Min", true);
-    desc->Max = ParseFloat32Field(value, "Max", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_CLIP;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -852,21 +1445,16 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseClip1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlElementWiseClip1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_CLIP1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    desc->MinMaxDataType = ParseDmlTensorDataTypeField(value, "MinMaxDataType", true, {});
-    desc->Min = *ParseDmlScalarUnionField(value, "Min", "MinMaxDataType", allocator, true);
-    desc->Max = *ParseDmlScalarUnionField(value, "Max", "MinMaxDataType", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_CLIP1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // ScaleBias
+    ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>, // MinMaxDataType
+    nullptr, // Min
+    nullptr, // Max
+};
+static_assert(std::size(c_dmlElementWiseClip1FieldParsers) == DML_ELEMENT_WISE_CLIP1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP1_OPERATOR_DESC& desc)
 {
@@ -876,21 +1464,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseClipGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_CLIP_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->Min = ParseFloat32Field(value, "Min", true);
-    desc->Max = ParseFloat32Field(value, "Max", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP_GRAD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -900,21 +1473,16 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseClipGrad1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlElementWiseClipGrad1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_CLIP_GRAD1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->MinMaxDataType = ParseDmlTensorDataTypeField(value, "MinMaxDataType", true, {});
-    desc->Min = *ParseDmlScalarUnionField(value, "Min", "MinMaxDataType", allocator, true);
-    desc->Max = *ParseDmlScalarUnionField(value, "Max", "MinMaxDataType", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // InputGradientTensor
+    nullptr, // OutputGradientTensor
+    ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>, // MinMaxDataType
+    nullptr, // Min
+    nullptr, // Max
+};
+static_assert(std::size(c_dmlElementWiseClipGrad1FieldParsers) == DML_ELEMENT_WISE_CLIP_GRAD1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP_GRAD1_OPERATOR_DESC& desc)
 {
@@ -925,19 +1493,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CLIP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseCosOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_COS_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_COS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_COS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -946,19 +1501,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_COS_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseDivideOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_DIVIDE_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_DIVIDE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_DIVIDE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -968,19 +1510,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_DIVI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseExpOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_EXP_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_EXP;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_EXP_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -989,19 +1518,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_EXP_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseFloorOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_FLOOR_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_FLOOR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_FLOOR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1010,19 +1526,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_FLOO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOG_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOG;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOG_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1031,19 +1534,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOG_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalAndOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_AND_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_AND_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1053,19 +1543,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalEqualsOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_EQUALS_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_EQUALS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1075,19 +1552,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalGreaterThanOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_GREATER_THAN_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_GREATER_THAN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1097,19 +1561,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalLessThanOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_LESS_THAN_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_LESS_THAN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1119,19 +1570,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalGreaterThanOrEqualOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1141,19 +1579,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalLessThanOrEqualOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1163,18 +1588,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalNotOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_NOT_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_NOT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1183,19 +1596,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalOrOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_OR_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_OR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1205,19 +1605,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseLogicalXorOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_LOGICAL_XOR_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGICAL_XOR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1227,19 +1614,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_LOGI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseMaxOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_MAX_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_MAX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MAX_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1249,19 +1623,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MAX_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseMeanOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_MEAN_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_MEAN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MEAN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1271,19 +1632,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MEAN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseMinOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_MIN_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_MIN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MIN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1293,19 +1641,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MIN_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseMultiplyOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_MULTIPLY_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_MULTIPLY;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MULTIPLY_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1315,20 +1650,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MULT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWisePowOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_POW_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ExponentTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ExponentTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_POW;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_POW_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1338,20 +1659,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_POW_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseConstantPowOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_CONSTANT_POW_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    desc->Exponent = ParseFloat32Field(value, "Exponent", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CONSTANT_POW_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1360,19 +1667,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_CONS
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseRecipOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_RECIP_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_RECIP;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_RECIP_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1381,19 +1675,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_RECI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseSinOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_SIN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_SIN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SIN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1402,19 +1683,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SIN_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseSqrtOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_SQRT_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_SQRT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SQRT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1423,19 +1691,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SQRT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseDifferenceSquareOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_DIFFERENCE_SQUARE_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_DIFFERENCE_SQUARE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1445,19 +1700,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_DIFF
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAtanYxOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ATAN_YX_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ATAN_YX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ATAN_YX_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1467,19 +1709,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ATAN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseSubtractOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_SUBTRACT_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_SUBTRACT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SUBTRACT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1489,19 +1718,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SUBT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseTanOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_TAN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_TAN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_TAN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1510,20 +1726,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_TAN_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseThresholdOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_THRESHOLD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    desc->Min = ParseFloat32Field(value, "Min", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_THRESHOLD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_THRESHOLD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1532,20 +1734,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_THRE
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseQuantizeLinearOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_QUANTIZE_LINEAR_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, true);
-    desc->ZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_QUANTIZE_LINEAR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1556,20 +1744,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_QUAN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseDequantizeLinearOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_DEQUANTIZE_LINEAR_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, true);
-    desc->ZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_DEQUANTIZE_LINEAR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1580,29 +1754,24 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_DEQU
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlConvolutionOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlConvolutionFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_CONVOLUTION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->FilterTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FilterTensor", allocator, true);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Mode = ParseDmlConvolutionModeField(value, "Mode", true, {});
-    desc->Direction = ParseDmlConvolutionDirectionField(value, "Direction", true, {});
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->OutputPadding = AsPointer(ParseUInt32ArrayField(value, "OutputPadding", allocator, true));
-    desc->GroupCount = ParseUInt32Field(value, "GroupCount", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_CONVOLUTION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // FilterTensor
+    nullptr, // BiasTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_CONVOLUTION_MODE, ParseDmlConvolutionMode>, // Mode
+    ParseAsUInt32<DML_CONVOLUTION_DIRECTION, ParseDmlConvolutionDirection>, // Direction
+    nullptr, // DimensionCount
+    nullptr, // Strides
+    nullptr, // Dilations
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+    nullptr, // OutputPadding
+    nullptr, // GroupCount
+    nullptr, // FusedActivation
+};
+static_assert(std::size(c_dmlConvolutionFieldParsers) == DML_CONVOLUTION_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CONVOLUTION_OPERATOR_DESC& desc)
 {
@@ -1614,24 +1783,19 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CONVOLUTION_OPERA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlGemmOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlGemmFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_GEMM_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->CTensor = fused ? nullptr : ParseDmlTensorDescField(value, "CTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->TransA = ParseDmlMatrixTransformField(value, "TransA", true, {});
-    desc->TransB = ParseDmlMatrixTransformField(value, "TransB", true, {});
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_GEMM;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // ATensor
+    nullptr, // BTensor
+    nullptr, // CTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_MATRIX_TRANSFORM, ParseDmlMatrixTransform>, // TransA
+    ParseAsUInt32<DML_MATRIX_TRANSFORM, ParseDmlMatrixTransform>, // TransB
+    nullptr, // Alpha
+    nullptr, // Beta
+    nullptr, // FusedActivation
+};
+static_assert(std::size(c_dmlGemmFieldParsers) == DML_GEMM_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GEMM_OPERATOR_DESC& desc)
 {
@@ -1643,20 +1807,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GEMM_OPERATOR_DES
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlReduceOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlReduceFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_REDUCE_OPERATOR_DESC>();
-    desc->Function = ParseDmlReduceFunctionField(value, "Function", true, {});
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_REDUCE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    ParseAsUInt32<DML_REDUCE_FUNCTION, ParseDmlReduceFunction>, // Function
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // AxisCount
+    nullptr, // Axes
+};
+static_assert(std::size(c_dmlReduceFieldParsers) == DML_REDUCE_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_REDUCE_OPERATOR_DESC& desc)
 {
@@ -1666,20 +1825,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_REDUCE_OPERATOR_D
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlArgminOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlArgminFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ARGMIN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    desc->AxisDirection = ParseDmlAxisDirectionField(value, "AxisDirection", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ARGMIN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // AxisCount
+    nullptr, // Axes
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // AxisDirection
+};
+static_assert(std::size(c_dmlArgminFieldParsers) == DML_ARGMIN_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ARGMIN_OPERATOR_DESC& desc)
 {
@@ -1689,20 +1843,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ARGMIN_OPERATOR_D
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlArgmaxOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlArgmaxFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ARGMAX_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    desc->AxisDirection = ParseDmlAxisDirectionField(value, "AxisDirection", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ARGMAX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // AxisCount
+    nullptr, // Axes
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // AxisDirection
+};
+static_assert(std::size(c_dmlArgmaxFieldParsers) == DML_ARGMAX_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ARGMAX_OPERATOR_DESC& desc)
 {
@@ -1712,23 +1861,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ARGMAX_OPERATOR_D
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlAveragePoolingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlAveragePoolingFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_AVERAGE_POOLING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->IncludePadding = ParseBoolField(value, "IncludePadding", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_AVERAGE_POOLING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // DimensionCount
+    nullptr, // Strides
+    nullptr, // WindowSize
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+    ParseAsUInt32<bool, ParseBool>, // IncludePadding
+};
+static_assert(std::size(c_dmlAveragePoolingFieldParsers) == DML_AVERAGE_POOLING_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_AVERAGE_POOLING_OPERATOR_DESC& desc)
 {
@@ -1738,24 +1882,19 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_AVERAGE_POOLING_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlAveragePooling1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlAveragePooling1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_AVERAGE_POOLING1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    desc->IncludePadding = ParseBoolField(value, "IncludePadding", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_AVERAGE_POOLING1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // DimensionCount
+    nullptr, // Strides
+    nullptr, // WindowSize
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+    nullptr, // Dilations
+    ParseAsUInt32<bool, ParseBool>, // IncludePadding
+};
+static_assert(std::size(c_dmlAveragePooling1FieldParsers) == DML_AVERAGE_POOLING1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_AVERAGE_POOLING1_OPERATOR_DESC& desc)
 {
@@ -1765,24 +1904,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_AVERAGE_POOLING1_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlLpPoolingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_LP_POOLING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->P = ParseUInt32Field(value, "P", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_LP_POOLING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LP_POOLING_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1791,25 +1912,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LP_POOLING_OPERAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlLpPooling1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_LP_POOLING1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    desc->P = ParseUInt32Field(value, "P", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_LP_POOLING1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LP_POOLING1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1818,23 +1920,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LP_POOLING1_OPERA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMaxPoolingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MAX_POOLING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MAX_POOLING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1843,24 +1928,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING_OPERA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMaxPooling1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MAX_POOLING1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputIndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputIndicesTensor", allocator, false);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MAX_POOLING1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1870,21 +1937,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING1_OPER
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlRoiPoolingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ROI_POOLING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ROITensor = fused ? nullptr : ParseDmlTensorDescField(value, "ROITensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->SpatialScale = ParseFloat32Field(value, "SpatialScale", true);
-    desc->PooledSize = *ParseDmlSize2dField(value, "PooledSize", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ROI_POOLING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_POOLING_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1894,22 +1946,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_POOLING_OPERA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlSliceOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SLICE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Offsets = AsPointer(ParseUInt32ArrayField(value, "Offsets", allocator, true));
-    desc->Sizes = AsPointer(ParseUInt32ArrayField(value, "Sizes", allocator, true));
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SLICE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SLICE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1918,18 +1954,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SLICE_OPERATOR_DE
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlCastOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_CAST_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_CAST;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CAST_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1938,20 +1962,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CAST_OPERATOR_DES
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlSplitOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SPLIT_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputCount = ParseUInt32Field(value, "OutputCount", true);
-    desc->OutputTensors = fused ? nullptr : AsPointer(ParseDmlTensorDescArrayField(value, "OutputTensors", allocator, true));
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SPLIT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SPLIT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1960,20 +1970,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SPLIT_OPERATOR_DE
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlJoinOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_JOIN_OPERATOR_DESC>();
-    desc->InputCount = ParseUInt32Field(value, "InputCount", true);
-    desc->InputTensors = fused ? nullptr : AsPointer(ParseDmlTensorDescArrayField(value, "InputTensors", allocator, true));
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_JOIN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_JOIN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -1982,22 +1978,17 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_JOIN_OPERATOR_DES
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlPaddingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlPaddingFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_PADDING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->PaddingMode = ParseDmlPaddingModeField(value, "PaddingMode", true, {});
-    desc->PaddingValue = ParseFloat32Field(value, "PaddingValue", true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_PADDING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_PADDING_MODE, ParseDmlPaddingMode>, // PaddingMode
+    nullptr, // PaddingValue
+    nullptr, // DimensionCount
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+};
+static_assert(std::size(c_dmlPaddingFieldParsers) == DML_PADDING_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_PADDING_OPERATOR_DESC& desc)
 {
@@ -2007,23 +1998,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_PADDING_OPERATOR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlPadding1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlPadding1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_PADDING1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->PaddingMode = ParseDmlPaddingModeField(value, "PaddingMode", true, {});
-    desc->PaddingValueDataType = ParseDmlTensorDataTypeField(value, "PaddingValueDataType", true, {});
-    desc->PaddingValue = *ParseDmlScalarUnionField(value, "PaddingValue", "PaddingValueDataType", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_PADDING1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_PADDING_MODE, ParseDmlPaddingMode>, // PaddingMode
+    ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>, // PaddingValueDataType
+    nullptr, // PaddingValue
+    nullptr, // DimensionCount
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+};
+static_assert(std::size(c_dmlPadding1FieldParsers) == DML_PADDING1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_PADDING1_OPERATOR_DESC& desc)
 {
@@ -2033,21 +2019,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_PADDING1_OPERATOR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlValueScale2dOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_VALUE_SCALE_2D_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Scale = ParseFloat32Field(value, "Scale", true);
-    desc->ChannelCount = ParseUInt32Field(value, "ChannelCount", true);
-    desc->Bias = AsPointer(ParseFloat32ArrayField(value, "Bias", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_VALUE_SCALE_2D;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_VALUE_SCALE_2D_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2056,19 +2027,14 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_VALUE_SCALE_2D_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlUpsample2dOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlUpsample2dFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_UPSAMPLE_2D_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleSize = *ParseDmlSize2dField(value, "ScaleSize", allocator, true);
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_UPSAMPLE_2D;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // ScaleSize
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+};
+static_assert(std::size(c_dmlUpsample2dFieldParsers) == DML_UPSAMPLE_2D_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_UPSAMPLE_2D_OPERATOR_DESC& desc)
 {
@@ -2078,21 +2044,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_UPSAMPLE_2D_OPERA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlGatherOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_GATHER_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    desc->IndexDimensions = ParseUInt32Field(value, "IndexDimensions", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_GATHER;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2102,19 +2053,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_OPERATOR_D
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlSpaceToDepthOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SPACE_TO_DEPTH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->BlockSize = ParseUInt32Field(value, "BlockSize", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SPACE_TO_DEPTH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SPACE_TO_DEPTH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2123,19 +2061,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SPACE_TO_DEPTH_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlDepthToSpaceOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_DEPTH_TO_SPACE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->BlockSize = ParseUInt32Field(value, "BlockSize", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_DEPTH_TO_SPACE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DEPTH_TO_SPACE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2144,20 +2069,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DEPTH_TO_SPACE_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlTileOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_TILE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->RepeatsCount = ParseUInt32Field(value, "RepeatsCount", true);
-    desc->Repeats = AsPointer(ParseUInt32ArrayField(value, "Repeats", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_TILE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_TILE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2166,21 +2077,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_TILE_OPERATOR_DES
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlTopKOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_TOP_K_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputValueTensor", allocator, true);
-    desc->OutputIndexTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputIndexTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    desc->K = ParseUInt32Field(value, "K", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_TOP_K;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_TOP_K_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2190,24 +2086,19 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_TOP_K_OPERATOR_DE
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlBatchNormalizationOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlBatchNormalizationFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_BATCH_NORMALIZATION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->MeanTensor = fused ? nullptr : ParseDmlTensorDescField(value, "MeanTensor", allocator, true);
-    desc->VarianceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "VarianceTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, true);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Spatial = ParseBoolField(value, "Spatial", true) ? 1 : 0;
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_BATCH_NORMALIZATION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // MeanTensor
+    nullptr, // VarianceTensor
+    nullptr, // ScaleTensor
+    nullptr, // BiasTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<bool, ParseBool>, // Spatial
+    nullptr, // Epsilon
+    nullptr, // FusedActivation
+};
+static_assert(std::size(c_dmlBatchNormalizationFieldParsers) == DML_BATCH_NORMALIZATION_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATION_OPERATOR_DESC& desc)
 {
@@ -2221,25 +2112,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlBatchNormalizationGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_BATCH_NORMALIZATION_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->MeanTensor = fused ? nullptr : ParseDmlTensorDescField(value, "MeanTensor", allocator, true);
-    desc->VarianceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "VarianceTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->OutputScaleGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleGradientTensor", allocator, true);
-    desc->OutputBiasGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputBiasGradientTensor", allocator, true);
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_BATCH_NORMALIZATION_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATION_GRAD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2254,25 +2126,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlBatchNormalizationTrainingGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_BATCH_NORMALIZATION_TRAINING_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->MeanTensor = fused ? nullptr : ParseDmlTensorDescField(value, "MeanTensor", allocator, true);
-    desc->VarianceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "VarianceTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->OutputScaleGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleGradientTensor", allocator, true);
-    desc->OutputBiasGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputBiasGradientTensor", allocator, true);
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATION_TRAINING_GRAD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2287,23 +2140,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMeanVarianceNormalizationOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlMeanVarianceNormalizationFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MEAN_VARIANCE_NORMALIZATION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->CrossChannel = ParseBoolField(value, "CrossChannel", true) ? 1 : 0;
-    desc->NormalizeVariance = ParseBoolField(value, "NormalizeVariance", true) ? 1 : 0;
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // ScaleTensor
+    nullptr, // BiasTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<bool, ParseBool>, // CrossChannel
+    ParseAsUInt32<bool, ParseBool>, // NormalizeVariance
+    nullptr, // Epsilon
+    nullptr, // FusedActivation
+};
+static_assert(std::size(c_dmlMeanVarianceNormalizationFieldParsers) == DML_MEAN_VARIANCE_NORMALIZATION_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MEAN_VARIANCE_NORMALIZATION_OPERATOR_DESC& desc)
 {
@@ -2315,22 +2163,17 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MEAN_VARIANCE_NOR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlLocalResponseNormalizationOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlLocalResponseNormalizationFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_LOCAL_RESPONSE_NORMALIZATION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->CrossChannel = ParseBoolField(value, "CrossChannel", true) ? 1 : 0;
-    desc->LocalSize = ParseUInt32Field(value, "LocalSize", true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    desc->Bias = ParseFloat32Field(value, "Bias", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<bool, ParseBool>, // CrossChannel
+    nullptr, // LocalSize
+    nullptr, // Alpha
+    nullptr, // Beta
+    nullptr, // Bias
+};
+static_assert(std::size(c_dmlLocalResponseNormalizationFieldParsers) == DML_LOCAL_RESPONSE_NORMALIZATION_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LOCAL_RESPONSE_NORMALIZATION_OPERATOR_DESC& desc)
 {
@@ -2340,23 +2183,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LOCAL_RESPONSE_NO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlLocalResponseNormalizationGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlLocalResponseNormalizationGradFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_LOCAL_RESPONSE_NORMALIZATION_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->CrossChannel = ParseBoolField(value, "CrossChannel", true) ? 1 : 0;
-    desc->LocalSize = ParseUInt32Field(value, "LocalSize", true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    desc->Bias = ParseFloat32Field(value, "Bias", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // InputGradientTensor
+    nullptr, // OutputGradientTensor
+    ParseAsUInt32<bool, ParseBool>, // CrossChannel
+    nullptr, // LocalSize
+    nullptr, // Alpha
+    nullptr, // Beta
+    nullptr, // Bias
+};
+static_assert(std::size(c_dmlLocalResponseNormalizationGradFieldParsers) == DML_LOCAL_RESPONSE_NORMALIZATION_GRAD_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LOCAL_RESPONSE_NORMALIZATION_GRAD_OPERATOR_DESC& desc)
 {
@@ -2367,21 +2205,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LOCAL_RESPONSE_NO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlLpNormalizationOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_LP_NORMALIZATION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    desc->P = ParseUInt32Field(value, "P", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_LP_NORMALIZATION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LP_NORMALIZATION_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2390,26 +2213,21 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LP_NORMALIZATION_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlRnnOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlRnnFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RNN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->WeightTensor = fused ? nullptr : ParseDmlTensorDescField(value, "WeightTensor", allocator, true);
-    desc->RecurrenceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "RecurrenceTensor", allocator, true);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->HiddenInitTensor = fused ? nullptr : ParseDmlTensorDescField(value, "HiddenInitTensor", allocator, false);
-    desc->SequenceLengthsTensor = fused ? nullptr : ParseDmlTensorDescField(value, "SequenceLengthsTensor", allocator, false);
-    desc->OutputSequenceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSequenceTensor", allocator, false);
-    desc->OutputSingleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSingleTensor", allocator, false);
-    desc->ActivationDescCount = ParseUInt32Field(value, "ActivationDescCount", true);
-    desc->ActivationDescs = AsPointer(ParseDmlOperatorDescArrayField(value, "ActivationDescs", true, allocator, true));
-    desc->Direction = ParseDmlRecurrentNetworkDirectionField(value, "Direction", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RNN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // WeightTensor
+    nullptr, // RecurrenceTensor
+    nullptr, // BiasTensor
+    nullptr, // HiddenInitTensor
+    nullptr, // SequenceLengthsTensor
+    nullptr, // OutputSequenceTensor
+    nullptr, // OutputSingleTensor
+    nullptr, // ActivationDescCount
+    nullptr, // ActivationDescs
+    ParseAsUInt32<DML_RECURRENT_NETWORK_DIRECTION, ParseDmlRecurrentNetworkDirection>, // Direction
+};
+static_assert(std::size(c_dmlRnnFieldParsers) == DML_RNN_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RNN_OPERATOR_DESC& desc)
 {
@@ -2425,32 +2243,27 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RNN_OPERATOR_DESC
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlLstmOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_LSTM_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->WeightTensor = fused ? nullptr : ParseDmlTensorDescField(value, "WeightTensor", allocator, true);
-    desc->RecurrenceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "RecurrenceTensor", allocator, true);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->HiddenInitTensor = fused ? nullptr : ParseDmlTensorDescField(value, "HiddenInitTensor", allocator, false);
-    desc->CellMemInitTensor = fused ? nullptr : ParseDmlTensorDescField(value, "CellMemInitTensor", allocator, false);
-    desc->SequenceLengthsTensor = fused ? nullptr : ParseDmlTensorDescField(value, "SequenceLengthsTensor", allocator, false);
-    desc->PeepholeTensor = fused ? nullptr : ParseDmlTensorDescField(value, "PeepholeTensor", allocator, false);
-    desc->OutputSequenceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSequenceTensor", allocator, false);
-    desc->OutputSingleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSingleTensor", allocator, false);
-    desc->OutputCellSingleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputCellSingleTensor", allocator, false);
-    desc->ActivationDescCount = ParseUInt32Field(value, "ActivationDescCount", true);
-    desc->ActivationDescs = AsPointer(ParseDmlOperatorDescArrayField(value, "ActivationDescs", true, allocator, true));
-    desc->Direction = ParseDmlRecurrentNetworkDirectionField(value, "Direction", true, {});
-    desc->ClipThreshold = ParseFloat32Field(value, "ClipThreshold", true);
-    desc->UseClipThreshold = ParseBoolField(value, "UseClipThreshold", true) ? 1 : 0;
-    desc->CoupleInputForget = ParseBoolField(value, "CoupleInputForget", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_LSTM;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+constexpr DmlUInt32FieldParser c_dmlLstmFieldParsers[] =
+{
+    nullptr, // InputTensor
+    nullptr, // WeightTensor
+    nullptr, // RecurrenceTensor
+    nullptr, // BiasTensor
+    nullptr, // HiddenInitTensor
+    nullptr, // CellMemInitTensor
+    nullptr, // SequenceLengthsTensor
+    nullptr, // PeepholeTensor
+    nullptr, // OutputSequenceTensor
+    nullptr, // OutputSingleTensor
+    nullptr, // OutputCellSingleTensor
+    nullptr, // ActivationDescCount
+    nullptr, // ActivationDescs
+    ParseAsUInt32<DML_RECURRENT_NETWORK_DIRECTION, ParseDmlRecurrentNetworkDirection>, // Direction
+    nullptr, // ClipThreshold
+    ParseAsUInt32<bool, ParseBool>, // UseClipThreshold
+    ParseAsUInt32<bool, ParseBool>, // CoupleInputForget
+};
+static_assert(std::size(c_dmlLstmFieldParsers) == DML_LSTM_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LSTM_OPERATOR_DESC& desc)
 {
@@ -2469,27 +2282,22 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_LSTM_OPERATOR_DES
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlGruOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlGruFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_GRU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->WeightTensor = fused ? nullptr : ParseDmlTensorDescField(value, "WeightTensor", allocator, true);
-    desc->RecurrenceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "RecurrenceTensor", allocator, true);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->HiddenInitTensor = fused ? nullptr : ParseDmlTensorDescField(value, "HiddenInitTensor", allocator, false);
-    desc->SequenceLengthsTensor = fused ? nullptr : ParseDmlTensorDescField(value, "SequenceLengthsTensor", allocator, false);
-    desc->OutputSequenceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSequenceTensor", allocator, false);
-    desc->OutputSingleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSingleTensor", allocator, false);
-    desc->ActivationDescCount = ParseUInt32Field(value, "ActivationDescCount", true);
-    desc->ActivationDescs = AsPointer(ParseDmlOperatorDescArrayField(value, "ActivationDescs", true, allocator, true));
-    desc->Direction = ParseDmlRecurrentNetworkDirectionField(value, "Direction", true, {});
-    desc->LinearBeforeReset = ParseBoolField(value, "LinearBeforeReset", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_GRU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // WeightTensor
+    nullptr, // RecurrenceTensor
+    nullptr, // BiasTensor
+    nullptr, // HiddenInitTensor
+    nullptr, // SequenceLengthsTensor
+    nullptr, // OutputSequenceTensor
+    nullptr, // OutputSingleTensor
+    nullptr, // ActivationDescCount
+    nullptr, // ActivationDescs
+    ParseAsUInt32<DML_RECURRENT_NETWORK_DIRECTION, ParseDmlRecurrentNetworkDirection>, // Direction
+    ParseAsUInt32<bool, ParseBool>, // LinearBeforeReset
+};
+static_assert(std::size(c_dmlGruFieldParsers) == DML_GRU_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GRU_OPERATOR_DESC& desc)
 {
@@ -2505,18 +2313,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GRU_OPERATOR_DESC
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseSignOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_SIGN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_SIGN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SIGN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2525,18 +2321,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SIGN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseIsNanOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_IS_NAN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_IS_NAN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IS_NAN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2545,18 +2329,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IS_N
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseNegateOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_NEGATE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_NEGATE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_NEGATE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2565,19 +2337,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_NEGA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseErfOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ERF_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ERF;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ERF_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2586,19 +2345,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ERF_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseSinhOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_SINH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_SINH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SINH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2607,19 +2353,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_SINH
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseCoshOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_COSH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_COSH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_COSH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2628,19 +2361,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_COSH
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseTanhOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_TANH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_TANH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_TANH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2649,19 +2369,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_TANH
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAsinhOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ASINH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ASINH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ASINH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2670,19 +2377,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ASIN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAcoshOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ACOSH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ACOSH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ACOSH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2691,19 +2385,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ACOS
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAtanhOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ATANH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ScaleBias = ParseDmlScaleBiasField(value, "ScaleBias", allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ATANH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ATANH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2712,20 +2393,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ATAN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseIfOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_IF_OPERATOR_DESC>();
-    desc->ConditionTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ConditionTensor", allocator, true);
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_IF;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IF_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2736,20 +2403,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IF_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseAdd1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ADD1_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ADD1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ADD1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2759,19 +2412,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ADD1
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMaxUnpoolingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MAX_UNPOOLING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MAX_UNPOOLING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_UNPOOLING_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2781,19 +2421,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_UNPOOLING_OPE
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlDiagonalMatrixOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_DIAGONAL_MATRIX_OPERATOR_DESC>();
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Offset = ParseInt32Field(value, "Offset", true);
-    desc->Value = ParseFloat32Field(value, "Value", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_DIAGONAL_MATRIX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DIAGONAL_MATRIX_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2801,21 +2428,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DIAGONAL_MATRIX_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlScatterOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SCATTER_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->UpdatesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "UpdatesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SCATTER;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SCATTER_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2826,20 +2438,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SCATTER_OPERATOR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlOneHotOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ONE_HOT_OPERATOR_DESC>();
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->ValuesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ValuesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ONE_HOT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ONE_HOT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2849,20 +2447,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ONE_HOT_OPERATOR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlResampleOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlResampleFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RESAMPLE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->ScaleCount = ParseUInt32Field(value, "ScaleCount", true);
-    desc->Scales = AsPointer(ParseFloat32ArrayField(value, "Scales", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RESAMPLE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    nullptr, // ScaleCount
+    nullptr, // Scales
+};
+static_assert(std::size(c_dmlResampleFieldParsers) == DML_RESAMPLE_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE_OPERATOR_DESC& desc)
 {
@@ -2872,19 +2465,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE_OPERATOR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitShiftLeftOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_SHIFT_LEFT_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_SHIFT_LEFT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2894,19 +2474,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitShiftRightOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_SHIFT_RIGHT_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_SHIFT_RIGHT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2916,18 +2483,13 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseRoundOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlElementWiseRoundFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_ROUND_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->RoundingMode = ParseDmlRoundingModeField(value, "RoundingMode", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_ROUND;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_ROUNDING_MODE, ParseDmlRoundingMode>, // RoundingMode
+};
+static_assert(std::size(c_dmlElementWiseRoundFieldParsers) == DML_ELEMENT_WISE_ROUND_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ROUND_OPERATOR_DESC& desc)
 {
@@ -2937,18 +2499,13 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_ROUN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseIsInfinityOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlElementWiseIsInfinityFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_IS_INFINITY_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InfinityMode = ParseDmlIsInfinityModeField(value, "InfinityMode", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_IS_INFINITY;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_IS_INFINITY_MODE, ParseDmlIsInfinityMode>, // InfinityMode
+};
+static_assert(std::size(c_dmlElementWiseIsInfinityFieldParsers) == DML_ELEMENT_WISE_IS_INFINITY_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IS_INFINITY_OPERATOR_DESC& desc)
 {
@@ -2958,19 +2515,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_IS_I
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseModulusTruncateOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_MODULUS_TRUNCATE_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MODULUS_TRUNCATE_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -2980,19 +2524,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MODU
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseModulusFloorOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_MODULUS_FLOOR_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MODULUS_FLOOR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3002,18 +2533,13 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_MODU
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlFillValueConstantOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlFillValueConstantFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_FILL_VALUE_CONSTANT_OPERATOR_DESC>();
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ValueDataType = ParseDmlTensorDataTypeField(value, "ValueDataType", true, {});
-    desc->Value = *ParseDmlScalarUnionField(value, "Value", "ValueDataType", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_FILL_VALUE_CONSTANT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>, // ValueDataType
+    nullptr, // Value
+};
+static_assert(std::size(c_dmlFillValueConstantFieldParsers) == DML_FILL_VALUE_CONSTANT_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_FILL_VALUE_CONSTANT_OPERATOR_DESC& desc)
 {
@@ -3022,19 +2548,14 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_FILL_VALUE_CONSTA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlFillValueSequenceOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlFillValueSequenceFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_FILL_VALUE_SEQUENCE_OPERATOR_DESC>();
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ValueDataType = ParseDmlTensorDataTypeField(value, "ValueDataType", true, {});
-    desc->ValueStart = *ParseDmlScalarUnionField(value, "ValueStart", "ValueDataType", allocator, true);
-    desc->ValueDelta = *ParseDmlScalarUnionField(value, "ValueDelta", "ValueDataType", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_FILL_VALUE_SEQUENCE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>, // ValueDataType
+    nullptr, // ValueStart
+    nullptr, // ValueDelta
+};
+static_assert(std::size(c_dmlFillValueSequenceFieldParsers) == DML_FILL_VALUE_SEQUENCE_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_FILL_VALUE_SEQUENCE_OPERATOR_DESC& desc)
 {
@@ -3043,20 +2564,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_FILL_VALUE_SEQUEN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlCumulativeSummationOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlCumulativeSummationFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_CUMULATIVE_SUMMATION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    desc->AxisDirection = ParseDmlAxisDirectionField(value, "AxisDirection", true, {});
-    desc->HasExclusiveSum = ParseBoolField(value, "HasExclusiveSum", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_CUMULATIVE_SUMMATION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // Axis
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // AxisDirection
+    ParseAsUInt32<bool, ParseBool>, // HasExclusiveSum
+};
+static_assert(std::size(c_dmlCumulativeSummationFieldParsers) == DML_CUMULATIVE_SUMMATION_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CUMULATIVE_SUMMATION_OPERATOR_DESC& desc)
 {
@@ -3066,20 +2582,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CUMULATIVE_SUMMAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlCumulativeProductOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlCumulativeProductFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_CUMULATIVE_PRODUCT_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    desc->AxisDirection = ParseDmlAxisDirectionField(value, "AxisDirection", true, {});
-    desc->HasExclusiveProduct = ParseBoolField(value, "HasExclusiveProduct", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_CUMULATIVE_PRODUCT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // Axis
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // AxisDirection
+    ParseAsUInt32<bool, ParseBool>, // HasExclusiveProduct
+};
+static_assert(std::size(c_dmlCumulativeProductFieldParsers) == DML_CUMULATIVE_PRODUCT_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CUMULATIVE_PRODUCT_OPERATOR_DESC& desc)
 {
@@ -3089,20 +2600,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CUMULATIVE_PRODUC
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlReverseSubsequencesOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_REVERSE_SUBSEQUENCES_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->SequenceLengthsTensor = fused ? nullptr : ParseDmlTensorDescField(value, "SequenceLengthsTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_REVERSE_SUBSEQUENCES;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_REVERSE_SUBSEQUENCES_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3112,20 +2609,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_REVERSE_SUBSEQUEN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlGatherElementsOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_GATHER_ELEMENTS_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_GATHER_ELEMENTS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_ELEMENTS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3135,21 +2618,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_ELEMENTS_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlGatherNdOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_GATHER_ND_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InputDimensionCount = ParseUInt32Field(value, "InputDimensionCount", true);
-    desc->IndicesDimensionCount = ParseUInt32Field(value, "IndicesDimensionCount", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_GATHER_ND;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_ND_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3159,22 +2627,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_ND_OPERATO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlScatterNdOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SCATTER_ND_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->UpdatesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "UpdatesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InputDimensionCount = ParseUInt32Field(value, "InputDimensionCount", true);
-    desc->IndicesDimensionCount = ParseUInt32Field(value, "IndicesDimensionCount", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SCATTER_ND;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SCATTER_ND_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3185,25 +2637,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SCATTER_ND_OPERAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMaxPooling2OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MAX_POOLING2_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputIndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputIndicesTensor", allocator, false);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MAX_POOLING2;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING2_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3213,22 +2646,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING2_OPER
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlSlice1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SLICE1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->InputWindowOffsets = AsPointer(ParseUInt32ArrayField(value, "InputWindowOffsets", allocator, true));
-    desc->InputWindowSizes = AsPointer(ParseUInt32ArrayField(value, "InputWindowSizes", allocator, true));
-    desc->InputWindowStrides = AsPointer(ParseInt32ArrayField(value, "InputWindowStrides", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SLICE1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SLICE1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3237,21 +2654,16 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SLICE1_OPERATOR_D
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlTopK1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlTopK1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_TOP_K1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputValueTensor", allocator, true);
-    desc->OutputIndexTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputIndexTensor", allocator, true);
-    desc->Axis = ParseUInt32Field(value, "Axis", true);
-    desc->K = ParseUInt32Field(value, "K", true);
-    desc->AxisDirection = ParseDmlAxisDirectionField(value, "AxisDirection", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_TOP_K1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputValueTensor
+    nullptr, // OutputIndexTensor
+    nullptr, // Axis
+    nullptr, // K
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // AxisDirection
+};
+static_assert(std::size(c_dmlTopK1FieldParsers) == DML_TOP_K1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_TOP_K1_OPERATOR_DESC& desc)
 {
@@ -3262,19 +2674,14 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_TOP_K1_OPERATOR_D
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlDepthToSpace1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlDepthToSpace1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_DEPTH_TO_SPACE1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->BlockSize = ParseUInt32Field(value, "BlockSize", true);
-    desc->Order = ParseDmlDepthSpaceOrderField(value, "Order", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_DEPTH_TO_SPACE1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // BlockSize
+    ParseAsUInt32<DML_DEPTH_SPACE_ORDER, ParseDmlDepthSpaceOrder>, // Order
+};
+static_assert(std::size(c_dmlDepthToSpace1FieldParsers) == DML_DEPTH_TO_SPACE1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DEPTH_TO_SPACE1_OPERATOR_DESC& desc)
 {
@@ -3284,19 +2691,14 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DEPTH_TO_SPACE1_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlSpaceToDepth1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlSpaceToDepth1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SPACE_TO_DEPTH1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->BlockSize = ParseUInt32Field(value, "BlockSize", true);
-    desc->Order = ParseDmlDepthSpaceOrderField(value, "Order", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SPACE_TO_DEPTH1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    nullptr, // BlockSize
+    ParseAsUInt32<DML_DEPTH_SPACE_ORDER, ParseDmlDepthSpaceOrder>, // Order
+};
+static_assert(std::size(c_dmlSpaceToDepth1FieldParsers) == DML_SPACE_TO_DEPTH1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SPACE_TO_DEPTH1_OPERATOR_DESC& desc)
 {
@@ -3306,24 +2708,19 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SPACE_TO_DEPTH1_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMeanVarianceNormalization1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlMeanVarianceNormalization1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MEAN_VARIANCE_NORMALIZATION1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    desc->NormalizeVariance = ParseBoolField(value, "NormalizeVariance", true) ? 1 : 0;
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // ScaleTensor
+    nullptr, // BiasTensor
+    nullptr, // OutputTensor
+    nullptr, // AxisCount
+    nullptr, // Axes
+    ParseAsUInt32<bool, ParseBool>, // NormalizeVariance
+    nullptr, // Epsilon
+    nullptr, // FusedActivation
+};
+static_assert(std::size(c_dmlMeanVarianceNormalization1FieldParsers) == DML_MEAN_VARIANCE_NORMALIZATION1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MEAN_VARIANCE_NORMALIZATION1_OPERATOR_DESC& desc)
 {
@@ -3335,22 +2732,17 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MEAN_VARIANCE_NOR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlResample1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlResample1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RESAMPLE1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Scales = AsPointer(ParseFloat32ArrayField(value, "Scales", allocator, true));
-    desc->InputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "InputPixelOffsets", allocator, true));
-    desc->OutputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "OutputPixelOffsets", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RESAMPLE1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    nullptr, // DimensionCount
+    nullptr, // Scales
+    nullptr, // InputPixelOffsets
+    nullptr, // OutputPixelOffsets
+};
+static_assert(std::size(c_dmlResample1FieldParsers) == DML_RESAMPLE1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE1_OPERATOR_DESC& desc)
 {
@@ -3360,21 +2752,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE1_OPERATO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMatrixMultiplyIntegerOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MATRIX_MULTIPLY_INTEGER_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->AZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AZeroPointTensor", allocator, false);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->BZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MATRIX_MULTIPLY_INTEGER;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MATRIX_MULTIPLY_INTEGER_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3386,25 +2763,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MATRIX_MULTIPLY_I
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlQuantizedLinearMatrixMultiplyOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_QUANTIZED_LINEAR_MATRIX_MULTIPLY_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->AScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AScaleTensor", allocator, true);
-    desc->AZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AZeroPointTensor", allocator, false);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->BScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BScaleTensor", allocator, true);
-    desc->BZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BZeroPointTensor", allocator, false);
-    desc->OutputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleTensor", allocator, true);
-    desc->OutputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZED_LINEAR_MATRIX_MULTIPLY_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3420,27 +2778,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZED_LINEAR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlConvolutionIntegerOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_CONVOLUTION_INTEGER_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputZeroPointTensor", allocator, false);
-    desc->FilterTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FilterTensor", allocator, true);
-    desc->FilterZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FilterZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->GroupCount = ParseUInt32Field(value, "GroupCount", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_CONVOLUTION_INTEGER;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CONVOLUTION_INTEGER_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3452,32 +2789,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_CONVOLUTION_INTEG
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlQuantizedLinearConvolutionOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_QUANTIZED_LINEAR_CONVOLUTION_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputScaleTensor", allocator, true);
-    desc->InputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputZeroPointTensor", allocator, false);
-    desc->FilterTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FilterTensor", allocator, true);
-    desc->FilterScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FilterScaleTensor", allocator, true);
-    desc->FilterZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FilterZeroPointTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->OutputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleTensor", allocator, true);
-    desc->OutputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->GroupCount = ParseUInt32Field(value, "GroupCount", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZED_LINEAR_CONVOLUTION_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3494,19 +2805,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZED_LINEAR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitAndOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_AND_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_AND;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_AND_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3516,19 +2814,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitOrOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_OR_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_OR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_OR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3538,19 +2823,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitXorOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_XOR_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_XOR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_XOR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3560,18 +2832,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitNotOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_NOT_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_NOT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_NOT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3580,18 +2840,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseBitCountOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_BIT_COUNT_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_BIT_COUNT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_COUNT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3600,19 +2848,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_BIT_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationReluGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_RELU_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_RELU_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_RELU_GRAD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3622,23 +2857,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_RELU_G
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlAveragePoolingGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlAveragePoolingGradFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_AVERAGE_POOLING_GRAD_OPERATOR_DESC>();
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->IncludePadding = ParseBoolField(value, "IncludePadding", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_AVERAGE_POOLING_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputGradientTensor
+    nullptr, // OutputGradientTensor
+    nullptr, // DimensionCount
+    nullptr, // Strides
+    nullptr, // WindowSize
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+    ParseAsUInt32<bool, ParseBool>, // IncludePadding
+};
+static_assert(std::size(c_dmlAveragePoolingGradFieldParsers) == DML_AVERAGE_POOLING_GRAD_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_AVERAGE_POOLING_GRAD_OPERATOR_DESC& desc)
 {
@@ -3648,25 +2878,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_AVERAGE_POOLING_G
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMaxPoolingGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MAX_POOLING_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MAX_POOLING_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING_GRAD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3676,19 +2887,14 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MAX_POOLING_GRAD_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlRandomGeneratorOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlRandomGeneratorFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RANDOM_GENERATOR_OPERATOR_DESC>();
-    desc->InputStateTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputStateTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputStateTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputStateTensor", allocator, false);
-    desc->Type = ParseDmlRandomGeneratorTypeField(value, "Type", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RANDOM_GENERATOR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputStateTensor
+    nullptr, // OutputTensor
+    nullptr, // OutputStateTensor
+    ParseAsUInt32<DML_RANDOM_GENERATOR_TYPE, ParseDmlRandomGeneratorType>, // Type
+};
+static_assert(std::size(c_dmlRandomGeneratorFieldParsers) == DML_RANDOM_GENERATOR_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RANDOM_GENERATOR_OPERATOR_DESC& desc)
 {
@@ -3699,19 +2905,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RANDOM_GENERATOR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlNonzeroCoordinatesOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_NONZERO_COORDINATES_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputCountTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputCountTensor", allocator, true);
-    desc->OutputCoordinatesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputCoordinatesTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_NONZERO_COORDINATES;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_NONZERO_COORDINATES_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3721,22 +2914,17 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_NONZERO_COORDINAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlResampleGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlResampleGradFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RESAMPLE_GRAD_OPERATOR_DESC>();
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Scales = AsPointer(ParseFloat32ArrayField(value, "Scales", allocator, true));
-    desc->InputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "InputPixelOffsets", allocator, true));
-    desc->OutputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "OutputPixelOffsets", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RESAMPLE_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputGradientTensor
+    nullptr, // OutputGradientTensor
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    nullptr, // DimensionCount
+    nullptr, // Scales
+    nullptr, // InputPixelOffsets
+    nullptr, // OutputPixelOffsets
+};
+static_assert(std::size(c_dmlResampleGradFieldParsers) == DML_RESAMPLE_GRAD_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE_GRAD_OPERATOR_DESC& desc)
 {
@@ -3746,22 +2934,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE_GRAD_OPE
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlSliceGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_SLICE_GRAD_OPERATOR_DESC>();
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->InputWindowOffsets = AsPointer(ParseUInt32ArrayField(value, "InputWindowOffsets", allocator, true));
-    desc->InputWindowSizes = AsPointer(ParseUInt32ArrayField(value, "InputWindowSizes", allocator, true));
-    desc->InputWindowStrides = AsPointer(ParseInt32ArrayField(value, "InputWindowStrides", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_SLICE_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SLICE_GRAD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3770,28 +2942,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_SLICE_GRAD_OPERAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlAdamOptimizerOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ADAM_OPTIMIZER_OPERATOR_DESC>();
-    desc->InputParametersTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputParametersTensor", allocator, true);
-    desc->InputFirstMomentTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputFirstMomentTensor", allocator, true);
-    desc->InputSecondMomentTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputSecondMomentTensor", allocator, true);
-    desc->GradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "GradientTensor", allocator, true);
-    desc->TrainingStepTensor = fused ? nullptr : ParseDmlTensorDescField(value, "TrainingStepTensor", allocator, true);
-    desc->OutputParametersTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputParametersTensor", allocator, true);
-    desc->OutputFirstMomentTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputFirstMomentTensor", allocator, true);
-    desc->OutputSecondMomentTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputSecondMomentTensor", allocator, true);
-    desc->LearningRate = ParseFloat32Field(value, "LearningRate", true);
-    desc->Beta1 = ParseFloat32Field(value, "Beta1", true);
-    desc->Beta2 = ParseFloat32Field(value, "Beta2", true);
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ADAM_OPTIMIZER;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ADAM_OPTIMIZER_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3806,26 +2956,21 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ADAM_OPTIMIZER_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlRoiAlignOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlRoiAlignFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ROI_ALIGN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ROITensor = fused ? nullptr : ParseDmlTensorDescField(value, "ROITensor", allocator, true);
-    desc->BatchIndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BatchIndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ReductionFunction = ParseDmlReduceFunctionField(value, "ReductionFunction", true, {});
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->SpatialScaleX = ParseFloat32Field(value, "SpatialScaleX", true);
-    desc->SpatialScaleY = ParseFloat32Field(value, "SpatialScaleY", true);
-    desc->OutOfBoundsInputValue = ParseFloat32Field(value, "OutOfBoundsInputValue", true);
-    desc->MinimumSamplesPerOutput = ParseUInt32Field(value, "MinimumSamplesPerOutput", true);
-    desc->MaximumSamplesPerOutput = ParseUInt32Field(value, "MaximumSamplesPerOutput", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ROI_ALIGN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // ROITensor
+    nullptr, // BatchIndicesTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_REDUCE_FUNCTION, ParseDmlReduceFunction>, // ReductionFunction
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    nullptr, // SpatialScaleX
+    nullptr, // SpatialScaleY
+    nullptr, // OutOfBoundsInputValue
+    nullptr, // MinimumSamplesPerOutput
+    nullptr, // MaximumSamplesPerOutput
+};
+static_assert(std::size(c_dmlRoiAlignFieldParsers) == DML_ROI_ALIGN_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_ALIGN_OPERATOR_DESC& desc)
 {
@@ -3837,29 +2982,24 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_ALIGN_OPERATO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlRoiAlign1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlRoiAlign1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ROI_ALIGN1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ROITensor = fused ? nullptr : ParseDmlTensorDescField(value, "ROITensor", allocator, true);
-    desc->BatchIndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BatchIndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ReductionFunction = ParseDmlReduceFunctionField(value, "ReductionFunction", true, {});
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->SpatialScaleX = ParseFloat32Field(value, "SpatialScaleX", true);
-    desc->SpatialScaleY = ParseFloat32Field(value, "SpatialScaleY", true);
-    desc->InputPixelOffset = ParseFloat32Field(value, "InputPixelOffset", true);
-    desc->OutputPixelOffset = ParseFloat32Field(value, "OutputPixelOffset", true);
-    desc->OutOfBoundsInputValue = ParseFloat32Field(value, "OutOfBoundsInputValue", true);
-    desc->MinimumSamplesPerOutput = ParseUInt32Field(value, "MinimumSamplesPerOutput", true);
-    desc->MaximumSamplesPerOutput = ParseUInt32Field(value, "MaximumSamplesPerOutput", true);
-    desc->AlignRegionsToCorners = ParseBoolField(value, "AlignRegionsToCorners", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ROI_ALIGN1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // ROITensor
+    nullptr, // BatchIndicesTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_REDUCE_FUNCTION, ParseDmlReduceFunction>, // ReductionFunction
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    nullptr, // SpatialScaleX
+    nullptr, // SpatialScaleY
+    nullptr, // InputPixelOffset
+    nullptr, // OutputPixelOffset
+    nullptr, // OutOfBoundsInputValue
+    nullptr, // MinimumSamplesPerOutput
+    nullptr, // MaximumSamplesPerOutput
+    ParseAsUInt32<bool, ParseBool>, // AlignRegionsToCorners
+};
+static_assert(std::size(c_dmlRoiAlign1FieldParsers) == DML_ROI_ALIGN1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_ALIGN1_OPERATOR_DESC& desc)
 {
@@ -3871,22 +3011,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_ALIGN1_OPERAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlGatherNd1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_GATHER_ND1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->IndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "IndicesTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InputDimensionCount = ParseUInt32Field(value, "InputDimensionCount", true);
-    desc->IndicesDimensionCount = ParseUInt32Field(value, "IndicesDimensionCount", true);
-    desc->BatchDimensionCount = ParseUInt32Field(value, "BatchDimensionCount", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_GATHER_ND1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_ND1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3896,20 +3020,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_GATHER_ND1_OPERAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlDynamicQuantizeLinearOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_DYNAMIC_QUANTIZE_LINEAR_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleTensor", allocator, true);
-    desc->OutputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputZeroPointTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DYNAMIC_QUANTIZE_LINEAR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3920,25 +3030,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DYNAMIC_QUANTIZE_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlElementWiseQuantizedLinearAddOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ELEMENT_WISE_QUANTIZED_LINEAR_ADD_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->AScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AScaleTensor", allocator, true);
-    desc->AZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AZeroPointTensor", allocator, false);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->BScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BScaleTensor", allocator, true);
-    desc->BZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BZeroPointTensor", allocator, false);
-    desc->OutputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleTensor", allocator, true);
-    desc->OutputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_QUANTIZED_LINEAR_ADD_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -3954,30 +3045,25 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ELEMENT_WISE_QUAN
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlRoiAlignGradOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlRoiAlignGradFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ROI_ALIGN_GRAD_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, false);
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->ROITensor = fused ? nullptr : ParseDmlTensorDescField(value, "ROITensor", allocator, true);
-    desc->BatchIndicesTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BatchIndicesTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, false);
-    desc->OutputROIGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputROIGradientTensor", allocator, false);
-    desc->ReductionFunction = ParseDmlReduceFunctionField(value, "ReductionFunction", true, {});
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->SpatialScaleX = ParseFloat32Field(value, "SpatialScaleX", true);
-    desc->SpatialScaleY = ParseFloat32Field(value, "SpatialScaleY", true);
-    desc->InputPixelOffset = ParseFloat32Field(value, "InputPixelOffset", true);
-    desc->OutputPixelOffset = ParseFloat32Field(value, "OutputPixelOffset", true);
-    desc->MinimumSamplesPerOutput = ParseUInt32Field(value, "MinimumSamplesPerOutput", true);
-    desc->MaximumSamplesPerOutput = ParseUInt32Field(value, "MaximumSamplesPerOutput", true);
-    desc->AlignRegionsToCorners = ParseBoolField(value, "AlignRegionsToCorners", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ROI_ALIGN_GRAD;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // InputGradientTensor
+    nullptr, // ROITensor
+    nullptr, // BatchIndicesTensor
+    nullptr, // OutputGradientTensor
+    nullptr, // OutputROIGradientTensor
+    ParseAsUInt32<DML_REDUCE_FUNCTION, ParseDmlReduceFunction>, // ReductionFunction
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    nullptr, // SpatialScaleX
+    nullptr, // SpatialScaleY
+    nullptr, // InputPixelOffset
+    nullptr, // OutputPixelOffset
+    nullptr, // MinimumSamplesPerOutput
+    nullptr, // MaximumSamplesPerOutput
+    ParseAsUInt32<bool, ParseBool>, // AlignRegionsToCorners
+};
+static_assert(std::size(c_dmlRoiAlignGradFieldParsers) == DML_ROI_ALIGN_GRAD_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_ALIGN_GRAD_OPERATOR_DESC& desc)
 {
@@ -3991,25 +3077,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ROI_ALIGN_GRAD_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlBatchNormalizationTrainingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_BATCH_NORMALIZATION_TRAINING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, true);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, true);
-    desc->FusedAddTensor = fused ? nullptr : ParseDmlTensorDescField(value, "FusedAddTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputMeanTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputMeanTensor", allocator, true);
-    desc->OutputVarianceTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputVarianceTensor", allocator, true);
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_BATCH_NORMALIZATION_TRAINING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATION_TRAINING_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4023,23 +3090,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_BATCH_NORMALIZATI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlResample2OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlResample2FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RESAMPLE2_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->RoundingDirection = ParseDmlAxisDirectionField(value, "RoundingDirection", true, {});
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Scales = AsPointer(ParseFloat32ArrayField(value, "Scales", allocator, true));
-    desc->InputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "InputPixelOffsets", allocator, true));
-    desc->OutputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "OutputPixelOffsets", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RESAMPLE2;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // RoundingDirection
+    nullptr, // DimensionCount
+    nullptr, // Scales
+    nullptr, // InputPixelOffsets
+    nullptr, // OutputPixelOffsets
+};
+static_assert(std::size(c_dmlResample2FieldParsers) == DML_RESAMPLE2_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE2_OPERATOR_DESC& desc)
 {
@@ -4049,23 +3111,18 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE2_OPERATO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlResampleGrad1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlResampleGrad1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_RESAMPLE_GRAD1_OPERATOR_DESC>();
-    desc->InputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputGradientTensor", allocator, true);
-    desc->OutputGradientTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputGradientTensor", allocator, true);
-    desc->InterpolationMode = ParseDmlInterpolationModeField(value, "InterpolationMode", true, {});
-    desc->RoundingDirection = ParseDmlAxisDirectionField(value, "RoundingDirection", true, {});
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Scales = AsPointer(ParseFloat32ArrayField(value, "Scales", allocator, true));
-    desc->InputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "InputPixelOffsets", allocator, true));
-    desc->OutputPixelOffsets = AsPointer(ParseFloat32ArrayField(value, "OutputPixelOffsets", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_RESAMPLE_GRAD1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputGradientTensor
+    nullptr, // OutputGradientTensor
+    ParseAsUInt32<DML_INTERPOLATION_MODE, ParseDmlInterpolationMode>, // InterpolationMode
+    ParseAsUInt32<DML_AXIS_DIRECTION, ParseDmlAxisDirection>, // RoundingDirection
+    nullptr, // DimensionCount
+    nullptr, // Scales
+    nullptr, // InputPixelOffsets
+    nullptr, // OutputPixelOffsets
+};
+static_assert(std::size(c_dmlResampleGrad1FieldParsers) == DML_RESAMPLE_GRAD1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE_GRAD1_OPERATOR_DESC& desc)
 {
@@ -4075,21 +3132,16 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_RESAMPLE_GRAD1_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlDiagonalMatrix1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlDiagonalMatrix1FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_DIAGONAL_MATRIX1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->ValueDataType = ParseDmlTensorDataTypeField(value, "ValueDataType", true, {});
-    desc->Value = *ParseDmlScalarUnionField(value, "Value", "ValueDataType", allocator, true);
-    desc->DiagonalFillBegin = ParseInt32Field(value, "DiagonalFillBegin", true);
-    desc->DiagonalFillEnd = ParseInt32Field(value, "DiagonalFillEnd", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_DIAGONAL_MATRIX1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // OutputTensor
+    ParseAsUInt32<DML_TENSOR_DATA_TYPE, ParseDmlTensorDataType>, // ValueDataType
+    nullptr, // Value
+    nullptr, // DiagonalFillBegin
+    nullptr, // DiagonalFillEnd
+};
+static_assert(std::size(c_dmlDiagonalMatrix1FieldParsers) == DML_DIAGONAL_MATRIX1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DIAGONAL_MATRIX1_OPERATOR_DESC& desc)
 {
@@ -4099,33 +3151,28 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DIAGONAL_MATRIX1_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMultiheadAttentionOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MULTIHEAD_ATTENTION_OPERATOR_DESC>();
-    desc->QueryTensor = fused ? nullptr : ParseDmlTensorDescField(value, "QueryTensor", allocator, false);
-    desc->KeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "KeyTensor", allocator, false);
-    desc->ValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ValueTensor", allocator, false);
-    desc->StackedQueryKeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "StackedQueryKeyTensor", allocator, false);
-    desc->StackedKeyValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "StackedKeyValueTensor", allocator, false);
-    desc->StackedQueryKeyValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "StackedQueryKeyValueTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->MaskTensor = fused ? nullptr : ParseDmlTensorDescField(value, "MaskTensor", allocator, false);
-    desc->RelativePositionBiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "RelativePositionBiasTensor", allocator, false);
-    desc->PastKeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "PastKeyTensor", allocator, false);
-    desc->PastValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "PastValueTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputPresentKeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputPresentKeyTensor", allocator, false);
-    desc->OutputPresentValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputPresentValueTensor", allocator, false);
-    desc->Scale = ParseFloat32Field(value, "Scale", true);
-    desc->MaskFilterValue = ParseFloat32Field(value, "MaskFilterValue", true);
-    desc->HeadCount = ParseUInt32Field(value, "HeadCount", true);
-    desc->MaskType = ParseDmlMultiheadAttentionMaskTypeField(value, "MaskType", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MULTIHEAD_ATTENTION;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+constexpr DmlUInt32FieldParser c_dmlMultiheadAttentionFieldParsers[] =
+{
+    nullptr, // QueryTensor
+    nullptr, // KeyTensor
+    nullptr, // ValueTensor
+    nullptr, // StackedQueryKeyTensor
+    nullptr, // StackedKeyValueTensor
+    nullptr, // StackedQueryKeyValueTensor
+    nullptr, // BiasTensor
+    nullptr, // MaskTensor
+    nullptr, // RelativePositionBiasTensor
+    nullptr, // PastKeyTensor
+    nullptr, // PastValueTensor
+    nullptr, // OutputTensor
+    nullptr, // OutputPresentKeyTensor
+    nullptr, // OutputPresentValueTensor
+    nullptr, // Scale
+    nullptr, // MaskFilterValue
+    nullptr, // HeadCount
+    ParseAsUInt32<DML_MULTIHEAD_ATTENTION_MASK_TYPE, ParseDmlMultiheadAttentionMaskType>, // MaskType
+};
+static_assert(std::size(c_dmlMultiheadAttentionFieldParsers) == DML_MULTIHEAD_ATTENTION_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MULTIHEAD_ATTENTION_OPERATOR_DESC& desc)
 {
@@ -4147,28 +3194,23 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MULTIHEAD_ATTENTI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlQuantizedLinearAveragePoolingOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlQuantizedLinearAveragePoolingFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_QUANTIZED_LINEAR_AVERAGE_POOLING_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->InputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputScaleTensor", allocator, true);
-    desc->InputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputZeroPointTensor", allocator, false);
-    desc->OutputScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputScaleTensor", allocator, true);
-    desc->OutputZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputZeroPointTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->DimensionCount = ParseUInt32Field(value, "DimensionCount", true);
-    desc->Strides = AsPointer(ParseUInt32ArrayField(value, "Strides", allocator, true));
-    desc->WindowSize = AsPointer(ParseUInt32ArrayField(value, "WindowSize", allocator, true));
-    desc->StartPadding = AsPointer(ParseUInt32ArrayField(value, "StartPadding", allocator, true));
-    desc->EndPadding = AsPointer(ParseUInt32ArrayField(value, "EndPadding", allocator, true));
-    desc->Dilations = AsPointer(ParseUInt32ArrayField(value, "Dilations", allocator, true));
-    desc->IncludePadding = ParseBoolField(value, "IncludePadding", true) ? 1 : 0;
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // InputScaleTensor
+    nullptr, // InputZeroPointTensor
+    nullptr, // OutputScaleTensor
+    nullptr, // OutputZeroPointTensor
+    nullptr, // OutputTensor
+    nullptr, // DimensionCount
+    nullptr, // Strides
+    nullptr, // WindowSize
+    nullptr, // StartPadding
+    nullptr, // EndPadding
+    nullptr, // Dilations
+    ParseAsUInt32<bool, ParseBool>, // IncludePadding
+};
+static_assert(std::size(c_dmlQuantizedLinearAveragePoolingFieldParsers) == DML_QUANTIZED_LINEAR_AVERAGE_POOLING_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZED_LINEAR_AVERAGE_POOLING_OPERATOR_DESC& desc)
 {
@@ -4182,24 +3224,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZED_LINEAR_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMatrixMultiplyIntegerToFloatOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MATRIX_MULTIPLY_INTEGER_TO_FLOAT_OPERATOR_DESC>();
-    desc->ATensor = fused ? nullptr : ParseDmlTensorDescField(value, "ATensor", allocator, true);
-    desc->AScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AScaleTensor", allocator, true);
-    desc->AZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "AZeroPointTensor", allocator, false);
-    desc->BTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BTensor", allocator, true);
-    desc->BScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BScaleTensor", allocator, true);
-    desc->BZeroPointTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BZeroPointTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MATRIX_MULTIPLY_INTEGER_TO_FLOAT_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4214,25 +3238,20 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MATRIX_MULTIPLY_I
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMeanVarianceNormalization2OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlMeanVarianceNormalization2FieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MEAN_VARIANCE_NORMALIZATION2_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->ScaleTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ScaleTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    desc->UseMean = ParseBoolField(value, "UseMean", true) ? 1 : 0;
-    desc->UseVariance = ParseBoolField(value, "UseVariance", true) ? 1 : 0;
-    desc->Epsilon = ParseFloat32Field(value, "Epsilon", true);
-    desc->FusedActivation = ParseDmlOperatorDescField(value, "FusedActivation", true, allocator, false);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    nullptr, // ScaleTensor
+    nullptr, // BiasTensor
+    nullptr, // OutputTensor
+    nullptr, // AxisCount
+    nullptr, // Axes
+    ParseAsUInt32<bool, ParseBool>, // UseMean
+    ParseAsUInt32<bool, ParseBool>, // UseVariance
+    nullptr, // Epsilon
+    nullptr, // FusedActivation
+};
+static_assert(std::size(c_dmlMeanVarianceNormalization2FieldParsers) == DML_MEAN_VARIANCE_NORMALIZATION2_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MEAN_VARIANCE_NORMALIZATION2_OPERATOR_DESC& desc)
 {
@@ -4244,35 +3263,30 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MEAN_VARIANCE_NOR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlMultiheadAttention1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_MULTIHEAD_ATTENTION1_OPERATOR_DESC>();
-    desc->QueryTensor = fused ? nullptr : ParseDmlTensorDescField(value, "QueryTensor", allocator, false);
-    desc->KeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "KeyTensor", allocator, false);
-    desc->ValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "ValueTensor", allocator, false);
-    desc->StackedQueryKeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "StackedQueryKeyTensor", allocator, false);
-    desc->StackedKeyValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "StackedKeyValueTensor", allocator, false);
-    desc->StackedQueryKeyValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "StackedQueryKeyValueTensor", allocator, false);
-    desc->BiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "BiasTensor", allocator, false);
-    desc->MaskTensor = fused ? nullptr : ParseDmlTensorDescField(value, "MaskTensor", allocator, false);
-    desc->RelativePositionBiasTensor = fused ? nullptr : ParseDmlTensorDescField(value, "RelativePositionBiasTensor", allocator, false);
-    desc->PastKeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "PastKeyTensor", allocator, false);
-    desc->PastValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "PastValueTensor", allocator, false);
-    desc->PastSequenceLengthsTensor = fused ? nullptr : ParseDmlTensorDescField(value, "PastSequenceLengthsTensor", allocator, false);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->OutputPresentKeyTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputPresentKeyTensor", allocator, false);
-    desc->OutputPresentValueTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputPresentValueTensor", allocator, false);
-    desc->Scale = ParseFloat32Field(value, "Scale", true);
-    desc->MaskFilterValue = ParseFloat32Field(value, "MaskFilterValue", true);
-    desc->QueryHeadCount = ParseUInt32Field(value, "QueryHeadCount", true);
-    desc->KeyValueHeadCount = ParseUInt32Field(value, "KeyValueHeadCount", true);
-    desc->MaskType = ParseDmlMultiheadAttentionMaskTypeField(value, "MaskType", true, {});
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_MULTIHEAD_ATTENTION1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+constexpr DmlUInt32FieldParser c_dmlMultiheadAttention1FieldParsers[] =
+{
+    nullptr, // QueryTensor
+    nullptr, // KeyTensor
+    nullptr, // ValueTensor
+    nullptr, // StackedQueryKeyTensor
+    nullptr, // StackedKeyValueTensor
+    nullptr, // StackedQueryKeyValueTensor
+    nullptr, // BiasTensor
+    nullptr, // MaskTensor
+    nullptr, // RelativePositionBiasTensor
+    nullptr, // PastKeyTensor
+    nullptr, // PastValueTensor
+    nullptr, // PastSequenceLengthsTensor
+    nullptr, // OutputTensor
+    nullptr, // OutputPresentKeyTensor
+    nullptr, // OutputPresentValueTensor
+    nullptr, // Scale
+    nullptr, // MaskFilterValue
+    nullptr, // QueryHeadCount
+    nullptr, // KeyValueHeadCount
+    ParseAsUInt32<DML_MULTIHEAD_ATTENTION_MASK_TYPE, ParseDmlMultiheadAttentionMaskType>, // MaskType
+};
+static_assert(std::size(c_dmlMultiheadAttention1FieldParsers) == DML_MULTIHEAD_ATTENTION1_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MULTIHEAD_ATTENTION1_OPERATOR_DESC& desc)
 {
@@ -4295,20 +3309,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_MULTIHEAD_ATTENTI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlQuantizeOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlQuantizeFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_QUANTIZE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->QuantizationType = ParseDmlQuantizationTypeField(value, "QuantizationType", true, {});
-    desc->QuantizationTensorCount = ParseUInt32Field(value, "QuantizationTensorCount", true);
-    desc->QuantizationTensors = fused ? nullptr : AsPointer(ParseDmlTensorDescArrayField(value, "QuantizationTensors", allocator, true));
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_QUANTIZE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    ParseAsUInt32<DML_QUANTIZATION_TYPE, ParseDmlQuantizationType>, // QuantizationType
+    nullptr, // QuantizationTensorCount
+    nullptr, // QuantizationTensors
+    nullptr, // OutputTensor
+};
+static_assert(std::size(c_dmlQuantizeFieldParsers) == DML_QUANTIZE_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZE_OPERATOR_DESC& desc)
 {
@@ -4319,20 +3328,15 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_QUANTIZE_OPERATOR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlDequantizeOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+constexpr DmlUInt32FieldParser c_dmlDequantizeFieldParsers[] =
 {
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_DEQUANTIZE_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->QuantizationType = ParseDmlQuantizationTypeField(value, "QuantizationType", true, {});
-    desc->QuantizationTensorCount = ParseUInt32Field(value, "QuantizationTensorCount", true);
-    desc->QuantizationTensors = fused ? nullptr : AsPointer(ParseDmlTensorDescArrayField(value, "QuantizationTensors", allocator, true));
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_DEQUANTIZE;
-    opDesc->Desc = desc;
-    return opDesc;
-}
+    nullptr, // InputTensor
+    ParseAsUInt32<DML_QUANTIZATION_TYPE, ParseDmlQuantizationType>, // QuantizationType
+    nullptr, // QuantizationTensorCount
+    nullptr, // QuantizationTensors
+    nullptr, // OutputTensor
+};
+static_assert(std::size(c_dmlDequantizeFieldParsers) == DML_DEQUANTIZE_OPERATOR_SCHEMA.FieldCount);
  
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DEQUANTIZE_OPERATOR_DESC& desc)
 {
@@ -4343,19 +3347,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_DEQUANTIZE_OPERAT
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationEluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_ELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_ELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_ELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4364,19 +3355,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_ELU_OP
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationCeluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_CELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_CELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_CELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4385,18 +3363,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_CELU_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationHardmaxOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_HARDMAX_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_HARDMAX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARDMAX_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4405,20 +3371,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARDMA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationHardmax1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_HARDMAX1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_HARDMAX1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARDMAX1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4427,20 +3379,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARDMA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationHardSigmoidOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_HARD_SIGMOID_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_HARD_SIGMOID;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARD_SIGMOID_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4449,18 +3387,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARD_S
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationIdentityOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_IDENTITY_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_IDENTITY;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_IDENTITY_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4469,19 +3395,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_IDENTI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationLeakyReluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_LEAKY_RELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_LEAKY_RELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LEAKY_RELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4490,20 +3403,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LEAKY_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationLinearOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_LINEAR_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_LINEAR;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LINEAR_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4512,18 +3411,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LINEAR
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationLogSoftmaxOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_LOG_SOFTMAX_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_LOG_SOFTMAX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LOG_SOFTMAX_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4532,20 +3419,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LOG_SO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationLogSoftmax1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_LOG_SOFTMAX1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LOG_SOFTMAX1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4554,19 +3427,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_LOG_SO
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationParameterizedReluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_PARAMETERIZED_RELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->SlopeTensor = fused ? nullptr : ParseDmlTensorDescField(value, "SlopeTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_PARAMETERIZED_RELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4576,20 +3436,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_PARAME
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationParametricSoftplusOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_PARAMETRIC_SOFTPLUS_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_PARAMETRIC_SOFTPLUS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4598,18 +3444,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_PARAME
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationReluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_RELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_RELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_RELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4618,20 +3452,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_RELU_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationScaledEluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SCALED_ELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Gamma = ParseFloat32Field(value, "Gamma", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SCALED_ELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SCALED_ELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4640,20 +3460,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SCALED
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationScaledTanhOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SCALED_TANH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SCALED_TANH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SCALED_TANH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4662,18 +3468,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SCALED
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationSigmoidOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SIGMOID_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SIGMOID;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SIGMOID_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4682,18 +3476,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SIGMOI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationSoftmaxOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SOFTMAX_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SOFTMAX;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTMAX_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4702,20 +3484,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTMA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationSoftmax1OperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SOFTMAX1_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->AxisCount = ParseUInt32Field(value, "AxisCount", true);
-    desc->Axes = AsPointer(ParseUInt32ArrayField(value, "Axes", allocator, true));
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SOFTMAX1;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTMAX1_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4724,19 +3492,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTMA
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationSoftplusOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SOFTPLUS_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Steepness = ParseFloat32Field(value, "Steepness", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SOFTPLUS;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTPLUS_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4745,18 +3500,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTPL
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationSoftsignOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SOFTSIGN_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SOFTSIGN;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTSIGN_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4765,18 +3508,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SOFTSI
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationTanhOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_TANH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_TANH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_TANH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4785,19 +3516,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_TANH_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationThresholdedReluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_THRESHOLDED_RELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_THRESHOLDED_RELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4806,20 +3524,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_THRESH
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationShrinkOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SHRINK_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Bias = ParseFloat32Field(value, "Bias", true);
-    desc->Threshold = ParseFloat32Field(value, "Threshold", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SHRINK;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SHRINK_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4828,18 +3532,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SHRINK
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationGeluOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_GELU_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_GELU;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_GELU_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4848,19 +3540,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_GELU_O
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationSwishOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_SWISH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->SigmoidInputScale = ParseFloat32Field(value, "SigmoidInputScale", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_SWISH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SWISH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4869,20 +3548,6 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_SWISH_
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlActivationHardSwishOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
-{
-    if (!value.IsObject()) { throw std::invalid_argument("Expected a valid JSON object."); }
-    auto desc = allocator.Allocate<DML_ACTIVATION_HARD_SWISH_OPERATOR_DESC>();
-    desc->InputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "InputTensor", allocator, true);
-    desc->OutputTensor = fused ? nullptr : ParseDmlTensorDescField(value, "OutputTensor", allocator, true);
-    desc->Alpha = ParseFloat32Field(value, "Alpha", true);
-    desc->Beta = ParseFloat32Field(value, "Beta", true);
-    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();
-    opDesc->Type = DML_OPERATOR_ACTIVATION_HARD_SWISH;
-    opDesc->Desc = desc;
-    return opDesc;
-}
- 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARD_SWISH_OPERATOR_DESC& desc)
 {
     Model::DmlDispatchableDesc::BindPoints bindPoints = {};
@@ -4891,207 +3556,186 @@ Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_ACTIVATION_HARD_S
     return bindPoints;
 }
  
-DML_OPERATOR_DESC* ParseDmlOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)
+static DmlOperatorSchemaInfo GetDmlOperatorSchemaInfo(DML_OPERATOR_TYPE type)
 {
-    if (!value.IsObject())
-    {
-        throw std::invalid_argument("Expected a non-null JSON object.");
-    }
-    auto typeMember = value.FindMember("Type");
-    if (typeMember == value.MemberEnd())
+    switch (type)
     {
-        typeMember = value.FindMember("type");
-    }
-    if (typeMember == value.MemberEnd())
-    {
-        throw std::invalid_argument("Expected a member 'Type' with the operator type.");
-    }
-    if (typeMember->value.GetType() != rapidjson::Type::kStringType)
-    {
-        throw std::invalid_argument("The member 'Type' must be a string.");
-    }
-    auto type = typeMember->value.GetString();
-    auto descMember = value.FindMember("Desc");
-    if (descMember == value.MemberEnd())
-    {
-        descMember = value.FindMember("desc");
+    case DML_OPERATOR_ELEMENT_WISE_IDENTITY: return { &DML_ELEMENT_WISE_IDENTITY_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ABS: return { &DML_ELEMENT_WISE_ABS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ACOS: return { &DML_ELEMENT_WISE_ACOS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ADD: return { &DML_ELEMENT_WISE_ADD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ASIN: return { &DML_ELEMENT_WISE_ASIN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ATAN: return { &DML_ELEMENT_WISE_ATAN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_CEIL: return { &DML_ELEMENT_WISE_CEIL_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_CLIP: return { &DML_ELEMENT_WISE_CLIP_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_CLIP1: return { &DML_ELEMENT_WISE_CLIP1_OPERATOR_SCHEMA, c_dmlElementWiseClip1FieldParsers };
+    case DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD: return { &DML_ELEMENT_WISE_CLIP_GRAD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1: return { &DML_ELEMENT_WISE_CLIP_GRAD1_OPERATOR_SCHEMA, c_dmlElementWiseClipGrad1FieldParsers };
+    case DML_OPERATOR_ELEMENT_WISE_COS: return { &DML_ELEMENT_WISE_COS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_DIVIDE: return { &DML_ELEMENT_WISE_DIVIDE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_EXP: return { &DML_ELEMENT_WISE_EXP_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_FLOOR: return { &DML_ELEMENT_WISE_FLOOR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOG: return { &DML_ELEMENT_WISE_LOG_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND: return { &DML_ELEMENT_WISE_LOGICAL_AND_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS: return { &DML_ELEMENT_WISE_LOGICAL_EQUALS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN: return { &DML_ELEMENT_WISE_LOGICAL_GREATER_THAN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN: return { &DML_ELEMENT_WISE_LOGICAL_LESS_THAN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL: return { &DML_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL: return { &DML_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT: return { &DML_ELEMENT_WISE_LOGICAL_NOT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR: return { &DML_ELEMENT_WISE_LOGICAL_OR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR: return { &DML_ELEMENT_WISE_LOGICAL_XOR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_MAX: return { &DML_ELEMENT_WISE_MAX_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_MEAN: return { &DML_ELEMENT_WISE_MEAN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_MIN: return { &DML_ELEMENT_WISE_MIN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_MULTIPLY: return { &DML_ELEMENT_WISE_MULTIPLY_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_POW: return { &DML_ELEMENT_WISE_POW_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW: return { &DML_ELEMENT_WISE_CONSTANT_POW_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_RECIP: return { &DML_ELEMENT_WISE_RECIP_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_SIN: return { &DML_ELEMENT_WISE_SIN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_SQRT: return { &DML_ELEMENT_WISE_SQRT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE: return { &DML_ELEMENT_WISE_DIFFERENCE_SQUARE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ATAN_YX: return { &DML_ELEMENT_WISE_ATAN_YX_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_SUBTRACT: return { &DML_ELEMENT_WISE_SUBTRACT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_TAN: return { &DML_ELEMENT_WISE_TAN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_THRESHOLD: return { &DML_ELEMENT_WISE_THRESHOLD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR: return { &DML_ELEMENT_WISE_QUANTIZE_LINEAR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR: return { &DML_ELEMENT_WISE_DEQUANTIZE_LINEAR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_CONVOLUTION: return { &DML_CONVOLUTION_OPERATOR_SCHEMA, c_dmlConvolutionFieldParsers };
+    case DML_OPERATOR_GEMM: return { &DML_GEMM_OPERATOR_SCHEMA, c_dmlGemmFieldParsers };
+    case DML_OPERATOR_REDUCE: return { &DML_REDUCE_OPERATOR_SCHEMA, c_dmlReduceFieldParsers };
+    case DML_OPERATOR_ARGMIN: return { &DML_ARGMIN_OPERATOR_SCHEMA, c_dmlArgminFieldParsers };
+    case DML_OPERATOR_ARGMAX: return { &DML_ARGMAX_OPERATOR_SCHEMA, c_dmlArgmaxFieldParsers };
+    case DML_OPERATOR_AVERAGE_POOLING: return { &DML_AVERAGE_POOLING_OPERATOR_SCHEMA, c_dmlAveragePoolingFieldParsers };
+    case DML_OPERATOR_AVERAGE_POOLING1: return { &DML_AVERAGE_POOLING1_OPERATOR_SCHEMA, c_dmlAveragePooling1FieldParsers };
+    case DML_OPERATOR_LP_POOLING: return { &DML_LP_POOLING_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_LP_POOLING1: return { &DML_LP_POOLING1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_MAX_POOLING: return { &DML_MAX_POOLING_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_MAX_POOLING1: return { &DML_MAX_POOLING1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ROI_POOLING: return { &DML_ROI_POOLING_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_SLICE: return { &DML_SLICE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_CAST: return { &DML_CAST_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_SPLIT: return { &DML_SPLIT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_JOIN: return { &DML_JOIN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_PADDING: return { &DML_PADDING_OPERATOR_SCHEMA, c_dmlPaddingFieldParsers };
+    case DML_OPERATOR_PADDING1: return { &DML_PADDING1_OPERATOR_SCHEMA, c_dmlPadding1FieldParsers };
+    case DML_OPERATOR_VALUE_SCALE_2D: return { &DML_VALUE_SCALE_2D_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_UPSAMPLE_2D: return { &DML_UPSAMPLE_2D_OPERATOR_SCHEMA, c_dmlUpsample2dFieldParsers };
+    case DML_OPERATOR_GATHER: return { &DML_GATHER_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_SPACE_TO_DEPTH: return { &DML_SPACE_TO_DEPTH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_DEPTH_TO_SPACE: return { &DML_DEPTH_TO_SPACE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_TILE: return { &DML_TILE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_TOP_K: return { &DML_TOP_K_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_BATCH_NORMALIZATION: return { &DML_BATCH_NORMALIZATION_OPERATOR_SCHEMA, c_dmlBatchNormalizationFieldParsers };
+    case DML_OPERATOR_BATCH_NORMALIZATION_GRAD: return { &DML_BATCH_NORMALIZATION_GRAD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD: return { &DML_BATCH_NORMALIZATION_TRAINING_GRAD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION: return { &DML_MEAN_VARIANCE_NORMALIZATION_OPERATOR_SCHEMA, c_dmlMeanVarianceNormalizationFieldParsers };
+    case DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION: return { &DML_LOCAL_RESPONSE_NORMALIZATION_OPERATOR_SCHEMA, c_dmlLocalResponseNormalizationFieldParsers };
+    case DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD: return { &DML_LOCAL_RESPONSE_NORMALIZATION_GRAD_OPERATOR_SCHEMA, c_dmlLocalResponseNormalizationGradFieldParsers };
+    case DML_OPERATOR_LP_NORMALIZATION: return { &DML_LP_NORMALIZATION_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_RNN: return { &DML_RNN_OPERATOR_SCHEMA, c_dmlRnnFieldParsers };
+    case DML_OPERATOR_LSTM: return { &DML_LSTM_OPERATOR_SCHEMA, c_dmlLstmFieldParsers };
+    case DML_OPERATOR_GRU: return { &DML_GRU_OPERATOR_SCHEMA, c_dmlGruFieldParsers };
+    case DML_OPERATOR_ELEMENT_WISE_SIGN: return { &DML_ELEMENT_WISE_SIGN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_IS_NAN: return { &DML_ELEMENT_WISE_IS_NAN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_NEGATE: return { &DML_ELEMENT_WISE_NEGATE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ERF: return { &DML_ELEMENT_WISE_ERF_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_SINH: return { &DML_ELEMENT_WISE_SINH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_COSH: return { &DML_ELEMENT_WISE_COSH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_TANH: return { &DML_ELEMENT_WISE_TANH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ASINH: return { &DML_ELEMENT_WISE_ASINH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ACOSH: return { &DML_ELEMENT_WISE_ACOSH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ATANH: return { &DML_ELEMENT_WISE_ATANH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_IF: return { &DML_ELEMENT_WISE_IF_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ADD1: return { &DML_ELEMENT_WISE_ADD1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_MAX_UNPOOLING: return { &DML_MAX_UNPOOLING_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_DIAGONAL_MATRIX: return { &DML_DIAGONAL_MATRIX_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_SCATTER: return { &DML_SCATTER_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ONE_HOT: return { &DML_ONE_HOT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_RESAMPLE: return { &DML_RESAMPLE_OPERATOR_SCHEMA, c_dmlResampleFieldParsers };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT: return { &DML_ELEMENT_WISE_BIT_SHIFT_LEFT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT: return { &DML_ELEMENT_WISE_BIT_SHIFT_RIGHT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_ROUND: return { &DML_ELEMENT_WISE_ROUND_OPERATOR_SCHEMA, c_dmlElementWiseRoundFieldParsers };
+    case DML_OPERATOR_ELEMENT_WISE_IS_INFINITY: return { &DML_ELEMENT_WISE_IS_INFINITY_OPERATOR_SCHEMA, c_dmlElementWiseIsInfinityFieldParsers };
+    case DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE: return { &DML_ELEMENT_WISE_MODULUS_TRUNCATE_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR: return { &DML_ELEMENT_WISE_MODULUS_FLOOR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_FILL_VALUE_CONSTANT: return { &DML_FILL_VALUE_CONSTANT_OPERATOR_SCHEMA, c_dmlFillValueConstantFieldParsers };
+    case DML_OPERATOR_FILL_VALUE_SEQUENCE: return { &DML_FILL_VALUE_SEQUENCE_OPERATOR_SCHEMA, c_dmlFillValueSequenceFieldParsers };
+    case DML_OPERATOR_CUMULATIVE_SUMMATION: return { &DML_CUMULATIVE_SUMMATION_OPERATOR_SCHEMA, c_dmlCumulativeSummationFieldParsers };
+    case DML_OPERATOR_CUMULATIVE_PRODUCT: return { &DML_CUMULATIVE_PRODUCT_OPERATOR_SCHEMA, c_dmlCumulativeProductFieldParsers };
+    case DML_OPERATOR_REVERSE_SUBSEQUENCES: return { &DML_REVERSE_SUBSEQUENCES_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_GATHER_ELEMENTS: return { &DML_GATHER_ELEMENTS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_GATHER_ND: return { &DML_GATHER_ND_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_SCATTER_ND: return { &DML_SCATTER_ND_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_MAX_POOLING2: return { &DML_MAX_POOLING2_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_SLICE1: return { &DML_SLICE1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_TOP_K1: return { &DML_TOP_K1_OPERATOR_SCHEMA, c_dmlTopK1FieldParsers };
+    case DML_OPERATOR_DEPTH_TO_SPACE1: return { &DML_DEPTH_TO_SPACE1_OPERATOR_SCHEMA, c_dmlDepthToSpace1FieldParsers };
+    case DML_OPERATOR_SPACE_TO_DEPTH1: return { &DML_SPACE_TO_DEPTH1_OPERATOR_SCHEMA, c_dmlSpaceToDepth1FieldParsers };
+    case DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1: return { &DML_MEAN_VARIANCE_NORMALIZATION1_OPERATOR_SCHEMA, c_dmlMeanVarianceNormalization1FieldParsers };
+    case DML_OPERATOR_RESAMPLE1: return { &DML_RESAMPLE1_OPERATOR_SCHEMA, c_dmlResample1FieldParsers };
+    case DML_OPERATOR_MATRIX_MULTIPLY_INTEGER: return { &DML_MATRIX_MULTIPLY_INTEGER_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY: return { &DML_QUANTIZED_LINEAR_MATRIX_MULTIPLY_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_CONVOLUTION_INTEGER: return { &DML_CONVOLUTION_INTEGER_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION: return { &DML_QUANTIZED_LINEAR_CONVOLUTION_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_AND: return { &DML_ELEMENT_WISE_BIT_AND_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_OR: return { &DML_ELEMENT_WISE_BIT_OR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_XOR: return { &DML_ELEMENT_WISE_BIT_XOR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_NOT: return { &DML_ELEMENT_WISE_BIT_NOT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_BIT_COUNT: return { &DML_ELEMENT_WISE_BIT_COUNT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_RELU_GRAD: return { &DML_ACTIVATION_RELU_GRAD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_AVERAGE_POOLING_GRAD: return { &DML_AVERAGE_POOLING_GRAD_OPERATOR_SCHEMA, c_dmlAveragePoolingGradFieldParsers };
+    case DML_OPERATOR_MAX_POOLING_GRAD: return { &DML_MAX_POOLING_GRAD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_RANDOM_GENERATOR: return { &DML_RANDOM_GENERATOR_OPERATOR_SCHEMA, c_dmlRandomGeneratorFieldParsers };
+    case DML_OPERATOR_NONZERO_COORDINATES: return { &DML_NONZERO_COORDINATES_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_RESAMPLE_GRAD: return { &DML_RESAMPLE_GRAD_OPERATOR_SCHEMA, c_dmlResampleGradFieldParsers };
+    case DML_OPERATOR_SLICE_GRAD: return { &DML_SLICE_GRAD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ADAM_OPTIMIZER: return { &DML_ADAM_OPTIMIZER_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ROI_ALIGN: return { &DML_ROI_ALIGN_OPERATOR_SCHEMA, c_dmlRoiAlignFieldParsers };
+    case DML_OPERATOR_ROI_ALIGN1: return { &DML_ROI_ALIGN1_OPERATOR_SCHEMA, c_dmlRoiAlign1FieldParsers };
+    case DML_OPERATOR_GATHER_ND1: return { &DML_GATHER_ND1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR: return { &DML_DYNAMIC_QUANTIZE_LINEAR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD: return { &DML_ELEMENT_WISE_QUANTIZED_LINEAR_ADD_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ROI_ALIGN_GRAD: return { &DML_ROI_ALIGN_GRAD_OPERATOR_SCHEMA, c_dmlRoiAlignGradFieldParsers };
+    case DML_OPERATOR_BATCH_NORMALIZATION_TRAINING: return { &DML_BATCH_NORMALIZATION_TRAINING_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_RESAMPLE2: return { &DML_RESAMPLE2_OPERATOR_SCHEMA, c_dmlResample2FieldParsers };
+    case DML_OPERATOR_RESAMPLE_GRAD1: return { &DML_RESAMPLE_GRAD1_OPERATOR_SCHEMA, c_dmlResampleGrad1FieldParsers };
+    case DML_OPERATOR_DIAGONAL_MATRIX1: return { &DML_DIAGONAL_MATRIX1_OPERATOR_SCHEMA, c_dmlDiagonalMatrix1FieldParsers };
+    case DML_OPERATOR_MULTIHEAD_ATTENTION: return { &DML_MULTIHEAD_ATTENTION_OPERATOR_SCHEMA, c_dmlMultiheadAttentionFieldParsers };
+    case DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING: return { &DML_QUANTIZED_LINEAR_AVERAGE_POOLING_OPERATOR_SCHEMA, c_dmlQuantizedLinearAveragePoolingFieldParsers };
+    case DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT: return { &DML_MATRIX_MULTIPLY_INTEGER_TO_FLOAT_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2: return { &DML_MEAN_VARIANCE_NORMALIZATION2_OPERATOR_SCHEMA, c_dmlMeanVarianceNormalization2FieldParsers };
+    case DML_OPERATOR_MULTIHEAD_ATTENTION1: return { &DML_MULTIHEAD_ATTENTION1_OPERATOR_SCHEMA, c_dmlMultiheadAttention1FieldParsers };
+    case DML_OPERATOR_QUANTIZE: return { &DML_QUANTIZE_OPERATOR_SCHEMA, c_dmlQuantizeFieldParsers };
+    case DML_OPERATOR_DEQUANTIZE: return { &DML_DEQUANTIZE_OPERATOR_SCHEMA, c_dmlDequantizeFieldParsers };
+    case DML_OPERATOR_ACTIVATION_ELU: return { &DML_ACTIVATION_ELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_CELU: return { &DML_ACTIVATION_CELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_HARDMAX: return { &DML_ACTIVATION_HARDMAX_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_HARDMAX1: return { &DML_ACTIVATION_HARDMAX1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_HARD_SIGMOID: return { &DML_ACTIVATION_HARD_SIGMOID_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_IDENTITY: return { &DML_ACTIVATION_IDENTITY_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_LEAKY_RELU: return { &DML_ACTIVATION_LEAKY_RELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_LINEAR: return { &DML_ACTIVATION_LINEAR_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_LOG_SOFTMAX: return { &DML_ACTIVATION_LOG_SOFTMAX_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1: return { &DML_ACTIVATION_LOG_SOFTMAX1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU: return { &DML_ACTIVATION_PARAMETERIZED_RELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS: return { &DML_ACTIVATION_PARAMETRIC_SOFTPLUS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_RELU: return { &DML_ACTIVATION_RELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SCALED_ELU: return { &DML_ACTIVATION_SCALED_ELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SCALED_TANH: return { &DML_ACTIVATION_SCALED_TANH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SIGMOID: return { &DML_ACTIVATION_SIGMOID_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SOFTMAX: return { &DML_ACTIVATION_SOFTMAX_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SOFTMAX1: return { &DML_ACTIVATION_SOFTMAX1_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SOFTPLUS: return { &DML_ACTIVATION_SOFTPLUS_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SOFTSIGN: return { &DML_ACTIVATION_SOFTSIGN_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_TANH: return { &DML_ACTIVATION_TANH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU: return { &DML_ACTIVATION_THRESHOLDED_RELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SHRINK: return { &DML_ACTIVATION_SHRINK_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_GELU: return { &DML_ACTIVATION_GELU_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_SWISH: return { &DML_ACTIVATION_SWISH_OPERATOR_SCHEMA, nullptr };
+    case DML_OPERATOR_ACTIVATION_HARD_SWISH: return { &DML_ACTIVATION_HARD_SWISH_OPERATOR_SCHEMA, nullptr };
+    default: throw std::invalid_argument("Unknown operator type.");
     }
-    const rapidjson::Value& descValue = descMember != value.MemberEnd() ? descMember->value : value;
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_IDENTITY") || !strcmp(type, "ELEMENT_WISE_IDENTITY")) return ParseDmlElementWiseIdentityOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ABS") || !strcmp(type, "ELEMENT_WISE_ABS")) return ParseDmlElementWiseAbsOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ACOS") || !strcmp(type, "ELEMENT_WISE_ACOS")) return ParseDmlElementWiseAcosOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ADD") || !strcmp(type, "ELEMENT_WISE_ADD")) return ParseDmlElementWiseAddOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ASIN") || !strcmp(type, "ELEMENT_WISE_ASIN")) return ParseDmlElementWiseAsinOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ATAN") || !strcmp(type, "ELEMENT_WISE_ATAN")) return ParseDmlElementWiseAtanOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_CEIL") || !strcmp(type, "ELEMENT_WISE_CEIL")) return ParseDmlElementWiseCeilOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_CLIP") || !strcmp(type, "ELEMENT_WISE_CLIP")) return ParseDmlElementWiseClipOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_CLIP1") || !strcmp(type, "ELEMENT_WISE_CLIP1")) return ParseDmlElementWiseClip1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD") || !strcmp(type, "ELEMENT_WISE_CLIP_GRAD")) return ParseDmlElementWiseClipGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_CLIP_GRAD1") || !strcmp(type, "ELEMENT_WISE_CLIP_GRAD1")) return ParseDmlElementWiseClipGrad1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_COS") || !strcmp(type, "ELEMENT_WISE_COS")) return ParseDmlElementWiseCosOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_DIVIDE") || !strcmp(type, "ELEMENT_WISE_DIVIDE")) return ParseDmlElementWiseDivideOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_EXP") || !strcmp(type, "ELEMENT_WISE_EXP")) return ParseDmlElementWiseExpOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_FLOOR") || !strcmp(type, "ELEMENT_WISE_FLOOR")) return ParseDmlElementWiseFloorOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOG") || !strcmp(type, "ELEMENT_WISE_LOG")) return ParseDmlElementWiseLogOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_AND") || !strcmp(type, "ELEMENT_WISE_LOGICAL_AND")) return ParseDmlElementWiseLogicalAndOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_EQUALS") || !strcmp(type, "ELEMENT_WISE_LOGICAL_EQUALS")) return ParseDmlElementWiseLogicalEqualsOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN") || !strcmp(type, "ELEMENT_WISE_LOGICAL_GREATER_THAN")) return ParseDmlElementWiseLogicalGreaterThanOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN") || !strcmp(type, "ELEMENT_WISE_LOGICAL_LESS_THAN")) return ParseDmlElementWiseLogicalLessThanOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL") || !strcmp(type, "ELEMENT_WISE_LOGICAL_GREATER_THAN_OR_EQUAL")) return ParseDmlElementWiseLogicalGreaterThanOrEqualOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL") || !strcmp(type, "ELEMENT_WISE_LOGICAL_LESS_THAN_OR_EQUAL")) return ParseDmlElementWiseLogicalLessThanOrEqualOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_NOT") || !strcmp(type, "ELEMENT_WISE_LOGICAL_NOT")) return ParseDmlElementWiseLogicalNotOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_OR") || !strcmp(type, "ELEMENT_WISE_LOGICAL_OR")) return ParseDmlElementWiseLogicalOrOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_LOGICAL_XOR") || !strcmp(type, "ELEMENT_WISE_LOGICAL_XOR")) return ParseDmlElementWiseLogicalXorOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_MAX") || !strcmp(type, "ELEMENT_WISE_MAX")) return ParseDmlElementWiseMaxOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_MEAN") || !strcmp(type, "ELEMENT_WISE_MEAN")) return ParseDmlElementWiseMeanOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_MIN") || !strcmp(type, "ELEMENT_WISE_MIN")) return ParseDmlElementWiseMinOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_MULTIPLY") || !strcmp(type, "ELEMENT_WISE_MULTIPLY")) return ParseDmlElementWiseMultiplyOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_POW") || !strcmp(type, "ELEMENT_WISE_POW")) return ParseDmlElementWisePowOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_CONSTANT_POW") || !strcmp(type, "ELEMENT_WISE_CONSTANT_POW")) return ParseDmlElementWiseConstantPowOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_RECIP") || !strcmp(type, "ELEMENT_WISE_RECIP")) return ParseDmlElementWiseRecipOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_SIN") || !strcmp(type, "ELEMENT_WISE_SIN")) return ParseDmlElementWiseSinOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_SQRT") || !strcmp(type, "ELEMENT_WISE_SQRT")) return ParseDmlElementWiseSqrtOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_DIFFERENCE_SQUARE") || !strcmp(type, "ELEMENT_WISE_DIFFERENCE_SQUARE")) return ParseDmlElementWiseDifferenceSquareOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ATAN_YX") || !strcmp(type, "ELEMENT_WISE_ATAN_YX")) return ParseDmlElementWiseAtanYxOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_SUBTRACT") || !strcmp(type, "ELEMENT_WISE_SUBTRACT")) return ParseDmlElementWiseSubtractOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_TAN") || !strcmp(type, "ELEMENT_WISE_TAN")) return ParseDmlElementWiseTanOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_THRESHOLD") || !strcmp(type, "ELEMENT_WISE_THRESHOLD")) return ParseDmlElementWiseThresholdOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_QUANTIZE_LINEAR") || !strcmp(type, "ELEMENT_WISE_QUANTIZE_LINEAR")) return ParseDmlElementWiseQuantizeLinearOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_DEQUANTIZE_LINEAR") || !strcmp(type, "ELEMENT_WISE_DEQUANTIZE_LINEAR")) return ParseDmlElementWiseDequantizeLinearOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_CONVOLUTION") || !strcmp(type, "CONVOLUTION")) return ParseDmlConvolutionOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_GEMM") || !strcmp(type, "GEMM")) return ParseDmlGemmOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_REDUCE") || !strcmp(type, "REDUCE")) return ParseDmlReduceOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ARGMIN") || !strcmp(type, "ARGMIN")) return ParseDmlArgminOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ARGMAX") || !strcmp(type, "ARGMAX")) return ParseDmlArgmaxOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_AVERAGE_POOLING") || !strcmp(type, "AVERAGE_POOLING")) return ParseDmlAveragePoolingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_AVERAGE_POOLING1") || !strcmp(type, "AVERAGE_POOLING1")) return ParseDmlAveragePooling1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_LP_POOLING") || !strcmp(type, "LP_POOLING")) return ParseDmlLpPoolingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_LP_POOLING1") || !strcmp(type, "LP_POOLING1")) return ParseDmlLpPooling1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MAX_POOLING") || !strcmp(type, "MAX_POOLING")) return ParseDmlMaxPoolingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MAX_POOLING1") || !strcmp(type, "MAX_POOLING1")) return ParseDmlMaxPooling1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ROI_POOLING") || !strcmp(type, "ROI_POOLING")) return ParseDmlRoiPoolingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SLICE") || !strcmp(type, "SLICE")) return ParseDmlSliceOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_CAST") || !strcmp(type, "CAST")) return ParseDmlCastOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SPLIT") || !strcmp(type, "SPLIT")) return ParseDmlSplitOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_JOIN") || !strcmp(type, "JOIN")) return ParseDmlJoinOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_PADDING") || !strcmp(type, "PADDING")) return ParseDmlPaddingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_PADDING1") || !strcmp(type, "PADDING1")) return ParseDmlPadding1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_VALUE_SCALE_2D") || !strcmp(type, "VALUE_SCALE_2D")) return ParseDmlValueScale2dOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_UPSAMPLE_2D") || !strcmp(type, "UPSAMPLE_2D")) return ParseDmlUpsample2dOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_GATHER") || !strcmp(type, "GATHER")) return ParseDmlGatherOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SPACE_TO_DEPTH") || !strcmp(type, "SPACE_TO_DEPTH")) return ParseDmlSpaceToDepthOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_DEPTH_TO_SPACE") || !strcmp(type, "DEPTH_TO_SPACE")) return ParseDmlDepthToSpaceOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_TILE") || !strcmp(type, "TILE")) return ParseDmlTileOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_TOP_K") || !strcmp(type, "TOP_K")) return ParseDmlTopKOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_BATCH_NORMALIZATION") || !strcmp(type, "BATCH_NORMALIZATION")) return ParseDmlBatchNormalizationOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_BATCH_NORMALIZATION_GRAD") || !strcmp(type, "BATCH_NORMALIZATION_GRAD")) return ParseDmlBatchNormalizationGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_BATCH_NORMALIZATION_TRAINING_GRAD") || !strcmp(type, "BATCH_NORMALIZATION_TRAINING_GRAD")) return ParseDmlBatchNormalizationTrainingGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION") || !strcmp(type, "MEAN_VARIANCE_NORMALIZATION")) return ParseDmlMeanVarianceNormalizationOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION") || !strcmp(type, "LOCAL_RESPONSE_NORMALIZATION")) return ParseDmlLocalResponseNormalizationOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_LOCAL_RESPONSE_NORMALIZATION_GRAD") || !strcmp(type, "LOCAL_RESPONSE_NORMALIZATION_GRAD")) return ParseDmlLocalResponseNormalizationGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_LP_NORMALIZATION") || !strcmp(type, "LP_NORMALIZATION")) return ParseDmlLpNormalizationOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RNN") || !strcmp(type, "RNN")) return ParseDmlRnnOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_LSTM") || !strcmp(type, "LSTM")) return ParseDmlLstmOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_GRU") || !strcmp(type, "GRU")) return ParseDmlGruOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_SIGN") || !strcmp(type, "ELEMENT_WISE_SIGN")) return ParseDmlElementWiseSignOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_IS_NAN") || !strcmp(type, "ELEMENT_WISE_IS_NAN")) return ParseDmlElementWiseIsNanOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_NEGATE") || !strcmp(type, "ELEMENT_WISE_NEGATE")) return ParseDmlElementWiseNegateOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ERF") || !strcmp(type, "ELEMENT_WISE_ERF")) return ParseDmlElementWiseErfOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_SINH") || !strcmp(type, "ELEMENT_WISE_SINH")) return ParseDmlElementWiseSinhOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_COSH") || !strcmp(type, "ELEMENT_WISE_COSH")) return ParseDmlElementWiseCoshOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_TANH") || !strcmp(type, "ELEMENT_WISE_TANH")) return ParseDmlElementWiseTanhOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ASINH") || !strcmp(type, "ELEMENT_WISE_ASINH")) return ParseDmlElementWiseAsinhOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ACOSH") || !strcmp(type, "ELEMENT_WISE_ACOSH")) return ParseDmlElementWiseAcoshOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ATANH") || !strcmp(type, "ELEMENT_WISE_ATANH")) return ParseDmlElementWiseAtanhOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_IF") || !strcmp(type, "ELEMENT_WISE_IF")) return ParseDmlElementWiseIfOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ADD1") || !strcmp(type, "ELEMENT_WISE_ADD1")) return ParseDmlElementWiseAdd1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MAX_UNPOOLING") || !strcmp(type, "MAX_UNPOOLING")) return ParseDmlMaxUnpoolingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_DIAGONAL_MATRIX") || !strcmp(type, "DIAGONAL_MATRIX")) return ParseDmlDiagonalMatrixOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SCATTER") || !strcmp(type, "SCATTER")) return ParseDmlScatterOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ONE_HOT") || !strcmp(type, "ONE_HOT")) return ParseDmlOneHotOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RESAMPLE") || !strcmp(type, "RESAMPLE")) return ParseDmlResampleOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_LEFT") || !strcmp(type, "ELEMENT_WISE_BIT_SHIFT_LEFT")) return ParseDmlElementWiseBitShiftLeftOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_SHIFT_RIGHT") || !strcmp(type, "ELEMENT_WISE_BIT_SHIFT_RIGHT")) return ParseDmlElementWiseBitShiftRightOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_ROUND") || !strcmp(type, "ELEMENT_WISE_ROUND")) return ParseDmlElementWiseRoundOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_IS_INFINITY") || !strcmp(type, "ELEMENT_WISE_IS_INFINITY")) return ParseDmlElementWiseIsInfinityOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_MODULUS_TRUNCATE") || !strcmp(type, "ELEMENT_WISE_MODULUS_TRUNCATE")) return ParseDmlElementWiseModulusTruncateOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_MODULUS_FLOOR") || !strcmp(type, "ELEMENT_WISE_MODULUS_FLOOR")) return ParseDmlElementWiseModulusFloorOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_FILL_VALUE_CONSTANT") || !strcmp(type, "FILL_VALUE_CONSTANT")) return ParseDmlFillValueConstantOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_FILL_VALUE_SEQUENCE") || !strcmp(type, "FILL_VALUE_SEQUENCE")) return ParseDmlFillValueSequenceOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_CUMULATIVE_SUMMATION") || !strcmp(type, "CUMULATIVE_SUMMATION")) return ParseDmlCumulativeSummationOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_CUMULATIVE_PRODUCT") || !strcmp(type, "CUMULATIVE_PRODUCT")) return ParseDmlCumulativeProductOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_REVERSE_SUBSEQUENCES") || !strcmp(type, "REVERSE_SUBSEQUENCES")) return ParseDmlReverseSubsequencesOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_GATHER_ELEMENTS") || !strcmp(type, "GATHER_ELEMENTS")) return ParseDmlGatherElementsOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_GATHER_ND") || !strcmp(type, "GATHER_ND")) return ParseDmlGatherNdOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SCATTER_ND") || !strcmp(type, "SCATTER_ND")) return ParseDmlScatterNdOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MAX_POOLING2") || !strcmp(type, "MAX_POOLING2")) return ParseDmlMaxPooling2OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SLICE1") || !strcmp(type, "SLICE1")) return ParseDmlSlice1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_TOP_K1") || !strcmp(type, "TOP_K1")) return ParseDmlTopK1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_DEPTH_TO_SPACE1") || !strcmp(type, "DEPTH_TO_SPACE1")) return ParseDmlDepthToSpace1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SPACE_TO_DEPTH1") || !strcmp(type, "SPACE_TO_DEPTH1")) return ParseDmlSpaceToDepth1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION1") || !strcmp(type, "MEAN_VARIANCE_NORMALIZATION1")) return ParseDmlMeanVarianceNormalization1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RESAMPLE1") || !strcmp(type, "RESAMPLE1")) return ParseDmlResample1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MATRIX_MULTIPLY_INTEGER") || !strcmp(type, "MATRIX_MULTIPLY_INTEGER")) return ParseDmlMatrixMultiplyIntegerOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_QUANTIZED_LINEAR_MATRIX_MULTIPLY") || !strcmp(type, "QUANTIZED_LINEAR_MATRIX_MULTIPLY")) return ParseDmlQuantizedLinearMatrixMultiplyOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_CONVOLUTION_INTEGER") || !strcmp(type, "CONVOLUTION_INTEGER")) return ParseDmlConvolutionIntegerOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_QUANTIZED_LINEAR_CONVOLUTION") || !strcmp(type, "QUANTIZED_LINEAR_CONVOLUTION")) return ParseDmlQuantizedLinearConvolutionOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_AND") || !strcmp(type, "ELEMENT_WISE_BIT_AND")) return ParseDmlElementWiseBitAndOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_OR") || !strcmp(type, "ELEMENT_WISE_BIT_OR")) return ParseDmlElementWiseBitOrOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_XOR") || !strcmp(type, "ELEMENT_WISE_BIT_XOR")) return ParseDmlElementWiseBitXorOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_NOT") || !strcmp(type, "ELEMENT_WISE_BIT_NOT")) return ParseDmlElementWiseBitNotOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_BIT_COUNT") || !strcmp(type, "ELEMENT_WISE_BIT_COUNT")) return ParseDmlElementWiseBitCountOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_RELU_GRAD") || !strcmp(type, "ACTIVATION_RELU_GRAD")) return ParseDmlActivationReluGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_AVERAGE_POOLING_GRAD") || !strcmp(type, "AVERAGE_POOLING_GRAD")) return ParseDmlAveragePoolingGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MAX_POOLING_GRAD") || !strcmp(type, "MAX_POOLING_GRAD")) return ParseDmlMaxPoolingGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RANDOM_GENERATOR") || !strcmp(type, "RANDOM_GENERATOR")) return ParseDmlRandomGeneratorOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_NONZERO_COORDINATES") || !strcmp(type, "NONZERO_COORDINATES")) return ParseDmlNonzeroCoordinatesOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RESAMPLE_GRAD") || !strcmp(type, "RESAMPLE_GRAD")) return ParseDmlResampleGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_SLICE_GRAD") || !strcmp(type, "SLICE_GRAD")) return ParseDmlSliceGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ADAM_OPTIMIZER") || !strcmp(type, "ADAM_OPTIMIZER")) return ParseDmlAdamOptimizerOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ROI_ALIGN") || !strcmp(type, "ROI_ALIGN")) return ParseDmlRoiAlignOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ROI_ALIGN1") || !strcmp(type, "ROI_ALIGN1")) return ParseDmlRoiAlign1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_GATHER_ND1") || !strcmp(type, "GATHER_ND1")) return ParseDmlGatherNd1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_DYNAMIC_QUANTIZE_LINEAR") || !strcmp(type, "DYNAMIC_QUANTIZE_LINEAR")) return ParseDmlDynamicQuantizeLinearOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ELEMENT_WISE_QUANTIZED_LINEAR_ADD") || !strcmp(type, "ELEMENT_WISE_QUANTIZED_LINEAR_ADD")) return ParseDmlElementWiseQuantizedLinearAddOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ROI_ALIGN_GRAD") || !strcmp(type, "ROI_ALIGN_GRAD")) return ParseDmlRoiAlignGradOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_BATCH_NORMALIZATION_TRAINING") || !strcmp(type, "BATCH_NORMALIZATION_TRAINING")) return ParseDmlBatchNormalizationTrainingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RESAMPLE2") || !strcmp(type, "RESAMPLE2")) return ParseDmlResample2OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_RESAMPLE_GRAD1") || !strcmp(type, "RESAMPLE_GRAD1")) return ParseDmlResampleGrad1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_DIAGONAL_MATRIX1") || !strcmp(type, "DIAGONAL_MATRIX1")) return ParseDmlDiagonalMatrix1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MULTIHEAD_ATTENTION") || !strcmp(type, "MULTIHEAD_ATTENTION")) return ParseDmlMultiheadAttentionOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_QUANTIZED_LINEAR_AVERAGE_POOLING") || !strcmp(type, "QUANTIZED_LINEAR_AVERAGE_POOLING")) return ParseDmlQuantizedLinearAveragePoolingOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MATRIX_MULTIPLY_INTEGER_TO_FLOAT") || !strcmp(type, "MATRIX_MULTIPLY_INTEGER_TO_FLOAT")) return ParseDmlMatrixMultiplyIntegerToFloatOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MEAN_VARIANCE_NORMALIZATION2") || !strcmp(type, "MEAN_VARIANCE_NORMALIZATION2")) return ParseDmlMeanVarianceNormalization2OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_MULTIHEAD_ATTENTION1") || !strcmp(type, "MULTIHEAD_ATTENTION1")) return ParseDmlMultiheadAttention1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_QUANTIZE") || !strcmp(type, "QUANTIZE")) return ParseDmlQuantizeOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_DEQUANTIZE") || !strcmp(type, "DEQUANTIZE")) return ParseDmlDequantizeOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_ELU") || !strcmp(type, "ACTIVATION_ELU")) return ParseDmlActivationEluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_CELU") || !strcmp(type, "ACTIVATION_CELU")) return ParseDmlActivationCeluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_HARDMAX") || !strcmp(type, "ACTIVATION_HARDMAX")) return ParseDmlActivationHardmaxOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_HARDMAX1") || !strcmp(type, "ACTIVATION_HARDMAX1")) return ParseDmlActivationHardmax1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_HARD_SIGMOID") || !strcmp(type, "ACTIVATION_HARD_SIGMOID")) return ParseDmlActivationHardSigmoidOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_IDENTITY") || !strcmp(type, "ACTIVATION_IDENTITY")) return ParseDmlActivationIdentityOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_LEAKY_RELU") || !strcmp(type, "ACTIVATION_LEAKY_RELU")) return ParseDmlActivationLeakyReluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_LINEAR") || !strcmp(type, "ACTIVATION_LINEAR")) return ParseDmlActivationLinearOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_LOG_SOFTMAX") || !strcmp(type, "ACTIVATION_LOG_SOFTMAX")) return ParseDmlActivationLogSoftmaxOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_LOG_SOFTMAX1") || !strcmp(type, "ACTIVATION_LOG_SOFTMAX1")) return ParseDmlActivationLogSoftmax1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_PARAMETERIZED_RELU") || !strcmp(type, "ACTIVATION_PARAMETERIZED_RELU")) return ParseDmlActivationParameterizedReluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_PARAMETRIC_SOFTPLUS") || !strcmp(type, "ACTIVATION_PARAMETRIC_SOFTPLUS")) return ParseDmlActivationParametricSoftplusOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_RELU") || !strcmp(type, "ACTIVATION_RELU")) return ParseDmlActivationReluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SCALED_ELU") || !strcmp(type, "ACTIVATION_SCALED_ELU")) return ParseDmlActivationScaledEluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SCALED_TANH") || !strcmp(type, "ACTIVATION_SCALED_TANH")) return ParseDmlActivationScaledTanhOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SIGMOID") || !strcmp(type, "ACTIVATION_SIGMOID")) return ParseDmlActivationSigmoidOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SOFTMAX") || !strcmp(type, "ACTIVATION_SOFTMAX")) return ParseDmlActivationSoftmaxOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SOFTMAX1") || !strcmp(type, "ACTIVATION_SOFTMAX1")) return ParseDmlActivationSoftmax1OperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SOFTPLUS") || !strcmp(type, "ACTIVATION_SOFTPLUS")) return ParseDmlActivationSoftplusOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SOFTSIGN") || !strcmp(type, "ACTIVATION_SOFTSIGN")) return ParseDmlActivationSoftsignOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_TANH") || !strcmp(type, "ACTIVATION_TANH")) return ParseDmlActivationTanhOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_THRESHOLDED_RELU") || !strcmp(type, "ACTIVATION_THRESHOLDED_RELU")) return ParseDmlActivationThresholdedReluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SHRINK") || !strcmp(type, "ACTIVATION_SHRINK")) return ParseDmlActivationShrinkOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_GELU") || !strcmp(type, "ACTIVATION_GELU")) return ParseDmlActivationGeluOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_SWISH") || !strcmp(type, "ACTIVATION_SWISH")) return ParseDmlActivationSwishOperatorDesc(descValue, fused, allocator);
-    if (!strcmp(type, "DML_OPERATOR_ACTIVATION_HARD_SWISH") || !strcmp(type, "ACTIVATION_HARD_SWISH")) return ParseDmlActivationHardSwishOperatorDesc(descValue, fused, allocator);
-    throw std::invalid_argument("Unknown operator type.");
 }
 
 Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_OPERATOR_DESC& desc)
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Counts durations in log-linear buckets, in the style of an HDR histogram, so percentiles of any number of
+// samples can be computed in constant memory. Values are quantized to a resolution (1 ns for durations in
+// milliseconds) and then bucketed by their top precisionBits + 1 significant bits: every power-of-two range
+// [2^k, 2^(k+1)) is split into 2^precisionBits equal buckets. A percentile is reported as the middle of its
+// bucket, so it's within 2^-(precisionBits + 1) of the true value relative to it (0.4% with the default of 7
+// bits), or within one resolution step for tiny values. The count, sum, min, max, and standard deviation are exact.
+//
+// Recording is O(1). The buckets grow with the largest value recorded, up to (65 - precisionBits) * 2^precisionBits
+// counters (58 KB with the default precision) for values near 2^64 resolution steps. Histograms with the same
+// precision and resolution can be merged, e.g. after each thread records its own, or compared (TestForSlowdown).
+class LatencyHistogram
+{
+public:
+    explicit LatencyHistogram(uint32_t precisionBits = 7, double resolution = 1e-6) :
+        m_precisionBits(precisionBits),
+        m_resolution(resolution)
+    {
+        if (precisionBits < 1 || precisionBits > 16)
+        {
+            throw std::invalid_argument("LatencyHistogram precision must be between 1 and 16 bits.");
+        }
+        if (!(resolution > 0) || !std::isfinite(resolution))
+        {
+            throw std::invalid_argument("LatencyHistogram resolution must be positive and finite.");
+        }
+    }
+
+    // Records a value count times (e.g. to rebuild a histogram from its buckets).
+    void Record(double value, uint64_t count = 1)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const size_t bucketIndex = GetBucketIndex(Quantize(value));
+        if (bucketIndex >= m_bucketCounts.size())
+        {
+            m_bucketCounts.resize(bucketIndex + 1);
+        }
+        m_bucketCounts[bucketIndex] += count;
+
+        if (m_count == 0)
+        {
+            m_min = value;
+            m_max = value;
+        }
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+        m_sum += value * count;
+
+        // Welford's update (for count equal values), which doesn't lose precision the way a sum of squares does.
+        const double delta = value - m_mean;
+        const double totalCount = static_cast<double>(m_count + count);
+        m_sumOfSquaredDeviations += delta * delta * m_count * count / totalCount;
+        m_mean += delta * count / totalCount;
+        m_count += count;
+    }
+
+    void Merge(const LatencyHistogram& other)
+    {
+        if (other.m_precisionBits != m_precisionBits || other.m_resolution != m_resolution)
+        {
+            throw std::invalid_argument("Only histograms with the same precision and resolution can be merged.");
+        }
+        if (other.m_count == 0)
+        {
+            return;
+        }
+
+        if (other.m_bucketCounts.size() > m_bucketCounts.size())
+        {
+            m_bucketCounts.resize(other.m_bucketCounts.size());
+        }
+        for (size_t i = 0; i < other.m_bucketCounts.size(); i++)
+        {
+            m_bucketCounts[i] += other.m_bucketCounts[i];
+        }
+
+        m_min = (m_count == 0) ? other.m_min : std::min(m_min, other.m_min);
+        m_max = (m_count == 0) ? other.m_max : std::max(m_max, other.m_max);
+        m_sum += other.m_sum;
+
+        // Chan et al.'s combination of two Welford accumulators.
+        const double delta = other.m_mean - m_mean;
+        const double totalCount = static_cast<double>(m_count + other.m_count);
+        m_sumOfSquaredDeviations += other.m_sumOfSquaredDeviations + delta * delta * m_count * other.m_count / totalCount;
+        m_mean += delta * other.m_count / totalCount;
+        m_count += other.m_count;
+    }
+
+    uint32_t PrecisionBits() const { return m_precisionBits; }
+    double Resolution() const { return m_resolution; }
+
+    uint64_t Count() const { return m_count; }
+    double Sum() const { return m_sum; }
+    double Average() const { return m_count ? m_sum / m_count : 0.0; }
+    double Min() const { return m_min; }
+    double Max() const { return m_max; }
+
+    // The population standard deviation.
+    double StandardDeviation() const { return m_count ? std::sqrt(m_sumOfSquaredDeviations / m_count) : 0.0; }
+
+    // Returns the value below which the given fraction (0 to 1) of the recorded values fall, e.g. 0.99 for
+    // the 99th percentile. Returns 0 if nothing was recorded.
+    double Percentile(double fraction) const
+    {
+        if (m_count == 0)
+        {
+            return 0.0;
+        }
+
+        // The 1-based rank of the value in sorted order; a fraction of 0 is the smallest value and 1 the largest.
+        const double clampedFraction = std::clamp(fraction, 0.0, 1.0);
+        const uint64_t rank = std::clamp<uint64_t>(static_cast<uint64_t>(std::ceil(clampedFraction * m_count)), 1, m_count);
+
+        if (rank == 1)
+        {
+            return m_min;
+        }
+        if (rank == m_count)
+        {
+            return m_max;
+        }
+
+        uint64_t countBelow = 0;
+        for (size_t i = 0; i < m_bucketCounts.size(); i++)
+        {
+            countBelow += m_bucketCounts[i];
+            if (countBelow >= rank)
+            {
+                return std::clamp(GetBucketMidpoint(i) * m_resolution, m_min, m_max);
+            }
+        }
+        return m_max;
+    }
+
+    struct Bucket
+    {
+        double value;
+        uint64_t count;
+    };
+
+    // Returns the non-empty buckets in increasing order, each with the value a percentile in it would report.
+    std::vector<Bucket> GetBuckets() const
+    {
+        std::vector<Bucket> buckets;
+        for (size_t i = 0; i < m_bucketCounts.size(); i++)
+        {
+            if (m_bucketCounts[i] != 0)
+            {
+                buckets.push_back({std::clamp(GetBucketMidpoint(i) * m_resolution, m_min, m_max), m_bucketCounts[i]});
+            }
+        }
+        return buckets;
+    }
+
+    struct SlowdownTestResult
+    {
+        // The one-sided p-value: how likely a difference this large would be if current weren't slower.
+        double pValue;
+
+        // The probability that a value from current exceeds one from baseline (ties count half); 0.5 if neither
+        // tends to be larger.
+        double probabilityOfSlower;
+    };
+
+    // Tests whether the values in current tend to be larger than those in baseline with a Mann-Whitney U test,
+    // using the normal approximation with a correction for ties (values in the same bucket are tied). The test
+    // makes no assumption about the shape of the distributions, which are rarely normal for timings. Both
+    // histograms must have the same precision and resolution.
+    static SlowdownTestResult TestForSlowdown(const LatencyHistogram& baseline, const LatencyHistogram& current)
+    {
+        if (baseline.m_precisionBits != current.m_precisionBits || baseline.m_resolution != current.m_resolution)
+        {
+            throw std::invalid_argument("Only histograms with the same precision and resolution can be compared.");
+        }
+
+        const double baselineCount = static_cast<double>(baseline.m_count);
+        const double currentCount = static_cast<double>(current.m_count);
+        const double totalCount = baselineCount + currentCount;
+        if (baseline.m_count == 0 || current.m_count == 0)
+        {
+            return { 1.0, 0.5 };
+        }
+
+        // Sum the ranks of the current values; tied values share the average of their ranks.
+        double currentRankSum = 0;
+        double tieCorrection = 0;
+        double lowerCount = 0;
+        const size_t bucketCount = std::max(baseline.m_bucketCounts.size(), current.m_bucketCounts.size());
+        for (size_t i = 0; i < bucketCount; i++)
+        {
+            const double a = i < baseline.m_bucketCounts.size() ? static_cast<double>(baseline.m_bucketCounts[i]) : 0;
+            const double b = i < current.m_bucketCounts.size() ? static_cast<double>(current.m_bucketCounts[i]) : 0;
+            const double tiedCount = a + b;
+            currentRankSum += b * (lowerCount + (tiedCount + 1) / 2);
+            tieCorrection += tiedCount * tiedCount * tiedCount - tiedCount;
+            lowerCount += tiedCount;
+        }
+
+        const double u = currentRankSum - currentCount * (currentCount + 1) / 2;
+        const double meanU = baselineCount * currentCount / 2;
+        const double varianceU = baselineCount * currentCount / 12 *
+            ((totalCount + 1) - tieCorrection / (totalCount * (totalCount - 1)));
+
+        SlowdownTestResult result = { 1.0, u / (baselineCount * currentCount) };
+        if (varianceU > 0)
+        {
+            // The 0.5 is a continuity correction, since U only takes discrete values.
+            const double z = (u - meanU - 0.5) / std::sqrt(varianceU);
+            result.pValue = std::min(1.0, 0.5 * std::erfc(z / std::sqrt(2.0)));
+        }
+        return result;
+    }
+
+private:
+    uint64_t Quantize(double value) const
+    {
+        // Negative and NaN values count as 0, and values too large for 64 bits as the largest.
+        const double steps = std::round(value / m_resolution);
+        if (!(steps > 0))
+        {
+            return 0;
+        }
+        if (steps >= 18446744073709551615.0)
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return static_cast<uint64_t>(steps);
+    }
+
+    static uint32_t GetHighestBitIndex(uint64_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return index;
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    // Values below 2^precisionBits get a bucket each. Above that, a value with its highest bit at index k is
+    // in the bucket of its top precisionBits + 1 bits, after the 2^precisionBits buckets of each lower k.
+    size_t GetBucketIndex(uint64_t value) const
+    {
+        const uint64_t subBucketCount = uint64_t(1) << m_precisionBits;
+        if (value < subBucketCount)
+        {
+            return static_cast<size_t>(value);
+        }
+        const uint32_t shift = GetHighestBitIndex(value) - m_precisionBits;
+        return static_cast<size_t>((shift + 1) * subBucketCount + ((value >> shift) - subBucketCount));
+    }
+
+    double GetBucketMidpoint(size_t bucketIndex) const
+    {
+        const uint64_t subBucketCount = uint64_t(1) << m_precisionBits;
+        if (bucketIndex < subBucketCount)
+        {
+            return static_cast<double>(bucketIndex);
+        }
+        const uint32_t shift = static_cast<uint32_t>(bucketIndex / subBucketCount) - 1;
+        const uint64_t topBits = subBucketCount + bucketIndex % subBucketCount;
+        const double lowest = std::ldexp(static_cast<double>(topBits), shift);
+        return lowest + (std::ldexp(1.0, shift) - 1) / 2;
+    }
+
+    uint32_t m_precisionBits;
+    double m_resolution;
+    std::vector<uint64_t> m_bucketCounts;
+    uint64_t m_count = 0;
+    double m_sum = 0;
+    double m_min = 0;
+    double m_max = 0;
+    double m_mean = 0;
+    double m_sumOfSquaredDeviations = 0;
+};
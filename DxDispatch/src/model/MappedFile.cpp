@@ -0,0 +1,101 @@
+#include "pch.h"
+#include "MappedFile.h"
+
+#ifdef WIN32
+#include <wil/resource.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::filesystem::path& path)
+{
+    // The constructor is private, so make_shared can't be used.
+    std::shared_ptr<MappedFile> mappedFile(new MappedFile());
+    mappedFile->m_path = path;
+
+#ifdef WIN32
+    wil::unique_hfile file(CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+    if (!file)
+    {
+        throw std::ios::failure(fmt::format("Given filename '{}' could not be opened.", path.string()));
+    }
+
+    LARGE_INTEGER fileSize;
+    THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(file.get(), &fileSize));
+
+    // Empty files can't be mapped; they simply have no data.
+    if (fileSize.QuadPart > 0)
+    {
+        wil::unique_handle mapping(CreateFileMappingW(file.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+        THROW_LAST_ERROR_IF_NULL(mapping.get());
+
+        void* data = MapViewOfFile(mapping.get(), FILE_MAP_COPY, 0, 0, 0);
+        THROW_LAST_ERROR_IF_NULL(data);
+
+        mappedFile->m_data = static_cast<std::byte*>(data);
+        mappedFile->m_sizeInBytes = static_cast<size_t>(fileSize.QuadPart);
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::ios::failure(fmt::format("Given filename '{}' could not be opened.", path.string()));
+    }
+
+    struct stat fileStatus = {};
+    if (fstat(fd, &fileStatus) != 0)
+    {
+        close(fd);
+        throw std::ios::failure(fmt::format("Given filename '{}' could not be read.", path.string()));
+    }
+
+    if (fileStatus.st_size > 0)
+    {
+        void* data = mmap(nullptr, fileStatus.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw std::ios::failure(fmt::format("Given filename '{}' could not be mapped.", path.string()));
+        }
+
+        mappedFile->m_data = static_cast<std::byte*>(data);
+        mappedFile->m_sizeInBytes = static_cast<size_t>(fileStatus.st_size);
+    }
+
+    // The mapping keeps its own reference to the file.
+    close(fd);
+#endif
+
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+#ifdef WIN32
+        (void)UnmapViewOfFile(m_data);
+#else
+        (void)munmap(m_data, m_sizeInBytes);
+#endif
+    }
+}
+
+ByteBuffer::ByteBuffer(std::shared_ptr<MappedFile> file, size_t offset, size_t sizeInBytes) :
+    m_file(std::move(file))
+{
+    auto fileData = m_file->GetData();
+    if (offset > fileData.size() || sizeInBytes > fileData.size() - offset)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Range [{}, {}) is outside of file '{}' ({} bytes).",
+            offset,
+            offset + sizeInBytes,
+            m_file->GetPath().string(),
+            fileData.size()));
+    }
+    m_fileBytes = fileData.subspan(offset, sizeInBytes);
+}
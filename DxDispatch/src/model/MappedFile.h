@@ -0,0 +1,101 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <gsl/gsl>
+
+// A view of an entire file, mapped into the address space of the process. Pages are only read from disk
+// when first touched, so mapping a large file is cheap until its contents are actually used. The view is
+// copy-on-write: it may be modified, but changes are private to the process and never reach the file.
+class MappedFile
+{
+public:
+    // Maps the file at the given path. Throws if the file can't be opened or mapped.
+    static std::shared_ptr<MappedFile> Open(const std::filesystem::path& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    gsl::span<std::byte> GetData() const { return { m_data, m_sizeInBytes }; }
+    const std::filesystem::path& GetPath() const { return m_path; }
+
+private:
+    MappedFile() = default;
+
+private:
+    std::filesystem::path m_path;
+    std::byte* m_data = nullptr;
+    size_t m_sizeInBytes = 0;
+};
+
+// Bytes that are either owned (e.g. values generated from JSON) or a range within a MappedFile. File-backed
+// bytes are never copied by the parser; they are read straight from the mapping when consumed (e.g. when
+// uploaded to a GPU buffer). Copying a ByteBuffer that references a file only copies the reference, so
+// writes through one copy are visible in the others. Owned bytes are shared between copies until one of
+// them is modified (copy-on-write), which lets resources with identical contents share a single copy. The
+// interface mirrors the parts of std::vector<std::byte> used for resource data.
+class ByteBuffer
+{
+public:
+    ByteBuffer() = default;
+    ByteBuffer(std::vector<std::byte>&& bytes) : m_bytes(std::make_shared<std::vector<std::byte>>(std::move(bytes))) {}
+    ByteBuffer(std::shared_ptr<MappedFile> file, size_t offset, size_t sizeInBytes);
+
+    ByteBuffer& operator=(std::vector<std::byte>&& bytes)
+    {
+        m_bytes = std::make_shared<std::vector<std::byte>>(std::move(bytes));
+        m_file.reset();
+        m_fileBytes = {};
+        return *this;
+    }
+
+    const std::byte* data() const { return m_file ? m_fileBytes.data() : m_bytes ? m_bytes->data() : nullptr; }
+    std::byte* data() { return m_file ? m_fileBytes.data() : MutableBytes(); }
+    size_t size() const { return m_file ? m_fileBytes.size() : m_bytes ? m_bytes->size() : 0; }
+    bool empty() const { return size() == 0; }
+
+    const std::byte* begin() const { return data(); }
+    const std::byte* end() const { return data() + size(); }
+    std::byte* begin() { return data(); }
+    std::byte* end() { return data() + size(); }
+
+    const std::byte& operator[](size_t index) const { return data()[index]; }
+    std::byte& operator[](size_t index) { return data()[index]; }
+
+    void clear()
+    {
+        m_bytes.reset();
+        m_file.reset();
+        m_fileBytes = {};
+    }
+
+    // Returns the mapped file that holds the bytes, or null if the bytes are owned.
+    const std::shared_ptr<MappedFile>& GetFile() const { return m_file; }
+
+    // Returns true if both buffers refer to the same bytes (not merely equal bytes).
+    bool SharesBytesWith(const ByteBuffer& other) const
+    {
+        return !empty() && data() == other.data() && size() == other.size();
+    }
+
+private:
+    std::byte* MutableBytes()
+    {
+        if (!m_bytes)
+        {
+            return nullptr;
+        }
+        if (m_bytes.use_count() > 1)
+        {
+            m_bytes = std::make_shared<std::vector<std::byte>>(*m_bytes);
+        }
+        return m_bytes->data();
+    }
+
+private:
+    std::shared_ptr<std::vector<std::byte>> m_bytes;
+    std::shared_ptr<MappedFile> m_file;
+    gsl::span<std::byte> m_fileBytes;
+};
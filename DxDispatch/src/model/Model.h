@@ -9,6 +9,7 @@
 #include <gsl/gsl>
 #include <DirectML.h>
 #include "BucketAllocator.h"
+#include "MappedFile.h"
 
 class Model
 {
@@ -41,10 +42,12 @@ public:
     struct BufferDesc
     {
         uint64_t sizeInBytes;
-        std::vector<std::byte> initialValues;
+        ByteBuffer initialValues; // May reference a memory-mapped file.
         DML_TENSOR_DATA_TYPE initialValuesDataType;
         uint64_t initialValuesOffsetInBytes;
         bool useDeferredBinding;
+        std::filesystem::path sourcePath; // Set when initialValues were loaded from a file.
+        std::vector<std::filesystem::path> sourceImagePaths; // The image in each slot of a batch, when sourcePath is a directory or wildcard pattern.
     };
 
     // Texture resource description (moved out of ResourceDesc)
@@ -53,8 +56,9 @@ public:
         uint32_t width;
         uint32_t height;
         DXGI_FORMAT format;                 // e.g. DXGI_FORMAT_R8G8B8A8_UNORM
-        std::vector<std::byte> initialData; // Optional initial texel data (row-major, tightly packed)
+        ByteBuffer initialData;             // Optional initial texel data (row-major, tightly packed)
         bool useDeferredBinding = false;    // For parity with buffers (not yet implemented for textures)
+        std::filesystem::path sourcePath;   // Set when initialData was loaded from a file.
     };
     
     // Sampler description (moved out of ResourceDesc)
@@ -170,7 +174,7 @@ public:
     {
         std::string resourceName;
         std::string targetPath;
-        std::vector<uint32_t> dimensions; // The resources don't store their dimensions. So repeat them here.
+        std::vector<uint64_t> dimensions; // The resources don't store their dimensions. So repeat them here.
     };
 
     using Command = std::variant<DispatchCommand, PrintCommand, WriteFileCommand>;
@@ -198,6 +202,7 @@ public:
     gsl::span<const ResourceDesc> GetResourceDescs() const { return m_resourceDescs; }
     gsl::span<const DispatchableDesc> GetDispatchableDescs() const { return m_dispatchableDescs; }
     gsl::span<const CommandDesc> GetCommands() const { return m_commands; }
+    const BucketAllocator& GetAllocator() const { return m_allocator; }
 
     const ResourceDesc& GetResource(std::string_view name) const { return *m_resourceDescsByName.find(name.data())->second; }
     const DispatchableDesc& GetDispatchable(std::string_view name) const { return *m_dispatchableDescsByName.find(name.data())->second; }
@@ -1,6 +1,23 @@
 #include "pch.h"
 #include "JsonParsers.h"
 #include "StdSupport.h"
+#include "SafeArithmetic.h"
+#include "ParallelFor.h"
+#include "CpuFeatures.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define NPY_SSE2
+#endif
+#if defined(NPY_SSE2) && defined(CPU_FEATURES_X86)
+// SSSE3 and AVX2 are detected at runtime (see CpuFeatures.h).
+#include <immintrin.h>
+#define NPY_SSSE3
+#endif
+#if defined(_M_ARM64) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NPY_NEON
+#endif
 
 ////////////////////////////////////////
 // Generic helpers
@@ -104,9 +121,9 @@ uint32_t GetByteSizeFromDataType(DML_TENSOR_DATA_TYPE dataType) noexcept
     return g_elementDataTypeByteSizes[index < std::size(g_elementDataTypeByteSizes) ? index : 0];
 }
 
-uint32_t ComputeElementCount(std::span<const uint32_t> dimensions)
+uint64_t ComputeElementCount(std::span<const uint64_t> dimensions)
 {
-    return std::accumulate(dimensions.begin(), dimensions.end(), 1, std::multiplies<int32_t>());
+    return std::accumulate(dimensions.begin(), dimensions.end(), uint64_t(1), SafeMultiply);
 }
 
 ////////////////////////////////////////
@@ -144,6 +161,10 @@ void MapNumPyArrayDataTypeToDml(
         case 'H': resolvedDataType = DML_TENSOR_DATA_TYPE_UINT16;  break; // unsigned short
         case 'i': resolvedDataType = DML_TENSOR_DATA_TYPE_INT32;   break; // signed integer
         case 'u': resolvedDataType = DML_TENSOR_DATA_TYPE_UINT32;  break; // unsigned integer
+        case 'I': resolvedDataType = DML_TENSOR_DATA_TYPE_UINT32;  break; // unsigned integer
+        case 'q': resolvedDataType = DML_TENSOR_DATA_TYPE_INT64;   break; // signed long long
+        case 'Q': resolvedDataType = DML_TENSOR_DATA_TYPE_UINT64;  break; // unsigned long long
+        case 'e': resolvedDataType = DML_TENSOR_DATA_TYPE_FLOAT16; break; // half
         case 'f': resolvedDataType = DML_TENSOR_DATA_TYPE_FLOAT32; break; // float
         case 'd': resolvedDataType = DML_TENSOR_DATA_TYPE_FLOAT64; break; // float64
         case '>': isBackwardsEndian = true; break;    // (backwards-endian)
@@ -172,6 +193,7 @@ void MapNumPyArrayDataTypeToDml(
         case DML_TENSOR_DATA_TYPE_UINT8:
         case DML_TENSOR_DATA_TYPE_UINT16:
         case DML_TENSOR_DATA_TYPE_UINT32:
+        case DML_TENSOR_DATA_TYPE_UINT64:
             switch (elementByteSize)
             {
             case 1: resolvedDataType = DML_TENSOR_DATA_TYPE_UINT8; break;
@@ -185,6 +207,7 @@ void MapNumPyArrayDataTypeToDml(
         case DML_TENSOR_DATA_TYPE_INT8:
         case DML_TENSOR_DATA_TYPE_INT16:
         case DML_TENSOR_DATA_TYPE_INT32:
+        case DML_TENSOR_DATA_TYPE_INT64:
             switch (elementByteSize)
             {
             case 1: resolvedDataType = DML_TENSOR_DATA_TYPE_INT8; break;
@@ -195,6 +218,7 @@ void MapNumPyArrayDataTypeToDml(
             }
             break;
 
+        case DML_TENSOR_DATA_TYPE_FLOAT16:
         case DML_TENSOR_DATA_TYPE_FLOAT32:
         case DML_TENSOR_DATA_TYPE_FLOAT64:
             switch (elementByteSize)
@@ -244,55 +268,322 @@ void AppendOnnxDataTypeToNumPyArray(
     numPyElementType.append(characterCode);
 }
 
+////////////////////////////////////////
+// Byte order conversion
+
+#ifdef NPY_SSSE3
+// Shuffle control that reverses the bytes of every elementByteSize-wide element in a 16-byte lane.
+template <uint32_t ElementByteSize>
+__m128i ByteReverseShuffle()
+{
+    alignas(16) uint8_t shuffle[16];
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        shuffle[i] = static_cast<uint8_t>(i / ElementByteSize * ElementByteSize + ElementByteSize - 1 - i % ElementByteSize);
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle));
+}
+
+template <uint32_t ElementByteSize>
+TARGET_INSTRUCTIONS("avx2")
+size_t SwapBytesAvx2(uint8_t* data, size_t byteCount)
+{
+    const __m256i shuffle = _mm256_broadcastsi128_si256(ByteReverseShuffle<ElementByteSize>());
+    size_t i = 0;
+    for (; i + 32 <= byteCount; i += 32)
+    {
+        auto p = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(p, _mm256_shuffle_epi8(_mm256_loadu_si256(p), shuffle));
+    }
+    return i;
+}
+
+template <uint32_t ElementByteSize>
+TARGET_INSTRUCTIONS("ssse3")
+size_t SwapBytesSsse3(uint8_t* data, size_t byteCount)
+{
+    const __m128i shuffle = ByteReverseShuffle<ElementByteSize>();
+    size_t i = 0;
+    for (; i + 16 <= byteCount; i += 16)
+    {
+        auto p = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(p, _mm_shuffle_epi8(_mm_loadu_si128(p), shuffle));
+    }
+    return i;
+}
+#endif
+
+// Reverses the bytes of each element in as many whole 16/32-byte blocks as possible, returning the number of
+// bytes processed; the caller handles the remainder.
+template <uint32_t ElementByteSize>
+size_t SwapBytesVectorized(uint8_t* data, size_t byteCount)
+{
+    size_t i = 0;
+#if defined(NPY_SSSE3)
+    auto& cpuFeatures = GetCpuFeatures();
+    if (cpuFeatures.avx2)
+    {
+        i = SwapBytesAvx2<ElementByteSize>(data, byteCount);
+    }
+    if (cpuFeatures.ssse3)
+    {
+        return i + SwapBytesSsse3<ElementByteSize>(data + i, byteCount - i);
+    }
+#endif
+#if defined(NPY_SSE2)
+    // Without pshufb, reorder the 16-bit words within each element, then swap the bytes within each word.
+    for (; i + 16 <= byteCount; i += 16)
+    {
+        auto p = reinterpret_cast<__m128i*>(data + i);
+        __m128i v = _mm_loadu_si128(p);
+        if constexpr (ElementByteSize == 4)
+        {
+            v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else if constexpr (ElementByteSize == 8)
+        {
+            v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        _mm_storeu_si128(p, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    }
+#elif defined(NPY_NEON)
+    for (; i + 16 <= byteCount; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(data + i);
+        if constexpr (ElementByteSize == 2) { v = vrev16q_u8(v); }
+        else if constexpr (ElementByteSize == 4) { v = vrev32q_u8(v); }
+        else { v = vrev64q_u8(v); }
+        vst1q_u8(data + i, v);
+    }
+#endif
+    return i;
+}
+
+template <uint32_t ElementByteSize>
+void SwapBytes(uint8_t* data, size_t byteCount)
+{
+    size_t i = 0;
+    if constexpr (ElementByteSize == 2 || ElementByteSize == 4 || ElementByteSize == 8)
+    {
+        i = SwapBytesVectorized<ElementByteSize>(data, byteCount);
+    }
+    for (; i + ElementByteSize <= byteCount; i += ElementByteSize)
+    {
+        std::reverse(data + i, data + i + ElementByteSize);
+    }
+}
+
+// Reverses the byte order of each element (e.g. big-endian to little-endian). Any trailing partial element is
+// left as it is. Large arrays are converted in parallel chunks, since a single thread can't keep up with memory.
 void SwapBytes(/*inout*/ std::span<uint8_t> arrayByteData, uint32_t elementByteSize)
 {
-    switch (elementByteSize)
+    if (elementByteSize <= 1)
     {
-    // case 1: NOP
+        return;
+    }
 
-    case 2:
+    // Chunks are a multiple of every element size handled here and of the widest vector.
+    constexpr size_t chunkByteSize = 1 << 20;
+    const size_t chunkCount = (arrayByteData.size() + chunkByteSize - 1) / chunkByteSize;
+    ParallelFor(chunkCount, 0, [&](size_t chunkIndex, uint32_t workerIndex)
+    {
+        size_t chunkOffset = chunkIndex * chunkByteSize;
+        uint8_t* data = arrayByteData.data() + chunkOffset;
+        size_t byteCount = std::min(chunkByteSize, arrayByteData.size() - chunkOffset);
+        switch (elementByteSize)
         {
-            auto s16 = reinterpret_span<uint16_t>(arrayByteData);
-            for (auto& u : s16)
+        case 2: SwapBytes<2>(data, byteCount); break;
+        case 4: SwapBytes<4>(data, byteCount); break;
+        case 8: SwapBytes<8>(data, byteCount); break;
+        default:
+            for (size_t i = 0; i + elementByteSize <= byteCount; i += elementByteSize)
             {
-                uint32_t v = u;
-                u = ((v & 0x00FF) << 8) |
-                    ((v & 0xFF00) >> 8);
+                std::reverse(data + i, data + i + elementByteSize);
             }
         }
-        break;
+    });
+}
+
+////////////////////////////////////////
+// Fortran order (column-major) to C order (row-major) conversion
+
+#ifdef NPY_SSE2
+template <typename T>
+__m128i UnpackLow(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(T) == 1) { return _mm_unpacklo_epi8(a, b); }
+    else if constexpr (sizeof(T) == 2) { return _mm_unpacklo_epi16(a, b); }
+    else if constexpr (sizeof(T) == 4) { return _mm_unpacklo_epi32(a, b); }
+    else { return _mm_unpacklo_epi64(a, b); }
+}
 
-    case 4: // 32-bit
-    case 8: // 64-bit
-    case 16: // 128-bit
+template <typename T>
+__m128i UnpackHigh(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(T) == 1) { return _mm_unpackhi_epi8(a, b); }
+    else if constexpr (sizeof(T) == 2) { return _mm_unpackhi_epi16(a, b); }
+    else if constexpr (sizeof(T) == 4) { return _mm_unpackhi_epi32(a, b); }
+    else { return _mm_unpackhi_epi64(a, b); }
+}
+
+// Transposes one square tile that fills a 16-byte register per row (16x16 bytes, 8x8 halfs, 4x4 floats, or
+// 2x2 doubles). Each stage interleaves row j with row j + n/2; after log2(n) stages the rows are transposed.
+template <typename T>
+void TransposeTile(const T* src, size_t srcPitch, T* dst, size_t dstPitch)
+{
+    constexpr size_t n = 16 / sizeof(T);
+    __m128i rows[n];
+    for (size_t i = 0; i < n; i++)
+    {
+        rows[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * srcPitch));
+    }
+
+    for (size_t stage = 1; stage < n; stage *= 2)
+    {
+        __m128i interleaved[n];
+        for (size_t j = 0; j < n / 2; j++)
         {
-            auto s32 = reinterpret_span<uint32_t>(arrayByteData);
-            for (auto& u : s32)
+            interleaved[2 * j + 0] = UnpackLow<T>(rows[j], rows[j + n / 2]);
+            interleaved[2 * j + 1] = UnpackHigh<T>(rows[j], rows[j + n / 2]);
+        }
+        std::copy(std::begin(interleaved), std::end(interleaved), std::begin(rows));
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * dstPitch), rows[i]);
+    }
+}
+#endif
+
+// Writes the transpose of a rows x columns matrix: dst[c * dstPitch + r] = src[r * srcPitch + c]. Pitches are
+// in elements. The caller keeps rows and columns small enough (a cache block) that both sides stay in cache.
+template <typename T>
+void TransposeBlock(const T* src, size_t srcPitch, T* dst, size_t dstPitch, size_t rows, size_t columns)
+{
+    size_t r = 0;
+#ifdef NPY_SSE2
+    constexpr size_t n = 16 / sizeof(T);
+    for (; r + n <= rows; r += n)
+    {
+        size_t c = 0;
+        for (; c + n <= columns; c += n)
+        {
+            TransposeTile<T>(src + r * srcPitch + c, srcPitch, dst + c * dstPitch + r, dstPitch);
+        }
+        for (; c < columns; c++)
+        {
+            for (size_t i = r; i < r + n; i++)
             {
-                uint32_t v = u;
-                u = ((v & 0x000000FF) << 24) |
-                    ((v & 0x0000FF00) << 8)  |
-                    ((v & 0x00FF0000) >> 8)  |
-                    ((v & 0xFF000000) >> 24);
+                dst[c * dstPitch + i] = src[i * srcPitch + c];
             }
+        }
+    }
+#endif
+    for (; r < rows; r++)
+    {
+        for (size_t c = 0; c < columns; c++)
+        {
+            dst[c * dstPitch + r] = src[r * srcPitch + c];
+        }
+    }
+}
+
+// Converts an array stored in Fortran order into C order. Both orders agree on which axis is which; they only
+// reverse the roles of the strides. Splitting the dimensions into the first (fastest in Fortran order), the last
+// (fastest in C order), and everything in between, each combination of the middle indices selects a 2D slab that
+// is a plain matrix transpose between the two layouts. Slabs are transposed in cache-sized blocks, in parallel.
+template <typename T>
+void ConvertFortranToCOrder(const T* src, T* dst, std::span<const uint64_t> dimensions)
+{
+    constexpr size_t blockSize = 64;
+    constexpr size_t minElementsPerTask = 1 << 16;
+
+    const size_t firstSize = SafeSizeCast(dimensions.front());
+    const size_t lastSize = SafeSizeCast(dimensions.back());
+    std::span<const uint64_t> middleDimensions = dimensions.subspan(1, dimensions.size() - 2);
+    const size_t middleSize = SafeSizeCast(ComputeElementCount(middleDimensions));
+    const size_t slabSize = firstSize * lastSize;
+    if (slabSize == 0 || middleSize == 0)
+    {
+        return;
+    }
 
-            if (elementByteSize == 8)
+    // Small slabs are grouped so each task has enough work; large slabs are split by blocks of source rows.
+    const size_t rowBlockCount = (lastSize + blockSize - 1) / blockSize;
+    const size_t slabsPerTask = std::max<size_t>(1, minElementsPerTask / slabSize);
+    const bool splitSlabs = slabsPerTask == 1 && rowBlockCount > 1;
+    const size_t taskCount = splitSlabs ? middleSize * rowBlockCount : (middleSize + slabsPerTask - 1) / slabsPerTask;
+    const uint32_t threadCount = middleSize * slabSize < minElementsPerTask ? 1 : 0;
+
+    ParallelFor(taskCount, threadCount, [&](size_t taskIndex, uint32_t workerIndex)
+    {
+        size_t slabBegin = splitSlabs ? taskIndex / rowBlockCount : taskIndex * slabsPerTask;
+        size_t slabEnd = splitSlabs ? slabBegin + 1 : std::min(slabBegin + slabsPerTask, middleSize);
+        size_t rowBegin = splitSlabs ? (taskIndex % rowBlockCount) * blockSize : 0;
+        size_t rowEnd = splitSlabs ? std::min(rowBegin + blockSize, lastSize) : lastSize;
+
+        for (size_t slab = slabBegin; slab < slabEnd; slab++)
+        {
+            // The slab index enumerates the middle indices in C order; find the same indices in Fortran order.
+            size_t fortranSlab = 0;
+            size_t remainder = slab;
+            size_t trailingSize = 1; // Product of the middle dimensions after the current one.
+            for (size_t i = middleDimensions.size(); i-- > 0;)
             {
-                for (uint32_t i = 0; i < static_cast<uint32_t>(s32.size() & ~0x1); i += 2)
-                {
-                    std::swap(s32[i + 0], s32[i + 1]);
-                }
+                size_t dimensionSize = static_cast<size_t>(middleDimensions[i]);
+                fortranSlab += (remainder % dimensionSize) * (middleSize / trailingSize / dimensionSize);
+                remainder /= dimensionSize;
+                trailingSize *= dimensionSize;
             }
-            else if (elementByteSize == 16)
+
+            // In the source, the slab is a lastSize x firstSize matrix with rows that are middleSize * firstSize
+            // apart. In the destination it's firstSize x lastSize with rows middleSize * lastSize apart.
+            const T* srcSlab = src + fortranSlab * firstSize;
+            T* dstSlab = dst + slab * lastSize;
+            const size_t srcPitch = middleSize * firstSize;
+            const size_t dstPitch = middleSize * lastSize;
+
+            for (size_t row = rowBegin; row < rowEnd; row += blockSize)
             {
-                for (uint32_t i = 0; i < static_cast<uint32_t>(s32.size() & ~0x3); i += 4)
+                size_t rowCount = std::min(blockSize, rowEnd - row);
+                for (size_t column = 0; column < firstSize; column += blockSize)
                 {
-                    std::swap(s32[i + 0], s32[i + 3]);
-                    std::swap(s32[i + 1], s32[i + 2]);
+                    size_t columnCount = std::min(blockSize, firstSize - column);
+                    TransposeBlock<T>(
+                        srcSlab + row * srcPitch + column, srcPitch, 
+                        dstSlab + column * dstPitch + row, dstPitch, 
+                        rowCount, columnCount);
                 }
             }
         }
-        break;
+    });
+}
+
+// Returns true if a Fortran-ordered array has the same layout as a C-ordered one, which is the case when at
+// most one dimension is larger than 1.
+bool IsFortranOrderSameAsCOrder(std::span<const uint64_t> dimensions)
+{
+    return std::count_if(dimensions.begin(), dimensions.end(), [](uint64_t size) { return size > 1; }) <= 1;
+}
+
+void ConvertFortranToCOrder(
+    std::span<const std::byte> src, 
+    /*out*/ std::span<std::byte> dst, 
+    std::span<const uint64_t> dimensions, 
+    uint32_t elementByteSize)
+{
+    // Dimensions of size 1 don't affect the layout. Dropping them keeps the slabs as large as possible.
+    std::vector<uint64_t> squeezedDimensions;
+    std::copy_if(dimensions.begin(), dimensions.end(), std::back_inserter(squeezedDimensions), [](uint64_t size) { return size != 1; });
+
+    switch (elementByteSize)
+    {
+    case 1: ConvertFortranToCOrder(reinterpret_cast<const uint8_t*>(src.data()), reinterpret_cast<uint8_t*>(dst.data()), squeezedDimensions); break;
+    case 2: ConvertFortranToCOrder(reinterpret_cast<const uint16_t*>(src.data()), reinterpret_cast<uint16_t*>(dst.data()), squeezedDimensions); break;
+    case 4: ConvertFortranToCOrder(reinterpret_cast<const uint32_t*>(src.data()), reinterpret_cast<uint32_t*>(dst.data()), squeezedDimensions); break;
+    case 8: ConvertFortranToCOrder(reinterpret_cast<const uint64_t*>(src.data()), reinterpret_cast<uint64_t*>(dst.data()), squeezedDimensions); break;
+    default: throw std::ios::failure("Fortran stride order is unsupported for this data type.");
     }
 }
 
@@ -490,7 +781,7 @@ public:
         return map;
     }
 
-    void ParseIntegers(/*out*/ std::vector<uint32_t>& numbers)
+    void ParseIntegers(/*out*/ std::vector<uint64_t>& numbers)
     {
         while (true)
         {
@@ -504,8 +795,12 @@ public:
 
             case TokenType::Number:
                 {
-                    uint32_t value = 0;
-                    std::from_chars(ToChar(token.begin()), ToChar(token.end()), /*out*/ value);
+                    uint64_t value = 0;
+                    auto result = std::from_chars(ToChar(token.begin()), ToChar(token.end()), /*out*/ value);
+                    if (result.ec != std::errc())
+                    {
+                        throw std::ios::failure("NumPy array shape is invalid.");
+                    }
                     numbers.push_back(value);
                 }
                 break;
@@ -556,7 +851,7 @@ public:
         text_.append(U8("\', "));
     }
 
-    void WriteIntegers(std::span<const uint32_t> numbers, std::u8string_view brackets)
+    void WriteIntegers(std::span<const uint64_t> numbers, std::u8string_view brackets)
     {
         if (!brackets.empty())
         {
@@ -564,7 +859,7 @@ public:
         }
         for (auto n : numbers)
         {
-            char buffer[11];
+            char buffer[21];
             auto result = std::to_chars(std::begin(buffer), std::end(buffer), n);
             text_.append(std::begin(buffer), result.ptr);
             text_.append(U8(","));
@@ -605,16 +900,9 @@ using NumPyArrayHeaderV3 = NumPyArrayHeaderV2;
 // silently parse the file incorrectly. Also, NumPy will likely continue to emit V2 by
 // default as a minimum compatibility bar.
 
-void ReadNpy(
-    std::span<const std::byte> fileData,
-    /*out*/DML_TENSOR_DATA_TYPE& dataType,
-    /*out*/std::vector<uint32_t>& dimensions,
-    /*out*/std::vector<std::byte>& arrayByteData
-    )
+NpyHeader ReadNpyHeader(std::span<const std::byte> fileData)
 {
-    dataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
-    dimensions.clear();
-    arrayByteData.clear();
+    NpyHeader header;
 
     using namespace std::literals;
 
@@ -632,60 +920,121 @@ void ReadNpy(
 
     size_t dictionaryOffset = (headerV1.majorVersion >= 2) ? sizeof(NumPyArrayHeaderV2) : sizeof(NumPyArrayHeaderV1);
     size_t dictionaryLength = (headerV1.majorVersion >= 2) ? headerV2.dictionaryLength : headerV1.dictionaryLength;
-    size_t dataByteOffset = dictionaryOffset + dictionaryLength;
+    header.dataByteOffset = dictionaryOffset + dictionaryLength;
+    if (header.dataByteOffset > fileData.size_bytes())
+    {
+        throw std::ios::failure("NumPy array header is truncated.");
+    }
 
-    PythonDictionaryLexer lexer(fileData.subrange(dictionaryOffset, dataByteOffset));
+    PythonDictionaryLexer lexer(fileData.subrange(dictionaryOffset, header.dataByteOffset));
     std::map<std::u8string_view, std::u8string_view> dictionary = lexer.ReadDictionary();
 
-    bool isBackwardsEndian = false;
-    bool hasIncreasingStrides = false;
-
     for (auto& i : dictionary)
     {
         if (i.first == std::u8string_view(U8("descr")))
         {
-            MapNumPyArrayDataTypeToDml(i.second, /*out*/ dataType, /*out*/ isBackwardsEndian);
+            MapNumPyArrayDataTypeToDml(i.second, /*out*/ header.dataType, /*out*/ header.isBackwardsEndian);
         }
         else if (i.first == std::u8string_view(U8("fortran_order")))
         {
-            hasIncreasingStrides = (i.second == std::u8string_view(U8("True")));
+            header.isFortranOrder = (i.second == std::u8string_view(U8("True")));
         }
         else if (i.first == std::u8string_view(U8("shape")))
         {
             PythonDictionaryLexer shapeLexer(i.second);
-            shapeLexer.ParseIntegers(dimensions);
+            shapeLexer.ParseIntegers(header.dimensions);
         }
     }
 
-    arrayByteData.assign(fileData.data() + dataByteOffset, fileData.end());
-    const uint32_t elementByteSize = GetByteSizeFromDataType(dataType);
-    const uint32_t totalElementCount = ComputeElementCount(dimensions);
-    const uint32_t totalByteSize = elementByteSize * totalElementCount;
-    if (arrayByteData.size() < totalByteSize)
+    header.dataSizeInBytes = SafeMultiply(GetByteSizeFromDataType(header.dataType), ComputeElementCount(header.dimensions));
+
+    return header;
+}
+
+std::span<const std::byte> ReadNpyArrayData(
+    std::span<const std::byte> fileData,
+    const NpyHeader& header,
+    /*out*/std::vector<std::byte>& convertedData
+    )
+{
+    convertedData.clear();
+
+    std::span<const std::byte> arrayData(fileData.data() + header.dataByteOffset, fileData.end());
+    const uint32_t elementByteSize = GetByteSizeFromDataType(header.dataType);
+    const bool needsByteSwap = header.isBackwardsEndian && elementByteSize > 1;
+    const bool needsTranspose = header.isFortranOrder && header.dataSizeInBytes > 0 && !IsFortranOrderSameAsCOrder(header.dimensions);
+    if (!needsByteSwap && !needsTranspose && arrayData.size() >= header.dataSizeInBytes)
+    {
+        return arrayData;
+    }
+
+    // A truncated array is padded with zeros.
+    const size_t dataSizeInBytes = SafeSizeCast(header.dataSizeInBytes);
+    std::vector<std::byte> paddedData;
+    if (arrayData.size() < dataSizeInBytes)
+    {
+        paddedData.assign(arrayData.begin(), arrayData.end());
+        paddedData.resize(dataSizeInBytes);
+        arrayData = paddedData;
+    }
+
+    if (needsTranspose)
+    {
+        // Transposed straight out of the file data; only bytes following the array are copied as they are.
+        convertedData.resize(arrayData.size());
+        ConvertFortranToCOrder(
+            arrayData.first(dataSizeInBytes), 
+            std::span<std::byte>(convertedData.data(), dataSizeInBytes), 
+            header.dimensions, 
+            elementByteSize);
+        std::copy(arrayData.begin() + dataSizeInBytes, arrayData.end(), convertedData.begin() + dataSizeInBytes);
+    }
+    else if (!paddedData.empty())
+    {
+        convertedData = std::move(paddedData);
+    }
+    else
     {
-        arrayByteData.resize(totalByteSize);
+        convertedData.assign(arrayData.begin(), arrayData.end());
     }
 
     // Assuming that we're running on a logical endian machine.
     // If not, lots of other places would break too anyway.
-    if (isBackwardsEndian)
+    if (needsByteSwap)
     {
-        SwapBytes(/*inout*/ reinterpret_span<uint8_t>(arrayByteData), totalByteSize);
+        SwapBytes(/*inout*/ reinterpret_span<uint8_t>(convertedData).first(dataSizeInBytes), elementByteSize);
     }
-    if (hasIncreasingStrides)
+
+    return convertedData;
+}
+
+void ReadNpy(
+    std::span<const std::byte> fileData,
+    /*out*/DML_TENSOR_DATA_TYPE& dataType,
+    /*out*/std::vector<uint64_t>& dimensions,
+    /*out*/std::vector<std::byte>& arrayByteData
+    )
+{
+    NpyHeader header = ReadNpyHeader(fileData);
+    auto arrayData = ReadNpyArrayData(fileData, header, /*out*/ arrayByteData);
+    if (arrayData.data() != arrayByteData.data())
     {
-        throw std::ios::failure("Fortran stride order unsupported.");
+        arrayByteData.assign(arrayData.begin(), arrayData.end());
     }
+
+    dataType = header.dataType;
+    dimensions = std::move(header.dimensions);
 }
 
-// Writes tensor data to in memory file data (not directly to file).
-void WriteNpy(
-    std::span<const std::byte> arrayByteData,
+// Writes only the header of a NumPy array file; the array data follows it directly.
+void WriteNpyHeader(
     DML_TENSOR_DATA_TYPE dataType,
-    std::span<const uint32_t> dimensions,
-    /*out*/std::vector<std::byte>& fileData
+    std::span<const uint64_t> dimensions,
+    /*out*/std::vector<std::byte>& headerData
     )
 {
+    headerData.clear();
+
     NumPyArrayHeaderV1 headerFixedPart = { {uint8_t('\x0093'),'N','U','M','P','Y'}, 1,0, 0 };
 
     PythonDictionaryWriter dictionaryWriter;
@@ -710,14 +1059,25 @@ void WriteNpy(
 
     // Write header, including fixed size part, dictionary, and alignment padding.
     headerFixedPart.dictionaryLength = static_cast<uint16_t>(headerLength - sizeof(headerFixedPart));
-    append_data(/*inout*/ fileData, { reinterpret_cast<const std::byte*>(&headerFixedPart), sizeof(headerFixedPart) });
-    append_data(/*inout*/ fileData, dictionaryWriter.GetBytes());
-    fileData.insert(fileData.end(), headerLength - fileData.size(), std::byte{' '});
-    fileData.back() = std::byte{ '\x000A' }; // Terminate with new line.
+    append_data(/*inout*/ headerData, { reinterpret_cast<const std::byte*>(&headerFixedPart), sizeof(headerFixedPart) });
+    append_data(/*inout*/ headerData, dictionaryWriter.GetBytes());
+    headerData.insert(headerData.end(), headerLength - headerData.size(), std::byte{' '});
+    headerData.back() = std::byte{ '\x000A' }; // Terminate with new line.
     // Note the spec says "It is terminated by a newline (\n) and padded with spaces (\x20)",
     // but that's wrong. It's actually "padding with spaces and then terminated by a newline".
     // Otherwise Numpy 1.18.5 barfs (1.19 works fine either way).
     // https://numpy.org/devdocs/reference/generated/numpy.lib.format.html
+}
 
+// Writes tensor data to in memory file data (not directly to file).
+void WriteNpy(
+    std::span<const std::byte> arrayByteData,
+    DML_TENSOR_DATA_TYPE dataType,
+    std::span<const uint64_t> dimensions,
+    /*out*/std::vector<std::byte>& fileData
+    )
+{
+    WriteNpyHeader(dataType, dimensions, /*out*/ fileData);
+    fileData.reserve(fileData.size() + arrayByteData.size());
     append_data(/*inout*/ fileData, arrayByteData);
 }
@@ -4,18 +4,53 @@
 
 bool IsNpyFilenameExtension(std::string_view filename);
 
+// Dimensions and sizes are 64-bit throughout, so arrays larger than 4 GB (or with more than 4G elements) are
+// supported. Shapes whose size overflows 64 bits are rejected.
+
+// The header of a NumPy array file.
+struct NpyHeader
+{
+    DML_TENSOR_DATA_TYPE dataType = DML_TENSOR_DATA_TYPE_UNKNOWN;
+    std::vector<uint64_t> dimensions;
+    bool isBackwardsEndian = false;
+    bool isFortranOrder = false;
+    size_t dataByteOffset = 0;   // Offset of the array data within the file.
+    uint64_t dataSizeInBytes = 0; // Size of the array data implied by the data type and dimensions.
+};
+
+// Reads only the header of a NumPy array file in memory. Nothing is copied.
+NpyHeader ReadNpyHeader(std::span<const std::byte> fileData);
+
+// Returns the array data of a NumPy array file in memory. When the data can be used in place (little-endian, C
+// order, and not truncated) the result is a view of fileData, and nothing is allocated. Otherwise the data is
+// converted into convertedData and the result is a view of it. As with ReadNpy, any bytes following the array
+// in the file are included.
+std::span<const std::byte> ReadNpyArrayData(
+    std::span<const std::byte> fileData,
+    const NpyHeader& header,
+    /*out*/std::vector<std::byte>& convertedData
+    );
+
 // Reads a NumPy array file in memory.
 void ReadNpy(
     std::span<const std::byte> fileData,
     /*out*/DML_TENSOR_DATA_TYPE& dataType,
-    /*out*/std::vector<uint32_t>& dimensions,
+    /*out*/std::vector<uint64_t>& dimensions,
     /*out*/std::vector<std::byte>& arrayByteData
     );
 
+// Writes only the header of a NumPy array file. Writing the array data right after it yields a complete file,
+// so large arrays can be streamed to a file without first being copied next to their header.
+void WriteNpyHeader(
+    DML_TENSOR_DATA_TYPE dataType,
+    std::span<const uint64_t> dimensions,
+    /*out*/std::vector<std::byte>& headerData
+    );
+
 // Writes tensor data to in-memory NumPy file data.
 void WriteNpy(
     std::span<const std::byte> arrayByteData,
     DML_TENSOR_DATA_TYPE dataType,
-    std::span<const uint32_t> dimensions,
+    std::span<const uint64_t> dimensions,
     /*out*/std::vector<std::byte>& fileData
     );
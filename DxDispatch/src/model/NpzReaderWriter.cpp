@@ -0,0 +1,881 @@
+#include "pch.h"
+#include "StdSupport.h"
+#include "SafeArithmetic.h"
+#include "NpzReaderWriter.h"
+
+////////////////////////////////////////
+// Generic helpers
+
+namespace
+{
+    template <typename T>
+    T ReadLittleEndian(std::span<const std::byte> data, uint64_t offset)
+    {
+        if (offset > data.size() || sizeof(T) > data.size() - offset)
+        {
+            throw std::ios::failure("NPZ archive is truncated or corrupt.");
+        }
+
+        T value;
+        memcpy(&value, data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void AppendLittleEndian(std::vector<std::byte>& data, T value)
+    {
+        auto p = reinterpret_cast<const std::byte*>(&value);
+        data.insert(data.end(), p, p + sizeof(T));
+    }
+
+    bool EndsWithNpyExtension(std::string_view name)
+    {
+        return name.size() >= 4 && name.substr(name.size() - 4) == ".npy";
+    }
+
+    class Crc32Table
+    {
+    public:
+        Crc32Table()
+        {
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t crc = i;
+                for (uint32_t bit = 0; bit < 8; bit++)
+                {
+                    crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+                }
+                m_table[i] = crc;
+            }
+        }
+
+        uint32_t Compute(std::span<const std::byte> data) const
+        {
+            uint32_t crc = ~0u;
+            for (auto b : data)
+            {
+                crc = (crc >> 8) ^ m_table[(crc ^ static_cast<uint8_t>(b)) & 0xFF];
+            }
+            return ~crc;
+        }
+
+    private:
+        std::array<uint32_t, 256> m_table;
+    };
+
+    uint32_t ComputeCrc32(std::span<const std::byte> data)
+    {
+        static const Crc32Table table;
+        return table.Compute(data);
+    }
+}
+
+////////////////////////////////////////
+// Deflate (RFC 1951) decompression
+
+namespace
+{
+    // Reads bits least-significant first, as deflate packs them. Reading past the end of the data yields zeros,
+    // which is caught by checking the number of bytes consumed (any stream that would loop forever on zeros is
+    // stopped earlier by the output size).
+    class BitReader
+    {
+    public:
+        explicit BitReader(std::span<const std::byte> data) : m_data(data) {}
+
+        uint32_t Peek(uint32_t bitCount)
+        {
+            Refill();
+            return static_cast<uint32_t>(m_bits & ((1ull << bitCount) - 1));
+        }
+
+        void Consume(uint32_t bitCount)
+        {
+            m_bits >>= bitCount;
+            m_bitCount -= bitCount;
+        }
+
+        uint32_t Read(uint32_t bitCount)
+        {
+            uint32_t value = Peek(bitCount);
+            Consume(bitCount);
+            return value;
+        }
+
+        void AlignToByte()
+        {
+            Consume(m_bitCount % 8);
+        }
+
+        // Copies whole bytes; the reader must be byte aligned.
+        void ReadBytes(std::byte* destination, size_t byteCount)
+        {
+            for (; byteCount > 0 && m_bitCount >= 8; byteCount--)
+            {
+                *destination++ = static_cast<std::byte>(m_bits & 0xFF);
+                Consume(8);
+            }
+            if (byteCount > m_data.size() - std::min(m_position, m_data.size()))
+            {
+                throw std::ios::failure("Deflate stream is truncated.");
+            }
+            memcpy(destination, m_data.data() + m_position, byteCount);
+            m_position += byteCount;
+        }
+
+        size_t GetConsumedByteCount() const
+        {
+            return m_position - m_bitCount / 8;
+        }
+
+    private:
+        void Refill()
+        {
+            for (; m_bitCount <= 56; m_bitCount += 8, m_position++)
+            {
+                uint64_t b = 0;
+                if (m_position < m_data.size())
+                {
+                    b = static_cast<uint8_t>(m_data[m_position]);
+                }
+                else if (m_position > m_data.size() + 16)
+                {
+                    throw std::ios::failure("Deflate stream is truncated.");
+                }
+                m_bits |= b << m_bitCount;
+            }
+        }
+
+    private:
+        std::span<const std::byte> m_data;
+        size_t m_position = 0;
+        uint64_t m_bits = 0;
+        uint32_t m_bitCount = 0;
+    };
+
+    // A canonical Huffman code, decoded with a single table lookup indexed by the next maxLength bits.
+    class HuffmanTable
+    {
+    public:
+        static constexpr uint32_t c_maxCodeLength = 15;
+
+        void Build(const uint8_t* codeLengths, uint32_t symbolCount)
+        {
+            std::array<uint32_t, c_maxCodeLength + 1> lengthCounts = {};
+            for (uint32_t symbol = 0; symbol < symbolCount; symbol++)
+            {
+                lengthCounts[codeLengths[symbol]]++;
+            }
+            lengthCounts[0] = 0;
+
+            m_maxLength = 0;
+            int32_t remainingCodes = 1;
+            std::array<uint32_t, c_maxCodeLength + 1> nextCode = {};
+            for (uint32_t length = 1, code = 0; length <= c_maxCodeLength; length++)
+            {
+                remainingCodes = remainingCodes * 2 - static_cast<int32_t>(lengthCounts[length]);
+                if (remainingCodes < 0)
+                {
+                    throw std::ios::failure("Deflate stream has an invalid Huffman code.");
+                }
+                code = (code + lengthCounts[length - 1]) << 1;
+                nextCode[length] = code;
+                if (lengthCounts[length] > 0)
+                {
+                    m_maxLength = length;
+                }
+            }
+
+            // Incomplete codes are allowed; unused bit patterns decode to an entry with zero length.
+            m_entries.assign(size_t(1) << m_maxLength, Entry{});
+            for (uint32_t symbol = 0; symbol < symbolCount; symbol++)
+            {
+                uint32_t length = codeLengths[symbol];
+                if (length == 0)
+                {
+                    continue;
+                }
+
+                // Codes are sent most-significant bit first, so they're reversed relative to the bit reader.
+                uint32_t code = nextCode[length]++;
+                uint32_t reversedCode = 0;
+                for (uint32_t bit = 0; bit < length; bit++)
+                {
+                    reversedCode |= ((code >> bit) & 1) << (length - 1 - bit);
+                }
+                for (size_t i = reversedCode; i < m_entries.size(); i += size_t(1) << length)
+                {
+                    m_entries[i] = { static_cast<uint16_t>(symbol), static_cast<uint8_t>(length) };
+                }
+            }
+        }
+
+        uint32_t Decode(BitReader& reader) const
+        {
+            const Entry& entry = m_entries[reader.Peek(m_maxLength)];
+            if (entry.length == 0)
+            {
+                throw std::ios::failure("Deflate stream has an invalid Huffman code.");
+            }
+            reader.Consume(entry.length);
+            return entry.symbol;
+        }
+
+    private:
+        struct Entry
+        {
+            uint16_t symbol = 0;
+            uint8_t length = 0;
+        };
+
+        std::vector<Entry> m_entries;
+        uint32_t m_maxLength = 0;
+    };
+
+    constexpr uint16_t c_lengthBases[] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    constexpr uint8_t c_lengthExtraBits[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+    constexpr uint16_t c_distanceBases[] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+        4097, 6145, 8193, 12289, 16385, 24577
+    };
+    constexpr uint8_t c_distanceExtraBits[] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+
+    void ReadDynamicHuffmanTables(BitReader& reader, HuffmanTable& literalLengthTable, HuffmanTable& distanceTable)
+    {
+        const uint32_t literalLengthCount = reader.Read(5) + 257;
+        const uint32_t distanceCount = reader.Read(5) + 1;
+        const uint32_t codeLengthCount = reader.Read(4) + 4;
+        if (literalLengthCount > 286 || distanceCount > 30)
+        {
+            throw std::ios::failure("Deflate stream has too many Huffman codes.");
+        }
+
+        constexpr uint8_t codeLengthOrder[] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+        std::array<uint8_t, 19> codeLengthCodeLengths = {};
+        for (uint32_t i = 0; i < codeLengthCount; i++)
+        {
+            codeLengthCodeLengths[codeLengthOrder[i]] = static_cast<uint8_t>(reader.Read(3));
+        }
+
+        HuffmanTable codeLengthTable;
+        codeLengthTable.Build(codeLengthCodeLengths.data(), static_cast<uint32_t>(codeLengthCodeLengths.size()));
+
+        // The literal/length and distance code lengths form a single sequence, and repeats may cross between them.
+        std::array<uint8_t, 286 + 30> codeLengths = {};
+        for (uint32_t i = 0; i < literalLengthCount + distanceCount;)
+        {
+            uint32_t symbol = codeLengthTable.Decode(reader);
+            if (symbol < 16)
+            {
+                codeLengths[i++] = static_cast<uint8_t>(symbol);
+                continue;
+            }
+
+            uint8_t repeatedLength = 0;
+            uint32_t repeatCount = 0;
+            switch (symbol)
+            {
+            case 16:
+                if (i == 0)
+                {
+                    throw std::ios::failure("Deflate stream repeats a code length before the first.");
+                }
+                repeatedLength = codeLengths[i - 1];
+                repeatCount = 3 + reader.Read(2);
+                break;
+            case 17: repeatCount = 3 + reader.Read(3); break;
+            default: repeatCount = 11 + reader.Read(7); break;
+            }
+
+            if (repeatCount > literalLengthCount + distanceCount - i)
+            {
+                throw std::ios::failure("Deflate stream has too many code lengths.");
+            }
+            std::fill_n(codeLengths.begin() + i, repeatCount, repeatedLength);
+            i += repeatCount;
+        }
+
+        if (codeLengths[256] == 0)
+        {
+            throw std::ios::failure("Deflate stream has no end of block code.");
+        }
+
+        literalLengthTable.Build(codeLengths.data(), literalLengthCount);
+        distanceTable.Build(codeLengths.data() + literalLengthCount, distanceCount);
+    }
+
+    struct FixedHuffmanTables
+    {
+        FixedHuffmanTables()
+        {
+            std::array<uint8_t, 288> literalLengthCodeLengths;
+            std::fill(literalLengthCodeLengths.begin(), literalLengthCodeLengths.begin() + 144, uint8_t(8));
+            std::fill(literalLengthCodeLengths.begin() + 144, literalLengthCodeLengths.begin() + 256, uint8_t(9));
+            std::fill(literalLengthCodeLengths.begin() + 256, literalLengthCodeLengths.begin() + 280, uint8_t(7));
+            std::fill(literalLengthCodeLengths.begin() + 280, literalLengthCodeLengths.end(), uint8_t(8));
+            literalLength.Build(literalLengthCodeLengths.data(), static_cast<uint32_t>(literalLengthCodeLengths.size()));
+
+            std::array<uint8_t, 30> distanceCodeLengths;
+            distanceCodeLengths.fill(5);
+            distance.Build(distanceCodeLengths.data(), static_cast<uint32_t>(distanceCodeLengths.size()));
+        }
+
+        HuffmanTable literalLength;
+        HuffmanTable distance;
+    };
+
+    // Decompresses a raw deflate stream whose decompressed size is known in advance.
+    void Inflate(std::span<const std::byte> compressedData, std::span<std::byte> output)
+    {
+        static const FixedHuffmanTables fixedTables;
+
+        BitReader reader(compressedData);
+        HuffmanTable dynamicLiteralLengthTable;
+        HuffmanTable dynamicDistanceTable;
+        size_t outputSize = 0;
+        bool isFinalBlock = false;
+
+        while (!isFinalBlock)
+        {
+            isFinalBlock = reader.Read(1) != 0;
+            uint32_t blockType = reader.Read(2);
+
+            if (blockType == 0)
+            {
+                reader.AlignToByte();
+                uint32_t length = reader.Read(16);
+                uint32_t lengthComplement = reader.Read(16);
+                if (length != (~lengthComplement & 0xFFFF))
+                {
+                    throw std::ios::failure("Deflate stream has an invalid stored block.");
+                }
+                if (length > output.size() - outputSize)
+                {
+                    throw std::ios::failure("Deflate stream is larger than expected.");
+                }
+                reader.ReadBytes(output.data() + outputSize, length);
+                outputSize += length;
+                continue;
+            }
+
+            const HuffmanTable* literalLengthTable = &fixedTables.literalLength;
+            const HuffmanTable* distanceTable = &fixedTables.distance;
+            if (blockType == 2)
+            {
+                ReadDynamicHuffmanTables(reader, dynamicLiteralLengthTable, dynamicDistanceTable);
+                literalLengthTable = &dynamicLiteralLengthTable;
+                distanceTable = &dynamicDistanceTable;
+            }
+            else if (blockType != 1)
+            {
+                throw std::ios::failure("Deflate stream has an invalid block type.");
+            }
+
+            while (true)
+            {
+                uint32_t symbol = literalLengthTable->Decode(reader);
+                if (symbol < 256)
+                {
+                    if (outputSize == output.size())
+                    {
+                        throw std::ios::failure("Deflate stream is larger than expected.");
+                    }
+                    output[outputSize++] = static_cast<std::byte>(symbol);
+                    continue;
+                }
+                if (symbol == 256)
+                {
+                    break;
+                }
+
+                symbol -= 257;
+                if (symbol >= std::size(c_lengthBases))
+                {
+                    throw std::ios::failure("Deflate stream has an invalid length.");
+                }
+                size_t length = c_lengthBases[symbol] + reader.Read(c_lengthExtraBits[symbol]);
+
+                uint32_t distanceSymbol = distanceTable->Decode(reader);
+                if (distanceSymbol >= std::size(c_distanceBases))
+                {
+                    throw std::ios::failure("Deflate stream has an invalid distance.");
+                }
+                size_t distance = c_distanceBases[distanceSymbol] + reader.Read(c_distanceExtraBits[distanceSymbol]);
+
+                if (distance > outputSize)
+                {
+                    throw std::ios::failure("Deflate stream refers to data before its start.");
+                }
+                if (length > output.size() - outputSize)
+                {
+                    throw std::ios::failure("Deflate stream is larger than expected.");
+                }
+
+                std::byte* destination = output.data() + outputSize;
+                const std::byte* source = destination - distance;
+                if (distance >= length)
+                {
+                    memcpy(destination, source, length);
+                }
+                else
+                {
+                    // Overlapping copies repeat the most recent bytes, so they must go one byte at a time.
+                    for (size_t i = 0; i < length; i++)
+                    {
+                        destination[i] = source[i];
+                    }
+                }
+                outputSize += length;
+            }
+        }
+
+        if (outputSize != output.size() || reader.GetConsumedByteCount() > compressedData.size())
+        {
+            throw std::ios::failure("Deflate stream is truncated.");
+        }
+    }
+}
+
+////////////////////////////////////////
+// Zip archive reading
+
+namespace
+{
+    constexpr uint32_t c_localHeaderSignature = 0x04034B50;
+    constexpr uint32_t c_centralHeaderSignature = 0x02014B50;
+    constexpr uint32_t c_endOfCentralDirectorySignature = 0x06054B50;
+    constexpr uint32_t c_zip64EndOfCentralDirectorySignature = 0x06064B50;
+    constexpr uint32_t c_zip64EndOfCentralDirectoryLocatorSignature = 0x07064B50;
+    constexpr uint16_t c_zip64ExtraFieldId = 0x0001;
+
+    constexpr size_t c_localHeaderSize = 30;
+    constexpr size_t c_centralHeaderSize = 46;
+    constexpr size_t c_endOfCentralDirectorySize = 22;
+    constexpr size_t c_zip64EndOfCentralDirectorySize = 56;
+    constexpr size_t c_zip64EndOfCentralDirectoryLocatorSize = 20;
+
+    constexpr uint16_t c_compressionMethodStored = 0;
+    constexpr uint16_t c_compressionMethodDeflated = 8;
+}
+
+bool SplitNpzMemberPath(std::string_view path, /*out*/ std::string_view& archivePath, /*out*/ std::string_view& memberName)
+{
+    constexpr std::string_view separator = ".npz:";
+    auto it = std::search(path.begin(), path.end(), separator.begin(), separator.end(),
+        [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; }
+    );
+    if (it == path.end())
+    {
+        return false;
+    }
+
+    size_t separatorOffset = static_cast<size_t>(it - path.begin()) + separator.size() - 1;
+    archivePath = path.substr(0, separatorOffset);
+    memberName = path.substr(separatorOffset + 1);
+    return true;
+}
+
+NpzArchive::NpzArchive(std::span<const std::byte> archiveData) : m_archiveData(archiveData)
+{
+    if (archiveData.size() < c_endOfCentralDirectorySize)
+    {
+        throw std::ios::failure("NPZ archive is too small to be a zip file.");
+    }
+
+    // The end of central directory record is last, followed only by a comment of up to 64 KB.
+    size_t endOffset = archiveData.size() - c_endOfCentralDirectorySize;
+    const size_t minEndOffset = endOffset > 0xFFFF ? endOffset - 0xFFFF : 0;
+    while (ReadLittleEndian<uint32_t>(archiveData, endOffset) != c_endOfCentralDirectorySignature)
+    {
+        if (endOffset == minEndOffset)
+        {
+            throw std::ios::failure("NPZ archive has no zip central directory.");
+        }
+        endOffset--;
+    }
+
+    uint64_t entryCount = ReadLittleEndian<uint16_t>(archiveData, endOffset + 10);
+    uint64_t centralDirectoryOffset = ReadLittleEndian<uint32_t>(archiveData, endOffset + 16);
+
+    // Zip64 archives have another record before it, holding the full-size values.
+    if (endOffset >= c_zip64EndOfCentralDirectoryLocatorSize &&
+        ReadLittleEndian<uint32_t>(archiveData, endOffset - c_zip64EndOfCentralDirectoryLocatorSize) == c_zip64EndOfCentralDirectoryLocatorSignature)
+    {
+        uint64_t zip64EndOffset = ReadLittleEndian<uint64_t>(archiveData, endOffset - c_zip64EndOfCentralDirectoryLocatorSize + 8);
+        if (ReadLittleEndian<uint32_t>(archiveData, zip64EndOffset) != c_zip64EndOfCentralDirectorySignature)
+        {
+            throw std::ios::failure("NPZ archive has an invalid zip64 central directory.");
+        }
+        entryCount = ReadLittleEndian<uint64_t>(archiveData, zip64EndOffset + 32);
+        centralDirectoryOffset = ReadLittleEndian<uint64_t>(archiveData, zip64EndOffset + 48);
+    }
+
+    m_centralDirectoryOffset = centralDirectoryOffset;
+
+    // Each entry takes at least c_centralHeaderSize bytes, which bounds the reservation for corrupt counts.
+    m_members.reserve(static_cast<size_t>(std::min<uint64_t>(entryCount, archiveData.size() / c_centralHeaderSize)));
+
+    uint64_t entryOffset = centralDirectoryOffset;
+    for (uint64_t entryIndex = 0; entryIndex < entryCount; entryIndex++)
+    {
+        if (ReadLittleEndian<uint32_t>(archiveData, entryOffset) != c_centralHeaderSignature)
+        {
+            throw std::ios::failure("NPZ archive has an invalid zip central directory entry.");
+        }
+
+        Member member;
+        member.isEncrypted = (ReadLittleEndian<uint16_t>(archiveData, entryOffset + 8) & 1) != 0;
+        member.compressionMethod = ReadLittleEndian<uint16_t>(archiveData, entryOffset + 10);
+        member.crc32 = ReadLittleEndian<uint32_t>(archiveData, entryOffset + 16);
+        member.compressedSize = ReadLittleEndian<uint32_t>(archiveData, entryOffset + 20);
+        member.uncompressedSize = ReadLittleEndian<uint32_t>(archiveData, entryOffset + 24);
+        uint16_t nameSize = ReadLittleEndian<uint16_t>(archiveData, entryOffset + 28);
+        uint16_t extraFieldSize = ReadLittleEndian<uint16_t>(archiveData, entryOffset + 30);
+        uint16_t commentSize = ReadLittleEndian<uint16_t>(archiveData, entryOffset + 32);
+        member.localHeaderOffset = ReadLittleEndian<uint32_t>(archiveData, entryOffset + 42);
+
+        uint64_t nameOffset = entryOffset + c_centralHeaderSize;
+        uint64_t extraFieldOffset = nameOffset + nameSize;
+        uint64_t extraFieldEnd = extraFieldOffset + extraFieldSize;
+        if (extraFieldEnd > archiveData.size())
+        {
+            throw std::ios::failure("NPZ archive is truncated or corrupt.");
+        }
+        member.name.assign(reinterpret_cast<const char*>(archiveData.data() + nameOffset), nameSize);
+
+        // Values that don't fit are saturated, and the full values follow in order in the zip64 extra field.
+        for (uint64_t fieldOffset = extraFieldOffset; fieldOffset + 4 <= extraFieldEnd;)
+        {
+            uint16_t fieldId = ReadLittleEndian<uint16_t>(archiveData, fieldOffset);
+            uint16_t fieldSize = ReadLittleEndian<uint16_t>(archiveData, fieldOffset + 2);
+            uint64_t valueOffset = fieldOffset + 4;
+            fieldOffset = valueOffset + fieldSize;
+            if (fieldId != c_zip64ExtraFieldId)
+            {
+                continue;
+            }
+
+            for (uint64_t* value : { &member.uncompressedSize, &member.compressedSize, &member.localHeaderOffset })
+            {
+                if (*value == 0xFFFFFFFF && valueOffset + 8 <= fieldOffset)
+                {
+                    *value = ReadLittleEndian<uint64_t>(archiveData, valueOffset);
+                    valueOffset += 8;
+                }
+            }
+        }
+
+        m_memberIndices.emplace(member.name, m_members.size());
+        m_members.push_back(std::move(member));
+        entryOffset = extraFieldEnd + commentSize;
+    }
+}
+
+const NpzArchive::Member* NpzArchive::FindMember(std::string_view name) const
+{
+    auto it = m_memberIndices.find(std::string(name));
+    if (it == m_memberIndices.end() && !EndsWithNpyExtension(name))
+    {
+        it = m_memberIndices.find(std::string(name) + ".npy");
+    }
+    return it != m_memberIndices.end() ? &m_members[it->second] : nullptr;
+}
+
+uint64_t NpzArchive::GetMemberDataOffset(const Member& member) const
+{
+    if (ReadLittleEndian<uint32_t>(m_archiveData, member.localHeaderOffset) != c_localHeaderSignature)
+    {
+        throw std::ios::failure(fmt::format("NPZ archive has an invalid zip header for member '{}'.", member.name));
+    }
+
+    // The local header repeats the name, but its extra field may differ from the central directory's.
+    uint16_t nameSize = ReadLittleEndian<uint16_t>(m_archiveData, member.localHeaderOffset + 26);
+    uint16_t extraFieldSize = ReadLittleEndian<uint16_t>(m_archiveData, member.localHeaderOffset + 28);
+    uint64_t dataOffset = member.localHeaderOffset + c_localHeaderSize + nameSize + extraFieldSize;
+    if (dataOffset > m_archiveData.size() || member.compressedSize > m_archiveData.size() - dataOffset)
+    {
+        throw std::ios::failure(fmt::format("NPZ archive is truncated at member '{}'.", member.name));
+    }
+
+    return dataOffset;
+}
+
+std::span<const std::byte> NpzArchive::ReadMember(const Member& member, /*out*/ std::vector<std::byte>& decompressedData) const
+{
+    decompressedData.clear();
+
+    if (member.isEncrypted)
+    {
+        throw std::ios::failure(fmt::format("NPZ archive member '{}' is encrypted.", member.name));
+    }
+
+    auto memberData = m_archiveData.subspan(
+        static_cast<size_t>(GetMemberDataOffset(member)),
+        static_cast<size_t>(member.compressedSize));
+
+    switch (member.compressionMethod)
+    {
+    case c_compressionMethodStored:
+        if (member.compressedSize != member.uncompressedSize)
+        {
+            throw std::ios::failure(fmt::format("NPZ archive member '{}' has inconsistent sizes.", member.name));
+        }
+        return memberData;
+
+    case c_compressionMethodDeflated:
+        // Deflate can't expand data by more than 1032:1, so larger sizes can only come from a corrupt archive.
+        if (member.uncompressedSize / 1032 > member.compressedSize)
+        {
+            throw std::ios::failure(fmt::format("NPZ archive member '{}' has inconsistent sizes.", member.name));
+        }
+        decompressedData.resize(SafeSizeCast(member.uncompressedSize));
+        Inflate(memberData, decompressedData);
+        if (ComputeCrc32(decompressedData) != member.crc32)
+        {
+            throw std::ios::failure(fmt::format("NPZ archive member '{}' failed its CRC check.", member.name));
+        }
+        return decompressedData;
+
+    default:
+        throw std::ios::failure(fmt::format(
+            "NPZ archive member '{}' uses unsupported compression method {}.",
+            member.name,
+            member.compressionMethod));
+    }
+}
+
+////////////////////////////////////////
+// Zip archive writing
+
+namespace
+{
+    struct ZipEntry
+    {
+        std::string_view name;
+        uint16_t compressionMethod;
+        uint32_t crc32;
+        uint64_t compressedSize;
+        uint64_t uncompressedSize;
+        uint64_t localHeaderOffset;
+    };
+
+    // Entries use fixed timestamps (1980-01-01 00:00), so writing the same arrays always yields the same file.
+    constexpr uint16_t c_dosTime = 0;
+    constexpr uint16_t c_dosDate = (1 << 5) | 1;
+
+    void WriteLocalHeader(std::vector<std::byte>& data, const ZipEntry& entry)
+    {
+        const bool isZip64 = entry.compressedSize >= 0xFFFFFFFF || entry.uncompressedSize >= 0xFFFFFFFF;
+        AppendLittleEndian<uint32_t>(data, c_localHeaderSignature);
+        AppendLittleEndian<uint16_t>(data, isZip64 ? 45 : 20); // version needed to extract
+        AppendLittleEndian<uint16_t>(data, 0); // flags
+        AppendLittleEndian<uint16_t>(data, entry.compressionMethod);
+        AppendLittleEndian<uint16_t>(data, c_dosTime);
+        AppendLittleEndian<uint16_t>(data, c_dosDate);
+        AppendLittleEndian<uint32_t>(data, entry.crc32);
+        AppendLittleEndian<uint32_t>(data, isZip64 ? 0xFFFFFFFF : static_cast<uint32_t>(entry.compressedSize));
+        AppendLittleEndian<uint32_t>(data, isZip64 ? 0xFFFFFFFF : static_cast<uint32_t>(entry.uncompressedSize));
+        AppendLittleEndian<uint16_t>(data, static_cast<uint16_t>(entry.name.size()));
+        AppendLittleEndian<uint16_t>(data, isZip64 ? 20 : 0);
+        data.insert(data.end(), reinterpret_cast<const std::byte*>(entry.name.data()), reinterpret_cast<const std::byte*>(entry.name.data() + entry.name.size()));
+        if (isZip64)
+        {
+            // Unlike the central directory, a local zip64 field always holds both sizes.
+            AppendLittleEndian<uint16_t>(data, c_zip64ExtraFieldId);
+            AppendLittleEndian<uint16_t>(data, 16);
+            AppendLittleEndian<uint64_t>(data, entry.uncompressedSize);
+            AppendLittleEndian<uint64_t>(data, entry.compressedSize);
+        }
+    }
+
+    void WriteCentralHeader(std::vector<std::byte>& data, const ZipEntry& entry)
+    {
+        std::vector<uint64_t> zip64Values;
+        auto saturate = [&](uint64_t value)
+        {
+            if (value < 0xFFFFFFFF)
+            {
+                return static_cast<uint32_t>(value);
+            }
+            zip64Values.push_back(value);
+            return 0xFFFFFFFFu;
+        };
+        uint32_t uncompressedSize = saturate(entry.uncompressedSize);
+        uint32_t compressedSize = saturate(entry.compressedSize);
+        uint32_t localHeaderOffset = saturate(entry.localHeaderOffset);
+        uint16_t version = zip64Values.empty() ? 20 : 45;
+
+        AppendLittleEndian<uint32_t>(data, c_centralHeaderSignature);
+        AppendLittleEndian<uint16_t>(data, version); // version made by
+        AppendLittleEndian<uint16_t>(data, version); // version needed to extract
+        AppendLittleEndian<uint16_t>(data, 0); // flags
+        AppendLittleEndian<uint16_t>(data, entry.compressionMethod);
+        AppendLittleEndian<uint16_t>(data, c_dosTime);
+        AppendLittleEndian<uint16_t>(data, c_dosDate);
+        AppendLittleEndian<uint32_t>(data, entry.crc32);
+        AppendLittleEndian<uint32_t>(data, compressedSize);
+        AppendLittleEndian<uint32_t>(data, uncompressedSize);
+        AppendLittleEndian<uint16_t>(data, static_cast<uint16_t>(entry.name.size()));
+        AppendLittleEndian<uint16_t>(data, static_cast<uint16_t>(zip64Values.empty() ? 0 : 4 + zip64Values.size() * 8));
+        AppendLittleEndian<uint16_t>(data, 0); // comment size
+        AppendLittleEndian<uint16_t>(data, 0); // disk number
+        AppendLittleEndian<uint16_t>(data, 0); // internal attributes
+        AppendLittleEndian<uint32_t>(data, 0); // external attributes
+        AppendLittleEndian<uint32_t>(data, localHeaderOffset);
+        data.insert(data.end(), reinterpret_cast<const std::byte*>(entry.name.data()), reinterpret_cast<const std::byte*>(entry.name.data() + entry.name.size()));
+        if (!zip64Values.empty())
+        {
+            AppendLittleEndian<uint16_t>(data, c_zip64ExtraFieldId);
+            AppendLittleEndian<uint16_t>(data, static_cast<uint16_t>(zip64Values.size() * 8));
+            for (uint64_t value : zip64Values)
+            {
+                AppendLittleEndian<uint64_t>(data, value);
+            }
+        }
+    }
+
+    // Appends the central directory and the end of central directory records. The data is written at dataOffset
+    // within the archive, which is where offsets within the data are relative to.
+    void WriteCentralDirectory(std::vector<std::byte>& data, uint64_t dataOffset, const std::vector<ZipEntry>& entries)
+    {
+        const uint64_t centralDirectoryOffset = dataOffset + data.size();
+        for (auto& entry : entries)
+        {
+            WriteCentralHeader(data, entry);
+        }
+        const uint64_t centralDirectorySize = dataOffset + data.size() - centralDirectoryOffset;
+
+        const bool isZip64 = entries.size() >= 0xFFFF || centralDirectoryOffset >= 0xFFFFFFFF || centralDirectorySize >= 0xFFFFFFFF;
+        if (isZip64)
+        {
+            const uint64_t zip64EndOffset = dataOffset + data.size();
+            AppendLittleEndian<uint32_t>(data, c_zip64EndOfCentralDirectorySignature);
+            AppendLittleEndian<uint64_t>(data, c_zip64EndOfCentralDirectorySize - 12); // size of the rest of the record
+            AppendLittleEndian<uint16_t>(data, 45); // version made by
+            AppendLittleEndian<uint16_t>(data, 45); // version needed to extract
+            AppendLittleEndian<uint32_t>(data, 0); // disk number
+            AppendLittleEndian<uint32_t>(data, 0); // disk with the central directory
+            AppendLittleEndian<uint64_t>(data, entries.size()); // entries on this disk
+            AppendLittleEndian<uint64_t>(data, entries.size()); // total entries
+            AppendLittleEndian<uint64_t>(data, centralDirectorySize);
+            AppendLittleEndian<uint64_t>(data, centralDirectoryOffset);
+
+            AppendLittleEndian<uint32_t>(data, c_zip64EndOfCentralDirectoryLocatorSignature);
+            AppendLittleEndian<uint32_t>(data, 0); // disk with the zip64 record
+            AppendLittleEndian<uint64_t>(data, zip64EndOffset);
+            AppendLittleEndian<uint32_t>(data, 1); // total disks
+        }
+
+        AppendLittleEndian<uint32_t>(data, c_endOfCentralDirectorySignature);
+        AppendLittleEndian<uint16_t>(data, 0); // disk number
+        AppendLittleEndian<uint16_t>(data, 0); // disk with the central directory
+        AppendLittleEndian<uint16_t>(data, static_cast<uint16_t>(isZip64 ? 0xFFFF : entries.size()));
+        AppendLittleEndian<uint16_t>(data, static_cast<uint16_t>(isZip64 ? 0xFFFF : entries.size()));
+        AppendLittleEndian<uint32_t>(data, static_cast<uint32_t>(isZip64 ? 0xFFFFFFFF : centralDirectorySize));
+        AppendLittleEndian<uint32_t>(data, static_cast<uint32_t>(isZip64 ? 0xFFFFFFFF : centralDirectoryOffset));
+        AppendLittleEndian<uint16_t>(data, 0); // comment size
+    }
+}
+
+void AddNpzMember(
+    std::span<const std::byte> archiveData,
+    std::string_view memberName,
+    std::span<const std::byte> memberData,
+    /*out*/std::vector<std::byte>& newArchiveData
+    )
+{
+    std::string name(memberName);
+    if (!EndsWithNpyExtension(name))
+    {
+        name += ".npy";
+    }
+    if (name.size() > 0xFFFF)
+    {
+        throw std::invalid_argument(fmt::format("NPZ archive member name '{}' is too long.", memberName));
+    }
+
+    std::optional<NpzArchive> archive;
+    if (!archiveData.empty())
+    {
+        archive.emplace(archiveData);
+    }
+
+    newArchiveData.clear();
+    std::vector<ZipEntry> entries;
+
+    // Existing members are copied as they are, compressed or not, under new headers.
+    if (archive)
+    {
+        for (auto& member : archive->GetMembers())
+        {
+            if (member.name == name)
+            {
+                continue;
+            }
+
+            auto dataOffset = static_cast<size_t>(archive->GetMemberDataOffset(member));
+            ZipEntry entry = { member.name, member.compressionMethod, member.crc32, member.compressedSize, member.uncompressedSize, newArchiveData.size() };
+            WriteLocalHeader(newArchiveData, entry);
+            newArchiveData.insert(newArchiveData.end(), archiveData.begin() + dataOffset, archiveData.begin() + dataOffset + static_cast<size_t>(member.compressedSize));
+            entries.push_back(entry);
+        }
+    }
+
+    ZipEntry newEntry = { name, c_compressionMethodStored, ComputeCrc32(memberData), memberData.size(), memberData.size(), newArchiveData.size() };
+    WriteLocalHeader(newArchiveData, newEntry);
+    newArchiveData.insert(newArchiveData.end(), memberData.begin(), memberData.end());
+    entries.push_back(newEntry);
+
+    WriteCentralDirectory(newArchiveData, 0, entries);
+}
+
+
+bool AppendNpzMember(
+    std::span<const std::byte> archiveData,
+    std::string_view memberName,
+    std::span<const std::byte> memberData,
+    /*out*/uint64_t& appendOffset,
+    /*out*/std::vector<std::byte>& appendedData
+    )
+{
+    std::string name(memberName);
+    if (!EndsWithNpyExtension(name))
+    {
+        name += ".npy";
+    }
+    if (name.size() > 0xFFFF)
+    {
+        throw std::invalid_argument(fmt::format("NPZ archive member name '{}' is too long.", memberName));
+    }
+
+    NpzArchive archive(archiveData);
+    if (archive.FindMember(name))
+    {
+        return false;
+    }
+
+    // The existing members stay where they are; only their central directory entries are written again.
+    std::vector<ZipEntry> entries;
+    entries.reserve(archive.GetMembers().size() + 1);
+    for (auto& member : archive.GetMembers())
+    {
+        entries.push_back({ member.name, member.compressionMethod, member.crc32, member.compressedSize, member.uncompressedSize, member.localHeaderOffset });
+    }
+
+    appendOffset = archive.GetCentralDirectoryOffset();
+    appendedData.clear();
+
+    ZipEntry newEntry = { name, c_compressionMethodStored, ComputeCrc32(memberData), memberData.size(), memberData.size(), appendOffset };
+    WriteLocalHeader(appendedData, newEntry);
+    appendedData.insert(appendedData.end(), memberData.begin(), memberData.end());
+    entries.push_back(newEntry);
+
+    WriteCentralDirectory(appendedData, appendOffset, entries);
+    return true;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <span>
+
+// A NumPy .npz archive (see numpy.savez) is a zip file holding one .npy file per array. A single array in an
+// archive is addressed as "archive.npz:name", where the ".npy" extension of the member name may be omitted.
+
+// Splits "archive.npz:name" into the archive path and the member name. Returns false, leaving the outputs
+// unchanged, if the path doesn't refer to a member of an .npz archive.
+bool SplitNpzMemberPath(std::string_view path, /*out*/ std::string_view& archivePath, /*out*/ std::string_view& memberName);
+
+// An index of the members of an .npz archive in memory. The index is built from the zip central directory, so a
+// member is found without scanning the archive, and only the members actually read are touched. Zip64 archives
+// (those larger than 4 GB or with more than 65535 members) are supported. The archive data must outlive the index.
+class NpzArchive
+{
+public:
+    struct Member
+    {
+        std::string name;
+        uint16_t compressionMethod = 0; // 0 (stored) or 8 (deflated); others can be indexed but not read.
+        bool isEncrypted = false;
+        uint32_t crc32 = 0;
+        uint64_t compressedSize = 0;
+        uint64_t uncompressedSize = 0;
+        uint64_t localHeaderOffset = 0;
+    };
+
+    explicit NpzArchive(std::span<const std::byte> archiveData);
+
+    const std::vector<Member>& GetMembers() const { return m_members; }
+
+    // Returns the offset of the zip central directory, which follows the data of the last member.
+    uint64_t GetCentralDirectoryOffset() const { return m_centralDirectoryOffset; }
+
+    // Finds a member by name, with or without its ".npy" extension. Returns null if there's no such member.
+    const Member* FindMember(std::string_view name) const;
+
+    // Returns the offset of a member's (possibly compressed) data within the archive.
+    uint64_t GetMemberDataOffset(const Member& member) const;
+
+    // Returns the contents of a member. A stored member is returned as a view of the archive data and nothing is
+    // allocated; a deflated member is decompressed into decompressedData and the result is a view of it. The
+    // index isn't modified, so different members may be read by different threads at the same time.
+    std::span<const std::byte> ReadMember(const Member& member, /*out*/ std::vector<std::byte>& decompressedData) const;
+
+private:
+    std::span<const std::byte> m_archiveData;
+    uint64_t m_centralDirectoryOffset = 0;
+    std::vector<Member> m_members;
+    std::unordered_map<std::string, size_t> m_memberIndices;
+};
+
+// Writes an .npz archive to in-memory file data, holding the members of an existing archive (which may be empty)
+// plus one more. A member with the same name is replaced. The new member is stored uncompressed, like
+// numpy.savez, so it can be read in place; existing members are copied without being recompressed.
+void AddNpzMember(
+    std::span<const std::byte> archiveData,
+    std::string_view memberName,
+    std::span<const std::byte> memberData,
+    /*out*/std::vector<std::byte>& newArchiveData
+    );
+
+// Adds a member to an existing archive without copying the other members. The result replaces the end of the
+// archive, from appendOffset (the start of its central directory) on: it holds the new member followed by a new
+// central directory. Returns false, leaving the outputs unchanged, if the archive already has a member with the
+// same name; AddNpzMember must be used to replace it.
+bool AppendNpzMember(
+    std::span<const std::byte> archiveData,
+    std::string_view memberName,
+    std::span<const std::byte> memberData,
+    /*out*/uint64_t& appendOffset,
+    /*out*/std::vector<std::byte>& appendedData
+    );
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The threads an automatic thread count may use on this thread, when it's a worker of a ParallelFor (0 when it
+// isn't). Nested loops share the enclosing loop's threads rather than each using every hardware thread.
+inline thread_local uint32_t t_parallelForThreadBudget = 0;
+
+// Returns the number of worker threads to use when the caller asks for 0 ("automatic").
+inline uint32_t GetDefaultThreadCount()
+{
+    if (t_parallelForThreadBudget != 0)
+    {
+        return t_parallelForThreadBudget;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Invokes func(index, workerIndex) once for every index in [0, count) using up to threadCount threads, one of
+// which is the calling thread (workerIndex 0). Each worker starts with a contiguous range of indices and, once
+// its own range is exhausted, steals indices from the back of other workers' ranges; this keeps all threads
+// busy when the cost of each index varies widely (e.g. parsing resources backed by files of different sizes).
+//
+// Calls may nest: an automatic thread count (0) inside a call uses that worker's share of the enclosing
+// call's threads (e.g. 8 images decoded in parallel on 16 hardware threads each convert rows on 2 threads).
+//
+// Returns after every call has completed. If any call throws, the exception for the lowest index is rethrown.
+inline void ParallelFor(size_t count, uint32_t threadCount, const std::function<void(size_t index, uint32_t workerIndex)>& func)
+{
+    const uint32_t threadBudget = GetDefaultThreadCount();
+    if (threadCount == 0)
+    {
+        threadCount = threadBudget;
+    }
+    threadCount = static_cast<uint32_t>(std::min<size_t>(threadCount, count));
+
+    if (threadCount <= 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            func(i, 0);
+        }
+        return;
+    }
+
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<size_t> indices;
+    };
+
+    std::vector<WorkQueue> queues(threadCount);
+    for (size_t i = 0; i < count; i++)
+    {
+        queues[i * threadCount / count].indices.push_back(i);
+    }
+
+    std::mutex errorMutex;
+    std::exception_ptr firstError;
+    size_t firstErrorIndex = count;
+
+    auto tryTake = [&](uint32_t queueIndex, bool fromFront, size_t& index)
+    {
+        auto& queue = queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.indices.empty())
+        {
+            return false;
+        }
+        if (fromFront)
+        {
+            index = queue.indices.front();
+            queue.indices.pop_front();
+        }
+        else
+        {
+            index = queue.indices.back();
+            queue.indices.pop_back();
+        }
+        return true;
+    };
+
+    auto worker = [&](uint32_t workerIndex)
+    {
+        const uint32_t previousThreadBudget = t_parallelForThreadBudget;
+        t_parallelForThreadBudget = std::max(1u, threadBudget / threadCount);
+
+        size_t index;
+        while (true)
+        {
+            bool found = tryTake(workerIndex, true, index);
+            for (uint32_t i = 1; !found && i < threadCount; i++)
+            {
+                found = tryTake((workerIndex + i) % threadCount, false, index);
+            }
+            if (!found)
+            {
+                // Work is never added after the queues are filled, so all queues being empty means we're done.
+                t_parallelForThreadBudget = previousThreadBudget;
+                return;
+            }
+
+            try
+            {
+                func(index, workerIndex);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (index < firstErrorIndex)
+                {
+                    firstErrorIndex = index;
+                    firstError = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (firstError)
+    {
+        std::rethrow_exception(firstError);
+    }
+}
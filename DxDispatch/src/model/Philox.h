@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel Random Numbers: As Easy as
+// 1, 2, 3"). This is the same generator used by DML_OPERATOR_RANDOM_GENERATOR. Each call maps a 128-bit counter
+// and a 64-bit key to 128 random bits with no state carried between calls, so any element of a random sequence
+// can be generated independently of the others; this is what lets large buffers be filled in parallel and still
+// be identical for a given seed regardless of how the work is split.
+class Philox4x32
+{
+public:
+    using Result = std::array<uint32_t, 4>;
+
+    explicit Philox4x32(uint64_t seed) : m_key{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) } {}
+
+    Result operator()(uint64_t counterLow, uint64_t counterHigh = 0) const
+    {
+        Result counter = {
+            static_cast<uint32_t>(counterLow),
+            static_cast<uint32_t>(counterLow >> 32),
+            static_cast<uint32_t>(counterHigh),
+            static_cast<uint32_t>(counterHigh >> 32)
+        };
+        uint32_t key0 = m_key[0];
+        uint32_t key1 = m_key[1];
+
+        for (uint32_t round = 0; round < 10; round++)
+        {
+            uint64_t product0 = uint64_t(0xD2511F53u) * counter[0];
+            uint64_t product1 = uint64_t(0xCD9E8D57u) * counter[2];
+            counter = {
+                static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+                static_cast<uint32_t>(product1),
+                static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+                static_cast<uint32_t>(product0)
+            };
+            key0 += 0x9E3779B9u;
+            key1 += 0xBB67AE85u;
+        }
+
+        return counter;
+    }
+
+private:
+    std::array<uint32_t, 2> m_key;
+};
@@ -0,0 +1,316 @@
+#include "pch.h"
+#include "ResultsFile.h"
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+static bool EqualsIgnoreCase(std::string_view a, std::string_view b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](unsigned char x, unsigned char y) { return std::tolower(x) == std::tolower(y); });
+}
+
+// Quotes a CSV field if it contains a separator, quote, or line break (RFC 4180).
+static std::string EscapeCsvField(std::string_view field)
+{
+    if (field.find_first_of(",\"\r\n") == std::string_view::npos)
+    {
+        return std::string(field);
+    }
+
+    std::string escaped = "\"";
+    for (char c : field)
+    {
+        escaped += c;
+        if (c == '"')
+        {
+            escaped += '"';
+        }
+    }
+    escaped += '"';
+    return escaped;
+}
+
+ResultsFile::ResultsFile(std::filesystem::path path, RunInfo runInfo) :
+    m_path(std::move(path)),
+    m_format(EqualsIgnoreCase(m_path.extension().string(), ".csv") ? Format::Csv : Format::Json),
+    m_runInfo(std::move(runInfo))
+{
+}
+
+void ResultsFile::Append(const DispatchResult& result)
+{
+    std::string text;
+    if (m_format == Format::Csv)
+    {
+        std::error_code error;
+        if (!std::filesystem::exists(m_path, error) || std::filesystem::file_size(m_path, error) == 0)
+        {
+            text = FormatCsvHeader();
+        }
+        text += FormatCsv(result);
+    }
+    else
+    {
+        text = FormatJson(result);
+    }
+
+    std::ofstream file(m_path, std::ios::app | std::ios::binary);
+    file << text << '\n';
+    if (!file)
+    {
+        throw std::ios::failure(fmt::format("Failed to write results file '{}'.", m_path.string()));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// JSON
+// ----------------------------------------------------------------------------
+
+template <typename WriterType>
+static void WriteStats(WriterType& writer, const LatencyHistogram& histogram, bool includeHistogram)
+{
+    writer.StartObject();
+    writer.Key("count"); writer.Uint64(histogram.Count());
+    writer.Key("min"); writer.Double(histogram.Min());
+    writer.Key("median"); writer.Double(histogram.Percentile(0.5));
+    writer.Key("mean"); writer.Double(histogram.Average());
+    writer.Key("stddev"); writer.Double(histogram.StandardDeviation());
+    writer.Key("p90"); writer.Double(histogram.Percentile(0.9));
+    writer.Key("p99"); writer.Double(histogram.Percentile(0.99));
+    writer.Key("p999"); writer.Double(histogram.Percentile(0.999));
+    writer.Key("max"); writer.Double(histogram.Max());
+
+    // e.g. "histogram": [[0.0512, 3], [0.0514, 8]] for 3 samples near 0.0512 ms and 8 near 0.0514 ms. The
+    // precision and resolution are recorded so the histogram can be rebuilt with the same buckets.
+    if (includeHistogram)
+    {
+        writer.Key("precisionBits"); writer.Uint(histogram.PrecisionBits());
+        writer.Key("resolution"); writer.Double(histogram.Resolution());
+        writer.Key("histogram");
+        writer.StartArray();
+        for (auto& bucket : histogram.GetBuckets())
+        {
+            writer.StartArray();
+            writer.Double(bucket.value);
+            writer.Uint64(bucket.count);
+            writer.EndArray();
+        }
+        writer.EndArray();
+    }
+    writer.EndObject();
+}
+
+std::string ResultsFile::FormatJson(const DispatchResult& result) const
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    writer.Key("model"); writer.String(m_runInfo.modelPath.c_str());
+    writer.Key("modelHash"); writer.String(fmt::format("{:016x}", m_runInfo.modelHash).c_str());
+    writer.Key("adapter"); writer.String(m_runInfo.adapterDescription.c_str());
+    writer.Key("driverVersion"); writer.String(m_runInfo.adapterDriverVersion.c_str());
+    writer.Key("dispatch"); writer.String(result.dispatchName.data(), static_cast<rapidjson::SizeType>(result.dispatchName.size()));
+    writer.Key("iterations"); writer.Uint(result.iterations);
+    writer.Key("repeat"); writer.Uint(m_runInfo.dispatchRepeat);
+    writer.Key("warmupSamples"); writer.Uint(m_runInfo.maxWarmupSamples);
+    writer.Key("dispatchBatch"); writer.Uint(m_runInfo.dispatchBatchSize);
+    writer.Key("framesInFlight"); writer.Uint(m_runInfo.framesInFlight);
+
+    auto writeTimings = [&](const char* name, const LatencyHistogram& cold, const LatencyHistogram& hot)
+    {
+        writer.Key(name);
+        writer.StartObject();
+        writer.Key("cold"); WriteStats(writer, cold, false);
+        writer.Key("hot"); WriteStats(writer, hot, true);
+        writer.EndObject();
+    };
+    writeTimings("cpu", result.cpuCold, result.cpuHot);
+    if (result.gpuCold.Count() + result.gpuHot.Count() > 0)
+    {
+        writeTimings("gpu", result.gpuCold, result.gpuHot);
+    }
+    writer.EndObject();
+
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+static LatencyHistogram ReadHistogram(const rapidjson::Value& timings)
+{
+    if (!timings.IsObject() || !timings.HasMember("hot") || !timings["hot"].IsObject() ||
+        !timings["hot"].HasMember("histogram") || !timings["hot"]["histogram"].IsArray())
+    {
+        throw std::invalid_argument("Expected 'hot' timings with a 'histogram'.");
+    }
+    auto& hot = timings["hot"];
+
+    // Results written before the precision and resolution were recorded used the defaults.
+    LatencyHistogram defaultHistogram;
+    uint32_t precisionBits = defaultHistogram.PrecisionBits();
+    double resolution = defaultHistogram.Resolution();
+    if (hot.HasMember("precisionBits"))
+    {
+        if (!hot["precisionBits"].IsUint())
+        {
+            throw std::invalid_argument("'precisionBits' must be an unsigned integer.");
+        }
+        precisionBits = hot["precisionBits"].GetUint();
+    }
+    if (hot.HasMember("resolution"))
+    {
+        if (!hot["resolution"].IsNumber())
+        {
+            throw std::invalid_argument("'resolution' must be a number.");
+        }
+        resolution = hot["resolution"].GetDouble();
+    }
+
+    LatencyHistogram histogram(precisionBits, resolution);
+    for (auto& bucket : hot["histogram"].GetArray())
+    {
+        if (!bucket.IsArray() || bucket.Size() != 2 || !bucket[0].IsNumber() || !bucket[1].IsUint64())
+        {
+            throw std::invalid_argument("Histogram buckets must be [value, count] pairs.");
+        }
+        histogram.Record(bucket[0].GetDouble(), bucket[1].GetUint64());
+    }
+    return histogram;
+}
+
+static ResultsFile::RunInfo ReadRunInfo(const rapidjson::Value& result)
+{
+    auto getString = [&](const char* name)
+    {
+        if (!result.HasMember(name) || !result[name].IsString())
+        {
+            throw std::invalid_argument(fmt::format("Expected a '{}' string.", name));
+        }
+        return std::string(result[name].GetString(), result[name].GetStringLength());
+    };
+    auto getUint = [&](const char* name)
+    {
+        if (!result.HasMember(name) || !result[name].IsUint())
+        {
+            throw std::invalid_argument(fmt::format("Expected a '{}' unsigned integer.", name));
+        }
+        return result[name].GetUint();
+    };
+
+    // Results written before a field was recorded used its default.
+    auto getOptionalUint = [&](const char* name, uint32_t defaultValue)
+    {
+        return result.HasMember(name) ? getUint(name) : defaultValue;
+    };
+
+    ResultsFile::RunInfo runInfo = {};
+    runInfo.modelPath = getString("model");
+    auto modelHash = getString("modelHash");
+    auto [end, error] = std::from_chars(modelHash.data(), modelHash.data() + modelHash.size(), runInfo.modelHash, 16);
+    if (error != std::errc() || end != modelHash.data() + modelHash.size())
+    {
+        throw std::invalid_argument(fmt::format("Invalid 'modelHash' '{}'.", modelHash));
+    }
+    runInfo.adapterDescription = getString("adapter");
+    runInfo.adapterDriverVersion = getString("driverVersion");
+    runInfo.dispatchRepeat = getUint("repeat");
+    runInfo.maxWarmupSamples = getUint("warmupSamples");
+    runInfo.dispatchBatchSize = getOptionalUint("dispatchBatch", 1);
+    runInfo.framesInFlight = getOptionalUint("framesInFlight", 1);
+    return runInfo;
+}
+
+std::unordered_map<std::string, ResultsFile::RecordedResult> ResultsFile::ReadJsonResults(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::ios::failure(fmt::format("Failed to open results file '{}'.", path.string()));
+    }
+
+    std::unordered_map<std::string, RecordedResult> results;
+    std::string line;
+    for (uint32_t lineNumber = 1; std::getline(file, line); lineNumber++)
+    {
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+        {
+            continue;
+        }
+
+        try
+        {
+            rapidjson::Document document;
+            document.Parse(line.c_str(), line.size());
+            if (document.HasParseError() || !document.IsObject() || !document.HasMember("dispatch") || !document["dispatch"].IsString())
+            {
+                throw std::invalid_argument("Expected a JSON object with a 'dispatch' name (CSV results can't be read).");
+            }
+            if (!document.HasMember("cpu"))
+            {
+                throw std::invalid_argument("Expected 'cpu' timings.");
+            }
+
+            RecordedResult result;
+            result.runInfo = ReadRunInfo(document);
+            result.cpuHot = ReadHistogram(document["cpu"]);
+            if (document.HasMember("gpu"))
+            {
+                result.gpuHot = ReadHistogram(document["gpu"]);
+            }
+            results.insert_or_assign(document["dispatch"].GetString(), std::move(result));
+        }
+        catch (const std::exception& e)
+        {
+            throw std::invalid_argument(fmt::format("Invalid result on line {} of '{}': {}", lineNumber, path.string(), e.what()));
+        }
+    }
+    return results;
+}
+
+// ----------------------------------------------------------------------------
+// CSV
+// ----------------------------------------------------------------------------
+
+std::string ResultsFile::FormatCsvHeader()
+{
+    std::string header = "model,modelHash,adapter,driverVersion,dispatch,iterations,repeat,warmupSamples,dispatchBatch,framesInFlight";
+    for (auto device : {"cpu", "gpu"})
+    {
+        header += fmt::format(",{0}ColdCount,{0}ColdMean", device);
+        for (auto stat : {"Count", "Min", "Median", "Mean", "Stddev", "P90", "P99", "P999", "Max"})
+        {
+            header += fmt::format(",{}Hot{}", device, stat);
+        }
+    }
+    return header + "\n";
+}
+
+std::string ResultsFile::FormatCsv(const DispatchResult& result) const
+{
+    std::string row = fmt::format("{},{:016x},{},{},{},{},{},{},{},{}",
+        EscapeCsvField(m_runInfo.modelPath),
+        m_runInfo.modelHash,
+        EscapeCsvField(m_runInfo.adapterDescription),
+        EscapeCsvField(m_runInfo.adapterDriverVersion),
+        EscapeCsvField(result.dispatchName),
+        result.iterations,
+        m_runInfo.dispatchRepeat,
+        m_runInfo.maxWarmupSamples,
+        m_runInfo.dispatchBatchSize,
+        m_runInfo.framesInFlight);
+
+    auto appendTimings = [&](const LatencyHistogram& cold, const LatencyHistogram& hot)
+    {
+        // Without any samples (e.g. GPU timing is disabled), the cells are left empty.
+        if (cold.Count() + hot.Count() == 0)
+        {
+            row += std::string(11, ',');
+            return;
+        }
+        row += fmt::format(",{},{},{},{},{},{},{},{},{},{},{}",
+            cold.Count(), cold.Average(),
+            hot.Count(), hot.Min(), hot.Percentile(0.5), hot.Average(), hot.StandardDeviation(),
+            hot.Percentile(0.9), hot.Percentile(0.99), hot.Percentile(0.999), hot.Max());
+    };
+    appendTimings(result.cpuCold, result.cpuHot);
+    appendTimings(result.gpuCold, result.gpuHot);
+    return row;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "LatencyHistogram.h"
+
+// Appends the timing results of each dispatch command to a file (--results_file) for tools to ingest. A .csv
+// file gets a row per dispatch, under a header row written when the file is created. Any other file gets a line
+// of JSON per dispatch (JSON Lines), which also records the hot samples' histogram. Both append, so one file can
+// collect the results of many commands and runs.
+class ResultsFile
+{
+public:
+    // Describes the run; it's repeated in every result so results from different runs can share a file.
+    struct RunInfo
+    {
+        std::string modelPath;
+        uint64_t modelHash;
+        std::string adapterDescription;
+        std::string adapterDriverVersion;
+        uint32_t dispatchRepeat;
+        uint32_t maxWarmupSamples;
+        uint32_t dispatchBatchSize = 1;
+        uint32_t framesInFlight = 1;
+    };
+
+    struct DispatchResult
+    {
+        std::string_view dispatchName;
+        uint32_t iterations;
+        const LatencyHistogram& cpuCold;
+        const LatencyHistogram& cpuHot;
+        const LatencyHistogram& gpuCold; // Empty if GPU timing is disabled.
+        const LatencyHistogram& gpuHot;
+    };
+
+    enum class Format
+    {
+        Json,
+        Csv
+    };
+
+    // The hot samples of a dispatch in a JSON results file, rebuilt from its histogram, and the run that recorded them.
+    struct RecordedResult
+    {
+        RunInfo runInfo;
+        LatencyHistogram cpuHot;
+        LatencyHistogram gpuHot; // Empty if the run didn't time the GPU.
+    };
+
+    ResultsFile(std::filesystem::path path, RunInfo runInfo);
+
+    // Reads a JSON results file, by dispatch name. Later results for a dispatch (e.g. from a later run appended
+    // to the same file) replace earlier ones.
+    static std::unordered_map<std::string, RecordedResult> ReadJsonResults(const std::filesystem::path& path);
+
+    // Appends a result and closes the file, so results aren't lost if a later command fails.
+    void Append(const DispatchResult& result);
+
+    const std::filesystem::path& GetPath() const { return m_path; }
+
+private:
+    std::string FormatJson(const DispatchResult& result) const;
+    static std::string FormatCsvHeader();
+    std::string FormatCsv(const DispatchResult& result) const;
+
+private:
+    std::filesystem::path m_path;
+    Format m_format;
+    RunInfo m_runInfo;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+// Size arithmetic that throws instead of silently wrapping. Tensors can exceed 4 GB, so sizes and element
+// counts are computed in 64 bits and checked before they're used to allocate or index memory.
+
+inline uint64_t SafeMultiply(uint64_t a, uint64_t b)
+{
+    if (b != 0 && (a > std::numeric_limits<uint64_t>::max() / b))
+    {
+        throw std::overflow_error("Overflow in size calculation");
+    }
+    return a * b;
+}
+
+inline uint64_t SafeAdd(uint64_t a, uint64_t b)
+{
+    if (a > std::numeric_limits<uint64_t>::max() - b)
+    {
+        throw std::overflow_error("Overflow in size calculation");
+    }
+    return a + b;
+}
+
+// Converts a 64-bit size to size_t, which is narrower in 32-bit builds.
+inline size_t SafeSizeCast(uint64_t value)
+{
+    if (value > std::numeric_limits<size_t>::max())
+    {
+        throw std::overflow_error("Size exceeds the address space");
+    }
+    return static_cast<size_t>(value);
+}
@@ -0,0 +1,614 @@
+#include "pch.h"
+#include "StdSupport.h"
+#include "TensorCast.h"
+#include "SafeArithmetic.h"
+#include "ParallelFor.h"
+#include "CpuFeatures.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CAST_SSE2
+#endif
+#if defined(CPU_FEATURES_X86)
+// F16C is detected at runtime (see CpuFeatures.h).
+#include <immintrin.h>
+#define CAST_F16C
+#endif
+#if defined(_M_ARM64) || defined(__aarch64__)
+#include <arm_neon.h>
+#define CAST_NEON
+#endif
+
+using half_float::half;
+
+namespace
+{
+    // Elements are loaded and stored through memcpy, since tensor data read in place from a file (e.g. an .npz
+    // member) isn't necessarily aligned to its element size.
+    template <typename T>
+    T LoadElement(const std::byte* p)
+    {
+        T value;
+        memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void StoreElement(std::byte* p, T value)
+    {
+        memcpy(p, &value, sizeof(T));
+    }
+
+    // Rounds to the nearest float16 with ties to even, like F16C and NEON. (half_float::half_cast rounds ties away
+    // from zero unless HALF_ROUND_TIES_TO_EVEN is defined before half.hpp is first included.) Scaling by powers of
+    // two is exact, so a double (or float) is rounded only once.
+    inline half RoundToHalf(double value)
+    {
+        uint16_t bits = std::signbit(value) ? 0x8000 : 0;
+        double magnitude = std::fabs(value);
+        if (std::isnan(value))
+        {
+            bits |= 0x7E00;
+        }
+        else if (magnitude >= 65520.0) // Halfway between the largest float16 (65504) and 65536 rounds to even (inf).
+        {
+            bits |= 0x7C00;
+        }
+        else if (magnitude < 0x1p-14) // Subnormal; rounding up to 0x400 correctly yields the smallest normal.
+        {
+            bits |= static_cast<uint16_t>(std::nearbyint(magnitude * 0x1p24));
+        }
+        else
+        {
+            int exponent = std::ilogb(magnitude);
+            auto mantissa = static_cast<uint32_t>(std::nearbyint(std::ldexp(magnitude, 10 - exponent)));
+            if (mantissa == 2048)
+            {
+                mantissa = 1024;
+                exponent++;
+            }
+            bits |= static_cast<uint16_t>(((exponent + 15) << 10) | (mantissa - 1024));
+        }
+
+        half result;
+        memcpy(static_cast<void*>(&result), &bits, sizeof(bits));
+        return result;
+    }
+
+    template <typename T>
+    constexpr bool IsFloatingPoint = std::is_floating_point_v<T> || std::is_same_v<T, half>;
+
+    template <typename DestinationType, typename SourceType>
+    DestinationType CastElement(SourceType value)
+    {
+        if constexpr (std::is_same_v<DestinationType, SourceType>)
+        {
+            return value;
+        }
+        else if constexpr (std::is_same_v<DestinationType, half>)
+        {
+            if constexpr (std::is_same_v<SourceType, double> || std::is_same_v<SourceType, float>)
+            {
+                return RoundToHalf(value);
+            }
+            else
+            {
+                // Every integer that doesn't overflow float16 is exact in a double.
+                return RoundToHalf(static_cast<double>(value));
+            }
+        }
+        else if constexpr (IsFloatingPoint<DestinationType>)
+        {
+            if constexpr (std::is_same_v<SourceType, half>)
+            {
+                return static_cast<DestinationType>(static_cast<float>(value));
+            }
+            else
+            {
+                return static_cast<DestinationType>(value);
+            }
+        }
+        else if constexpr (IsFloatingPoint<SourceType>)
+        {
+            using Limits = std::numeric_limits<DestinationType>;
+            double rounded;
+            if constexpr (std::is_same_v<SourceType, double>)
+            {
+                rounded = std::nearbyint(value);
+            }
+            else
+            {
+                rounded = std::nearbyint(static_cast<float>(value));
+            }
+
+            if (std::isnan(rounded))
+            {
+                return 0;
+            }
+            // The limits of 64-bit types aren't exact as doubles, but they round to the next power of two, so
+            // anything at or beyond them is out of range.
+            if (rounded <= static_cast<double>(Limits::min()))
+            {
+                return Limits::min();
+            }
+            if (rounded >= static_cast<double>(Limits::max()))
+            {
+                return Limits::max();
+            }
+            return static_cast<DestinationType>(rounded);
+        }
+        else
+        {
+            using Limits = std::numeric_limits<DestinationType>;
+            if constexpr (std::is_signed_v<SourceType>)
+            {
+                int64_t signedValue = value;
+                if (signedValue < static_cast<int64_t>(Limits::min()))
+                {
+                    return Limits::min();
+                }
+                if (signedValue > 0 && static_cast<uint64_t>(signedValue) > static_cast<uint64_t>(Limits::max()))
+                {
+                    return Limits::max();
+                }
+                return static_cast<DestinationType>(signedValue);
+            }
+            else
+            {
+                uint64_t unsignedValue = value;
+                if (unsignedValue > static_cast<uint64_t>(Limits::max()))
+                {
+                    return Limits::max();
+                }
+                return static_cast<DestinationType>(unsignedValue);
+            }
+        }
+    }
+
+    // Converts as many leading elements as a vector kernel can, and returns how many were converted. The scalar
+    // loop in CastElements converts the rest (all of them when there's no kernel for the pair of types).
+    template <typename DestinationType, typename SourceType>
+    size_t CastElementsVectorized(const std::byte* /*source*/, std::byte* /*destination*/, size_t /*elementCount*/)
+    {
+        return 0;
+    }
+
+#if defined(CAST_F16C)
+    TARGET_INSTRUCTIONS("avx,f16c")
+    size_t CastFloatToHalfF16C(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            __m256 v = _mm256_loadu_ps(reinterpret_cast<const float*>(source + i * sizeof(float)));
+            __m128i h = _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * sizeof(half)), h);
+        }
+        return i;
+    }
+
+    TARGET_INSTRUCTIONS("avx,f16c")
+    size_t CastHalfToFloatF16C(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * sizeof(half)));
+            _mm256_storeu_ps(reinterpret_cast<float*>(destination + i * sizeof(float)), _mm256_cvtph_ps(h));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<half, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        return GetCpuFeatures().f16c ? CastFloatToHalfF16C(source, destination, elementCount) : 0;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, half>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        return GetCpuFeatures().f16c ? CastHalfToFloatF16C(source, destination, elementCount) : 0;
+    }
+#elif defined(CAST_NEON)
+    template <>
+    size_t CastElementsVectorized<half, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 4 <= elementCount; i += 4)
+        {
+            float32x4_t v = vld1q_f32(reinterpret_cast<const float*>(source + i * sizeof(float)));
+            uint16x4_t h = vreinterpret_u16_f16(vcvt_f16_f32(v));
+            vst1_u16(reinterpret_cast<uint16_t*>(destination + i * sizeof(half)), h);
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, half>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 4 <= elementCount; i += 4)
+        {
+            uint16x4_t h = vld1_u16(reinterpret_cast<const uint16_t*>(source + i * sizeof(half)));
+            vst1q_f32(reinterpret_cast<float*>(destination + i * sizeof(float)), vcvt_f32_f16(vreinterpret_f16_u16(h)));
+        }
+        return i;
+    }
+#endif
+
+#if defined(CAST_SSE2)
+    // Rounds (ties to even, the default MXCSR mode) and clamps four floats to the range of IntegerType, with NaN
+    // becoming 0. Clamping before rounding gives the same result as after, since the limits are integers.
+    template <typename IntegerType>
+    __m128i RoundAndClamp(const std::byte* source)
+    {
+        const __m128 minValue = _mm_set1_ps(static_cast<float>(std::numeric_limits<IntegerType>::min()));
+        const __m128 maxValue = _mm_set1_ps(static_cast<float>(std::numeric_limits<IntegerType>::max()));
+        __m128 v = _mm_loadu_ps(reinterpret_cast<const float*>(source));
+        v = _mm_and_ps(v, _mm_cmpord_ps(v, v));
+        v = _mm_min_ps(_mm_max_ps(v, minValue), maxValue);
+        return _mm_cvtps_epi32(v);
+    }
+
+    template <>
+    size_t CastElementsVectorized<int8_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 16 <= elementCount; i += 16)
+        {
+            const std::byte* s = source + i * sizeof(float);
+            __m128i lo = _mm_packs_epi32(RoundAndClamp<int8_t>(s), RoundAndClamp<int8_t>(s + 16));
+            __m128i hi = _mm_packs_epi32(RoundAndClamp<int8_t>(s + 32), RoundAndClamp<int8_t>(s + 48));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packs_epi16(lo, hi));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<uint8_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 16 <= elementCount; i += 16)
+        {
+            const std::byte* s = source + i * sizeof(float);
+            __m128i lo = _mm_packs_epi32(RoundAndClamp<uint8_t>(s), RoundAndClamp<uint8_t>(s + 16));
+            __m128i hi = _mm_packs_epi32(RoundAndClamp<uint8_t>(s + 32), RoundAndClamp<uint8_t>(s + 48));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(lo, hi));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<int16_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            const std::byte* s = source + i * sizeof(float);
+            __m128i v = _mm_packs_epi32(RoundAndClamp<int16_t>(s), RoundAndClamp<int16_t>(s + 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * sizeof(int16_t)), v);
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<uint16_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        // SSE2 has no unsigned saturating pack from 32 bits, so the values are biased into the int16 range, packed,
+        // and unbiased again by flipping the top bit.
+        const __m128i bias = _mm_set1_epi32(0x8000);
+        const __m128i flip = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            const std::byte* s = source + i * sizeof(float);
+            __m128i lo = _mm_sub_epi32(RoundAndClamp<uint16_t>(s), bias);
+            __m128i hi = _mm_sub_epi32(RoundAndClamp<uint16_t>(s + 16), bias);
+            __m128i v = _mm_xor_si128(_mm_packs_epi32(lo, hi), flip);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * sizeof(uint16_t)), v);
+        }
+        return i;
+    }
+
+    // Widens eight 16-bit integers to float32, sign- or zero-extending them first.
+    template <bool isSigned>
+    void StoreWidened16(__m128i v, std::byte* destination)
+    {
+        __m128i lo, hi;
+        if constexpr (isSigned)
+        {
+            lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        }
+        else
+        {
+            lo = _mm_unpacklo_epi16(v, _mm_setzero_si128());
+            hi = _mm_unpackhi_epi16(v, _mm_setzero_si128());
+        }
+        _mm_storeu_ps(reinterpret_cast<float*>(destination), _mm_cvtepi32_ps(lo));
+        _mm_storeu_ps(reinterpret_cast<float*>(destination + 16), _mm_cvtepi32_ps(hi));
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, int8_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 16 <= elementCount; i += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            std::byte* d = destination + i * sizeof(float);
+            StoreWidened16<true>(_mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8), d);
+            StoreWidened16<true>(_mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8), d + 32);
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, uint8_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 16 <= elementCount; i += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            std::byte* d = destination + i * sizeof(float);
+            StoreWidened16<false>(_mm_unpacklo_epi8(v, _mm_setzero_si128()), d);
+            StoreWidened16<false>(_mm_unpackhi_epi8(v, _mm_setzero_si128()), d + 32);
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, int16_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * sizeof(int16_t)));
+            StoreWidened16<true>(v, destination + i * sizeof(float));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, uint16_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * sizeof(uint16_t)));
+            StoreWidened16<false>(v, destination + i * sizeof(float));
+        }
+        return i;
+    }
+#elif defined(CAST_NEON)
+    // vcvtnq rounds ties to even, turns NaN into 0, and saturates to int32; the narrowing moves saturate the rest.
+    inline int32x4_t RoundToInt32(const std::byte* source)
+    {
+        return vcvtnq_s32_f32(vld1q_f32(reinterpret_cast<const float*>(source)));
+    }
+
+    inline int16x8_t RoundToInt16(const std::byte* source)
+    {
+        return vcombine_s16(vqmovn_s32(RoundToInt32(source)), vqmovn_s32(RoundToInt32(source + 16)));
+    }
+
+    template <>
+    size_t CastElementsVectorized<int8_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            vst1_s8(reinterpret_cast<int8_t*>(destination + i), vqmovn_s16(RoundToInt16(source + i * sizeof(float))));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<uint8_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            vst1_u8(reinterpret_cast<uint8_t*>(destination + i), vqmovun_s16(RoundToInt16(source + i * sizeof(float))));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<int16_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            vst1q_s16(reinterpret_cast<int16_t*>(destination + i * sizeof(int16_t)), RoundToInt16(source + i * sizeof(float)));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<uint16_t, float>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 4 <= elementCount; i += 4)
+        {
+            uint16x4_t v = vqmovun_s32(RoundToInt32(source + i * sizeof(float)));
+            vst1_u16(reinterpret_cast<uint16_t*>(destination + i * sizeof(uint16_t)), v);
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, int8_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            int16x8_t v = vmovl_s8(vld1_s8(reinterpret_cast<const int8_t*>(source + i)));
+            float* d = reinterpret_cast<float*>(destination + i * sizeof(float));
+            vst1q_f32(d, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+            vst1q_f32(d + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, uint8_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 8 <= elementCount; i += 8)
+        {
+            uint16x8_t v = vmovl_u8(vld1_u8(reinterpret_cast<const uint8_t*>(source + i)));
+            float* d = reinterpret_cast<float*>(destination + i * sizeof(float));
+            vst1q_f32(d, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+            vst1q_f32(d + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, int16_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 4 <= elementCount; i += 4)
+        {
+            int16x4_t v = vld1_s16(reinterpret_cast<const int16_t*>(source + i * sizeof(int16_t)));
+            vst1q_f32(reinterpret_cast<float*>(destination + i * sizeof(float)), vcvtq_f32_s32(vmovl_s16(v)));
+        }
+        return i;
+    }
+
+    template <>
+    size_t CastElementsVectorized<float, uint16_t>(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = 0;
+        for (; i + 4 <= elementCount; i += 4)
+        {
+            uint16x4_t v = vld1_u16(reinterpret_cast<const uint16_t*>(source + i * sizeof(uint16_t)));
+            vst1q_f32(reinterpret_cast<float*>(destination + i * sizeof(float)), vcvtq_f32_u32(vmovl_u16(v)));
+        }
+        return i;
+    }
+#endif
+
+    template <typename DestinationType, typename SourceType>
+    void CastElements(const std::byte* source, std::byte* destination, size_t elementCount)
+    {
+        size_t i = CastElementsVectorized<DestinationType, SourceType>(source, destination, elementCount);
+        for (; i < elementCount; i++)
+        {
+            auto value = LoadElement<SourceType>(source + i * sizeof(SourceType));
+            StoreElement(destination + i * sizeof(DestinationType), CastElement<DestinationType>(value));
+        }
+    }
+
+    using CastFunction = void (*)(const std::byte* source, std::byte* destination, size_t elementCount);
+
+    // Invokes func with a value of the C++ type corresponding to a data type, or returns false if there's none.
+    template <typename Func>
+    bool VisitDataType(DML_TENSOR_DATA_TYPE dataType, Func&& func)
+    {
+        switch (dataType)
+        {
+        case DML_TENSOR_DATA_TYPE_FLOAT32: func(float()); return true;
+        case DML_TENSOR_DATA_TYPE_FLOAT16: func(half()); return true;
+        case DML_TENSOR_DATA_TYPE_FLOAT64: func(double()); return true;
+        case DML_TENSOR_DATA_TYPE_UINT8:   func(uint8_t()); return true;
+        case DML_TENSOR_DATA_TYPE_UINT16:  func(uint16_t()); return true;
+        case DML_TENSOR_DATA_TYPE_UINT32:  func(uint32_t()); return true;
+        case DML_TENSOR_DATA_TYPE_UINT64:  func(uint64_t()); return true;
+        case DML_TENSOR_DATA_TYPE_INT8:    func(int8_t()); return true;
+        case DML_TENSOR_DATA_TYPE_INT16:   func(int16_t()); return true;
+        case DML_TENSOR_DATA_TYPE_INT32:   func(int32_t()); return true;
+        case DML_TENSOR_DATA_TYPE_INT64:   func(int64_t()); return true;
+        default: return false;
+        }
+    }
+
+    struct CastDescription
+    {
+        CastFunction function = nullptr;
+        size_t sourceElementByteSize = 0;
+        size_t destinationElementByteSize = 0;
+    };
+
+    CastDescription GetCastDescription(DML_TENSOR_DATA_TYPE sourceType, DML_TENSOR_DATA_TYPE destinationType)
+    {
+        CastDescription description = {};
+        bool isSupported = VisitDataType(sourceType, [&](auto sourceValue)
+        {
+            using SourceType = decltype(sourceValue);
+            VisitDataType(destinationType, [&](auto destinationValue)
+            {
+                using DestinationType = decltype(destinationValue);
+                description.function = &CastElements<DestinationType, SourceType>;
+                description.sourceElementByteSize = sizeof(SourceType);
+                description.destinationElementByteSize = sizeof(DestinationType);
+            });
+        });
+
+        if (!isSupported || !description.function)
+        {
+            throw std::invalid_argument(fmt::format(
+                "Converting tensor data from data type {} to data type {} is not supported.",
+                static_cast<uint32_t>(sourceType),
+                static_cast<uint32_t>(destinationType)));
+        }
+        return description;
+    }
+
+    // Conversion is bound by memory bandwidth, so chunks only need to be large enough to amortize scheduling.
+    constexpr size_t elementsPerChunk = 256 * 1024;
+}
+
+void CastTensorData(
+    std::span<const std::byte> source,
+    DML_TENSOR_DATA_TYPE sourceType,
+    std::span<std::byte> destination,
+    DML_TENSOR_DATA_TYPE destinationType,
+    uint32_t threadCount
+    )
+{
+    CastDescription cast = GetCastDescription(sourceType, destinationType);
+
+    size_t elementCount = source.size() / cast.sourceElementByteSize;
+    if (elementCount * cast.sourceElementByteSize != source.size() ||
+        SafeSizeCast(SafeMultiply(elementCount, cast.destinationElementByteSize)) != destination.size())
+    {
+        throw std::invalid_argument(fmt::format(
+            "Tensor data of {} bytes can't be converted to {} bytes; the element counts differ.",
+            source.size(),
+            destination.size()));
+    }
+
+    if (sourceType == destinationType)
+    {
+        std::copy(source.begin(), source.end(), destination.begin());
+        return;
+    }
+
+    size_t chunkCount = (elementCount + elementsPerChunk - 1) / elementsPerChunk;
+    ParallelFor(chunkCount, threadCount, [&](size_t chunkIndex, uint32_t /*workerIndex*/)
+    {
+        size_t firstElement = chunkIndex * elementsPerChunk;
+        size_t chunkElementCount = std::min(elementsPerChunk, elementCount - firstElement);
+        cast.function(
+            source.data() + firstElement * cast.sourceElementByteSize,
+            destination.data() + firstElement * cast.destinationElementByteSize,
+            chunkElementCount);
+    });
+}
+
+std::vector<std::byte> CastTensorData(
+    std::span<const std::byte> source,
+    DML_TENSOR_DATA_TYPE sourceType,
+    DML_TENSOR_DATA_TYPE destinationType,
+    uint32_t threadCount
+    )
+{
+    CastDescription cast = GetCastDescription(sourceType, destinationType);
+    size_t elementCount = source.size() / cast.sourceElementByteSize;
+    std::vector<std::byte> destination(SafeSizeCast(SafeMultiply(elementCount, cast.destinationElementByteSize)));
+    CastTensorData(source, sourceType, destination, destinationType, threadCount);
+    return destination;
+}
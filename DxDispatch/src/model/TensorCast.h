@@ -0,0 +1,34 @@
+#pragma once
+
+#include <span>
+
+// Converts tensor elements from one data type to another, e.g. to load a float32 .npy file into a float16 buffer.
+// Every pair of the numeric DML_TENSOR_DATA_TYPE values is supported:
+//
+// - Floating point to integer rounds to the nearest integer (ties to even) and saturates to the range of the
+//   destination type. NaN converts to 0.
+// - Integer to integer saturates to the range of the destination type (e.g. int32 300 becomes int8 127, and
+//   int8 -1 becomes uint8 0).
+// - To floating point rounds to the nearest representable value (ties to even). Values beyond the range of
+//   float16 become infinity, as with any IEEE narrowing.
+//
+// The common conversions between float32, float16, and the 8- and 16-bit integer types are vectorized; large
+// tensors are split across threadCount threads (0 = automatic).
+
+// Converts source, holding elements of sourceType, into destination, which must hold the same number of
+// elements of destinationType.
+void CastTensorData(
+    std::span<const std::byte> source,
+    DML_TENSOR_DATA_TYPE sourceType,
+    std::span<std::byte> destination,
+    DML_TENSOR_DATA_TYPE destinationType,
+    uint32_t threadCount = 0
+    );
+
+// Returns source, holding elements of sourceType, converted to destinationType.
+std::vector<std::byte> CastTensorData(
+    std::span<const std::byte> source,
+    DML_TENSOR_DATA_TYPE sourceType,
+    DML_TENSOR_DATA_TYPE destinationType,
+    uint32_t threadCount = 0
+    );
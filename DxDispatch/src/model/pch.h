@@ -7,6 +7,7 @@
 #include "directml_guids.h"
 #endif
 
+#include <array>
 #include <numeric>
 #include <charconv>
 #include <unordered_map>
@@ -0,0 +1,121 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include "BackgroundFileWriter.h"
+
+using Result = BackgroundFileWriter::Result;
+
+TEST(BackgroundFileWriterTest, WritesRunInOrder)
+{
+    BackgroundFileWriter writer;
+    std::vector<int> order;
+    for (int i = 0; i < 100; i++)
+    {
+        writer.Enqueue([&order, i]
+        {
+            order.push_back(i);
+            return Result{ true, std::to_string(i) };
+        }, 1);
+    }
+
+    auto results = writer.Flush();
+    ASSERT_EQ(order.size(), 100);
+    ASSERT_EQ(results.size(), 100);
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(order[i], i);
+        EXPECT_TRUE(results[i].succeeded);
+        EXPECT_EQ(results[i].message, std::to_string(i));
+    }
+}
+
+TEST(BackgroundFileWriterTest, ErrorsAreReported)
+{
+    BackgroundFileWriter writer;
+    writer.Enqueue([] { return Result{ false, "failed" }; }, 1);
+    writer.Enqueue([]() -> Result { throw std::runtime_error("thrown"); }, 1);
+    writer.Enqueue([]() -> Result { throw 42; }, 1);
+    writer.Enqueue([] { return Result{ true, "written" }; }, 1);
+
+    auto results = writer.Flush();
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_FALSE(results[0].succeeded);
+    EXPECT_EQ(results[0].message, "failed");
+    EXPECT_FALSE(results[1].succeeded);
+    EXPECT_EQ(results[1].message, "thrown");
+    EXPECT_FALSE(results[2].succeeded);
+    EXPECT_EQ(results[2].message, "Unknown error");
+    EXPECT_TRUE(results[3].succeeded);
+}
+
+TEST(BackgroundFileWriterTest, FlushWaitsForWrites)
+{
+    BackgroundFileWriter writer;
+    EXPECT_TRUE(writer.Flush().empty());
+
+    std::atomic<bool> written = false;
+    writer.Enqueue([&written]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        written = true;
+        return Result{ true, "" };
+    }, 1);
+
+    EXPECT_EQ(writer.Flush().size(), 1);
+    EXPECT_TRUE(written);
+
+    // Results are only returned once.
+    EXPECT_TRUE(writer.Flush().empty());
+    EXPECT_TRUE(writer.TakeResults().empty());
+}
+
+TEST(BackgroundFileWriterTest, EnqueueBlocksWhenFull)
+{
+    BackgroundFileWriter writer(100);
+
+    std::mutex mutex;
+    std::condition_variable released;
+    bool release = false;
+    writer.Enqueue([&]
+    {
+        std::unique_lock lock(mutex);
+        released.wait(lock, [&] { return release; });
+        return Result{ true, "first" };
+    }, 60);
+
+    // The second write doesn't fit in the budget until the first one finishes.
+    std::atomic<bool> enqueued = false;
+    std::thread producer([&]
+    {
+        writer.Enqueue([] { return Result{ true, "second" }; }, 60);
+        enqueued = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(enqueued);
+
+    {
+        std::scoped_lock lock(mutex);
+        release = true;
+    }
+    released.notify_one();
+    producer.join();
+    EXPECT_TRUE(enqueued);
+
+    // A write larger than the whole budget is accepted once the queue drains.
+    writer.Enqueue([] { return Result{ true, "third" }; }, 1000);
+
+    auto results = writer.Flush();
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].message, "first");
+    EXPECT_EQ(results[1].message, "second");
+    EXPECT_EQ(results[2].message, "third");
+}
@@ -0,0 +1,80 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include "BucketAllocator.h"
+
+TEST(BucketAllocatorTest, GeometricGrowth) 
+{
+    BucketAllocator allocator;
+    EXPECT_EQ(allocator.GetStatistics().bucketCount, 0);
+
+    // 1 MB of small allocations fits in a few buckets rather than one per page.
+    for (size_t i = 0; i < 64 * 1024; i++)
+    {
+        *allocator.Allocate<uint32_t>(4) = static_cast<uint32_t>(i);
+    }
+
+    auto statistics = allocator.GetStatistics();
+    EXPECT_LE(statistics.bucketCount, 5);
+    EXPECT_EQ(statistics.usedBytes, 1024 * 1024);
+    EXPECT_LE(statistics.usedBytes + statistics.wastedBytes, statistics.reservedBytes);
+
+    // A large request gets a dedicated bucket; the current bucket stays open for small allocations.
+    auto regionCount = allocator.GetAllocatedRegions().size();
+    allocator.Allocate<std::byte>(BucketAllocator::c_maxBucketSize);
+    allocator.Allocate<uint32_t>();
+    EXPECT_EQ(allocator.GetAllocatedRegions().size(), regionCount + 1);
+}
+
+TEST(BucketAllocatorTest, ResetReusesBuckets) 
+{
+    BucketAllocator allocator;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        allocator.Allocate<uint64_t>(i);
+    }
+    auto statistics = allocator.GetStatistics();
+
+    allocator.Reset();
+    EXPECT_TRUE(allocator.GetAllocatedRegions().empty());
+    EXPECT_EQ(allocator.GetStatistics().usedBytes, 0);
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        allocator.Allocate<uint64_t>(i);
+    }
+    EXPECT_EQ(allocator.GetStatistics().bucketCount, statistics.bucketCount);
+    EXPECT_EQ(allocator.GetStatistics().reservedBytes, statistics.reservedBytes);
+    EXPECT_EQ(allocator.GetStatistics().usedBytes, statistics.usedBytes);
+}
+
+TEST(BucketAllocatorTest, Splice) 
+{
+    BucketAllocator allocator;
+    BucketAllocator other;
+    *allocator.Allocate<uint32_t>() = 1;
+    *other.Allocate<uint32_t>() = 2;
+
+    allocator.Splice(std::move(other));
+    EXPECT_EQ(other.GetStatistics().bucketCount, 0);
+    EXPECT_EQ(allocator.GetAllocatedRegions().size(), 2);
+    EXPECT_EQ(allocator.GetStatistics().usedBytes, 2 * sizeof(uint32_t));
+
+    // New allocations continue in the allocator's own bucket.
+    allocator.Allocate<uint32_t>();
+    EXPECT_EQ(allocator.GetAllocatedRegions().size(), 2);
+}
+
+TEST(BucketAllocatorTest, LargePages) 
+{
+    // Huge pages may not be available, but buckets are still usable (and sized for them) either way.
+    BucketAllocator allocator(true);
+    auto values = allocator.Allocate<uint32_t>(1024);
+    values[1023] = 1;
+    EXPECT_GE(allocator.GetStatistics().reservedBytes, BucketAllocator::c_largePageBucketSize);
+}
@@ -0,0 +1,247 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <DirectML.h>
+#include "StdSupport.h"
+#include "TestHelpers.h"
+#include "ImageReaderWriter.h"
+
+#ifndef WIN32
+// On Windows images go through WIC, which needs COM initialized by the caller.
+TEST(ImageReaderWriterTest, PngRoundTrip)
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+
+    // A 2x3 RGB image with an NCHW float32 tensor: R, G, and B planes of v / 255.
+    constexpr uint32_t height = 2, width = 3, channels = 3;
+    std::vector<float> values(channels * height * width);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<float>(i * 13) / 255.0f;
+    }
+
+    ImageTensorInfo tensorInfo = {};
+    tensorInfo.dataType = DML_TENSOR_DATA_TYPE_FLOAT32;
+    tensorInfo.channels = channels;
+    tensorInfo.height = height;
+    tensorInfo.width = width;
+    tensorInfo.sizeInBytes = values.size() * sizeof(float);
+    tensorInfo.layout = ImageTensorLayout::NCHW;
+    tensorInfo.channelOrder = ImageTensorChannelOrder::RGB;
+    WriteTensorToImage(directory / "image.png", AsBytes(values), tensorInfo);
+
+    std::vector<std::byte> floatTensor = ReadTensorFromImage(directory / "image.png", tensorInfo);
+    ASSERT_EQ(floatTensor.size(), values.size() * sizeof(float));
+    EXPECT_EQ(memcmp(floatTensor.data(), values.data(), floatTensor.size()), 0);
+
+    // As interleaved uint8, the first pixel holds the first element of each plane.
+    ImageTensorInfo pixelInfo = tensorInfo;
+    pixelInfo.dataType = DML_TENSOR_DATA_TYPE_UINT8;
+    pixelInfo.sizeInBytes = values.size();
+    pixelInfo.layout = ImageTensorLayout::NHWC;
+    std::vector<std::byte> pixels = ReadTensorFromImage(directory / "image.png", pixelInfo);
+    ASSERT_EQ(pixels.size(), values.size());
+    EXPECT_EQ(uint8_t(pixels[0]), 0);
+    EXPECT_EQ(uint8_t(pixels[1]), 6 * 13);
+    EXPECT_EQ(uint8_t(pixels[2]), 12 * 13);
+
+    // Resampling keeps a uniform image uniform.
+    std::vector<uint8_t> gray(16 * 16, 77);
+    ImageTensorInfo grayInfo = {DML_TENSOR_DATA_TYPE_UINT8, 1, 16, 16, gray.size(), ImageTensorLayout::NCHW, ImageTensorChannelOrder::Grayscale};
+    WriteTensorToImage(directory / "gray.png", AsBytes(gray), grayInfo);
+    grayInfo.height = 5;
+    grayInfo.width = 9;
+    grayInfo.sizeInBytes = 5 * 9;
+    std::vector<std::byte> resampled = ReadTensorFromImage(directory / "gray.png", grayInfo);
+    ASSERT_EQ(resampled.size(), 5 * 9);
+    EXPECT_TRUE(std::all_of(resampled.begin(), resampled.end(), [](std::byte b) { return uint8_t(b) == 77; }));
+
+    // Normalization applies per channel (in the tensor's channel order), and writing undoes it.
+    ImageTensorInfo normalizedInfo = tensorInfo;
+    normalizedInfo.layout = ImageTensorLayout::NHWC;
+    normalizedInfo.channelOrder = ImageTensorChannelOrder::BGR;
+    normalizedInfo.normalizeMean = {0.5f, 0.25f, 0.0f};
+    normalizedInfo.normalizeStd = {0.5f};
+    std::vector<std::byte> normalizedTensor = ReadTensorFromImage(directory / "image.png", normalizedInfo);
+    ASSERT_EQ(normalizedTensor.size(), values.size() * sizeof(float));
+    auto normalized = reinterpret_cast<const float*>(normalizedTensor.data());
+    EXPECT_FLOAT_EQ(normalized[0], (12 * 13 / 255.0f - 0.5f) / 0.5f); // B
+    EXPECT_FLOAT_EQ(normalized[1], (6 * 13 / 255.0f - 0.25f) / 0.5f); // G
+    EXPECT_FLOAT_EQ(normalized[2], (0 / 255.0f - 0.0f) / 0.5f);       // R
+
+    WriteTensorToImage(directory / "normalized.png", normalizedTensor, normalizedInfo);
+    EXPECT_EQ(ReadTensorFromImage(directory / "normalized.png", pixelInfo), pixels);
+
+    normalizedInfo.normalizeStd = {1.0f, 0.0f, 1.0f};
+    EXPECT_THROW(ReadTensorFromImage(directory / "image.png", normalizedInfo), std::invalid_argument);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ImageReaderWriterTest, ResampleModes)
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+
+    // A 40x20 grayscale image whose left half is 0 and right half is 200.
+    std::vector<uint8_t> pixels(20 * 40);
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = (i % 40 < 20) ? 0 : 200;
+    }
+    ImageTensorInfo imageInfo = {DML_TENSOR_DATA_TYPE_UINT8, 1, 20, 40, pixels.size(), ImageTensorLayout::NCHW, ImageTensorChannelOrder::Grayscale};
+    WriteTensorToImage(directory / "halves.png", AsBytes(pixels), imageInfo);
+
+    ImageTensorInfo tensorInfo = imageInfo;
+    tensorInfo.height = 10;
+    tensorInfo.width = 10;
+    tensorInfo.sizeInBytes = 100;
+    tensorInfo.resampleFilter = ImageResampleFilter::Area;
+    tensorInfo.padValue = 114;
+    auto at = [](const std::vector<std::byte>& tensor, uint32_t y, uint32_t x) { return uint8_t(tensor[y * 10 + x]); };
+
+    // The image is scaled to 10x5 and centered, with 2 rows of padding above and 3 below.
+    tensorInfo.resampleMode = ImageResampleMode::Letterbox;
+    std::vector<std::byte> letterboxed = ReadTensorFromImage(directory / "halves.png", tensorInfo);
+    ASSERT_EQ(letterboxed.size(), 100);
+    EXPECT_EQ(at(letterboxed, 1, 0), 114);
+    EXPECT_EQ(at(letterboxed, 2, 0), 0);
+    EXPECT_EQ(at(letterboxed, 6, 9), 200);
+    EXPECT_EQ(at(letterboxed, 7, 9), 114);
+
+    // The same, but with the padding below.
+    tensorInfo.resampleMode = ImageResampleMode::Fit;
+    std::vector<std::byte> fitted = ReadTensorFromImage(directory / "halves.png", tensorInfo);
+    EXPECT_EQ(at(fitted, 0, 0), 0);
+    EXPECT_EQ(at(fitted, 4, 9), 200);
+    EXPECT_EQ(at(fitted, 5, 0), 114);
+
+    // The image is scaled to 20x10, and the middle 10 columns are kept.
+    tensorInfo.resampleMode = ImageResampleMode::CenterCrop;
+    std::vector<std::byte> cropped = ReadTensorFromImage(directory / "halves.png", tensorInfo);
+    EXPECT_EQ(at(cropped, 0, 0), 0);
+    EXPECT_EQ(at(cropped, 9, 4), 0);
+    EXPECT_EQ(at(cropped, 0, 5), 200);
+    EXPECT_EQ(at(cropped, 9, 9), 200);
+
+    std::filesystem::remove_all(directory);
+}
+
+// The weight of every source sample in one destination sample along an axis, computed directly from the filter
+// definitions (samples at pixel centers, edges clamped, the cubic filter widened when downscaling).
+static std::vector<double> GetReferenceWeights(uint32_t srcSize, uint32_t dstSize, uint32_t dstIndex, ImageResampleFilter filter)
+{
+    const double scale = double(srcSize) / dstSize;
+    const double center = (dstIndex + 0.5) * scale - 0.5;
+    const bool isCubic = filter == ImageResampleFilter::Cubic;
+    const double filterScale = isCubic ? std::max(scale, 1.0) : 1.0;
+    const double support = isCubic ? 2 * filterScale : 1.0;
+
+    std::vector<double> weights(srcSize);
+    double weightSum = 0;
+    for (int64_t i = static_cast<int64_t>(std::floor(center - support)); i <= static_cast<int64_t>(std::ceil(center + support)); i++)
+    {
+        const double x = std::abs(i - center) / filterScale;
+        double weight = 0;
+        if (!isCubic)
+        {
+            weight = std::max(0.0, 1 - x);
+        }
+        else if (x < 1)
+        {
+            weight = 1.5 * x * x * x - 2.5 * x * x + 1;
+        }
+        else if (x < 2)
+        {
+            weight = -0.5 * x * x * x + 2.5 * x * x - 4 * x + 2;
+        }
+        weights[std::clamp<int64_t>(i, 0, srcSize - 1)] += weight;
+        weightSum += weight;
+    }
+    for (double& weight : weights)
+    {
+        weight /= weightSum;
+    }
+    return weights;
+}
+
+TEST(ImageReaderWriterTest, ResampleFiltersMatchScalarReference)
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+
+    // Odd widths leave a partial vector at the end of each row, and 3-channel pixels straddle vectors.
+    constexpr uint32_t srcWidth = 37, srcHeight = 23;
+    for (auto [channels, channelOrder] : {std::pair{3u, ImageTensorChannelOrder::RGB}, std::pair{4u, ImageTensorChannelOrder::RGBA}})
+    {
+        std::vector<uint8_t> pixels(srcWidth * srcHeight * channels);
+        uint32_t state = 12345;
+        for (uint8_t& pixel : pixels)
+        {
+            state = state * 1664525 + 1013904223;
+            pixel = static_cast<uint8_t>(state >> 24);
+        }
+        ImageTensorInfo imageInfo = {DML_TENSOR_DATA_TYPE_UINT8, channels, srcHeight, srcWidth, pixels.size(), ImageTensorLayout::NHWC, channelOrder};
+        WriteTensorToImage(directory / "noise.png", AsBytes(pixels), imageInfo);
+
+        for (auto filter : {ImageResampleFilter::Linear, ImageResampleFilter::Cubic})
+        {
+            // Upscaled, downscaled, and downscaled in one axis only.
+            for (auto [dstWidth, dstHeight] : {std::pair{51u, 31u}, std::pair{13u, 9u}, std::pair{srcWidth + 2, 7u}})
+            {
+                ImageTensorInfo tensorInfo = imageInfo;
+                tensorInfo.width = dstWidth;
+                tensorInfo.height = dstHeight;
+                tensorInfo.sizeInBytes = size_t(dstWidth) * dstHeight * channels;
+                tensorInfo.resampleFilter = filter;
+                std::vector<std::byte> resampled = ReadTensorFromImage(directory / "noise.png", tensorInfo);
+                ASSERT_EQ(resampled.size(), tensorInfo.sizeInBytes);
+
+                std::vector<std::vector<double>> columnWeights(dstWidth);
+                for (uint32_t x = 0; x < dstWidth; x++)
+                {
+                    columnWeights[x] = GetReferenceWeights(srcWidth, dstWidth, x, filter);
+                }
+
+                // The resize accumulates in float32, so it may round to the other side of .5.
+                int maxDifference = 0;
+                for (uint32_t y = 0; y < dstHeight; y++)
+                {
+                    std::vector<double> rowWeights = GetReferenceWeights(srcHeight, dstHeight, y, filter);
+                    for (uint32_t x = 0; x < dstWidth; x++)
+                    {
+                        for (uint32_t c = 0; c < channels; c++)
+                        {
+                            double sum = 0;
+                            for (uint32_t srcY = 0; srcY < srcHeight; srcY++)
+                            {
+                                for (uint32_t srcX = 0; srcX < srcWidth; srcX++)
+                                {
+                                    sum += rowWeights[srcY] * columnWeights[x][srcX] * pixels[(srcY * srcWidth + srcX) * channels + c];
+                                }
+                            }
+                            int expected = static_cast<int>(std::clamp(std::round(sum), 0.0, 255.0));
+                            int actual = uint8_t(resampled[(size_t(y) * dstWidth + x) * channels + c]);
+                            maxDifference = std::max(maxDifference, std::abs(actual - expected));
+                        }
+                    }
+                }
+                EXPECT_LE(maxDifference, 1) << channels << " channels, " << dstWidth << "x" << dstHeight
+                    << (filter == ImageResampleFilter::Linear ? " linear" : " cubic");
+            }
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+#endif
@@ -8,8 +8,14 @@
 #include <gtest/gtest.h>
 #include <fmt/format.h>
 #include <wrl/client.h>
+#include "StdSupport.h"
+#include "TestHelpers.h"
 #include "JsonParsers.h"
+#include "NpyReaderWriter.h"
+#include "NpzReaderWriter.h"
+#include "ImageReaderWriter.h"
 #include "DirectMLX.h"
+#include <fstream>
 
 using namespace rapidjson;
 using namespace JsonParsers;
@@ -1057,7 +1063,12 @@ TEST(ParseDmlTensorDataTypeTest, InvalidInput)
         "x3": "cat",
         "x4": true,
         "x5": 1.2,
-        "x6": -5
+        "x6": -5,
+        "x7": "",
+        "x8": "float32",
+        "x9": "FLOAT32 ",
+        "x10": "DML_TENSOR_DATA_TYPE_",
+        "x11": "DML_TENSOR_TYPE_BUFFER"
     })");
     ASSERT_FALSE(d.HasParseError());
     for (auto field = d.MemberBegin(); field < d.MemberEnd(); field++)
@@ -1594,6 +1605,96 @@ TEST(ParseDmlOperatorDescTest, CollapsedDesc)
     EXPECT_EQ(outputTensorDesc->Sizes[0], 3);
 }
 
+TEST(ParseDmlOperatorDescTest, SchemaDrivenDesc) 
+{
+    Document d;
+    d.Parse(R"({
+        "x0":
+        {
+            "Type": "DML_OPERATOR_CONVOLUTION",
+            "Desc":
+            {
+                "InputTensor": { "DataType": "FLOAT32", "Sizes": [1,1,3,3] },
+                "FilterTensor": { "DataType": "FLOAT32", "Sizes": [1,1,2,2] },
+                "OutputTensor": { "DataType": "FLOAT32", "Sizes": [1,1,2,2] },
+                "Mode": "CROSS_CORRELATION",
+                "Direction": "DML_CONVOLUTION_DIRECTION_FORWARD",
+                "DimensionCount": 2,
+                "Strides": [1,1],
+                "Dilations": [1,1],
+                "StartPadding": [0,0],
+                "EndPadding": [0,0],
+                "OutputPadding": [0,0],
+                "GroupCount": 1,
+                "FusedActivation": { "Type": "ACTIVATION_LEAKY_RELU", "Desc": { "Alpha": 0.5 } }
+            }
+        }
+    })");
+    ASSERT_FALSE(d.HasParseError());
+
+    BucketAllocator allocator;
+    auto result = ParseDmlOperatorDesc(d["x0"], false, allocator);
+    EXPECT_EQ(result->Type, DML_OPERATOR_CONVOLUTION);
+
+    // The operator desc, its tensors, arrays, and fused activation share a single allocation.
+    EXPECT_EQ(allocator.GetAllocatedRegions().size(), 1);
+
+    ASSERT_NE(result->Desc, nullptr);
+    auto convDesc = static_cast<const DML_CONVOLUTION_OPERATOR_DESC*>(result->Desc);
+    ASSERT_NE(convDesc->InputTensor, nullptr);
+    auto inputTensorDesc = static_cast<const DML_BUFFER_TENSOR_DESC*>(convDesc->InputTensor->Desc);
+    ASSERT_EQ(inputTensorDesc->DimensionCount, 4);
+    EXPECT_EQ(inputTensorDesc->Sizes[3], 3);
+    EXPECT_EQ(inputTensorDesc->TotalTensorSizeInBytes, 36);
+    EXPECT_EQ(convDesc->BiasTensor, nullptr);
+    EXPECT_EQ(convDesc->Mode, DML_CONVOLUTION_MODE_CROSS_CORRELATION);
+    EXPECT_EQ(convDesc->Direction, DML_CONVOLUTION_DIRECTION_FORWARD);
+    EXPECT_EQ(convDesc->DimensionCount, 2);
+    ASSERT_NE(convDesc->Strides, nullptr);
+    EXPECT_EQ(convDesc->Strides[1], 1);
+    EXPECT_EQ(convDesc->EndPadding[0], 0);
+    EXPECT_EQ(convDesc->GroupCount, 1);
+
+    ASSERT_NE(convDesc->FusedActivation, nullptr);
+    EXPECT_EQ(convDesc->FusedActivation->Type, DML_OPERATOR_ACTIVATION_LEAKY_RELU);
+    auto activationDesc = static_cast<const DML_ACTIVATION_LEAKY_RELU_OPERATOR_DESC*>(convDesc->FusedActivation->Desc);
+    EXPECT_EQ(activationDesc->InputTensor, nullptr);
+    EXPECT_EQ(activationDesc->OutputTensor, nullptr);
+    EXPECT_EQ(activationDesc->Alpha, 0.5f);
+}
+
+TEST(ParseDmlOperatorDescTest, ScalarUnionUsesDataTypeField) 
+{
+    Document d;
+    d.Parse(R"({
+        "x0":
+        {
+            "Type": "FILL_VALUE_SEQUENCE",
+            "OutputTensor": { "DataType": "INT32", "Sizes": [4] },
+            "ValueDataType": "INT32",
+            "ValueStart": -2,
+            "ValueDelta": 3
+        },
+        "x1":
+        {
+            "Type": "FILL_VALUE_SEQUENCE",
+            "OutputTensor": { "DataType": "INT32", "Sizes": [4] },
+            "ValueDataType": "INT32",
+            "ValueStart": -2
+        }
+    })");
+    ASSERT_FALSE(d.HasParseError());
+
+    BucketAllocator allocator;
+    auto result = ParseDmlOperatorDesc(d["x0"], false, allocator);
+    auto fillDesc = static_cast<const DML_FILL_VALUE_SEQUENCE_OPERATOR_DESC*>(result->Desc);
+    EXPECT_EQ(fillDesc->ValueDataType, DML_TENSOR_DATA_TYPE_INT32);
+    EXPECT_EQ(fillDesc->ValueStart.Int32, -2);
+    EXPECT_EQ(fillDesc->ValueDelta.Int32, 3);
+
+    EXPECT_THROW(ParseDmlOperatorDesc(d["x1"], false, allocator), std::invalid_argument);
+}
+
 // ----------------------------------------------------------------------------
 // Model::Resource
 // ----------------------------------------------------------------------------
@@ -1748,6 +1849,246 @@ TEST(ParseModelResourceDesc, BufferSequenceInitializer)
     }
 }
 
+TEST(ParseModelResourceDesc, BufferRandomInitializer) 
+{
+    Document d;
+    d.Parse(R"({
+        "x0": { "initialValuesDataType": "INT32", "initialValues": { "valueCount": 1000, "distribution": "uniform", "min": -5, "max": 5, "seed": 1 } },
+        "x1": { "initialValuesDataType": "INT32", "initialValues": { "valueCount": 1000, "distribution": "uniform", "min": -5, "max": 5, "seed": 1 } },
+        "x2": { "initialValuesDataType": "INT32", "initialValues": { "valueCount": 1000, "distribution": "uniform", "min": -5, "max": 5, "seed": 2 } },
+        "x3": { "initialValuesDataType": "FLOAT16", "initialValues": { "valueCount": 7, "distribution": "bernoulli", "probability": 1 } },
+        "x4": { "initialValuesDataType": "FLOAT64", "initialValues": { "valueCount": 3, "distribution": "normal", "stddev": 0, "mean": 2.5 } },
+        "x5": { "initialValuesDataType": "UINT8", "initialValues": { "valueCount": 3, "distribution": "uniform", "max": 256 } },
+        "x6": { "initialValuesDataType": "FLOAT32", "initialValues": { "valueCount": 3, "distribution": "poisson" } },
+        "x7": { "initialValuesDataType": "FLOAT16", "initialValues": { "valueCount": 10000, "distribution": "uniform", "min": 0, "max": 1 } },
+        "x8": { "initialValuesDataType": "FLOAT32", "initialValues": { "valueCount": 3, "distribution": "uniform", "min": 2, "max": 1 } },
+        "x9": { "initialValuesDataType": "UINT64", "initialValues": { "valueCount": 3000, "distribution": "uniform", "max": 13835058055282163711 } }
+    })");
+    ASSERT_FALSE(d.HasParseError());
+
+    auto x0 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x0", "", d["x0"]).value);
+    auto x1 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x1", "", d["x1"]).value);
+    auto x2 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x2", "", d["x2"]).value);
+    ASSERT_EQ(x0.initialValues.size(), 1000 * sizeof(int32_t));
+    EXPECT_EQ(x0.sizeInBytes, 4000);
+
+    // The same seed always produces the same values.
+    EXPECT_TRUE(std::equal(x0.initialValues.begin(), x0.initialValues.end(), x1.initialValues.begin()));
+    EXPECT_FALSE(std::equal(x0.initialValues.begin(), x0.initialValues.end(), x2.initialValues.begin()));
+
+    auto x0Values = reinterpret_cast<const int32_t*>(x0.initialValues.data());
+    EXPECT_EQ(*std::min_element(x0Values, x0Values + 1000), -5);
+    EXPECT_EQ(*std::max_element(x0Values, x0Values + 1000), 5);
+
+    auto x3 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x3", "", d["x3"]).value);
+    ASSERT_EQ(x3.initialValues.size(), 7 * sizeof(half_float::half));
+    auto x3Values = reinterpret_cast<const half_float::half*>(x3.initialValues.data());
+    for (size_t i = 0; i < 7; i++)
+    {
+        EXPECT_EQ(static_cast<float>(x3Values[i]), 1.0f);
+    }
+
+    auto x4 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x4", "", d["x4"]).value);
+    auto x4Values = reinterpret_cast<const double*>(x4.initialValues.data());
+    EXPECT_EQ(x4Values[0], 2.5);
+    EXPECT_EQ(x4Values[2], 2.5);
+
+    EXPECT_THROW(ParseModelResourceDesc("x5", "", d["x5"]), std::invalid_argument);
+    EXPECT_THROW(ParseModelResourceDesc("x6", "", d["x6"]), std::invalid_argument);
+
+    // Rounding to half never produces max.
+    auto x7 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x7", "", d["x7"]).value);
+    auto x7Values = reinterpret_cast<const half_float::half*>(x7.initialValues.data());
+    EXPECT_LT(static_cast<float>(*std::max_element(x7Values, x7Values + 10000)), 1.0f);
+    EXPECT_GE(static_cast<float>(*std::min_element(x7Values, x7Values + 10000)), 0.0f);
+
+    EXPECT_THROW(ParseModelResourceDesc("x8", "", d["x8"]), std::invalid_argument);
+
+    // The range is 3 * 2^62, so a plain modulo would put half of the values (not a third) below 2^62.
+    auto x9 = std::get<Model::BufferDesc>(ParseModelResourceDesc("x9", "", d["x9"]).value);
+    auto x9Values = reinterpret_cast<const uint64_t*>(x9.initialValues.data());
+    auto lowCount = std::count_if(x9Values, x9Values + 3000, [](uint64_t value) { return value < (1ull << 62); });
+    EXPECT_GT(lowCount, 850);
+    EXPECT_LT(lowCount, 1150);
+}
+
+TEST(ParseModelResourceDesc, BufferFileInitializerIsMapped) 
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+
+    constexpr float expectedValues[] = {1.5f, -2, 3, 4.25f};
+    auto valueBytes = AsBytes(expectedValues);
+    std::vector<uint64_t> dimensions = {2, 2};
+    std::vector<std::byte> npyFileData;
+    WriteNpy(valueBytes, DML_TENSOR_DATA_TYPE_FLOAT32, dimensions, npyFileData);
+
+    auto writeFile = [&](const char* fileName, std::span<const std::byte> data)
+    {
+        std::ofstream file(directory / fileName, std::ios::trunc | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    };
+    writeFile("values.npy", npyFileData);
+    writeFile("values.bin", valueBytes);
+    std::vector<std::byte> npzFileData;
+    AddNpzMember({}, "values", npyFileData, npzFileData);
+    writeFile("values.npz", npzFileData);
+
+    for (auto [json, fileName] : {
+        std::pair{R"({ "initialValues": { "sourcePath": "values.npy" } })", "values.npy"},
+        std::pair{R"({ "initialValues": { "sourcePath": "values.npz:values" } })", "values.npz"},
+        std::pair{R"({ "initialValuesDataType": "FLOAT32", "initialValues": { "sourcePath": "values.bin" } })", "values.bin"}})
+    {
+        Document d;
+        d.Parse(json);
+        ASSERT_FALSE(d.HasParseError());
+
+        auto result = ParseModelResourceDesc("testFile", directory, d);
+        auto& desc = std::get<Model::BufferDesc>(result.value);
+        EXPECT_EQ(desc.initialValuesDataType, DML_TENSOR_DATA_TYPE_FLOAT32);
+        EXPECT_EQ(desc.sourcePath.filename(), fileName);
+        EXPECT_EQ(desc.sizeInBytes, sizeof(expectedValues));
+
+        // The values should be read in place from the mapped file rather than copied.
+        ASSERT_NE(desc.initialValues.GetFile(), nullptr);
+        ASSERT_EQ(desc.initialValues.size(), sizeof(expectedValues));
+        EXPECT_EQ(memcmp(desc.initialValues.data(), expectedValues, sizeof(expectedValues)), 0);
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ParseModelResourceDesc, BufferFileInitializerIsConverted) 
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+
+    constexpr float values[] = {1.5f, -2, 2.5f, 1000};
+    std::vector<uint64_t> dimensions = {4};
+    std::vector<std::byte> npyFileData;
+    WriteNpy(AsBytes(values), DML_TENSOR_DATA_TYPE_FLOAT32, dimensions, npyFileData);
+
+    // Bytes after the array (here not even a whole element) aren't converted.
+    npyFileData.insert(npyFileData.end(), 3, std::byte{0xFF});
+    {
+        std::ofstream file(directory / "values.npy", std::ios::trunc | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(npyFileData.data()), npyFileData.size());
+    }
+
+    Document d;
+    d.Parse(R"({ "initialValuesDataType": "INT8", "initialValues": { "sourcePath": "values.npy" } })");
+    ASSERT_FALSE(d.HasParseError());
+
+    auto result = ParseModelResourceDesc("testFile", directory, d);
+    auto& desc = std::get<Model::BufferDesc>(result.value);
+    EXPECT_EQ(desc.initialValuesDataType, DML_TENSOR_DATA_TYPE_INT8);
+    EXPECT_EQ(desc.sizeInBytes, 4);
+
+    constexpr int8_t expectedValues[] = {2, -2, 2, 127};
+    ASSERT_EQ(desc.initialValues.size(), sizeof(expectedValues));
+    EXPECT_EQ(memcmp(desc.initialValues.data(), expectedValues, sizeof(expectedValues)), 0);
+
+    std::filesystem::remove_all(directory);
+}
+
+#ifndef WIN32
+TEST(ParseModelResourceDesc, ImageBatchFromPattern)
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests" / "batch";
+    std::filesystem::create_directories(directory);
+
+    // Two uniform 2x2 grayscale images, and a file that isn't an image.
+    ImageTensorInfo imageInfo = {DML_TENSOR_DATA_TYPE_UINT8, 1, 2, 2, 4, ImageTensorLayout::NCHW, ImageTensorChannelOrder::Grayscale};
+    std::vector<uint8_t> pixels(4, 10);
+    WriteTensorToImage(directory / "a.png", AsBytes(pixels), imageInfo);
+    std::fill(pixels.begin(), pixels.end(), 20);
+    WriteTensorToImage(directory / "b.png", AsBytes(pixels), imageInfo);
+    std::ofstream(directory / "notes.txt") << "not an image";
+
+    // The images fill the batch in name order, repeating as needed.
+    for (auto sourcePath : {"batch/*.png", "batch"})
+    {
+        Document d;
+        d.Parse(fmt::format(R"({{ "initialValuesDataType": "UINT8", "initialValues": {{ "sourcePath": "{}" }}, "resampleSize": [3, 1, 2, 2] }})", sourcePath).c_str());
+        ASSERT_FALSE(d.HasParseError());
+
+        auto result = ParseModelResourceDesc("testFile", directory.parent_path(), d);
+        auto& desc = std::get<Model::BufferDesc>(result.value);
+        constexpr uint8_t expectedValues[] = {10, 10, 10, 10, 20, 20, 20, 20, 10, 10, 10, 10};
+        ASSERT_EQ(desc.initialValues.size(), sizeof(expectedValues));
+        EXPECT_EQ(memcmp(desc.initialValues.data(), expectedValues, sizeof(expectedValues)), 0);
+
+        // The images of each slot are recorded, and a pattern's directory is resolved against the model's.
+        EXPECT_EQ(desc.sourceImagePaths, (std::vector<std::filesystem::path>{directory / "a.png", directory / "b.png", directory / "a.png"}));
+        EXPECT_EQ(desc.sourcePath, std::filesystem::absolute(directory.parent_path() / sourcePath));
+    }
+
+    // A single .jpeg is an image too, rather than raw data.
+    WriteTensorToImage(directory / "c.jpeg", AsBytes(pixels), imageInfo);
+    {
+        Document d;
+        d.Parse(R"({ "initialValuesDataType": "UINT8", "initialValues": { "sourcePath": "batch/c.jpeg" }, "resampleSize": [1, 1, 2, 2] })");
+        ASSERT_FALSE(d.HasParseError());
+
+        auto result = ParseModelResourceDesc("testFile", directory.parent_path(), d);
+        auto& desc = std::get<Model::BufferDesc>(result.value);
+        EXPECT_EQ(desc.initialValues.size(), 4);
+        EXPECT_TRUE(desc.sourceImagePaths.empty());
+    }
+
+    // A single image must have an N of 1, and a pattern must match something.
+    for (auto json : {
+        R"({ "initialValuesDataType": "UINT8", "initialValues": { "sourcePath": "batch/a.png" }, "resampleSize": [2, 1, 2, 2] })",
+        R"({ "initialValuesDataType": "UINT8", "initialValues": { "sourcePath": "batch/*.jpg" }, "resampleSize": [2, 1, 2, 2] })"})
+    {
+        Document d;
+        d.Parse(json);
+        ASSERT_FALSE(d.HasParseError());
+        EXPECT_ANY_THROW(ParseModelResourceDesc("testFile", directory.parent_path(), d));
+    }
+
+    std::filesystem::remove_all(directory.parent_path());
+}
+
+TEST(ParseModelResourceDesc, ImageChannelOrderAndLayout)
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+
+    // A 2x1 RGB image.
+    ImageTensorInfo imageInfo = {DML_TENSOR_DATA_TYPE_UINT8, 3, 1, 2, 6, ImageTensorLayout::NHWC, ImageTensorChannelOrder::RGB};
+    constexpr uint8_t pixels[] = {10, 20, 30, 40, 50, 60};
+    WriteTensorToImage(directory / "pixels.png", AsBytes(pixels), imageInfo);
+
+    for (auto [fields, expectedValues] : {
+        std::pair{R"("channelOrder": "bgr", "layout": "nhwc")", std::array<uint8_t, 6>{30, 20, 10, 60, 50, 40}},
+        std::pair{R"("channelOrder": "bgr")", std::array<uint8_t, 6>{30, 60, 20, 50, 10, 40}},
+        std::pair{R"("layout": "nhwc")", std::array<uint8_t, 6>{10, 20, 30, 40, 50, 60}},
+        std::pair{R"("layout": "nchw")", std::array<uint8_t, 6>{10, 40, 20, 50, 30, 60}}})
+    {
+        Document d;
+        d.Parse(fmt::format(R"({{ "initialValuesDataType": "UINT8", "initialValues": {{ "sourcePath": "pixels.png" }}, "resampleSize": [1, 3, 1, 2], {} }})", fields).c_str());
+        ASSERT_FALSE(d.HasParseError());
+
+        auto result = ParseModelResourceDesc("testFile", directory, d);
+        auto& desc = std::get<Model::BufferDesc>(result.value);
+        ASSERT_EQ(desc.initialValues.size(), expectedValues.size());
+        EXPECT_EQ(memcmp(desc.initialValues.data(), expectedValues.data(), expectedValues.size()), 0) << fields;
+    }
+
+    // The channel order must have as many channels as the resample size, and both fields only take known values.
+    for (auto fields : {R"("channelOrder": "bgra")", R"("channelOrder": "BGR")", R"("layout": "nhcw")"})
+    {
+        Document d;
+        d.Parse(fmt::format(R"({{ "initialValuesDataType": "UINT8", "initialValues": {{ "sourcePath": "pixels.png" }}, "resampleSize": [1, 3, 1, 2], {} }})", fields).c_str());
+        ASSERT_FALSE(d.HasParseError());
+        EXPECT_THROW(ParseModelResourceDesc("testFile", directory, d), std::invalid_argument) << fields;
+    }
+
+    std::filesystem::remove_all(directory);
+}
+#endif
+
 // ----------------------------------------------------------------------------
 // Model::DmlDispatchableDesc
 // ----------------------------------------------------------------------------
@@ -2005,4 +2346,168 @@ TEST(ParseExecuteCommandTest, ArrayBindings)
         EXPECT_EQ(binding->second[0].elementSizeInBytes, 0);
         EXPECT_EQ(binding->second[0].format, std::nullopt);
     }
-}
\ No newline at end of file
+}
+// ----------------------------------------------------------------------------
+// ParseModelInsitu
+// ----------------------------------------------------------------------------
+
+static Model ParseModelText(std::string text)
+{
+    std::vector<char> buffer(text.begin(), text.end());
+    buffer.push_back('\0');
+    return ParseModelInsitu(buffer, std::filesystem::current_path(), std::filesystem::current_path());
+}
+
+TEST(ParseModelInsituTest, StreamedInitialValues) 
+{
+    auto model = ParseModelText(R"({
+        "resources": 
+        {
+            "streamed": { "initialValuesDataType": "INT16", "initialValues": [1, -2, 3] },
+            "typeAfterValues": { "initialValues": [4.5, 5.5], "initialValuesDataType": "FLOAT32" },
+            "mixed": { "initialValues": [{ "type": "UINT8", "value": 7 }] },
+            "halfs": { "initialValuesDataType": "FLOAT16", "initialValues": [1.5, "inf"] }
+        },
+        "dispatchables": {},
+        "commands": []
+    })");
+
+    auto& streamed = std::get<Model::BufferDesc>(model.GetResource("streamed").value);
+    ASSERT_EQ(streamed.initialValues.size(), 3 * sizeof(int16_t));
+    auto int16Data = reinterpret_cast<const int16_t*>(streamed.initialValues.data());
+    EXPECT_EQ(int16Data[0], 1);
+    EXPECT_EQ(int16Data[1], -2);
+    EXPECT_EQ(int16Data[2], 3);
+    EXPECT_EQ(streamed.sizeInBytes, 8);
+
+    auto& typeAfterValues = std::get<Model::BufferDesc>(model.GetResource("typeAfterValues").value);
+    ASSERT_EQ(typeAfterValues.initialValues.size(), 2 * sizeof(float));
+    EXPECT_EQ(reinterpret_cast<const float*>(typeAfterValues.initialValues.data())[1], 5.5f);
+
+    auto& mixed = std::get<Model::BufferDesc>(model.GetResource("mixed").value);
+    ASSERT_EQ(mixed.initialValues.size(), 1);
+    EXPECT_EQ(static_cast<uint8_t>(mixed.initialValues[0]), 7);
+
+    auto& halfs = std::get<Model::BufferDesc>(model.GetResource("halfs").value);
+    ASSERT_EQ(halfs.initialValues.size(), 2 * sizeof(half_float::half));
+    auto halfData = reinterpret_cast<const half_float::half*>(halfs.initialValues.data());
+    EXPECT_EQ(halfData[0], half_float::half(1.5f));
+    EXPECT_EQ(halfData[1], std::numeric_limits<half_float::half>::infinity());
+}
+
+TEST(ParseModelInsituTest, IdenticalInitialValuesAreShared) 
+{
+    auto model = ParseModelText(R"({
+        "resources": 
+        {
+            "zeros0": { "initialValuesDataType": "FLOAT32", "initialValues": { "value": 0, "valueCount": 16 } },
+            "zeros1": { "initialValuesDataType": "FLOAT32", "initialValues": { "value": 0, "valueCount": 16 } },
+            "zerosInt": { "initialValuesDataType": "INT32", "initialValues": { "value": 0, "valueCount": 16 } },
+            "ones": { "initialValuesDataType": "FLOAT32", "initialValues": { "value": 1, "valueCount": 16 } }
+        },
+        "dispatchables": {},
+        "commands": []
+    })");
+
+    auto& zeros0 = std::get<Model::BufferDesc>(model.GetResource("zeros0").value);
+    auto& zeros1 = std::get<Model::BufferDesc>(model.GetResource("zeros1").value);
+    auto& zerosInt = std::get<Model::BufferDesc>(model.GetResource("zerosInt").value);
+    auto& ones = std::get<Model::BufferDesc>(model.GetResource("ones").value);
+    EXPECT_TRUE(zeros0.initialValues.SharesBytesWith(zeros1.initialValues));
+    EXPECT_TRUE(zeros0.initialValues.SharesBytesWith(zerosInt.initialValues)); // Same bytes, different type.
+    EXPECT_FALSE(zeros0.initialValues.SharesBytesWith(ones.initialValues));
+
+    // Writing to a shared copy detaches it.
+    ByteBuffer copy = zeros0.initialValues;
+    copy[0] = std::byte(1);
+    EXPECT_FALSE(copy.SharesBytesWith(zeros0.initialValues));
+    EXPECT_EQ(zeros0.initialValues[0], std::byte(0));
+}
+
+TEST(ParseModelInsituTest, InvalidStreamedInitialValues) 
+{
+    EXPECT_THROW(ParseModelText(R"({
+        "resources": { "A": { "initialValuesDataType": "UINT8", "initialValues": [1, 256] } },
+        "dispatchables": {},
+        "commands": []
+    })"), std::invalid_argument);
+
+    EXPECT_THROW(ParseModelText(R"({
+        "resources": { "A": { "initialValuesDataType": "UINT8", "initialValues": [] } },
+        "dispatchables": {},
+        "commands": []
+    })"), std::invalid_argument);
+
+    EXPECT_THROW(ParseModelText(R"({ "resources": { "A": { )"), std::invalid_argument);
+}
+
+TEST(ParseModelInsituTest, StreamedInitialValuesFollowResourceKind)
+{
+    // Textures keep their raw byte arrays, whether the kind is explicit or inferred from width/height.
+    auto model = ParseModelText(R"({
+        "resources":
+        {
+            "explicit": { "kind": "texture", "width": 1, "height": 1, "initialValuesDataType": "FLOAT32", "initialValues": [1, 2, 3, 4] },
+            "inferred": { "width": 1, "height": 1, "initialValuesDataType": "FLOAT32", "initialValues": [5, 6, 7, 8] },
+            "buffer": { "kind": "BUFFER", "initialValuesDataType": "UINT16", "initialValues": [9] }
+        },
+        "dispatchables": {},
+        "commands": []
+    })");
+
+    for (auto [name, firstValue] : { std::pair{"explicit", 1}, std::pair{"inferred", 5} })
+    {
+        auto& texture = std::get<Model::TextureDesc>(model.GetResource(name).value);
+        ASSERT_EQ(texture.initialData.size(), 4);
+        EXPECT_EQ(static_cast<uint8_t>(texture.initialData[0]), firstValue);
+    }
+
+    auto& buffer = std::get<Model::BufferDesc>(model.GetResource("buffer").value);
+    ASSERT_EQ(buffer.initialValues.size(), sizeof(uint16_t));
+    EXPECT_EQ(*reinterpret_cast<const uint16_t*>(buffer.initialValues.data()), 9);
+
+    // Unknown kinds are rejected, and so are texture fields that appear after an array was streamed as a buffer.
+    EXPECT_THROW(ParseModelText(R"({
+        "resources": { "A": { "kind": "bufer", "initialValuesDataType": "UINT8", "initialValues": [1] } },
+        "dispatchables": {},
+        "commands": []
+    })"), std::invalid_argument);
+
+    EXPECT_THROW(ParseModelText(R"({
+        "resources": { "A": { "initialValuesDataType": "UINT8", "initialValues": [1, 2, 3, 4], "width": 1, "height": 1 } },
+        "dispatchables": {},
+        "commands": []
+    })"), std::invalid_argument);
+}
+
+TEST(ParseModelInsituTest, ParallelParseIsDeterministic) 
+{
+    std::string resources;
+    std::string dispatchables;
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        resources += fmt::format(R"("r{}": {{ "initialValuesDataType": "UINT32", "initialValues": [{}] }},)", i, i);
+        dispatchables += fmt::format(R"("d{}": {{ "type": "hlsl", "sourcePath": "shader{}.hlsl", "compiler": "dxc", "compilerArgs": [] }},)", i, i);
+    }
+    resources.pop_back();
+    dispatchables.pop_back();
+
+    auto modelText = fmt::format(R"({{ "resources": {{ {} }}, "dispatchables": {{ {} }}, "commands": [] }})", resources, dispatchables);
+    std::vector<char> buffer(modelText.begin(), modelText.end());
+    buffer.push_back('\0');
+    auto model = ParseModelInsitu(buffer, std::filesystem::current_path(), std::filesystem::current_path(), /*parseThreadCount*/ 4);
+
+    ASSERT_EQ(model.GetResourceDescs().size(), 64);
+    ASSERT_EQ(model.GetDispatchableDescs().size(), 64);
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        auto& resource = model.GetResourceDescs()[i];
+        EXPECT_EQ(resource.name, fmt::format("r{}", i));
+        auto& bufferDesc = std::get<Model::BufferDesc>(resource.value);
+        EXPECT_EQ(*reinterpret_cast<const uint32_t*>(bufferDesc.initialValues.data()), i);
+        EXPECT_EQ(model.GetDispatchableDescs()[i].name, fmt::format("d{}", i));
+    }
+
+    std::vector<char> invalidModel{'{', '"', 'r', 'e', 's', 'o', 'u', 'r', 'c', 'e', 's', '"', ':', '{', '}', '}', '\0'};
+    EXPECT_THROW(ParseModelInsitu(invalidModel, std::filesystem::current_path(), std::filesystem::current_path(), 4), std::invalid_argument);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "LatencyHistogram.h"
+#include <random>
+
+TEST(LatencyHistogramTest, PercentilesAreWithinPrecision) 
+{
+    // 1,000,000 samples from 0.001 ms to 1000 ms, in a shuffled order.
+    LatencyHistogram histogram;
+    std::vector<double> samples(1000000);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = 0.001 * (i + 1);
+    }
+    std::vector<double> shuffled = samples;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+    for (double sample : shuffled)
+    {
+        histogram.Record(sample);
+    }
+
+    EXPECT_EQ(histogram.Count(), samples.size());
+    EXPECT_DOUBLE_EQ(histogram.Min(), 0.001);
+    EXPECT_DOUBLE_EQ(histogram.Max(), 1000.0);
+    EXPECT_NEAR(histogram.Average(), 500.0005, 1e-6);
+    EXPECT_NEAR(histogram.StandardDeviation(), 1000 / std::sqrt(12.0), 1e-3);
+    for (double fraction : {0.0, 0.5, 0.9, 0.99, 0.999, 1.0})
+    {
+        double expected = samples[std::max<size_t>(1, static_cast<size_t>(std::ceil(fraction * samples.size()))) - 1];
+        EXPECT_NEAR(histogram.Percentile(fraction), expected, expected / 256) << fraction;
+    }
+}
+
+TEST(LatencyHistogramTest, MergeMatchesSingleHistogram) 
+{
+    LatencyHistogram all(10), even(10), odd(10);
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        double sample = 0.5 + (i * 7919 % 1000) * 0.01;
+        all.Record(sample);
+        (i % 2 ? odd : even).Record(sample);
+    }
+    even.Merge(odd);
+
+    EXPECT_EQ(even.Count(), all.Count());
+    EXPECT_DOUBLE_EQ(even.Min(), all.Min());
+    EXPECT_DOUBLE_EQ(even.Max(), all.Max());
+    EXPECT_NEAR(even.Sum(), all.Sum(), 1e-9);
+    EXPECT_NEAR(even.StandardDeviation(), all.StandardDeviation(), 1e-9);
+    for (double fraction : {0.5, 0.9, 0.99, 0.999})
+    {
+        EXPECT_DOUBLE_EQ(even.Percentile(fraction), all.Percentile(fraction));
+    }
+
+    uint64_t bucketedCount = 0;
+    for (auto& bucket : all.GetBuckets())
+    {
+        EXPECT_GT(bucket.count, 0);
+        bucketedCount += bucket.count;
+    }
+    EXPECT_EQ(bucketedCount, all.Count());
+
+    EXPECT_THROW(all.Merge(LatencyHistogram(7)), std::invalid_argument);
+    EXPECT_THROW(LatencyHistogram(0), std::invalid_argument);
+    EXPECT_EQ(LatencyHistogram().Percentile(0.5), 0.0);
+}
+
+TEST(LatencyHistogramTest, SlowdownTest) 
+{
+    // Two runs with the same distribution of timings, and one that's 5% slower.
+    std::mt19937 random(7);
+    std::normal_distribution<double> jitter(0.0, 0.02);
+    LatencyHistogram baseline, same, slower;
+    for (uint32_t i = 0; i < 500; i++)
+    {
+        baseline.Record(1.0 + jitter(random));
+        same.Record(1.0 + jitter(random));
+        slower.Record(1.05 + jitter(random));
+    }
+
+    auto sameTest = LatencyHistogram::TestForSlowdown(baseline, same);
+    EXPECT_GT(sameTest.pValue, 0.01);
+    EXPECT_NEAR(sameTest.probabilityOfSlower, 0.5, 0.05);
+
+    auto slowerTest = LatencyHistogram::TestForSlowdown(baseline, slower);
+    EXPECT_LT(slowerTest.pValue, 1e-6);
+    EXPECT_GT(slowerTest.probabilityOfSlower, 0.9);
+
+    // Faster isn't slower, and identical values give no evidence either way.
+    EXPECT_GT(LatencyHistogram::TestForSlowdown(slower, baseline).pValue, 0.99);
+    LatencyHistogram constant;
+    constant.Record(1.0, 100);
+    EXPECT_EQ(LatencyHistogram::TestForSlowdown(constant, constant).pValue, 1.0);
+}
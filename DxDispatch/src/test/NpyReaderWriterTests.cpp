@@ -0,0 +1,179 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <DirectML.h>
+#include "StdSupport.h"
+#include "TestHelpers.h"
+#include "NpyReaderWriter.h"
+
+TEST(NpyReaderWriterTest, SixtyFourBitShapes) 
+{
+    // Only the header is read, so the array data doesn't need to exist.
+    std::vector<uint64_t> dimensions = {5000000000ull, 3};
+    std::vector<std::byte> npyFileData;
+    WriteNpy({}, DML_TENSOR_DATA_TYPE_UINT8, dimensions, npyFileData);
+
+    NpyHeader header = ReadNpyHeader(npyFileData);
+    EXPECT_EQ(header.dataType, DML_TENSOR_DATA_TYPE_UINT8);
+    EXPECT_EQ(header.dimensions, dimensions);
+    EXPECT_EQ(header.dataSizeInBytes, 15000000000ull);
+
+    // The size of this shape overflows 64 bits.
+    npyFileData.clear();
+    WriteNpy({}, DML_TENSOR_DATA_TYPE_FLOAT64, std::vector<uint64_t>{1ull << 40, 1ull << 40}, npyFileData);
+    DML_TENSOR_DATA_TYPE dataType;
+    std::vector<uint64_t> readDimensions;
+    std::vector<std::byte> arrayByteData;
+    EXPECT_THROW(ReadNpy(npyFileData, dataType, readDimensions, arrayByteData), std::overflow_error);
+}
+
+TEST(NpyReaderWriterTest, ArrayDataIsReadInPlace) 
+{
+    constexpr int16_t values[] = {1, -2, 3};
+    std::vector<std::byte> npyFileData;
+    WriteNpy(AsBytes(values), DML_TENSOR_DATA_TYPE_INT16, std::vector<uint64_t>{3}, npyFileData);
+
+    NpyHeader header = ReadNpyHeader(npyFileData);
+    std::vector<std::byte> convertedData;
+    auto arrayData = ReadNpyArrayData(npyFileData, header, convertedData);
+    EXPECT_TRUE(convertedData.empty());
+    EXPECT_EQ(arrayData.data(), npyFileData.data() + header.dataByteOffset);
+    ASSERT_EQ(arrayData.size(), sizeof(values));
+    EXPECT_EQ(reinterpret_cast<const int16_t*>(arrayData.data())[1], -2);
+
+    // A truncated array can't be used in place; it's copied and padded with zeros.
+    npyFileData.pop_back();
+    arrayData = ReadNpyArrayData(npyFileData, header, convertedData);
+    EXPECT_EQ(arrayData.data(), convertedData.data());
+    ASSERT_EQ(arrayData.size(), sizeof(values));
+    EXPECT_EQ(reinterpret_cast<const int16_t*>(arrayData.data())[2], 3);
+}
+
+TEST(NpyReaderWriterTest, BigEndian)
+{
+    // Enough elements to cover both the vectorized loop and the scalar remainder.
+    std::vector<double> values(37);
+    std::vector<std::byte> bigEndianBytes(values.size() * sizeof(double));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = i * -1.25;
+        auto valueBytes = reinterpret_cast<const std::byte*>(&values[i]);
+        std::reverse_copy(valueBytes, valueBytes + sizeof(double), bigEndianBytes.data() + i * sizeof(double));
+    }
+
+    std::vector<std::byte> npyFileData;
+    WriteNpy(bigEndianBytes, DML_TENSOR_DATA_TYPE_FLOAT64, std::vector<uint64_t>{values.size()}, npyFileData);
+    std::string_view descrText = "'<f8'";
+    auto descrPosition = std::search(npyFileData.begin(), npyFileData.end(), descrText.begin(), descrText.end(),
+        [](std::byte a, char b) { return a == std::byte(b); });
+    ASSERT_NE(descrPosition, npyFileData.end());
+    descrPosition[1] = std::byte('>');
+
+    DML_TENSOR_DATA_TYPE dataType;
+    std::vector<uint64_t> dimensions;
+    std::vector<std::byte> arrayByteData;
+    ReadNpy(npyFileData, dataType, dimensions, arrayByteData);
+    EXPECT_EQ(dataType, DML_TENSOR_DATA_TYPE_FLOAT64);
+    ASSERT_EQ(arrayByteData.size(), values.size() * sizeof(double));
+    EXPECT_EQ(std::memcmp(arrayByteData.data(), values.data(), arrayByteData.size()), 0);
+}
+
+// Writes array data that is already in Fortran order as an .npy file with 'fortran_order':True.
+static std::vector<std::byte> WriteFortranOrderNpy(
+    std::span<const std::byte> fortranValues, 
+    DML_TENSOR_DATA_TYPE dataType, 
+    const std::vector<uint64_t>& dimensions)
+{
+    std::vector<std::byte> npyFileData;
+    WriteNpy(fortranValues, dataType, dimensions, npyFileData);
+    std::string_view orderText = "'fortran_order':False";
+    auto orderPosition = std::search(npyFileData.begin(), npyFileData.end(), orderText.begin(), orderText.end(),
+        [](std::byte a, char b) { return a == std::byte(b); });
+    EXPECT_NE(orderPosition, npyFileData.end());
+    std::memcpy(&*orderPosition + orderText.size() - 5, "True ", 5);
+    return npyFileData;
+}
+
+TEST(NpyReaderWriterTest, FortranOrder)
+{
+    // A 2x3x2 array holding 0..11 in C order, stored in Fortran order (the first index varies fastest).
+    std::vector<float> fortranValues(12);
+    for (uint32_t i = 0; i < 2; i++)
+    for (uint32_t j = 0; j < 3; j++)
+    for (uint32_t k = 0; k < 2; k++)
+    {
+        fortranValues[i + 2 * (j + 3 * k)] = static_cast<float>((i * 3 + j) * 2 + k);
+    }
+
+    auto npyFileData = WriteFortranOrderNpy(AsBytes(fortranValues), DML_TENSOR_DATA_TYPE_FLOAT32, {2, 3, 2});
+
+    DML_TENSOR_DATA_TYPE dataType;
+    std::vector<uint64_t> dimensions;
+    std::vector<std::byte> arrayByteData;
+    ReadNpy(npyFileData, dataType, dimensions, arrayByteData);
+    EXPECT_EQ(dimensions, (std::vector<uint64_t>{2, 3, 2}));
+    ASSERT_EQ(arrayByteData.size(), 12 * sizeof(float));
+    auto values = reinterpret_cast<const float*>(arrayByteData.data());
+    for (uint32_t i = 0; i < 12; i++)
+    {
+        EXPECT_EQ(values[i], static_cast<float>(i));
+    }
+}
+
+TEST(NpyReaderWriterTest, FortranOrderMatchesScalarTranspose)
+{
+    // Odd sizes leave partial SIMD tiles and cache blocks, 300x300 is large enough that slabs are split between
+    // tasks, and the 4D shapes reorder the middle dimensions (with size-1 dimensions that are squeezed out).
+    const std::vector<std::vector<uint64_t>> shapes = {{37, 53}, {53, 37}, {300, 300}, {5, 7, 3, 11}, {1, 37, 1, 53, 2}};
+    const std::pair<DML_TENSOR_DATA_TYPE, size_t> dataTypes[] = {
+        {DML_TENSOR_DATA_TYPE_UINT8, 1},
+        {DML_TENSOR_DATA_TYPE_UINT16, 2},
+        {DML_TENSOR_DATA_TYPE_UINT32, 4},
+        {DML_TENSOR_DATA_TYPE_UINT64, 8},
+    };
+
+    for (auto& shape : shapes)
+    {
+        size_t elementCount = 1;
+        for (auto size : shape) { elementCount *= size; }
+
+        for (auto [dataType, elementSize] : dataTypes)
+        {
+            std::vector<std::byte> fortranBytes(elementCount * elementSize);
+            for (size_t i = 0; i < fortranBytes.size(); i++)
+            {
+                fortranBytes[i] = static_cast<std::byte>((i * 2654435761u) >> 13);
+            }
+
+            // Reference: for each element in C order, find the same indices in Fortran order.
+            std::vector<std::byte> expectedBytes(fortranBytes.size());
+            for (size_t cIndex = 0; cIndex < elementCount; cIndex++)
+            {
+                size_t remainder = cIndex;
+                size_t fortranIndex = 0;
+                size_t fortranStride = elementCount;
+                for (size_t axis = shape.size(); axis-- > 0;)
+                {
+                    fortranStride /= shape[axis];
+                    fortranIndex += (remainder % shape[axis]) * fortranStride;
+                    remainder /= shape[axis];
+                }
+                std::memcpy(&expectedBytes[cIndex * elementSize], &fortranBytes[fortranIndex * elementSize], elementSize);
+            }
+
+            auto npyFileData = WriteFortranOrderNpy(fortranBytes, dataType, shape);
+            DML_TENSOR_DATA_TYPE readDataType;
+            std::vector<uint64_t> dimensions;
+            std::vector<std::byte> arrayByteData;
+            ReadNpy(npyFileData, readDataType, dimensions, arrayByteData);
+            EXPECT_EQ(dimensions, shape);
+            EXPECT_EQ(arrayByteData, expectedBytes) << "Shape with " << shape.size() << " dimensions, " << elementSize << "-byte elements";
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include <DirectML.h>
+#include "StdSupport.h"
+#include "TestHelpers.h"
+#include "NpyReaderWriter.h"
+#include "NpzReaderWriter.h"
+
+TEST(NpzReaderWriterTest, SplitMemberPath)
+{
+    std::string_view archivePath, memberName;
+    ASSERT_TRUE(SplitNpzMemberPath("C:/models/Weights.NPZ:layer3.bias", archivePath, memberName));
+    EXPECT_EQ(archivePath, "C:/models/Weights.NPZ");
+    EXPECT_EQ(memberName, "layer3.bias");
+    EXPECT_FALSE(SplitNpzMemberPath("C:/models/weights.npy", archivePath, memberName));
+}
+
+TEST(NpzReaderWriterTest, AddAndReplaceMembers)
+{
+    constexpr int16_t values[] = {1, -2, 3};
+    std::vector<std::byte> archiveData;
+    AddNpzMember({}, "a", AsBytes(values), archiveData);
+    std::vector<std::byte> newArchiveData;
+    AddNpzMember(archiveData, "b.npy", AsBytes(values).first(sizeof(values[0])), newArchiveData);
+    AddNpzMember(newArchiveData, "a", AsBytes(values).first(2 * sizeof(values[0])), archiveData);
+
+    NpzArchive archive(archiveData);
+    ASSERT_EQ(archive.GetMembers().size(), 2u);
+    EXPECT_EQ(archive.GetMembers()[0].name, "b.npy");
+    EXPECT_EQ(archive.GetMembers()[1].name, "a.npy");
+    EXPECT_EQ(archive.FindMember("c"), nullptr);
+
+    // Members are stored, so they're read in place.
+    std::vector<std::byte> decompressedData;
+    auto memberData = archive.ReadMember(*archive.FindMember("a"), decompressedData);
+    EXPECT_TRUE(decompressedData.empty());
+    EXPECT_GE(memberData.data(), archiveData.data());
+    ASSERT_EQ(memberData.size(), 2 * sizeof(int16_t));
+    EXPECT_EQ(memcmp(memberData.data(), values, memberData.size()), 0);
+}
+
+TEST(NpzReaderWriterTest, AppendMembers)
+{
+    constexpr int32_t values[] = {10, 20, 30, 40, 50};
+    std::vector<std::byte> archiveData;
+    AddNpzMember({}, "a", AsBytes(values).first(sizeof(values[0])), archiveData);
+
+    // Each append keeps the existing bytes up to the central directory and replaces only what follows.
+    for (size_t count = 2; count <= 5; count++)
+    {
+        uint64_t appendOffset = 0;
+        std::vector<std::byte> appendedData;
+        std::string name(1, static_cast<char>('a' + count - 1));
+        ASSERT_TRUE(AppendNpzMember(archiveData, name, AsBytes(values).first(count * sizeof(values[0])), appendOffset, appendedData));
+        EXPECT_EQ(appendOffset, NpzArchive(archiveData).GetCentralDirectoryOffset());
+        archiveData.resize(static_cast<size_t>(appendOffset));
+        archiveData.insert(archiveData.end(), appendedData.begin(), appendedData.end());
+    }
+
+    NpzArchive archive(archiveData);
+    ASSERT_EQ(archive.GetMembers().size(), 5u);
+    for (size_t count = 1; count <= 5; count++)
+    {
+        auto member = archive.FindMember(std::string(1, static_cast<char>('a' + count - 1)));
+        ASSERT_NE(member, nullptr);
+        std::vector<std::byte> decompressedData;
+        auto memberData = archive.ReadMember(*member, decompressedData);
+        ASSERT_EQ(memberData.size(), count * sizeof(int32_t));
+        EXPECT_EQ(memcmp(memberData.data(), values, memberData.size()), 0);
+    }
+
+    // Replacing a member needs the whole archive to be rewritten.
+    uint64_t appendOffset = 0;
+    std::vector<std::byte> appendedData;
+    EXPECT_FALSE(AppendNpzMember(archiveData, "c.npy", AsBytes(values), appendOffset, appendedData));
+    EXPECT_TRUE(appendedData.empty());
+}
+
+TEST(NpzReaderWriterTest, DeflatedMember)
+{
+    // numpy.savez_compressed("squares.npz", squares=np.arange(16, dtype=np.int32) ** 2)
+    constexpr uint8_t archiveBytes[] = {
+        0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x00, 0x1C, 0xCB,
+        0x58, 0x67, 0x6E, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x73, 0x71,
+        0x75, 0x61, 0x72, 0x65, 0x73, 0x2E, 0x6E, 0x70, 0x79, 0x9B, 0xEC, 0x17, 0xEA, 0x1B, 0x10, 0xC9,
+        0xC8, 0x50, 0xC6, 0x50, 0xAD, 0x9E, 0x92, 0x5A, 0x9C, 0x5C, 0xA4, 0x6E, 0xA5, 0xA0, 0x6E, 0x93,
+        0x69, 0xA2, 0xAE, 0xA3, 0xA0, 0x9E, 0x96, 0x5F, 0x54, 0x52, 0x94, 0x98, 0x17, 0x9F, 0x5F, 0x94,
+        0x92, 0x0A, 0x12, 0x77, 0x4B, 0xCC, 0x29, 0x4E, 0x05, 0x8A, 0x17, 0x67, 0x24, 0x16, 0xA4, 0x02,
+        0xF9, 0x1A, 0x86, 0x66, 0x3A, 0x9A, 0x3A, 0x0A, 0xB5, 0x0A, 0xE4, 0x03, 0x2E, 0x06, 0x20, 0x60,
+        0x04, 0x62, 0x16, 0x20, 0xE6, 0x04, 0x62, 0x01, 0x20, 0x96, 0x04, 0x62, 0x15, 0x20, 0x36, 0x04,
+        0x62, 0x07, 0x20, 0x0E, 0x04, 0xE2, 0x14, 0x20, 0xAE, 0x04, 0xE2, 0x09, 0x40, 0xBC, 0x12, 0x88,
+        0x8F, 0x00, 0xF1, 0x43, 0x20, 0x06, 0x00, 0x50, 0x4B, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00,
+        0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x00, 0x1C, 0xCB, 0x58, 0x67, 0x6E, 0x00, 0x00, 0x00, 0xC0,
+        0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x73, 0x2E, 0x6E, 0x70, 0x79,
+        0x50, 0x4B, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x39, 0x00, 0x00, 0x00,
+        0x97, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    auto archiveData = AsBytes(archiveBytes);
+
+    NpzArchive archive(archiveData);
+    auto member = archive.FindMember("squares");
+    ASSERT_NE(member, nullptr);
+    EXPECT_EQ(member->compressionMethod, 8);
+
+    std::vector<std::byte> decompressedData;
+    auto memberData = archive.ReadMember(*member, decompressedData);
+    EXPECT_EQ(memberData.data(), decompressedData.data());
+
+    DML_TENSOR_DATA_TYPE dataType;
+    std::vector<uint64_t> dimensions;
+    std::vector<std::byte> arrayByteData;
+    ReadNpy(memberData, dataType, dimensions, arrayByteData);
+    EXPECT_EQ(dataType, DML_TENSOR_DATA_TYPE_INT32);
+    EXPECT_EQ(dimensions, std::vector<uint64_t>{16});
+    ASSERT_EQ(arrayByteData.size(), 16 * sizeof(int32_t));
+    auto squares = reinterpret_cast<const int32_t*>(arrayByteData.data());
+    for (int32_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(squares[i], i * i);
+    }
+
+    // A corrupt stream fails its CRC check rather than returning bad data.
+    std::vector<uint8_t> corruptArchiveBytes(std::begin(archiveBytes), std::end(archiveBytes));
+    corruptArchiveBytes[130] ^= 0x01;
+    NpzArchive corruptArchive(AsBytes(corruptArchiveBytes));
+    EXPECT_THROW(corruptArchive.ReadMember(*corruptArchive.FindMember("squares"), decompressedData), std::ios::failure);
+}
@@ -0,0 +1,12 @@
+#include <gtest/gtest.h>
+#include "Philox.h"
+
+TEST(Philox4x32Test, KnownAnswers) 
+{
+    // Known-answer tests from the Random123 library.
+    EXPECT_EQ(Philox4x32(0)(0, 0), (Philox4x32::Result{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 }));
+    EXPECT_EQ(Philox4x32(~0ull)(~0ull, ~0ull), (Philox4x32::Result{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd }));
+    EXPECT_EQ(
+        Philox4x32(0x299f31d0a4093822ull)(0x85a308d3243f6a88ull, 0x0370734413198a2eull), 
+        (Philox4x32::Result{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }));
+}
@@ -0,0 +1,179 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include "ResultsFile.h"
+
+static std::filesystem::path GetEmptyResultsPath(const char* fileName)
+{
+    auto directory = std::filesystem::temp_directory_path() / "dxdispatch_jsontests";
+    std::filesystem::create_directories(directory);
+    auto path = directory / fileName;
+    std::filesystem::remove(path);
+    return path;
+}
+
+static std::vector<std::string> ReadLines(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static ResultsFile::RunInfo GetRunInfo()
+{
+    return { "models/add.json", 0x0123456789abcdef, "Adapter", "1.2.3.4", 1, 5 };
+}
+
+TEST(ResultsFileTest, CsvEscapesFields)
+{
+    auto path = GetEmptyResultsPath("escape.csv");
+    ResultsFile::RunInfo runInfo = GetRunInfo();
+    runInfo.modelPath = "models/a,b.json";
+    runInfo.adapterDescription = "Adapter \"X\"";
+
+    LatencyHistogram cpuCold, cpuHot, gpuCold, gpuHot;
+    cpuHot.Record(1.0);
+    ResultsFile(path, runInfo).Append({ "plain", 1, cpuCold, cpuHot, gpuCold, gpuHot });
+
+    auto lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[1].rfind("\"models/a,b.json\",0123456789abcdef,\"Adapter \"\"X\"\"\",1.2.3.4,plain,1,1,5,1,1,", 0), 0);
+
+    // Without GPU timings, the GPU cells are empty but still present.
+    auto columns = [](const std::string& line) { return std::count(line.begin(), line.end(), ','); };
+    EXPECT_EQ(columns(lines[0]), 31);
+    EXPECT_EQ(columns(lines[1]), 31 + 1); // The escaped model path's comma doesn't separate columns.
+    EXPECT_EQ(lines[1].substr(lines[1].size() - 11), std::string(11, ','));
+}
+
+TEST(ResultsFileTest, CsvHeaderOnlyOnNewOrEmptyFile)
+{
+    LatencyHistogram cpuCold, cpuHot, gpuCold, gpuHot;
+    cpuHot.Record(1.0);
+
+    // A new file gets a header; appending to it doesn't repeat it.
+    auto path = GetEmptyResultsPath("header.csv");
+    ResultsFile(path, GetRunInfo()).Append({ "a", 1, cpuCold, cpuHot, gpuCold, gpuHot });
+    ResultsFile(path, GetRunInfo()).Append({ "b", 1, cpuCold, cpuHot, gpuCold, gpuHot });
+    auto lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines[0].rfind("model,modelHash,", 0), 0);
+    EXPECT_EQ(lines[1].rfind("models/add.json,", 0), 0);
+    EXPECT_EQ(lines[2].rfind("models/add.json,", 0), 0);
+
+    // An existing empty file gets a header too.
+    path = GetEmptyResultsPath("empty.csv");
+    std::ofstream(path).close();
+    ResultsFile(path, GetRunInfo()).Append({ "a", 1, cpuCold, cpuHot, gpuCold, gpuHot });
+    lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0].rfind("model,modelHash,", 0), 0);
+}
+
+TEST(ResultsFileTest, JsonRoundTrip)
+{
+    auto path = GetEmptyResultsPath("results.json");
+
+    LatencyHistogram cpuCold, cpuHot, gpuCold, gpuHot, emptyGpu;
+    cpuCold.Record(5.0);
+    gpuCold.Record(4.0);
+    for (int i = 1; i <= 1000; i++)
+    {
+        cpuHot.Record(0.05 + i * 0.0001);
+        gpuHot.Record(0.04 + (i % 17) * 0.001);
+    }
+
+    ResultsFile resultsFile(path, GetRunInfo());
+    resultsFile.Append({ "withGpu", 1000, cpuCold, cpuHot, gpuCold, gpuHot });
+    resultsFile.Append({ "withoutGpu", 1000, cpuCold, cpuHot, emptyGpu, emptyGpu });
+
+    // A later result for the same dispatch replaces the earlier one.
+    LatencyHistogram replacedHot;
+    replacedHot.Record(2.0, 3);
+    resultsFile.Append({ "replaced", 3, cpuCold, cpuHot, emptyGpu, emptyGpu });
+    resultsFile.Append({ "replaced", 3, cpuCold, replacedHot, emptyGpu, emptyGpu });
+    ASSERT_EQ(ReadLines(path).size(), 4);
+
+    auto results = ResultsFile::ReadJsonResults(path);
+    ASSERT_EQ(results.size(), 3);
+
+    auto expectSameBuckets = [](const LatencyHistogram& actual, const LatencyHistogram& expected)
+    {
+        EXPECT_EQ(actual.Count(), expected.Count());
+        auto actualBuckets = actual.GetBuckets();
+        auto expectedBuckets = expected.GetBuckets();
+        ASSERT_EQ(actualBuckets.size(), expectedBuckets.size());
+        for (size_t i = 0; i < actualBuckets.size(); i++)
+        {
+            EXPECT_EQ(actualBuckets[i].value, expectedBuckets[i].value);
+            EXPECT_EQ(actualBuckets[i].count, expectedBuckets[i].count);
+        }
+        EXPECT_EQ(actual.Percentile(0.5), expected.Percentile(0.5));
+        EXPECT_EQ(actual.Percentile(0.99), expected.Percentile(0.99));
+    };
+
+    expectSameBuckets(results.at("withGpu").cpuHot, cpuHot);
+    expectSameBuckets(results.at("withGpu").gpuHot, gpuHot);
+    expectSameBuckets(results.at("withoutGpu").cpuHot, cpuHot);
+    EXPECT_EQ(results.at("withoutGpu").gpuHot.Count(), 0);
+    expectSameBuckets(results.at("replaced").cpuHot, replacedHot);
+}
+
+TEST(ResultsFileTest, ReadJsonResultsRejectsCsv)
+{
+    auto path = GetEmptyResultsPath("results.csv");
+    LatencyHistogram cpuCold, cpuHot, gpuCold, gpuHot;
+    cpuHot.Record(1.0);
+    ResultsFile(path, GetRunInfo()).Append({ "a", 1, cpuCold, cpuHot, gpuCold, gpuHot });
+
+    EXPECT_THROW(ResultsFile::ReadJsonResults(path), std::invalid_argument);
+    EXPECT_THROW(ResultsFile::ReadJsonResults(GetEmptyResultsPath("missing.json")), std::ios::failure);
+}
+
+TEST(ResultsFileTest, JsonRecordsRunInfoAndHistogramPrecision)
+{
+    auto path = GetEmptyResultsPath("runinfo.json");
+
+    LatencyHistogram cold, empty, hot(4, 1e-3);
+    hot.Record(0.5, 10);
+    hot.Record(2.0, 5);
+    ResultsFile::RunInfo runInfo = GetRunInfo();
+    runInfo.dispatchBatchSize = 8;
+    runInfo.framesInFlight = 3;
+    ResultsFile(path, runInfo).Append({ "a", 15, cold, hot, empty, empty });
+
+    // A result written before the batch size and frames in flight were recorded was unbatched and not pipelined.
+    std::ofstream(path, std::ios::app) << R"({"model":"m","modelHash":"00","adapter":"a","driverVersion":"d","dispatch":"old","iterations":1,"repeat":1,"warmupSamples":1,"cpu":{"hot":{"histogram":[]}}})" << "\n";
+
+    auto results = ResultsFile::ReadJsonResults(path);
+    auto& result = results.at("a");
+    EXPECT_EQ(result.runInfo.modelPath, "models/add.json");
+    EXPECT_EQ(result.runInfo.modelHash, 0x0123456789abcdef);
+    EXPECT_EQ(result.runInfo.adapterDescription, "Adapter");
+    EXPECT_EQ(result.runInfo.adapterDriverVersion, "1.2.3.4");
+    EXPECT_EQ(result.runInfo.dispatchRepeat, 1);
+    EXPECT_EQ(result.runInfo.maxWarmupSamples, 5);
+    EXPECT_EQ(result.runInfo.dispatchBatchSize, 8);
+    EXPECT_EQ(result.runInfo.framesInFlight, 3);
+    EXPECT_EQ(results.at("old").runInfo.dispatchBatchSize, 1);
+    EXPECT_EQ(results.at("old").runInfo.framesInFlight, 1);
+
+    // The histogram is rebuilt with its own precision and resolution, so it can be compared with the original.
+    EXPECT_EQ(result.cpuHot.PrecisionBits(), 4);
+    EXPECT_EQ(result.cpuHot.Resolution(), 1e-3);
+    EXPECT_EQ(LatencyHistogram::TestForSlowdown(hot, result.cpuHot).probabilityOfSlower, 0.5);
+}
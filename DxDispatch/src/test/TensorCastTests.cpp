@@ -0,0 +1,98 @@
+#define NOMINMAX
+#define _SILENCE_ALL_CXX17_DEPRECATION_WARNINGS
+#ifndef WIN32
+#include <wsl/winadapter.h>
+#include "directml_guids.h"
+#endif
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <DirectML.h>
+#include <half.hpp>
+#include "StdSupport.h"
+#include "TestHelpers.h"
+#include "TensorCast.h"
+
+TEST(TensorCastTest, RoundsAndSaturates)
+{
+    // Enough elements for the vector kernels, plus a remainder for the scalar loop.
+    constexpr float values[] = {
+        0.5f, 1.5f, 2.5f, -1.5f, 127.6f, 300, -300, NAN,
+        INFINITY, -INFINITY, 65534.5f, 70000, 3, -7.7f, 1e10f, 1027.5f, 1028.5f,
+    };
+    auto valueBytes = AsBytes(values);
+
+    auto castTo = [&](DML_TENSOR_DATA_TYPE dataType, auto elementType)
+    {
+        std::vector<std::byte> castBytes = CastTensorData(valueBytes, DML_TENSOR_DATA_TYPE_FLOAT32, dataType);
+        std::vector<decltype(elementType)> result(castBytes.size() / sizeof(elementType));
+        memcpy(result.data(), castBytes.data(), castBytes.size());
+        return result;
+    };
+
+    // Ties round to even, out-of-range values saturate, and NaN becomes 0.
+    EXPECT_EQ(castTo(DML_TENSOR_DATA_TYPE_INT8, int8_t()), (std::vector<int8_t>{
+        0, 2, 2, -2, 127, 127, -128, 0, 127, -128, 127, 127, 3, -8, 127, 127, 127}));
+    EXPECT_EQ(castTo(DML_TENSOR_DATA_TYPE_UINT8, uint8_t()), (std::vector<uint8_t>{
+        0, 2, 2, 0, 128, 255, 0, 0, 255, 0, 255, 255, 3, 0, 255, 255, 255}));
+    EXPECT_EQ(castTo(DML_TENSOR_DATA_TYPE_UINT16, uint16_t()), (std::vector<uint16_t>{
+        0, 2, 2, 0, 128, 300, 0, 0, 65535, 0, 65534, 65535, 3, 0, 65535, 1028, 1028}));
+    EXPECT_EQ(castTo(DML_TENSOR_DATA_TYPE_INT64, int64_t())[14], 10000000000);
+
+    // Float16 also rounds ties to even (1027.5 and 1028.5 are halfway between float16 values), and overflows
+    // to infinity.
+    auto halfValues = castTo(DML_TENSOR_DATA_TYPE_FLOAT16, half_float::half());
+    EXPECT_EQ(float(halfValues[15]), 1028.0f);
+    EXPECT_EQ(float(halfValues[16]), 1028.0f);
+    EXPECT_EQ(float(halfValues[5]), 300.0f);
+    EXPECT_TRUE(std::isinf(float(halfValues[11])));
+    EXPECT_TRUE(std::isnan(float(halfValues[7])));
+
+    // Integers saturate to narrower and unsigned types.
+    constexpr int32_t integers[] = {-5, 7, 40000, -40000};
+    std::vector<std::byte> int16Bytes = CastTensorData(AsBytes(integers), DML_TENSOR_DATA_TYPE_INT32, DML_TENSOR_DATA_TYPE_UINT16);
+    std::vector<uint16_t> expectedInt16 = {0, 7, 40000, 0};
+    ASSERT_EQ(int16Bytes.size(), sizeof(uint16_t) * expectedInt16.size());
+    EXPECT_EQ(memcmp(int16Bytes.data(), expectedInt16.data(), int16Bytes.size()), 0);
+
+    std::vector<std::byte> tooSmall(3);
+    EXPECT_THROW(CastTensorData(valueBytes, DML_TENSOR_DATA_TYPE_FLOAT32, tooSmall, DML_TENSOR_DATA_TYPE_INT8), std::invalid_argument);
+}
+
+TEST(TensorCastTest, Float16RoundTripsEveryValue)
+{
+    // Every float16 bit pattern, plus a remainder for the scalar loop, so the vector kernels (where the processor
+    // has them) and the scalar conversions must agree.
+    std::vector<uint16_t> halfBits(65536 + 3);
+    for (size_t i = 0; i < halfBits.size(); i++)
+    {
+        halfBits[i] = static_cast<uint16_t>(i);
+    }
+
+    std::vector<std::byte> floatBytes = CastTensorData(AsBytes(halfBits), DML_TENSOR_DATA_TYPE_FLOAT16, DML_TENSOR_DATA_TYPE_FLOAT32);
+    ASSERT_EQ(floatBytes.size(), halfBits.size() * sizeof(float));
+    std::vector<float> floats(halfBits.size());
+    memcpy(floats.data(), floatBytes.data(), floatBytes.size());
+
+    std::vector<std::byte> roundTripBytes = CastTensorData(floatBytes, DML_TENSOR_DATA_TYPE_FLOAT32, DML_TENSOR_DATA_TYPE_FLOAT16);
+    ASSERT_EQ(roundTripBytes.size(), halfBits.size() * sizeof(uint16_t));
+    std::vector<uint16_t> roundTripBits(halfBits.size());
+    memcpy(roundTripBits.data(), roundTripBytes.data(), roundTripBytes.size());
+
+    auto halfValues = reinterpret_cast<const half_float::half*>(halfBits.data());
+    for (size_t i = 0; i < halfBits.size(); i++)
+    {
+        half_float::half value = halfValues[i];
+        if (std::isnan(float(value)))
+        {
+            EXPECT_TRUE(std::isnan(floats[i])) << i;
+            EXPECT_EQ(roundTripBits[i] & 0x7C00, 0x7C00) << i;
+            EXPECT_NE(roundTripBits[i] & 0x03FF, 0) << i;
+        }
+        else
+        {
+            EXPECT_EQ(floats[i], float(value)) << i;
+            EXPECT_EQ(roundTripBits[i], halfBits[i]) << i;
+        }
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+// Views the elements of a vector or array as bytes, like C++20's as_bytes (std::span may be minimal_span).
+template <typename ContainerType>
+std::span<const std::byte> AsBytes(const ContainerType& container)
+{
+    return std::span<const std::byte>(reinterpret_cast<const std::byte*>(std::data(container)), std::size(container) * sizeof(*std::data(container)));
+}
@@ -12,39 +12,165 @@ function ConvertSnakeToCamelCase($SnakeCaseName)
         {$args[0].Groups[1].Value.ToUpper() + $args[0].Groups[2].Value.ToUpper()})
 }
 
-function WriteEnumParser($Enum)
+# Returns (a * b) mod 2^32. PowerShell has no unchecked 32-bit arithmetic, so the product is split into 16-bit
+# halves that can't overflow a 64-bit integer. Constants above 2^31 are written in decimal, since PowerShell
+# parses hex literals such as 0xFFFFFFFF as negative 32-bit integers.
+function MultiplyUInt32([uint64]$A, [uint64]$B)
 {
-    $EnumNameCamelCase = ConvertSnakeToCamelCase($Enum.Name)
+    $Low = ($A -band 0xFFFF) * $B
+    $High = ((($A -shr 16) * $B) -band 0xFFFF) -shl 16
+    return [uint64](($Low + $High) -band 4294967295)
+}
+
+# Must match HashName in JsonParsers.cpp.
+function GetNameHash([string]$Name)
+{
+    [uint64]$Hash = 2166136261
+    foreach ($Byte in [System.Text.Encoding]::UTF8.GetBytes($Name))
+    {
+        $Hash = MultiplyUInt32 ($Hash -bxor $Byte) 16777619
+    }
+    return $Hash
+}
+
+# Must match MixHash in JsonParsers.cpp.
+function GetMixedHash([uint64]$Hash, [uint64]$Seed)
+{
+    $Hash = $Hash -bxor (MultiplyUInt32 $Seed 2654435769)
+    $Hash = $Hash -bxor ($Hash -shr 16)
+    $Hash = MultiplyUInt32 $Hash 2246822507
+    $Hash = $Hash -bxor ($Hash -shr 13)
+    $Hash = MultiplyUInt32 $Hash 3266489909
+    $Hash = $Hash -bxor ($Hash -shr 16)
+    return $Hash
+}
+
+function GetNameTableVariableName($TypeName)
+{
+    $CamelCase = ConvertSnakeToCamelCase $TypeName
+    return "c_$($CamelCase.Substring(0, 1).ToLower())$($CamelCase.Substring(1))Names"
+}
+
+# Writes a constexpr NameTable (see JsonParsers.cpp) that maps names to values with a perfect hash. $Entries is an
+# ordered list of @(Name, Value) pairs; if a name appears more than once, the first entry wins. The table is built
+# with hash-and-displace: names are grouped into buckets by hash, and the largest buckets are placed first by
+# searching for a displacement (seed) that maps all of the bucket's names to distinct free slots.
+function WriteNameTable($TypeName, $Entries)
+{
+    $Names = @()
+    $Values = @()
+    foreach ($Entry in $Entries)
+    {
+        if ($Names -cnotcontains $Entry[0])
+        {
+            $Names += $Entry[0]
+            $Values += $Entry[1]
+        }
+    }
+
+    $BucketCount = [int][Math]::Max(1, [Math]::Floor(($Names.Count + 1) / 2))
+    $SlotCount = 1
+    while ($SlotCount -lt $Names.Count) { $SlotCount *= 2 }
+
+    $Hashes = @($Names | ForEach-Object { GetNameHash $_ })
+    $Buckets = @(for ($i = 0; $i -lt $BucketCount; $i++) { ,@() })
+    for ($i = 0; $i -lt $Names.Count; $i++)
+    {
+        $Buckets[$Hashes[$i] % $BucketCount] += $i
+    }
+
+    $BucketOrder = 0..($BucketCount - 1) | Sort-Object @{Expression = { $Buckets[$_].Count }; Descending = $true}, @{Expression = { $_ }; Ascending = $true}
+    $Displacements = @(0) * $BucketCount
+    $Slots = @($null) * $SlotCount
+
+    foreach ($Bucket in $BucketOrder)
+    {
+        if ($Buckets[$Bucket].Count -eq 0) { continue }
+
+        for ($Displacement = 0; ; $Displacement++)
+        {
+            if ($Displacement -gt 1000000)
+            {
+                throw "Could not build a perfect hash table for '$TypeName'."
+            }
+
+            $Candidates = @($Buckets[$Bucket] | ForEach-Object { (GetMixedHash $Hashes[$_] $Displacement) -band ($SlotCount - 1) })
+            $Distinct = @($Candidates | Select-Object -Unique).Count -eq $Candidates.Count
+            $Occupied = @($Candidates | Where-Object { $null -ne $Slots[$_] }).Count -gt 0
+            if ($Distinct -and -not $Occupied)
+            {
+                break
+            }
+        }
+
+        $Displacements[$Bucket] = $Displacement
+        for ($i = 0; $i -lt $Candidates.Count; $i++)
+        {
+            $Slots[$Candidates[$i]] = $Buckets[$Bucket][$i]
+        }
+    }
 
     $Cpp = @()
-    $Cpp += "$($Enum.Name) Parse${EnumNameCamelCase}(const rapidjson::Value& value)"
+    $Cpp += "constexpr NameTable<$TypeName, $BucketCount, $SlotCount> $(GetNameTableVariableName $TypeName) ="
     $Cpp += "{"
-    $Cpp += "    if (value.GetType() != rapidjson::Type::kStringType)"
     $Cpp += "    {"
-    $Cpp += "        throw std::invalid_argument(`"$($Enum.Name) must be a string.`");"
-    $Cpp += "    }"
-    $Cpp += "    auto valueString = value.GetString();"
+    for ($i = 0; $i -lt $BucketCount; $i += 16)
+    {
+        $Cpp += "        $(($Displacements[$i..([Math]::Min($i + 15, $BucketCount - 1))]) -join ', '),"
+    }
+    $Cpp += "    },"
+    $Cpp += "    {{"
+    foreach ($Slot in $Slots)
+    {
+        if ($null -eq $Slot)
+        {
+            $Cpp += "        {},"
+        }
+        else
+        {
+            $Cpp += "        {`"$($Names[$Slot])`", $($Values[$Slot])},"
+        }
+    }
+    $Cpp += "    }}"
+    $Cpp += "};"
+    $Cpp += ""
+    return $Cpp
+}
+
+function WriteEnumParser($Enum)
+{
+    $EnumNameCamelCase = ConvertSnakeToCamelCase($Enum.Name)
+
+    $Entries = @()
     foreach ($Value in $Enum.Values)
     {
+        $Entries += ,@($Value, $Value)
         if ($Value.StartsWith("$($Enum.Name)_"))
         {
             # Most enum values follow a "DML_<ENUM_NAME>_<VALUE>" convention. E.g. DML_TENSOR_DATA_TYPE_FLOAT32 is a value in
             # the DML_TENSOR_DATA_TYPE enum. In these cases allow the JSON to only provide the ending (e.g. "FLOAT32").
             $ShortName = $Value -replace "$($Enum.Name)_"
-            $Cpp += "    if (!strcmp(valueString, `"$Value`") || !strcmp(valueString, `"$ShortName`")) { return $Value; }"
+            $Entries += ,@($ShortName, $Value)
         }
         elseif ($Enum.Name -eq "DML_OPERATOR_TYPE")
         {
             # DML_OPERATOR_TYPE is unique (at the moment) in that its values don't follow the above convention and omit
             # the '_TYPE' portion of the enum name. E.g. DML_OPERATOR_ELEMENT_WISE_ABS instead of DML_OPERATOR_TYPE_ELEMENT_WISE_ABS.
             $ShortName = $Value -replace "DML_OPERATOR_"
-            $Cpp += "    if (!strcmp(valueString, `"$Value`") || !strcmp(valueString, `"$ShortName`")) { return $Value; }"
-        }
-        else
-        {
-            $Cpp += "    if (!strcmp(valueString, `"$Value`")) { return $Value; }"
+            $Entries += ,@($ShortName, $Value)
         }
     }
+
+    $Cpp = @()
+    $Cpp += WriteNameTable $Enum.Name $Entries
+    $Cpp += "$($Enum.Name) Parse${EnumNameCamelCase}(const rapidjson::Value& value)"
+    $Cpp += "{"
+    $Cpp += "    if (value.GetType() != rapidjson::Type::kStringType)"
+    $Cpp += "    {"
+    $Cpp += "        throw std::invalid_argument(`"$($Enum.Name) must be a string.`");"
+    $Cpp += "    }"
+    $Cpp += "    auto valueString = value.GetString();"
+    $Cpp += "    if (auto result = $(GetNameTableVariableName $Enum.Name).Find({valueString, value.GetStringLength()})) { return *result; }"
     $Cpp += "    throw std::invalid_argument(fmt::format(`"'{}' is not a recognized value for $($Enum.Name).`", valueString));"
     $Cpp += "}"
     $Cpp += ""
@@ -63,7 +189,18 @@ function WriteFlagsParser($Flags)
     $FlagsNameCamelCase = ConvertSnakeToCamelCase($Flags.Name)
     $FlagsNameSingular = $Flags.Name -replace "FLAGS", "FLAG"
 
+    $Entries = @()
+    $Entries += ,@("${FlagsNameSingular}_NONE", "${FlagsNameSingular}_NONE")
+    $Entries += ,@("NONE", "${FlagsNameSingular}_NONE")
+    foreach ($Value in $Flags.Values)
+    {
+        $ShortName = $Value -replace "${FlagsNameSingular}_"
+        $Entries += ,@($Value, $Value)
+        $Entries += ,@($ShortName, $Value)
+    }
+
     $Cpp = @()
+    $Cpp += WriteNameTable $Flags.Name $Entries
     $Cpp += "$($Flags.Name) ParseSingleFlagFrom${FlagsNameCamelCase}(const rapidjson::Value& value)"
     $Cpp += "{"
     $Cpp += "    if (value.GetType() != rapidjson::Type::kStringType)"
@@ -71,12 +208,7 @@ function WriteFlagsParser($Flags)
     $Cpp += "        throw std::invalid_argument(`"Expected a string.`");"
     $Cpp += "    }"
     $Cpp += "    auto valueString = value.GetString();"
-    $Cpp += "    if (!strcmp(valueString, `"${FlagsNameSingular}_NONE`") || !strcmp(valueString, `"NONE`")) { return ${FlagsNameSingular}_NONE; }"
-    foreach ($Value in $Flags.Values)
-    {
-        $ShortName = $Value -replace "${FlagsNameSingular}_"
-        $Cpp += "    if (!strcmp(valueString, `"$Value`") || !strcmp(valueString, `"$ShortName`")) { return $Value; }"
-    }
+    $Cpp += "    if (auto result = $(GetNameTableVariableName $Flags.Name).Find({valueString, value.GetStringLength()})) { return *result; }"
     $Cpp += "    throw std::invalid_argument(fmt::format(`"'{}' is not a recognized value for $($Flags.Name).`", valueString));"    
     $Cpp += "}"
     $Cpp += ""
@@ -95,104 +227,55 @@ function WriteFlagsParser($Flags)
     return $Cpp
 }
 
-function WriteOperatorFunction($Operator)
+function GetFieldParsersVariableName($OperatorName)
 {
-    $OpFunctionName = "ParseDml$(ConvertSnakeToCamelCase $Operator.Name)OperatorDesc"
-
-    $Cpp = @()
-    $Cpp += "DML_OPERATOR_DESC* $OpFunctionName(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)"
-    $Cpp += "{"
-    $Cpp += "    if (!value.IsObject()) { throw std::invalid_argument(`"Expected a valid JSON object.`"); }"
-    $Cpp += "    auto desc = allocator.Allocate<DML_$($Operator.Name)_OPERATOR_DESC>();"
+    return "c_dml$(ConvertSnakeToCamelCase $OperatorName)FieldParsers"
+}
 
-    # Scalar unions are associated with a data type specified in a previously listed DML_TENSOR_DATA_TYPE field.
-    $LastDataTypeFieldName = ""
+# Operator descs are parsed from the DML_OPERATOR_SCHEMA tables in DirectMLSchema.h, which only know that enum and
+# BOOL fields are UINTs. This writes a parser for each of those fields (and null for the rest), if there are any.
+function WriteOperatorFunction($Operator)
+{
+    $SupportedFieldTypes = @(
+        "tensorDesc", "tensorDescArray", "bool", "bool_uint32", "float32", "float32Array", "int32", "int32Array", 
+        "uint32", "uint32Array", "fusedActivationOperatorDesc", "fusedActivationOperatorDescArray", "scalarUnion", 
+        "scaleBias", "size2D")
 
+    $FieldParsers = @()
     foreach ($Field in $Operator.Fields)
     {
-        $Required = if ($Field.Optional) { 'false' } else { 'true' }
-        $Deref = if ($Field.Optional) { '' } else { '*' }
-
-        if ($Field.Type -eq "tensorDesc")
-        {
-            $Cpp += "    desc->$($Field.Name) = fused ? nullptr : ParseDmlTensorDescField(value, `"$($Field.Name)`", allocator, $Required);"
-        }
-        elseif ($Field.Type -eq "tensorDescArray")
-        {
-            $Cpp += "    desc->$($Field.Name) = fused ? nullptr : AsPointer(ParseDmlTensorDescArrayField(value, `"$($Field.Name)`", allocator, $Required));"
-        }
-        elseif ($Field.Type -eq "bool" -or $Field.Type -eq "bool_uint32")
-        {
-            $Cpp += "    desc->$($Field.Name) = ParseBoolField(value, `"$($Field.Name)`", $Required) ? 1 : 0;"
-        }
-        elseif ($Field.Type -eq "float32")
-        {
-            $Cpp += "    desc->$($Field.Name) = ParseFloat32Field(value, `"$($Field.Name)`", $Required);"
-        }
-        elseif ($Field.Type -eq "float32Array")
-        {
-            $Cpp += "    desc->$($Field.Name) = AsPointer(ParseFloat32ArrayField(value, `"$($Field.Name)`", allocator, $Required));"
-        }
-        elseif ($Field.Type -eq "int32")
-        {
-            $Cpp += "    desc->$($Field.Name) = ParseInt32Field(value, `"$($Field.Name)`", $Required);"
-        }
-        elseif ($Field.Type -eq "int32Array")
+        if ($SupportedFieldTypes -cnotcontains $Field.Type)
         {
-            $Cpp += "    desc->$($Field.Name) = AsPointer(ParseInt32ArrayField(value, `"$($Field.Name)`", allocator, $Required));"
-        }
-        elseif ($Field.Type -eq "uint32")
-        {
-            if ($Field.Enum)
-            {
-                $EnumNameCamelCase = ConvertSnakeToCamelCase $Field.Enum
-                $Cpp += "    desc->$($Field.Name) = Parse${EnumNameCamelCase}Field(value, `"$($Field.Name)`", $Required, {});"
-                if ($Field.Enum -eq "DML_TENSOR_DATA_TYPE")
-                {
-                    $LastDataTypeFieldName = $Field.Name
-                }
-            }
-            else
-            {
-                $Cpp += "    desc->$($Field.Name) = ParseUInt32Field(value, `"$($Field.Name)`", $Required);"
-            }
-        }
-        elseif ($Field.Type -eq "uint32Array")
-        {
-            $Cpp += "    desc->$($Field.Name) = AsPointer(ParseUInt32ArrayField(value, `"$($Field.Name)`", allocator, $Required));"
-        }
-        elseif ($Field.Type -eq "fusedActivationOperatorDesc")
-        {
-            $Cpp += "    desc->$($Field.Name) = ParseDmlOperatorDescField(value, `"$($Field.Name)`", true, allocator, $Required);"
-        }
-        elseif ($Field.Type -eq "fusedActivationOperatorDescArray")
-        {
-            $Cpp += "    desc->$($Field.Name) = AsPointer(ParseDmlOperatorDescArrayField(value, `"$($Field.Name)`", true, allocator, $Required));"
-        }
-        elseif ($Field.Type -eq "scalarUnion")
-        {
-            $Cpp += "    desc->$($Field.Name) = ${Deref}ParseDmlScalarUnionField(value, `"$($Field.Name)`", `"$LastDataTypeFieldName`", allocator, $Required);"
+            throw "Serializing fields of type '$($Field.Type)' is not implemented!"
         }
-        elseif ($Field.Type -eq "scaleBias")
+
+        if ($Field.Type -eq "bool" -or $Field.Type -eq "bool_uint32")
         {
-            $Cpp += "    desc->$($Field.Name) = ParseDmlScaleBiasField(value, `"$($Field.Name)`", allocator, $Required);"
+            $FieldParsers += "    ParseAsUInt32<bool, ParseBool>, // $($Field.Name)"
         }
-        elseif ($Field.Type -eq "size2D")
+        elseif ($Field.Type -eq "uint32" -and $Field.Enum)
         {
-            $Cpp += "    desc->$($Field.Name) = ${Deref}ParseDmlSize2dField(value, `"$($Field.Name)`", allocator, $Required);"
+            $EnumNameCamelCase = ConvertSnakeToCamelCase $Field.Enum
+            $FieldParsers += "    ParseAsUInt32<$($Field.Enum), Parse${EnumNameCamelCase}>, // $($Field.Name)"
         }
         else
         {
-            throw "Serializing fields of type '$($Field.Type)' is not implemented!"
+            $FieldParsers += "    nullptr, // $($Field.Name)"
         }
     }
 
-    $Cpp += "    auto opDesc = allocator.Allocate<DML_OPERATOR_DESC>();"
-    $Cpp += "    opDesc->Type = DML_OPERATOR_$($Operator.Name);"
-    $Cpp += "    opDesc->Desc = desc;"
-    $Cpp += "    return opDesc;"
-    $Cpp += "}"
-    $Cpp += " "
+    $Cpp = @()
+    if (($FieldParsers | Where-Object { -not $_.StartsWith("    nullptr") }).Count -gt 0)
+    {
+        $VariableName = GetFieldParsersVariableName $Operator.Name
+        $Cpp += "constexpr DmlUInt32FieldParser ${VariableName}[] ="
+        $Cpp += "{"
+        $Cpp += $FieldParsers
+        $Cpp += "};"
+        $Cpp += "static_assert(std::size(${VariableName}) == DML_$($Operator.Name)_OPERATOR_SCHEMA.FieldCount);"
+        $Cpp += " "
+        $script:OpsWithFieldParsers += $Operator.Name
+    }
 
     $Cpp += "Model::DmlDispatchableDesc::BindPoints GetBindPoints(const DML_$($Operator.Name)_OPERATOR_DESC& desc)"
     $Cpp += "{"
@@ -234,6 +317,7 @@ function WriteOperatorFunction($Operator)
 $Schema = (Get-Content $SchemaFilePath) | ConvertFrom-Json
 
 $SuccessfulOps = @()
+$OpsWithFieldParsers = @()
 
 $Cpp = @("// This file is generated by GenerateHelpers.ps1. Do not edit manually or your changes will be lost!")
 $Cpp += ""
@@ -283,40 +367,19 @@ foreach ($Operator in $AllOperators)
 }
 
 # --------------------------
-# ParseDmlOperatorDesc
+# GetDmlOperatorSchemaInfo
 # --------------------------
-$Cpp += "DML_OPERATOR_DESC* ParseDmlOperatorDesc(const rapidjson::Value& value, bool fused, BucketAllocator& allocator)"
+$Cpp += "static DmlOperatorSchemaInfo GetDmlOperatorSchemaInfo(DML_OPERATOR_TYPE type)"
 $Cpp += "{"
-$Cpp += "    if (!value.IsObject())"
-$Cpp += "    {"
-$Cpp += "        throw std::invalid_argument(`"Expected a non-null JSON object.`");"
-$Cpp += "    }"
-$Cpp += "    auto typeMember = value.FindMember(`"Type`");"
-$Cpp += "    if (typeMember == value.MemberEnd())"
-$Cpp += "    {"
-$Cpp += "        typeMember = value.FindMember(`"type`");"
-$Cpp += "    }"
-$Cpp += "    if (typeMember == value.MemberEnd())"
+$Cpp += "    switch (type)"
 $Cpp += "    {"
-$Cpp += "        throw std::invalid_argument(`"Expected a member 'Type' with the operator type.`");"
-$Cpp += "    }"
-$Cpp += "    if (typeMember->value.GetType() != rapidjson::Type::kStringType)"
-$Cpp += "    {"
-$Cpp += "        throw std::invalid_argument(`"The member 'Type' must be a string.`");"
-$Cpp += "    }"
-$Cpp += "    auto type = typeMember->value.GetString();"
-$Cpp += "    auto descMember = value.FindMember(`"Desc`");"
-$Cpp += "    if (descMember == value.MemberEnd())"
-$Cpp += "    {"
-$Cpp += "        descMember = value.FindMember(`"desc`");"
-$Cpp += "    }"
-$Cpp += "    const rapidjson::Value& descValue = descMember != value.MemberEnd() ? descMember->value : value;"
 foreach ($OperatorName in $SuccessfulOps)
 {
-    $OpFunctionName = "ParseDml$(ConvertSnakeToCamelCase $OperatorName)OperatorDesc"
-    $Cpp += "    if (!strcmp(type, `"DML_OPERATOR_$OperatorName`") || !strcmp(type, `"$OperatorName`")) return $OpFunctionName(descValue, fused, allocator);"
+    $FieldParsers = if ($OpsWithFieldParsers -ccontains $OperatorName) { GetFieldParsersVariableName $OperatorName } else { "nullptr" }
+    $Cpp += "    case DML_OPERATOR_${OperatorName}: return { &DML_${OperatorName}_OPERATOR_SCHEMA, $FieldParsers };"
 }
-$Cpp += "    throw std::invalid_argument(`"Unknown operator type.`");"
+$Cpp += "    default: throw std::invalid_argument(`"Unknown operator type.`");"
+$Cpp += "    }"
 $Cpp += "}"
 $Cpp += ""
 